@@ -1,1117 +0,0 @@
-/* 
-**  Font data for Microsoft Sans Serif 8pt
-*/
-
-#include "alphabet.h"
-/* Character bitmaps for Microsoft Sans Serif 8pt */
-/* Character bitmaps for Microsoft Sans Serif 8pt */
-const uint8_t alphabet_Bitmap[] = 
-{
-/* @0 ' ' (2 pixels wide) */
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-
-	/* @14 '0' (5 pixels wide) */
-	0x00, //      
-	0x70, //  ### 
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @28 '1' (3 pixels wide) */
-	0x00, //    
-	0x40, //  # 
-	0xC0, // ## 
-	0x40, //  # 
-	0x40, //  # 
-	0x40, //  # 
-	0x40, //  # 
-	0x40, //  # 
-	0x40, //  # 
-	0xE0, // ###
-	0x00, //    
-	0x00, //    
-	0x00, //    
-	0x00, //    
-
-	/* @42 '2' (5 pixels wide) */
-	0x00, //      
-	0x70, //  ### 
-	0x88, // #   #
-	0x08, //     #
-	0x10, //    # 
-	0x20, //   #  
-	0x40, //  #   
-	0x80, // #    
-	0x80, // #    
-	0xF8, // #####
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @56 '3' (5 pixels wide) */
-	0x00, //      
-	0x70, //  ### 
-	0x88, // #   #
-	0x08, //     #
-	0x08, //     #
-	0x70, //  ### 
-	0x08, //     #
-	0x08, //     #
-	0x88, // #   #
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @70 '4' (6 pixels wide) */
-	0x00, //       
-	0x08, //     # 
-	0x18, //    ## 
-	0x28, //   # # 
-	0x48, //  #  # 
-	0x88, // #   # 
-	0xFC, // ######
-	0x08, //     # 
-	0x08, //     # 
-	0x08, //     # 
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	/* @84 '5' (5 pixels wide) */
-	0x00, //      
-	0xF8, // #####
-	0x80, // #    
-	0x80, // #    
-	0xB0, // # ## 
-	0xC8, // ##  #
-	0x88, // #   #
-	0x08, //     #
-	0x88, // #   #
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @98 '6' (5 pixels wide) */
-	0x00, //      
-	0x10, //    # 
-	0x20, //   #  
-	0x40, //  #   
-	0xF0, // #### 
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @112 '7' (7 pixels wide) */
-	0x00, //        
-	0xFE, // #######
-	0x04, //      # 
-	0x08, //     #  
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	/* @126 '8' (5 pixels wide) */
-	0x00, //      
-	0x70, //  ### 
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x70, //  ### 
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @140 '9' (5 pixels wide) */
-	0x00, //      
-	0x70, //  ### 
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x78, //  ####
-	0x10, //    # 
-	0x20, //   #  
-	0x40, //  #   
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @154 'A' (7 pixels wide) */
-	0x00, //        
-	0x08, //     #  
-	0x08, //     #  
-	0x14, //    # # 
-	0x14, //    # # 
-	0x24, //   #  # 
-	0x3C, //   #### 
-	0x42, //  #    #
-	0x42, //  #    #
-	0x82, // #     #
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	/* @168 'B' (5 pixels wide) */
-	0x00, //      
-	0xF0, // #### 
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0xF0, // #### 
-	0x90, // #  # 
-	0x88, // #   #
-	0x88, // #   #
-	0xF0, // #### 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @182 'C' (6 pixels wide) */
-	0x00, //       
-	0x1C, //    ###
-	0x24, //   #  #
-	0x40, //  #    
-	0x40, //  #    
-	0x80, // #     
-	0x80, // #     
-	0x80, // #     
-	0x84, // #    #
-	0x78, //  #### 
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	/* @196 'D' (7 pixels wide) */
-	0x00, //        
-	0xC0, // ##     
-	0xB0, // # ##   
-	0x88, // #   #  
-	0x84, // #    # 
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0x84, // #    # 
-	0x78, //  ####  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	/* @210 'E' (6 pixels wide) */
-	0x00, //       
-	0xFC, // ######
-	0x80, // #     
-	0x80, // #     
-	0x80, // #     
-	0xFC, // ######
-	0x80, // #     
-	0x80, // #     
-	0x80, // #     
-	0x7C, //  #####
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	/* @224 'F' (6 pixels wide) */
-	0x00, //       
-	0xFC, // ######
-	0x80, // #     
-	0x80, // #     
-	0x80, // #     
-	0xF8, // ##### 
-	0x80, // #     
-	0x80, // #     
-	0x80, // #     
-	0x80, // #     
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	/* @238 'G' (7 pixels wide) */
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x40, //  #     
-	0x80, // #      
-	0xBE, // # #####
-	0x82, // #     #
-	0x82, // #     #
-	0x84, // #    # 
-	0x78, //  ####  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	/* @252 'H' (7 pixels wide) */
-	0x00, //        
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0xFE, // #######
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	/* @266 'I' (5 pixels wide) */
-	0x00, //      
-	0xF8, // #####
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0xF8, // #####
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @280 'J' (7 pixels wide) */
-	0x00, //        
-	0x3E, //   #####
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x88, // #   #  
-	0x88, // #   #  
-	0x78, //  ####  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	/* @294 'K' (6 pixels wide) */
-	0x00, //       
-	0x84, // #    #
-	0x88, // #   # 
-	0x90, // #  #  
-	0xE0, // ###   
-	0xC0, // ##    
-	0xC0, // ##    
-	0xA0, // # #   
-	0x90, // #  #  
-	0x8C, // #   ##
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	/* @308 'L' (5 pixels wide) */
-	0x00, //      
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0xF8, // #####
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @322 'M' (9 pixels wide) */
-	0x00, 0x00, //          
-	0x22, 0x00, //   #   #  
-	0x22, 0x00, //   #   #  
-	0x22, 0x00, //   #   #  
-	0x56, 0x00, //  # # ##  
-	0x55, 0x00, //  # # # # 
-	0x55, 0x00, //  # # # # 
-	0x55, 0x00, //  # # # # 
-	0x88, 0x80, // #   #   #
-	0x88, 0x80, // #   #   #
-	0x00, 0x00, //          
-	0x00, 0x00, //          
-	0x00, 0x00, //          
-	0x00, 0x00, //          
-
-	/* @350 'N' (8 pixels wide) */
-	0x00, //         
-	0x81, // #      #
-	0xC1, // ##     #
-	0xA1, // # #    #
-	0x91, // #  #   #
-	0x91, // #  #   #
-	0x89, // #   #  #
-	0x85, // #    # #
-	0x83, // #     ##
-	0x81, // #      #
-	0x00, //         
-	0x00, //         
-	0x00, //         
-	0x00, //         
-
-	/* @364 'O' (8 pixels wide) */
-	0x00, //         
-	0x1C, //    ###  
-	0x22, //   #   # 
-	0x41, //  #     #
-	0x81, // #      #
-	0x81, // #      #
-	0x81, // #      #
-	0x82, // #     # 
-	0x42, //  #    # 
-	0x3C, //   ####  
-	0x00, //         
-	0x00, //         
-	0x00, //         
-	0x00, //         
-
-	/* @378 'P' (4 pixels wide) */
-	0x00, //     
-	0xE0, // ### 
-	0x90, // #  #
-	0x90, // #  #
-	0x90, // #  #
-	0x90, // #  #
-	0xE0, // ### 
-	0x80, // #   
-	0x80, // #   
-	0x80, // #   
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x00, //     
-
-	/* @392 'Q' (8 pixels wide) */
-	0x00, //         
-	0x3C, //   ####  
-	0x42, //  #    # 
-	0x81, // #      #
-	0x81, // #      #
-	0x81, // #      #
-	0x81, // #      #
-	0x89, // #   #  #
-	0x47, //  #   ###
-	0x3E, //   ##### 
-	0x03, //       ##
-	0x01, //        #
-	0x00, //         
-	0x00, //         
-
-	/* @406 'R' (5 pixels wide) */
-	0x00, //      
-	0xE0, // ###  
-	0x90, // #  # 
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0xF0, // #### 
-	0xA0, // # #  
-	0x90, // #  # 
-	0x88, // #   #
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @420 'S' (7 pixels wide) */
-	0x00, //        
-	0x1E, //    ####
-	0x20, //   #    
-	0x40, //  #     
-	0x40, //  #     
-	0x3C, //   #### 
-	0x02, //       #
-	0x02, //       #
-	0x84, // #    # 
-	0x78, //  ####  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	/* @434 'T' (7 pixels wide) */
-	0x00, //        
-	0xFE, // #######
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	/* @448 'U' (7 pixels wide) */
-	0x00, //        
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	/* @462 'V' (7 pixels wide) */
-	0x00, //        
-	0x82, // #     #
-	0x82, // #     #
-	0x84, // #    # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x28, //   # #  
-	0x28, //   # #  
-	0x30, //   ##   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	/* @476 'W' (11 pixels wide) */
-	0x00, 0x00, //            
-	0x84, 0x20, // #    #    #
-	0x84, 0x20, // #    #    #
-	0x44, 0x40, //  #   #   # 
-	0x4A, 0x40, //  #  # #  # 
-	0x4A, 0x40, //  #  # #  # 
-	0x52, 0x80, //  # #  # #  
-	0x52, 0x80, //  # #  # #  
-	0x22, 0x80, //   #   # #  
-	0x21, 0x00, //   #    #   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	/* @504 'X' (8 pixels wide) */
-	0x00, //         
-	0x81, // #      #
-	0x42, //  #    # 
-	0x24, //   #  #  
-	0x18, //    ##   
-	0x18, //    ##   
-	0x18, //    ##   
-	0x24, //   #  #  
-	0x42, //  #    # 
-	0x81, // #      #
-	0x00, //         
-	0x00, //         
-	0x00, //         
-	0x00, //         
-
-	/* @518 'Y' (7 pixels wide) */
-	0x00, //        
-	0x82, // #     #
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x24, //   #  # 
-	0x28, //   # #  
-	0x18, //    ##  
-	0x10, //    #   
-	0x10, //    #   
-	0x20, //   #    
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	/* @532 'Z' (8 pixels wide) */
-	0x00, //         
-	0xFF, // ########
-	0x02, //       # 
-	0x04, //      #  
-	0x08, //     #   
-	0x10, //    #    
-	0x20, //   #     
-	0x40, //  #      
-	0x80, // #       
-	0xFF, // ########
-	0x00, //         
-	0x00, //         
-	0x00, //         
-	0x00, //         
-
-	/* @546 'a' (6 pixels wide) */
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x38, //   ### 
-	0x48, //  #  # 
-	0x88, // #   # 
-	0x88, // #   # 
-	0x88, // #   # 
-	0x74, //  ### #
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	/* @560 'b' (5 pixels wide) */
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0xF0, // #### 
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0xF0, // #### 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @574 'c' (5 pixels wide) */
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x30, //   ## 
-	0x48, //  #  #
-	0x80, // #    
-	0x80, // #    
-	0x88, // #   #
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @588 'd' (5 pixels wide) */
-	0x08, //     #
-	0x08, //     #
-	0x08, //     #
-	0x08, //     #
-	0x78, //  ####
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x78, //  ####
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @602 'e' (5 pixels wide) */
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x70, //  ### 
-	0x88, // #   #
-	0x90, // #  # 
-	0xE0, // ###  
-	0x88, // #   #
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @616 'f' (5 pixels wide) */
-	0x18, //    ##
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0xF8, // #####
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @630 'g' (5 pixels wide) */
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x30, //   ## 
-	0x48, //  #  #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x78, //  ####
-	0x08, //     #
-	0x08, //     #
-	0xF0, // #### 
-	0x00, //      
-
-	/* @644 'h' (5 pixels wide) */
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0xB0, // # ## 
-	0xC8, // ##  #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @658 'i' (1 pixels wide) */
-	0x00, //  
-	0x00, //  
-	0x80, // #
-	0x00, //  
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-
-	/* @672 'j' (4 pixels wide) */
-	0x00, //     
-	0x00, //     
-	0x10, //    #
-	0x00, //     
-	0x10, //    #
-	0x10, //    #
-	0x10, //    #
-	0x10, //    #
-	0x10, //    #
-	0x10, //    #
-	0x10, //    #
-	0x10, //    #
-	0x90, // #  #
-	0x60, //  ## 
-
-	/* @686 'k' (5 pixels wide) */
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0x90, // #  # 
-	0xA0, // # #  
-	0xE0, // ###  
-	0xD0, // ## # 
-	0x90, // #  # 
-	0x88, // #   #
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @700 'l' (1 pixels wide) */
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-
-	/* @714 'm' (7 pixels wide) */
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xA4, // # #  # 
-	0xDA, // ## ## #
-	0x92, // #  #  #
-	0x92, // #  #  #
-	0x92, // #  #  #
-	0x92, // #  #  #
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	/* @728 'n' (5 pixels wide) */
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0xB0, // # ## 
-	0xC8, // ##  #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @742 'o' (5 pixels wide) */
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x70, //  ### 
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @756 'p' (5 pixels wide) */
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0xF0, // #### 
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0xF0, // #### 
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0x00, //      
-
-	/* @770 'q' (5 pixels wide) */
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x38, //   ###
-	0x48, //  #  #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x78, //  ####
-	0x08, //     #
-	0x08, //     #
-	0x08, //     #
-	0x00, //      
-
-	/* @784 'r' (4 pixels wide) */
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0xB0, // # ##
-	0xD0, // ## #
-	0x90, // #  #
-	0x80, // #   
-	0x80, // #   
-	0x80, // #   
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x00, //     
-
-	/* @798 's' (5 pixels wide) */
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x78, //  ####
-	0x88, // #   #
-	0x60, //  ##  
-	0x10, //    # 
-	0x08, //     #
-	0xF0, // #### 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @812 't' (5 pixels wide) */
-	0x00, //      
-	0x00, //      
-	0x20, //   #  
-	0x20, //   #  
-	0xF8, // #####
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @826 'u' (5 pixels wide) */
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x78, //  ####
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @840 'v' (5 pixels wide) */
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x88, // #   #
-	0x88, // #   #
-	0x50, //  # # 
-	0x50, //  # # 
-	0x20, //   #  
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	/* @854 'w' (7 pixels wide) */
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x92, // #  #  #
-	0x92, // #  #  #
-	0xB4, // # ## # 
-	0xB4, // # ## # 
-	0x54, //  # # # 
-	0x48, //  #  #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	/* @868 'x' (6 pixels wide) */
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x84, // #    #
-	0x48, //  #  # 
-	0x30, //   ##  
-	0x30, //   ##  
-	0x48, //  #  # 
-	0x84, // #    #
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	/* @882 'y' (6 pixels wide) */
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x84, // #    #
-	0x48, //  #  # 
-	0x48, //  #  # 
-	0x30, //   ##  
-	0x30, //   ##  
-	0x20, //   #   
-	0x20, //   #   
-	0x40, //  #    
-	0x40, //  #    
-	0x00, //       
-
-	/* @896 'z' (4 pixels wide) */
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0xF0, // ####
-	0x10, //    #
-	0x20, //   # 
-	0x40, //  #  
-	0x80, // #   
-	0xF0, // ####
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x00, //  
-};
-
-
-/* Character descriptors for Microsoft Sans Serif 8pt */
-/* { [Char width in bits], [Offset into microsoftSansSerif_8ptCharBitmaps in bytes] } */
-const FONT_CHAR_INFO alphabet_Descriptors[] = 
-{
-	{2, 0}, 		/*   */ 
-	{0, 0}, 		/* ! */ 
-	{0, 0}, 		/* " */ 
-	{0, 0}, 		/* # */ 
-	{0, 0}, 		/* $ */ 
-	{0, 0}, 		/* % */ 
-	{0, 0}, 		/* & */ 
-	{0, 0}, 		/* ' */ 
-	{0, 0}, 		/* ( */ 
-	{0, 0}, 		/* ) */ 
-	{0, 0}, 		/* * */ 
-	{0, 0}, 		/* + */ 
-	{0, 0}, 		/* , */ 
-	{0, 0}, 		/* - */ 
-	{0, 0}, 		/* . */ 
-	{0, 0}, 		/* / */ 
-	{5, 14}, 		/* 0 */ 
-	{3, 28}, 		/* 1 */ 
-	{5, 42}, 		/* 2 */ 
-	{5, 56}, 		/* 3 */ 
-	{6, 70}, 		/* 4 */ 
-	{5, 84}, 		/* 5 */ 
-	{5, 98}, 		/* 6 */ 
-	{7, 112}, 		/* 7 */ 
-	{5, 126}, 		/* 8 */ 
-	{5, 140}, 		/* 9 */ 
-	{0, 0}, 		/* : */ 
-	{0, 0}, 		/* ; */ 
-	{0, 0}, 		/* < */ 
-	{0, 0}, 		/* = */ 
-	{0, 0}, 		/* > */ 
-	{0, 0}, 		/* ? */ 
-	{0, 0}, 		/* @ */ 
-	{7, 154}, 		/* A */ 
-	{5, 168}, 		/* B */ 
-	{6, 182}, 		/* C */ 
-	{7, 196}, 		/* D */ 
-	{6, 210}, 		/* E */ 
-	{6, 224}, 		/* F */ 
-	{7, 238}, 		/* G */ 
-	{7, 252}, 		/* H */ 
-	{5, 266}, 		/* I */ 
-	{7, 280}, 		/* J */ 
-	{6, 294}, 		/* K */ 
-	{5, 308}, 		/* L */ 
-	{9, 322}, 		/* M */ 
-	{8, 350}, 		/* N */ 
-	{8, 364}, 		/* O */ 
-	{4, 378}, 		/* P */ 
-	{8, 392}, 		/* Q */ 
-	{5, 406}, 		/* R */ 
-	{7, 420}, 		/* S */ 
-	{7, 434}, 		/* T */ 
-	{7, 448}, 		/* U */ 
-	{7, 462}, 		/* V */ 
-	{11, 476}, 		/* W */ 
-	{8, 504}, 		/* X */ 
-	{7, 518}, 		/* Y */ 
-	{8, 532}, 		/* Z */ 
-	{0, 0}, 		/* [ */ 
-	{0, 0}, 		/* \ */ 
-	{0, 0}, 		/* ] */ 
-	{0, 0}, 		/* ^ */ 
-	{0, 0}, 		/* _ */ 
-	{0, 0}, 		/* ` */ 
-	{6, 546}, 		/* a */ 
-	{5, 560}, 		/* b */ 
-	{5, 574}, 		/* c */ 
-	{5, 588}, 		/* d */ 
-	{5, 602}, 		/* e */ 
-	{5, 616}, 		/* f */ 
-	{5, 630}, 		/* g */ 
-	{5, 644}, 		/* h */ 
-	{1, 658}, 		/* i */ 
-	{4, 672}, 		/* j */ 
-	{5, 686}, 		/* k */ 
-	{1, 700}, 		/* l */ 
-	{7, 714}, 		/* m */ 
-	{5, 728}, 		/* n */ 
-	{5, 742}, 		/* o */ 
-	{5, 756}, 		/* p */ 
-	{5, 770}, 		/* q */ 
-	{4, 784}, 		/* r */ 
-	{5, 798}, 		/* s */ 
-	{5, 812}, 		/* t */ 
-	{5, 826}, 		/* u */ 
-	{5, 840}, 		/* v */ 
-	{7, 854}, 		/* w */ 
-	{6, 868}, 		/* x */ 
-	{6, 882}, 		/* y */ 
-	{4, 896}, 		/* z */ 
-
-};
-
@@ -0,0 +1,45 @@
+#include "game.h"
+
+//*****************************************************************************
+// Playfield background, one screen of 16x16 tiles from ocean_tiles_image:
+//   0 water (BG_COLOR), 1 ripples, 2 bubbles, 3 sand edge, 4 sand, 5 seaweed
+// Tile 0 is plain BG_COLOR, so anything still drawn with BG_COLOR blends in.
+//*****************************************************************************
+static const uint8_t ocean_cells[OCEAN_ROWS * OCEAN_COLUMNS] =
+{
+	1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+	0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+	0, 0, 0, 0, 0, 0, 1, 2, 0, 1, 0, 0, 0, 0, 0,
+	0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1,
+	1, 0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+	1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2,
+	0, 0, 1, 2, 2, 0, 0, 2, 0, 1, 1, 0, 2, 0, 0,
+	0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+	2, 0, 0, 2, 0, 0, 2, 0, 0, 2, 0, 0, 2, 0, 0,
+	0, 0, 0, 1, 0, 1, 0, 2, 2, 0, 0, 0, 0, 0, 0,
+	0, 5, 0, 0, 5, 5, 0, 0, 0, 5, 0, 0, 0, 5, 0,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+};
+
+static const tileset_t ocean_tiles =
+{
+	&ocean_tiles_image,
+	16
+};
+
+const tilemap_t ocean_background =
+{
+	&ocean_tiles,
+	OCEAN_COLUMNS,
+	OCEAN_ROWS,
+	ocean_cells,
+	0, 0
+};
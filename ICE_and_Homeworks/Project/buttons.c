@@ -1,93 +1,17 @@
 #include "buttons.h"
 
-
-void debounce_wait(void) 
-{
-  int i = 10000;
-  while(i > 0)
-  {
-    i--;
-  }
-}
-
-bool debounce_fsm(uint8_t button_bit)
+uint8_t buttons_read_launchpad(void)
 {
-  static DEBOUNCE_STATES state = DEBOUNCE_ONE;
-  bool pin_logic_level;
+  uint8_t pressed = 0;
   
-  pin_logic_level = lp_io_read_pin(button_bit);
-  
-  switch (state)
-  {
-    case DEBOUNCE_ONE:
-    {
-      if(pin_logic_level)
-      {
-        state = DEBOUNCE_ONE;
-      }
-      else
-      {
-        state = DEBOUNCE_1ST_ZERO;
-      }
-      break;
-    }
-    case DEBOUNCE_1ST_ZERO:
-    {
-      if(pin_logic_level)
-      {
-        state = DEBOUNCE_ONE;
-      }
-      else
-      {
-        state = DEBOUNCE_2ND_ZERO;
-      }
-      break;
-    }
-    case DEBOUNCE_2ND_ZERO:
-    {
-      if(pin_logic_level)
-      {
-        state = DEBOUNCE_ONE;
-      }
-      else
-      {
-        state = DEBOUNCE_PRESSED;
-      }
-      break;
-    }
-    case DEBOUNCE_PRESSED:
-    {
-      if(pin_logic_level)
-      {
-        state = DEBOUNCE_ONE;
-      }
-      else
-      {
-        state = DEBOUNCE_PRESSED;
-      }
-      break;
-    }
-    default:
-    {
-      while(1){};
-    }
-  }
-  
-  if(state == DEBOUNCE_2ND_ZERO )
+  // the switches pull their pins low
+  if (!lp_io_read_pin(SW1_BIT))
   {
-    return true;
+    pressed |= 1 << BUTTON_SW1;
   }
-  else
+  if (!lp_io_read_pin(SW2_BIT))
   {
-    return false;
+    pressed |= 1 << BUTTON_SW2;
   }
+  return pressed;
 }
-
-bool button_pressed(uint8_t button_bit)
-{
-	debounce_wait();
-	if (debounce_fsm(button_bit))
-		return true;
-	else
-		return false;
-}
\ No newline at end of file
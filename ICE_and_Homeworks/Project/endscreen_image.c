@@ -0,0 +1,237 @@
+// Generated by tools/imgconv from bmp/endscreen.bmp (240x320)
+// Do not edit by hand, regenerate the file instead.
+
+#include "image.h"
+
+static const uint8_t endscreen_image_data[] =
+{
+  0xDE, 0x32, 0x06, 0x77, 0x06, 0x6A, 0x0D, 0x70, 0x0C, 0x65, 0x10, 0x6D, 0x10, 0x62, 0x06, 0x06,
+  0x06, 0x6B, 0x06, 0x06, 0x06, 0x60, 0x04, 0x0C, 0x03, 0x6A, 0x05, 0x0B, 0x04, 0x5E, 0x04, 0x0F,
+  0x01, 0x69, 0x04, 0x0E, 0x04, 0x5C, 0x04, 0x7A, 0x03, 0x10, 0x03, 0x5B, 0x04, 0x7A, 0x04, 0x10,
+  0x04, 0x5A, 0x03, 0x1F, 0x06, 0x0D, 0x02, 0x06, 0x04, 0x0A, 0x04, 0x12, 0x05, 0x18, 0x03, 0x12,
+  0x03, 0x06, 0x02, 0x0E, 0x02, 0x0C, 0x05, 0x0D, 0x02, 0x05, 0x04, 0x19, 0x03, 0x1C, 0x0B, 0x0B,
+  0x02, 0x04, 0x08, 0x06, 0x08, 0x0D, 0x0A, 0x16, 0x03, 0x12, 0x03, 0x06, 0x03, 0x0C, 0x03, 0x09,
+  0x0A, 0x0B, 0x02, 0x04, 0x05, 0x18, 0x03, 0x1C, 0x0E, 0x09, 0x02, 0x03, 0x0A, 0x03, 0x0B, 0x0B,
+  0x0D, 0x13, 0x03, 0x13, 0x04, 0x05, 0x03, 0x0C, 0x03, 0x08, 0x0D, 0x09, 0x02, 0x03, 0x06, 0x18,
+  0x03, 0x1C, 0x03, 0x07, 0x04, 0x09, 0x07, 0x04, 0x05, 0x01, 0x04, 0x04, 0x04, 0x0A, 0x04, 0x07,
+  0x03, 0x13, 0x03, 0x14, 0x03, 0x05, 0x03, 0x0C, 0x02, 0x08, 0x04, 0x07, 0x03, 0x09, 0x07, 0x1C,
+  0x03, 0x1C, 0x01, 0x0A, 0x04, 0x08, 0x06, 0x06, 0x07, 0x07, 0x04, 0x08, 0x04, 0x09, 0x03, 0x12,
+  0x03, 0x14, 0x03, 0x06, 0x03, 0x0A, 0x03, 0x07, 0x04, 0x09, 0x03, 0x08, 0x05, 0x1E, 0x03, 0x28,
+  0x03, 0x08, 0x05, 0x08, 0x05, 0x09, 0x03, 0x08, 0x03, 0x0B, 0x02, 0x12, 0x03, 0x14, 0x03, 0x06,
+  0x03, 0x0A, 0x03, 0x07, 0x03, 0x0B, 0x02, 0x08, 0x05, 0x1E, 0x03, 0x0A, 0x0A, 0x14, 0x03, 0x08,
+  0x04, 0x0A, 0x03, 0x0A, 0x03, 0x07, 0x03, 0x0C, 0x03, 0x11, 0x03, 0x14, 0x03, 0x06, 0x03, 0x0A,
+  0x02, 0x07, 0x03, 0x0C, 0x03, 0x07, 0x04, 0x1F, 0x03, 0x09, 0x0B, 0x14, 0x03, 0x08, 0x03, 0x0B,
+  0x03, 0x0A, 0x03, 0x07, 0x03, 0x0C, 0x03, 0x11, 0x03, 0x14, 0x03, 0x07, 0x03, 0x08, 0x03, 0x07,
+  0x03, 0x0C, 0x03, 0x07, 0x03, 0x20, 0x03, 0x0A, 0x0A, 0x14, 0x03, 0x08, 0x03, 0x0B, 0x03, 0x0B,
+  0x02, 0x07, 0x03, 0x0C, 0x03, 0x11, 0x03, 0x14, 0x03, 0x07, 0x03, 0x08, 0x03, 0x07, 0x03, 0x0C,
+  0x03, 0x07, 0x03, 0x20, 0x03, 0x11, 0x03, 0x0D, 0x0A, 0x08, 0x03, 0x0B, 0x03, 0x0B, 0x02, 0x07,
+  0x12, 0x11, 0x03, 0x14, 0x03, 0x08, 0x02, 0x07, 0x03, 0x08, 0x12, 0x07, 0x03, 0x20, 0x03, 0x11,
+  0x03, 0x0A, 0x0D, 0x08, 0x03, 0x0B, 0x03, 0x0B, 0x02, 0x07, 0x12, 0x11, 0x03, 0x13, 0x04, 0x08,
+  0x03, 0x06, 0x03, 0x08, 0x12, 0x07, 0x03, 0x20, 0x03, 0x11, 0x03, 0x08, 0x0F, 0x08, 0x03, 0x0B,
+  0x03, 0x0B, 0x02, 0x07, 0x12, 0x11, 0x03, 0x13, 0x03, 0x09, 0x03, 0x06, 0x02, 0x09, 0x12, 0x07,
+  0x03, 0x20, 0x04, 0x10, 0x03, 0x08, 0x04, 0x08, 0x03, 0x08, 0x03, 0x0B, 0x03, 0x0B, 0x02, 0x07,
+  0x03, 0x20, 0x04, 0x12, 0x03, 0x0A, 0x03, 0x04, 0x03, 0x09, 0x03, 0x16, 0x03, 0x21, 0x03, 0x10,
+  0x03, 0x07, 0x03, 0x0A, 0x03, 0x08, 0x03, 0x0B, 0x03, 0x0B, 0x02, 0x07, 0x03, 0x21, 0x03, 0x12,
+  0x03, 0x0A, 0x03, 0x04, 0x03, 0x09, 0x03, 0x16, 0x03, 0x21, 0x04, 0x0F, 0x03, 0x07, 0x03, 0x0A,
+  0x03, 0x08, 0x03, 0x0B, 0x03, 0x0B, 0x02, 0x07, 0x03, 0x21, 0x03, 0x11, 0x03, 0x0B, 0x03, 0x04,
+  0x02, 0x0A, 0x03, 0x16, 0x03, 0x22, 0x04, 0x0E, 0x03, 0x07, 0x03, 0x0A, 0x03, 0x08, 0x03, 0x0B,
+  0x03, 0x0B, 0x02, 0x07, 0x03, 0x21, 0x04, 0x0F, 0x04, 0x0C, 0x03, 0x02, 0x03, 0x0A, 0x03, 0x16,
+  0x03, 0x22, 0x05, 0x0D, 0x03, 0x07, 0x03, 0x0A, 0x03, 0x08, 0x03, 0x0B, 0x03, 0x0B, 0x02, 0x08,
+  0x03, 0x21, 0x04, 0x0E, 0x03, 0x0D, 0x03, 0x02, 0x03, 0x0B, 0x03, 0x15, 0x03, 0x23, 0x05, 0x0C,
+  0x03, 0x07, 0x03, 0x09, 0x04, 0x08, 0x03, 0x0B, 0x03, 0x0B, 0x02, 0x08, 0x04, 0x0B, 0x01, 0x15,
+  0x04, 0x0B, 0x05, 0x0D, 0x03, 0x02, 0x02, 0x0C, 0x04, 0x0B, 0x01, 0x08, 0x03, 0x24, 0x07, 0x06,
+  0x06, 0x07, 0x04, 0x06, 0x06, 0x08, 0x03, 0x0B, 0x03, 0x0B, 0x02, 0x09, 0x05, 0x07, 0x03, 0x15,
+  0x07, 0x06, 0x06, 0x0F, 0x06, 0x0D, 0x05, 0x07, 0x03, 0x08, 0x03, 0x26, 0x11, 0x08, 0x0B, 0x02,
+  0x02, 0x08, 0x03, 0x0B, 0x03, 0x0B, 0x02, 0x0A, 0x0E, 0x17, 0x10, 0x10, 0x06, 0x0E, 0x0E, 0x08,
+  0x03, 0x27, 0x0E, 0x0B, 0x09, 0x03, 0x02, 0x08, 0x03, 0x0B, 0x03, 0x0B, 0x02, 0x0B, 0x0C, 0x19,
+  0x0D, 0x13, 0x04, 0x10, 0x0C, 0x09, 0x03, 0x2B, 0x06, 0x11, 0x05, 0x05, 0x02, 0x08, 0x03, 0x0B,
+  0x02, 0x0C, 0x02, 0x0E, 0x05, 0x20, 0x07, 0x16, 0x04, 0x13, 0x05, 0x0D, 0x03, 0x8F, 0x20, 0x05,
+  0x07, 0x05, 0x06, 0x01, 0x18, 0x05, 0x19, 0x03, 0x9F, 0x01, 0x05, 0x07, 0x05, 0x05, 0x03, 0x17,
+  0x05, 0x16, 0x09, 0x9C, 0x01, 0x05, 0x07, 0x05, 0x04, 0x05, 0x16, 0x05, 0x14, 0x0A, 0x9D, 0x01,
+  0x05, 0x07, 0x05, 0x05, 0x04, 0x16, 0x05, 0x13, 0x0B, 0x9D, 0x01, 0x05, 0x07, 0x05, 0x05, 0x03,
+  0x17, 0x05, 0x13, 0x05, 0xA3, 0x01, 0x05, 0x07, 0x05, 0x1F, 0x05, 0x13, 0x04, 0xA4, 0x01, 0x05,
+  0x07, 0x05, 0x04, 0x05, 0x09, 0x01, 0x04, 0x04, 0x04, 0x05, 0x03, 0x02, 0x0D, 0x05, 0x12, 0x03,
+  0x09, 0x03, 0x09, 0x04, 0x04, 0x01, 0x08, 0x02, 0x0B, 0x02, 0x5A, 0x05, 0x07, 0x05, 0x04, 0x05,
+  0x06, 0x07, 0x01, 0x04, 0x04, 0x05, 0x01, 0x06, 0x0C, 0x04, 0x0F, 0x07, 0x06, 0x07, 0x07, 0x04,
+  0x02, 0x03, 0x06, 0x07, 0x07, 0x04, 0x59, 0x05, 0x07, 0x05, 0x04, 0x05, 0x05, 0x0D, 0x04, 0x0D,
+  0x0B, 0x05, 0x0D, 0x08, 0x04, 0x0B, 0x05, 0x04, 0x01, 0x04, 0x05, 0x09, 0x05, 0x05, 0x59, 0x11,
+  0x04, 0x05, 0x05, 0x0D, 0x04, 0x0D, 0x0B, 0x07, 0x0A, 0x09, 0x04, 0x05, 0x01, 0x05, 0x05, 0x09,
+  0x04, 0x04, 0x02, 0x05, 0x04, 0x05, 0x59, 0x11, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05,
+  0x04, 0x04, 0x0C, 0x08, 0x07, 0x05, 0x08, 0x05, 0x03, 0x05, 0x04, 0x09, 0x03, 0x04, 0x04, 0x04,
+  0x05, 0x04, 0x59, 0x11, 0x04, 0x05, 0x04, 0x04, 0x05, 0x05, 0x04, 0x05, 0x04, 0x04, 0x0D, 0x09,
+  0x05, 0x04, 0x09, 0x04, 0x05, 0x04, 0x04, 0x06, 0x06, 0x04, 0x05, 0x03, 0x06, 0x02, 0x5A, 0x11,
+  0x04, 0x05, 0x04, 0x04, 0x05, 0x05, 0x04, 0x05, 0x04, 0x05, 0x0E, 0x07, 0x05, 0x04, 0x09, 0x04,
+  0x05, 0x04, 0x04, 0x05, 0x07, 0x03, 0x06, 0x04, 0x61, 0x05, 0x07, 0x05, 0x04, 0x05, 0x04, 0x04,
+  0x05, 0x05, 0x04, 0x05, 0x04, 0x05, 0x10, 0x06, 0x04, 0x04, 0x09, 0x04, 0x05, 0x04, 0x04, 0x05,
+  0x07, 0x0D, 0x61, 0x05, 0x07, 0x05, 0x04, 0x05, 0x03, 0x05, 0x05, 0x05, 0x04, 0x05, 0x04, 0x05,
+  0x11, 0x05, 0x03, 0x05, 0x08, 0x05, 0x05, 0x05, 0x03, 0x05, 0x06, 0x0E, 0x61, 0x05, 0x07, 0x05,
+  0x04, 0x05, 0x03, 0x05, 0x05, 0x05, 0x04, 0x05, 0x04, 0x05, 0x12, 0x05, 0x03, 0x04, 0x09, 0x04,
+  0x05, 0x05, 0x03, 0x05, 0x06, 0x0E, 0x61, 0x05, 0x07, 0x05, 0x04, 0x05, 0x04, 0x04, 0x05, 0x05,
+  0x04, 0x05, 0x04, 0x05, 0x12, 0x04, 0x04, 0x04, 0x09, 0x04, 0x05, 0x04, 0x04, 0x05, 0x07, 0x03,
+  0x6B, 0x05, 0x07, 0x05, 0x04, 0x05, 0x04, 0x04, 0x05, 0x05, 0x04, 0x05, 0x04, 0x05, 0x12, 0x04,
+  0x04, 0x04, 0x09, 0x04, 0x05, 0x04, 0x04, 0x05, 0x07, 0x04, 0x0E, 0x02, 0x5A, 0x05, 0x07, 0x05,
+  0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x0A, 0x01, 0x06, 0x05, 0x04, 0x05,
+  0x08, 0x05, 0x03, 0x05, 0x04, 0x05, 0x07, 0x04, 0x0D, 0x04, 0x59, 0x05, 0x07, 0x05, 0x04, 0x05,
+  0x04, 0x06, 0x02, 0x06, 0x04, 0x05, 0x04, 0x05, 0x0A, 0x0C, 0x05, 0x09, 0x04, 0x05, 0x01, 0x05,
+  0x05, 0x05, 0x08, 0x05, 0x03, 0x02, 0x05, 0x05, 0x59, 0x05, 0x07, 0x05, 0x04, 0x05, 0x05, 0x0D,
+  0x04, 0x05, 0x04, 0x05, 0x0A, 0x0B, 0x06, 0x09, 0x04, 0x0B, 0x05, 0x05, 0x08, 0x0A, 0x05, 0x05,
+  0x59, 0x05, 0x07, 0x05, 0x04, 0x05, 0x06, 0x06, 0x01, 0x05, 0x04, 0x05, 0x04, 0x05, 0x09, 0x0A,
+  0x0A, 0x07, 0x06, 0x07, 0x07, 0x05, 0x0A, 0x09, 0x05, 0x04, 0x59, 0x05, 0x07, 0x05, 0x04, 0x05,
+  0x08, 0x02, 0x03, 0x04, 0x05, 0x05, 0x04, 0x05, 0x0D, 0x02, 0x11, 0x02, 0x0A, 0x03, 0x09, 0x05,
+  0x0D, 0x02, 0x0A, 0x02, 0x81, 0x01, 0x04, 0xEB, 0x01, 0x05, 0xE4, 0x01, 0x0C, 0xE4, 0x01, 0x0B,
+  0xE5, 0x01, 0x0A, 0xE9, 0x01, 0x03, 0xDE, 0x0E, 0x05, 0x07, 0x05, 0x3D, 0x03, 0xA0, 0x01, 0x05,
+  0x06, 0x04, 0x3B, 0x09, 0x9D, 0x01, 0x05, 0x05, 0x05, 0x39, 0x0A, 0x9F, 0x01, 0x04, 0x05, 0x04,
+  0x39, 0x0B, 0x9F, 0x01, 0x05, 0x04, 0x04, 0x39, 0x05, 0xA6, 0x01, 0x04, 0x03, 0x04, 0x3A, 0x04,
+  0xA7, 0x01, 0x04, 0x03, 0x04, 0x0A, 0x03, 0x09, 0x05, 0x04, 0x05, 0x04, 0x04, 0x04, 0x01, 0x08,
+  0x05, 0x12, 0x03, 0x09, 0x03, 0x09, 0x04, 0x04, 0x01, 0x08, 0x02, 0x0B, 0x02, 0x5E, 0x04, 0x02,
+  0x03, 0x09, 0x07, 0x07, 0x05, 0x04, 0x05, 0x04, 0x04, 0x02, 0x03, 0x09, 0x04, 0x0F, 0x07, 0x06,
+  0x07, 0x07, 0x04, 0x02, 0x03, 0x06, 0x07, 0x07, 0x04, 0x5D, 0x04, 0x02, 0x03, 0x07, 0x0B, 0x05,
+  0x05, 0x04, 0x05, 0x04, 0x04, 0x01, 0x04, 0x09, 0x05, 0x0D, 0x08, 0x04, 0x0B, 0x05, 0x04, 0x01,
+  0x04, 0x05, 0x09, 0x05, 0x05, 0x5D, 0x04, 0x01, 0x03, 0x08, 0x05, 0x01, 0x05, 0x05, 0x05, 0x04,
+  0x05, 0x04, 0x09, 0x09, 0x07, 0x0A, 0x09, 0x04, 0x05, 0x01, 0x05, 0x05, 0x09, 0x04, 0x04, 0x02,
+  0x05, 0x04, 0x05, 0x5E, 0x07, 0x07, 0x05, 0x03, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x09, 0x0A,
+  0x08, 0x07, 0x05, 0x08, 0x05, 0x03, 0x05, 0x04, 0x09, 0x03, 0x04, 0x04, 0x04, 0x05, 0x04, 0x5E,
+  0x07, 0x07, 0x04, 0x05, 0x04, 0x04, 0x05, 0x04, 0x05, 0x04, 0x06, 0x0E, 0x09, 0x05, 0x04, 0x09,
+  0x04, 0x05, 0x04, 0x04, 0x06, 0x06, 0x04, 0x05, 0x03, 0x06, 0x02, 0x60, 0x05, 0x08, 0x04, 0x05,
+  0x04, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x11, 0x07, 0x05, 0x04, 0x09, 0x04, 0x05, 0x04, 0x04,
+  0x05, 0x07, 0x03, 0x06, 0x04, 0x67, 0x05, 0x08, 0x04, 0x05, 0x04, 0x04, 0x05, 0x04, 0x05, 0x04,
+  0x05, 0x13, 0x06, 0x04, 0x04, 0x09, 0x04, 0x05, 0x04, 0x04, 0x05, 0x07, 0x0D, 0x67, 0x05, 0x07,
+  0x05, 0x05, 0x05, 0x03, 0x05, 0x04, 0x05, 0x04, 0x05, 0x14, 0x05, 0x03, 0x05, 0x08, 0x05, 0x05,
+  0x05, 0x03, 0x05, 0x06, 0x0E, 0x67, 0x05, 0x08, 0x04, 0x05, 0x05, 0x03, 0x05, 0x04, 0x05, 0x04,
+  0x05, 0x15, 0x05, 0x03, 0x04, 0x09, 0x04, 0x05, 0x05, 0x03, 0x05, 0x06, 0x0E, 0x67, 0x05, 0x08,
+  0x04, 0x05, 0x04, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x15, 0x04, 0x04, 0x04, 0x09, 0x04, 0x05,
+  0x04, 0x04, 0x05, 0x07, 0x03, 0x71, 0x05, 0x08, 0x04, 0x05, 0x04, 0x05, 0x04, 0x04, 0x05, 0x04,
+  0x05, 0x15, 0x04, 0x04, 0x04, 0x09, 0x04, 0x05, 0x04, 0x04, 0x05, 0x07, 0x04, 0x0E, 0x02, 0x60,
+  0x05, 0x08, 0x05, 0x03, 0x05, 0x05, 0x04, 0x04, 0x05, 0x04, 0x05, 0x0D, 0x01, 0x06, 0x05, 0x04,
+  0x05, 0x08, 0x05, 0x03, 0x05, 0x04, 0x05, 0x07, 0x04, 0x0D, 0x04, 0x5F, 0x05, 0x09, 0x05, 0x01,
+  0x05, 0x06, 0x0D, 0x04, 0x05, 0x0D, 0x0C, 0x05, 0x09, 0x04, 0x05, 0x01, 0x05, 0x05, 0x05, 0x08,
+  0x05, 0x03, 0x02, 0x05, 0x05, 0x5F, 0x05, 0x09, 0x0B, 0x06, 0x0D, 0x04, 0x05, 0x0D, 0x0B, 0x06,
+  0x09, 0x04, 0x0B, 0x05, 0x05, 0x08, 0x0A, 0x05, 0x05, 0x5F, 0x05, 0x0B, 0x07, 0x09, 0x06, 0x02,
+  0x04, 0x04, 0x05, 0x0C, 0x0A, 0x0A, 0x07, 0x06, 0x07, 0x07, 0x05, 0x0A, 0x09, 0x05, 0x04, 0x5F,
+  0x05, 0x0D, 0x03, 0x0D, 0x02, 0x04, 0x04, 0x04, 0x05, 0x10, 0x02, 0x11, 0x02, 0x0A, 0x03, 0x09,
+  0x05, 0x0D, 0x02, 0x0A, 0x02, 0xFE, 0x08, 0x0E, 0xDC, 0x01, 0x1A, 0xD2, 0x01, 0x22, 0xCB, 0x01,
+  0x28, 0xC5, 0x01, 0x2E, 0xC0, 0x01, 0x12, 0x0E, 0x12, 0xBC, 0x01, 0x0E, 0x1A, 0x0E, 0xB8, 0x01,
+  0x0D, 0x20, 0x0D, 0xB4, 0x01, 0x0C, 0x26, 0x0C, 0xB1, 0x01, 0x0B, 0x2B, 0x0A, 0xAF, 0x01, 0x09,
+  0x30, 0x09, 0xAC, 0x01, 0x09, 0x34, 0x09, 0xA9, 0x01, 0x09, 0x37, 0x08, 0xA7, 0x01, 0x08, 0x3A,
+  0x08, 0xA4, 0x01, 0x09, 0x3C, 0x09, 0xA1, 0x01, 0x08, 0x40, 0x08, 0x9F, 0x01, 0x08, 0x42, 0x08,
+  0x9D, 0x01, 0x08, 0x44, 0x08, 0x9B, 0x01, 0x07, 0x48, 0x07, 0x9A, 0x01, 0x06, 0x4A, 0x07, 0x98,
+  0x01, 0x06, 0x4C, 0x06, 0x97, 0x01, 0x06, 0x4E, 0x06, 0x95, 0x01, 0x07, 0x4E, 0x07, 0x93, 0x01,
+  0x07, 0x50, 0x07, 0x92, 0x01, 0x06, 0x10, 0x06, 0x22, 0x06, 0x14, 0x06, 0x91, 0x01, 0x06, 0x0F,
+  0x0A, 0x1E, 0x0A, 0x13, 0x06, 0x90, 0x01, 0x06, 0x0D, 0x0E, 0x1A, 0x0E, 0x12, 0x06, 0x8E, 0x01,
+  0x06, 0x0D, 0x10, 0x18, 0x10, 0x11, 0x06, 0x8D, 0x01, 0x06, 0x0D, 0x12, 0x16, 0x12, 0x11, 0x06,
+  0x8C, 0x01, 0x06, 0x0D, 0x13, 0x15, 0x13, 0x10, 0x06, 0x8B, 0x01, 0x06, 0x0D, 0x14, 0x14, 0x14,
+  0x11, 0x06, 0x8A, 0x01, 0x06, 0x0D, 0x14, 0x14, 0x14, 0x12, 0x05, 0x8A, 0x01, 0x05, 0x0D, 0x16,
+  0x12, 0x16, 0x11, 0x05, 0x89, 0x01, 0x06, 0x0D, 0x16, 0x12, 0x16, 0x12, 0x05, 0x88, 0x01, 0x05,
+  0x0E, 0x16, 0x12, 0x16, 0x12, 0x05, 0x87, 0x01, 0x06, 0x0E, 0x16, 0x12, 0x16, 0x12, 0x06, 0x6B,
+  0x01, 0x1A, 0x05, 0x0F, 0x16, 0x12, 0x16, 0x13, 0x05, 0x6A, 0x03, 0x19, 0x05, 0x10, 0x14, 0x14,
+  0x14, 0x14, 0x05, 0x6B, 0x03, 0x18, 0x05, 0x10, 0x14, 0x14, 0x14, 0x14, 0x06, 0x6A, 0x04, 0x16,
+  0x05, 0x11, 0x14, 0x14, 0x14, 0x15, 0x05, 0x1C, 0x03, 0x4C, 0x05, 0x14, 0x05, 0x12, 0x12, 0x16,
+  0x12, 0x16, 0x05, 0x1B, 0x05, 0x4C, 0x05, 0x13, 0x05, 0x13, 0x10, 0x0A, 0x04, 0x0A, 0x10, 0x17,
+  0x05, 0x19, 0x06, 0x4F, 0x04, 0x12, 0x05, 0x14, 0x0E, 0x0A, 0x06, 0x0A, 0x0E, 0x18, 0x05, 0x18,
+  0x05, 0x53, 0x03, 0x11, 0x05, 0x16, 0x0B, 0x0A, 0x06, 0x0D, 0x0B, 0x19, 0x06, 0x15, 0x05, 0x56,
+  0x03, 0x0F, 0x05, 0x19, 0x06, 0x0C, 0x04, 0x12, 0x06, 0x1D, 0x05, 0x14, 0x04, 0x59, 0x03, 0x0E,
+  0x05, 0x2A, 0x03, 0x37, 0x05, 0x12, 0x05, 0x5B, 0x03, 0x0D, 0x05, 0x29, 0x04, 0x37, 0x05, 0x11,
+  0x04, 0x5E, 0x03, 0x0C, 0x05, 0x28, 0x04, 0x38, 0x05, 0x10, 0x04, 0x60, 0x03, 0x0B, 0x05, 0x28,
+  0x03, 0x39, 0x05, 0x0F, 0x03, 0x63, 0x04, 0x09, 0x05, 0x27, 0x03, 0x3A, 0x05, 0x0D, 0x04, 0x65,
+  0x04, 0x08, 0x05, 0x26, 0x04, 0x3A, 0x05, 0x0C, 0x04, 0x67, 0x04, 0x07, 0x05, 0x26, 0x03, 0x3B,
+  0x05, 0x0A, 0x05, 0x69, 0x04, 0x06, 0x05, 0x25, 0x04, 0x3B, 0x05, 0x08, 0x05, 0x6C, 0x04, 0x05,
+  0x05, 0x25, 0x03, 0x3C, 0x05, 0x06, 0x06, 0x6E, 0x04, 0x04, 0x05, 0x25, 0x03, 0x3C, 0x05, 0x04,
+  0x06, 0x71, 0x03, 0x04, 0x05, 0x25, 0x04, 0x3B, 0x05, 0x02, 0x06, 0x74, 0x04, 0x03, 0x05, 0x24,
+  0x0F, 0x2F, 0x06, 0x01, 0x05, 0x77, 0x04, 0x02, 0x05, 0x25, 0x0F, 0x2E, 0x05, 0x01, 0x04, 0x7A,
+  0x04, 0x01, 0x05, 0x28, 0x0B, 0x2F, 0x05, 0x01, 0x03, 0x7C, 0x09, 0x62, 0x08, 0x7E, 0x08, 0x12,
+  0x03, 0x38, 0x03, 0x12, 0x07, 0x80, 0x01, 0x08, 0x10, 0x05, 0x36, 0x05, 0x10, 0x08, 0x81, 0x01,
+  0x07, 0x10, 0x07, 0x32, 0x07, 0x10, 0x06, 0x83, 0x01, 0x07, 0x10, 0x08, 0x30, 0x08, 0x10, 0x06,
+  0x84, 0x01, 0x07, 0x10, 0x08, 0x2E, 0x08, 0x10, 0x07, 0x85, 0x01, 0x06, 0x11, 0x08, 0x2B, 0x09,
+  0x11, 0x06, 0x87, 0x01, 0x06, 0x12, 0x08, 0x28, 0x08, 0x13, 0x05, 0x89, 0x01, 0x05, 0x13, 0x08,
+  0x25, 0x09, 0x13, 0x06, 0x89, 0x01, 0x06, 0x13, 0x08, 0x23, 0x08, 0x15, 0x05, 0x8A, 0x01, 0x06,
+  0x14, 0x09, 0x1F, 0x09, 0x15, 0x06, 0x8B, 0x01, 0x06, 0x15, 0x08, 0x1D, 0x09, 0x16, 0x05, 0x8C,
+  0x01, 0x06, 0x16, 0x09, 0x19, 0x09, 0x17, 0x06, 0x8D, 0x01, 0x06, 0x16, 0x09, 0x16, 0x0A, 0x17,
+  0x06, 0x8F, 0x01, 0x05, 0x18, 0x09, 0x12, 0x0A, 0x19, 0x06, 0x8F, 0x01, 0x06, 0x18, 0x0A, 0x0F,
+  0x0A, 0x19, 0x06, 0x91, 0x01, 0x06, 0x19, 0x0A, 0x0A, 0x0B, 0x1A, 0x06, 0x92, 0x01, 0x07, 0x19,
+  0x0D, 0x01, 0x0E, 0x1B, 0x07, 0x93, 0x01, 0x06, 0x1B, 0x19, 0x1C, 0x06, 0x95, 0x01, 0x06, 0x1C,
+  0x15, 0x1D, 0x06, 0x97, 0x01, 0x06, 0x1B, 0x14, 0x1D, 0x06, 0x98, 0x01, 0x07, 0x1A, 0x03, 0x01,
+  0x0C, 0x01, 0x03, 0x1C, 0x07, 0x99, 0x01, 0x07, 0x19, 0x03, 0x07, 0x03, 0x04, 0x03, 0x1B, 0x07,
+  0x9B, 0x01, 0x08, 0x17, 0x03, 0x07, 0x03, 0x04, 0x03, 0x1A, 0x07, 0x9D, 0x01, 0x08, 0x16, 0x03,
+  0x07, 0x03, 0x04, 0x03, 0x18, 0x08, 0x9F, 0x01, 0x08, 0x15, 0x03, 0x07, 0x03, 0x04, 0x04, 0x16,
+  0x08, 0xA1, 0x01, 0x09, 0x13, 0x03, 0x07, 0x03, 0x05, 0x03, 0x14, 0x09, 0xA4, 0x01, 0x08, 0x12,
+  0x03, 0x07, 0x03, 0x05, 0x03, 0x13, 0x09, 0xA6, 0x01, 0x08, 0x11, 0x03, 0x07, 0x03, 0x05, 0x03,
+  0x12, 0x09, 0xA8, 0x01, 0x09, 0x0F, 0x03, 0x07, 0x03, 0x05, 0x03, 0x10, 0x0C, 0xA7, 0x01, 0x0B,
+  0x0D, 0x03, 0x05, 0x0D, 0x0E, 0x09, 0x02, 0x04, 0xA5, 0x01, 0x0E, 0x0B, 0x15, 0x0C, 0x0A, 0x05,
+  0x03, 0xA3, 0x01, 0x04, 0x02, 0x0C, 0x08, 0x14, 0x0A, 0x0C, 0x07, 0x03, 0xA1, 0x01, 0x04, 0x05,
+  0x0D, 0x06, 0x08, 0x13, 0x0C, 0x0A, 0x03, 0xA0, 0x01, 0x03, 0x08, 0x0E, 0x1A, 0x0E, 0x0D, 0x03,
+  0x9E, 0x01, 0x04, 0x0A, 0x12, 0x0F, 0x11, 0x0F, 0x03, 0x9D, 0x01, 0x04, 0x0D, 0x2E, 0x12, 0x03,
+  0x9B, 0x01, 0x04, 0x11, 0x28, 0x15, 0x04, 0x99, 0x01, 0x04, 0x15, 0x22, 0x19, 0x04, 0x97, 0x01,
+  0x04, 0x1A, 0x1A, 0x1E, 0x04, 0x95, 0x01, 0x04, 0x21, 0x0F, 0x24, 0x04, 0x94, 0x01, 0x03, 0x56,
+  0x03, 0x93, 0x01, 0x03, 0x58, 0x01, 0x94, 0x01, 0x03, 0xB2, 0x01, 0x09, 0x31, 0x03, 0xB5, 0x01,
+  0x01, 0x06, 0x02, 0x2E, 0x04, 0x41, 0x01, 0x0F, 0x01, 0x63, 0x01, 0x07, 0x02, 0x2E, 0x02, 0x42,
+  0x01, 0x0F, 0x01, 0x63, 0x01, 0x08, 0x01, 0x71, 0x02, 0x0E, 0x02, 0x63, 0x01, 0x08, 0x01, 0x71,
+  0x02, 0x0E, 0x02, 0x63, 0x01, 0x08, 0x01, 0x04, 0x03, 0x04, 0x02, 0x07, 0x03, 0x0A, 0x05, 0x07,
+  0x05, 0x0A, 0x03, 0x04, 0x02, 0x07, 0x03, 0x0A, 0x05, 0x08, 0x03, 0x06, 0x08, 0x08, 0x08, 0x07,
+  0x03, 0x55, 0x01, 0x08, 0x01, 0x05, 0x02, 0x02, 0x04, 0x05, 0x01, 0x05, 0x01, 0x06, 0x01, 0x05,
+  0x01, 0x05, 0x01, 0x05, 0x01, 0x0B, 0x02, 0x02, 0x04, 0x05, 0x01, 0x05, 0x01, 0x06, 0x01, 0x05,
+  0x01, 0x06, 0x01, 0x05, 0x01, 0x06, 0x02, 0x0E, 0x02, 0x09, 0x01, 0x05, 0x01, 0x53, 0x01, 0x07,
+  0x02, 0x05, 0x02, 0x05, 0x01, 0x04, 0x01, 0x06, 0x02, 0x04, 0x01, 0x0B, 0x01, 0x12, 0x02, 0x05,
+  0x01, 0x04, 0x01, 0x06, 0x02, 0x04, 0x01, 0x0C, 0x01, 0x06, 0x02, 0x05, 0x02, 0x0E, 0x02, 0x08,
+  0x01, 0x06, 0x02, 0x52, 0x01, 0x07, 0x02, 0x06, 0x01, 0x0A, 0x01, 0x07, 0x01, 0x04, 0x01, 0x0B,
+  0x01, 0x13, 0x01, 0x0A, 0x01, 0x07, 0x01, 0x04, 0x01, 0x0C, 0x01, 0x07, 0x01, 0x05, 0x02, 0x0E,
+  0x02, 0x08, 0x01, 0x07, 0x01, 0x52, 0x01, 0x06, 0x02, 0x07, 0x01, 0x09, 0x02, 0x07, 0x01, 0x04,
+  0x02, 0x0A, 0x02, 0x12, 0x01, 0x09, 0x02, 0x07, 0x01, 0x04, 0x02, 0x0A, 0x02, 0x07, 0x01, 0x05,
+  0x02, 0x0E, 0x02, 0x07, 0x02, 0x07, 0x02, 0x51, 0x07, 0x09, 0x01, 0x09, 0x0A, 0x05, 0x02, 0x0A,
+  0x02, 0x11, 0x01, 0x09, 0x0A, 0x05, 0x02, 0x09, 0x0A, 0x05, 0x02, 0x0E, 0x02, 0x07, 0x02, 0x07,
+  0x02, 0x51, 0x01, 0x0F, 0x01, 0x09, 0x02, 0x0E, 0x03, 0x09, 0x03, 0x0F, 0x01, 0x09, 0x02, 0x0E,
+  0x03, 0x07, 0x02, 0x0D, 0x02, 0x0E, 0x02, 0x07, 0x02, 0x07, 0x02, 0x51, 0x01, 0x0F, 0x01, 0x09,
+  0x02, 0x0F, 0x04, 0x08, 0x04, 0x0D, 0x01, 0x09, 0x02, 0x0F, 0x04, 0x05, 0x02, 0x0D, 0x02, 0x0E,
+  0x02, 0x07, 0x02, 0x07, 0x02, 0x51, 0x01, 0x0F, 0x01, 0x09, 0x02, 0x11, 0x03, 0x09, 0x03, 0x0C,
+  0x01, 0x09, 0x02, 0x11, 0x03, 0x04, 0x02, 0x0D, 0x02, 0x0E, 0x02, 0x07, 0x02, 0x07, 0x02, 0x51,
+  0x01, 0x0F, 0x01, 0x09, 0x02, 0x13, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x09, 0x02, 0x13, 0x01, 0x04,
+  0x02, 0x0D, 0x02, 0x0E, 0x02, 0x07, 0x02, 0x07, 0x02, 0x51, 0x01, 0x0F, 0x01, 0x0A, 0x01, 0x13,
+  0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0A, 0x01, 0x13, 0x01, 0x05, 0x01, 0x0D, 0x02, 0x0E, 0x02, 0x08,
+  0x01, 0x07, 0x01, 0x52, 0x01, 0x0E, 0x02, 0x0A, 0x02, 0x0B, 0x01, 0x06, 0x01, 0x04, 0x01, 0x06,
+  0x01, 0x0B, 0x02, 0x0A, 0x02, 0x0B, 0x01, 0x06, 0x01, 0x05, 0x02, 0x0D, 0x01, 0x0F, 0x01, 0x08,
+  0x01, 0x07, 0x01, 0x52, 0x02, 0x0D, 0x02, 0x0B, 0x06, 0x06, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05,
+  0x01, 0x0C, 0x02, 0x0B, 0x06, 0x06, 0x01, 0x05, 0x01, 0x07, 0x06, 0x08, 0x05, 0x0B, 0x05, 0x05,
+  0x01, 0x05, 0x01, 0x51, 0x05, 0x0B, 0x05, 0x0A, 0x04, 0x08, 0x05, 0x07, 0x05, 0x0C, 0x05, 0x0A,
+  0x04, 0x08, 0x05, 0x09, 0x04, 0x0A, 0x02, 0x0E, 0x02, 0x08, 0x04, 0xF3, 0x1C, 0x03, 0xEE, 0x01,
+  0x02, 0x53, 0x02, 0x16, 0x02, 0x81, 0x01, 0x02, 0x53, 0x02, 0x16, 0x02, 0x81, 0x01, 0x02, 0x53,
+  0x02, 0x16, 0x02, 0x81, 0x01, 0x02, 0x6B, 0x02, 0x81, 0x01, 0x02, 0x6C, 0x01, 0x70, 0x03, 0x04,
+  0x02, 0x08, 0x02, 0x08, 0x04, 0x06, 0x04, 0x05, 0x04, 0x0C, 0x04, 0x0A, 0x08, 0x06, 0x04, 0x07,
+  0x03, 0x05, 0x03, 0x04, 0x02, 0x09, 0x01, 0x71, 0x02, 0x02, 0x06, 0x06, 0x02, 0x06, 0x01, 0x05,
+  0x01, 0x06, 0x02, 0x07, 0x02, 0x0B, 0x01, 0x05, 0x01, 0x07, 0x02, 0x04, 0x02, 0x06, 0x01, 0x05,
+  0x01, 0x07, 0x02, 0x06, 0x02, 0x02, 0x05, 0x08, 0x01, 0x71, 0x01, 0x07, 0x02, 0x06, 0x02, 0x05,
+  0x02, 0x05, 0x02, 0x06, 0x01, 0x07, 0x01, 0x0B, 0x02, 0x05, 0x02, 0x06, 0x01, 0x06, 0x01, 0x05,
+  0x02, 0x05, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x07, 0x01, 0x71, 0x02, 0x07, 0x02, 0x05,
+  0x02, 0x05, 0x01, 0x07, 0x01, 0x06, 0x01, 0x07, 0x01, 0x0B, 0x01, 0x07, 0x01, 0x05, 0x02, 0x06,
+  0x01, 0x05, 0x01, 0x07, 0x01, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x07, 0x01, 0x71, 0x02, 0x07,
+  0x02, 0x05, 0x02, 0x0D, 0x01, 0x06, 0x02, 0x1A, 0x01, 0x05, 0x02, 0x06, 0x01, 0x0D, 0x01, 0x06,
+  0x02, 0x06, 0x02, 0x06, 0x02, 0x79, 0x02, 0x07, 0x02, 0x05, 0x02, 0x0D, 0x01, 0x07, 0x01, 0x05,
+  0x01, 0x14, 0x01, 0x05, 0x02, 0x06, 0x01, 0x0D, 0x01, 0x06, 0x02, 0x06, 0x02, 0x07, 0x01, 0x79,
+  0x02, 0x07, 0x02, 0x05, 0x02, 0x0A, 0x04, 0x07, 0x01, 0x05, 0x01, 0x11, 0x04, 0x06, 0x01, 0x06,
+  0x01, 0x0A, 0x04, 0x06, 0x02, 0x06, 0x02, 0x07, 0x01, 0x79, 0x02, 0x07, 0x02, 0x05, 0x02, 0x07,
+  0x01, 0x05, 0x01, 0x07, 0x02, 0x13, 0x01, 0x05, 0x01, 0x06, 0x02, 0x04, 0x01, 0x08, 0x01, 0x05,
+  0x01, 0x06, 0x02, 0x06, 0x02, 0x07, 0x01, 0x79, 0x02, 0x07, 0x02, 0x05, 0x02, 0x05, 0x02, 0x06,
+  0x01, 0x08, 0x01, 0x03, 0x01, 0x0D, 0x02, 0x06, 0x01, 0x07, 0x05, 0x07, 0x02, 0x06, 0x01, 0x06,
+  0x02, 0x06, 0x02, 0x07, 0x01, 0x79, 0x02, 0x07, 0x02, 0x05, 0x02, 0x05, 0x01, 0x07, 0x01, 0x08,
+  0x01, 0x11, 0x01, 0x07, 0x01, 0x06, 0x01, 0x0C, 0x01, 0x07, 0x01, 0x06, 0x02, 0x06, 0x02, 0x07,
+  0x01, 0x79, 0x02, 0x07, 0x01, 0x06, 0x02, 0x05, 0x01, 0x06, 0x02, 0x09, 0x01, 0x01, 0x01, 0x0E,
+  0x01, 0x06, 0x02, 0x13, 0x01, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x07, 0x01, 0x79, 0x02, 0x07,
+  0x01, 0x06, 0x02, 0x05, 0x01, 0x07, 0x01, 0x09, 0x02, 0x0F, 0x01, 0x07, 0x01, 0x05, 0x01, 0x0D,
+  0x01, 0x07, 0x01, 0x06, 0x02, 0x06, 0x02, 0x07, 0x01, 0x06, 0x02, 0x71, 0x03, 0x05, 0x01, 0x07,
+  0x02, 0x05, 0x03, 0x02, 0x01, 0x02, 0x01, 0x09, 0x02, 0x0F, 0x03, 0x02, 0x01, 0x02, 0x01, 0x06,
+  0x08, 0x05, 0x03, 0x02, 0x01, 0x02, 0x01, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x71,
+  0x02, 0x01, 0x04, 0x08, 0x04, 0x05, 0x03, 0x04, 0x03, 0x19, 0x03, 0x04, 0x03, 0x04, 0x09, 0x05,
+  0x03, 0x04, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x02, 0x71, 0x02, 0x46, 0x01, 0x08,
+  0x02, 0x9D, 0x01, 0x02, 0x27, 0x01, 0x1E, 0x01, 0x09, 0x01, 0x9D, 0x01, 0x02, 0x26, 0x01, 0x1E,
+  0x02, 0x09, 0x01, 0x9D, 0x01, 0x02, 0x46, 0x01, 0x08, 0x01, 0x9E, 0x01, 0x02, 0x22, 0x04, 0x20,
+  0x02, 0x06, 0x01, 0x9E, 0x01, 0x04, 0x21, 0x02, 0x24, 0x05, 0xD8, 0x26,
+};
+
+const image_t endscreen_image =
+{
+  240,                    // width
+  320,                    // height
+  IMAGE_1BPP_RLE,
+  3484,                   // bytes of data
+  endscreen_image_data,
+  NULL,                   // no palette
+  0
+};
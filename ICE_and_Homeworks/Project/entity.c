@@ -0,0 +1,194 @@
+#include "entity.h"
+
+entity_store_t entities;
+
+void entity_reset(void)
+{
+	uint16_t i;
+
+	for (i = 0; i < entities.count; i++)
+	{
+		entities.flags[i] = 0;
+	}
+	entities.count = 0;
+}
+
+entity_t entity_create(
+	entity_type_t type,
+	int16_t x,
+	int16_t y,
+	uint8_t width,
+	uint8_t height
+)
+{
+	entity_t e;
+
+	// reuse the first free slot, else take a new one
+	for (e = 0; e < entities.count; e++)
+	{
+		if (!(entities.flags[e] & ENTITY_ACTIVE))
+		{
+			break;
+		}
+	}
+	if (e == ENTITY_MAX)
+	{
+		return ENTITY_NONE;
+	}
+	if (e == entities.count)
+	{
+		entities.count++;
+	}
+
+	entities.x[e] = x;
+	entities.y[e] = y;
+	entities.vx[e] = 0;
+	entities.vy[e] = 0;
+	entities.width[e] = width;
+	entities.height[e] = height;
+	entities.min_x[e] = INT16_MIN;
+	entities.max_x[e] = INT16_MAX;
+	entities.type[e] = type;
+	entities.flags[e] = ENTITY_ACTIVE | ENTITY_MOVED;
+
+	entities.drawn_x[e] = x;
+	entities.drawn_y[e] = y;
+	entities.image[e] = NULL;
+	entities.image_flags[e] = 0;
+	entities.border[e] = 0;
+	entities.fColor[e] = 0;
+	entities.bColor[e] = 0;
+	return e;
+}
+
+void entity_destroy(entity_t e)
+{
+	if (e >= entities.count)
+	{
+		return;
+	}
+
+	entities.flags[e] = 0;
+
+	// keep the loops short, count stops past the last active slot
+	while (entities.count > 0 && !(entities.flags[entities.count - 1] & ENTITY_ACTIVE))
+	{
+		entities.count--;
+	}
+}
+
+void entity_set_sprite(
+	entity_t e,
+	const image_t *image,
+	uint8_t image_flags,
+	uint16_t fColor,
+	uint16_t bColor
+)
+{
+	entities.image[e] = image;
+	entities.image_flags[e] = image_flags;
+	entities.width[e] = image->width * IMAGE_SCALE(image_flags);
+	entities.height[e] = image->height * IMAGE_SCALE(image_flags);
+	entities.fColor[e] = fColor;
+	entities.bColor[e] = bColor;
+}
+
+void entity_set_box(entity_t e, uint8_t border, uint16_t fColor, uint16_t bColor)
+{
+	entities.image[e] = NULL;
+	entities.border[e] = border;
+	entities.fColor[e] = fColor;
+	entities.bColor[e] = bColor;
+}
+
+//*****************************************************************************
+// One pass over the packed position and velocity arrays
+//*****************************************************************************
+void entity_update(uint8_t types)
+{
+	uint16_t count = entities.count;
+	uint16_t i;
+	int16_t x;
+
+	for (i = 0; i < count; i++)
+	{
+		if (!(entities.flags[i] & ENTITY_ACTIVE) || !(types & ENTITY_MASK(entities.type[i])))
+		{
+			continue;
+		}
+		if (entities.vx[i] == 0 && entities.vy[i] == 0)
+		{
+			continue;
+		}
+
+		x = entities.x[i] + entities.vx[i];
+		if (x >= entities.max_x[i])
+		{
+			x = entities.max_x[i];
+			entities.vx[i] = -entities.vx[i];
+		}
+		else if (x <= entities.min_x[i])
+		{
+			x = entities.min_x[i];
+			entities.vx[i] = -entities.vx[i];
+		}
+		entities.x[i] = x;
+		entities.y[i] += entities.vy[i];
+		entities.flags[i] |= ENTITY_MOVED;
+	}
+}
+
+entity_t entity_collide(entity_t e, uint8_t types)
+{
+	uint16_t count = entities.count;
+	int16_t x0 = entities.x[e];
+	int16_t y0 = entities.y[e];
+	int16_t x1 = x0 + entities.width[e];
+	int16_t y1 = y0 + entities.height[e];
+	uint16_t i;
+
+	for (i = 0; i < count; i++)
+	{
+		if (i == e || !(entities.flags[i] & ENTITY_ACTIVE) || !(types & ENTITY_MASK(entities.type[i])))
+		{
+			continue;
+		}
+		if (entities.x[i] < x1 && x0 < entities.x[i] + entities.width[i] &&
+				entities.y[i] < y1 && y0 < entities.y[i] + entities.height[i])
+		{
+			return i;
+		}
+	}
+	return ENTITY_NONE;
+}
+
+uint16_t entity_cull(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+	uint16_t count = entities.count;
+	uint16_t visible = 0;
+	uint16_t i;
+	bool inside;
+
+	for (i = 0; i < count; i++)
+	{
+		inside = entities.x[i] <= x1 && entities.x[i] + entities.width[i] > x0 &&
+						 entities.y[i] <= y1 && entities.y[i] + entities.height[i] > y0;
+		if (inside && (entities.flags[i] & ENTITY_ACTIVE))
+		{
+			entities.flags[i] |= ENTITY_VISIBLE;
+			visible++;
+		}
+		else
+		{
+			entities.flags[i] &= ~ENTITY_VISIBLE;
+		}
+	}
+	return visible;
+}
+
+void entity_drawn(entity_t e)
+{
+	entities.drawn_x[e] = entities.x[e];
+	entities.drawn_y[e] = entities.y[e];
+	entities.flags[e] &= ~ENTITY_MOVED;
+}
@@ -0,0 +1,147 @@
+#ifndef __ENTITY_H__
+#define __ENTITY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "image.h"
+
+// Most entities alive at once, 28 bytes each
+#ifndef ENTITY_MAX
+#define ENTITY_MAX			16
+#endif
+
+// Handle to an entity, an index into the store's arrays
+typedef uint16_t entity_t;
+#define ENTITY_NONE			0xFFFF
+
+// Type tags.  Loops take a mask of the types they work on.
+typedef enum
+{
+	ENTITY_PLAYER,
+	ENTITY_FISH,
+	ENTITY_SHIELD,
+	ENTITY_BULLET
+} entity_type_t;
+
+#define ENTITY_MASK(type)		(1 << (type))
+#define ENTITY_ALL					0xFF
+
+// entities.flags
+#define ENTITY_ACTIVE				0x01		// slot in use
+#define ENTITY_VISIBLE			0x02		// on screen, see entity_cull
+#define ENTITY_MOVED				0x04		// moved since entity_drawn
+
+//*****************************************************************************
+// Entity store
+//
+// Every entity is a slot across a set of parallel arrays instead of one
+// record, so a loop over one property walks contiguous memory and never
+// loads the rest.  The hot arrays are the ones the update, collision and
+// cull loops read every frame.  The cold ones are only read to draw.
+//
+// Positions are the upper left corner of the bounding box for every type,
+// sprites are drawn centered on it.  Slots are reused, so a handle is only
+// valid until its entity is destroyed.
+//*****************************************************************************
+typedef struct
+{
+	// hot
+	int16_t					x[ENTITY_MAX];
+	int16_t					y[ENTITY_MAX];
+	int8_t					vx[ENTITY_MAX];				// pixels per entity_update
+	int8_t					vy[ENTITY_MAX];
+	uint8_t					width[ENTITY_MAX];
+	uint8_t					height[ENTITY_MAX];
+	int16_t					min_x[ENTITY_MAX];		// x bounces between these
+	int16_t					max_x[ENTITY_MAX];
+	uint8_t					type[ENTITY_MAX];
+	uint8_t					flags[ENTITY_MAX];
+
+	// cold
+	int16_t					drawn_x[ENTITY_MAX];	// where the LCD shows it
+	int16_t					drawn_y[ENTITY_MAX];
+	const image_t		*image[ENTITY_MAX];		// NULL for a box
+	uint8_t					image_flags[ENTITY_MAX];
+	uint8_t					border[ENTITY_MAX];		// box border width
+	uint16_t				fColor[ENTITY_MAX];
+	uint16_t				bColor[ENTITY_MAX];
+
+	uint16_t				count;								// slots at or above are free
+} entity_store_t;
+
+extern entity_store_t entities;
+
+//*****************************************************************************
+// Destroys every entity.
+//*****************************************************************************
+void entity_reset(void);
+
+//*****************************************************************************
+// Adds an entity of the given type and size at rest, free to move anywhere.
+// It is drawn as a box until entity_set_sprite.
+//
+// Returns its handle, or ENTITY_NONE if the store is full.
+//*****************************************************************************
+entity_t entity_create(
+	entity_type_t type,
+	int16_t x,
+	int16_t y,
+	uint8_t width,
+	uint8_t height
+);
+
+void entity_destroy(entity_t e);
+
+//*****************************************************************************
+// Draws the entity as image, image_blit flags and colors as for image_blit.
+// The bounding box takes the image's size.
+//*****************************************************************************
+void entity_set_sprite(
+	entity_t e,
+	const image_t *image,
+	uint8_t image_flags,
+	uint16_t fColor,
+	uint16_t bColor
+);
+
+//*****************************************************************************
+// Draws the entity as a box, see lcd_draw_box.
+//*****************************************************************************
+void entity_set_box(entity_t e, uint8_t border, uint16_t fColor, uint16_t bColor);
+
+//*****************************************************************************
+// Moves every active entity of the types in mask by its velocity.  x stops
+// at min_x and max_x and vx reverses there.
+//*****************************************************************************
+void entity_update(uint8_t types);
+
+//*****************************************************************************
+// Returns the first active entity of the types in mask whose bounding box
+// overlaps e's, or ENTITY_NONE.
+//*****************************************************************************
+entity_t entity_collide(entity_t e, uint8_t types);
+
+//*****************************************************************************
+// Sets ENTITY_VISIBLE on the active entities that reach into the rectangle
+// x0,y0 .. x1,y1 (inclusive) and clears it on the rest.
+//
+// Returns the number visible.
+//*****************************************************************************
+uint16_t entity_cull(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+//*****************************************************************************
+// Records that the LCD now shows the entity where it is.
+//*****************************************************************************
+void entity_drawn(entity_t e);
+
+static __inline int16_t entity_center_x(entity_t e)
+{
+	return entities.x[e] + entities.width[e] / 2;
+}
+
+static __inline int16_t entity_center_y(entity_t e)
+{
+	return entities.y[e] + entities.height[e] / 2;
+}
+
+#endif
@@ -0,0 +1,340 @@
+#include "events.h"
+#include "scene.h"
+#include "TM4C123.h"
+#include "timers.h"
+#include "gpio_port.h"
+#include "accel.h"
+#include "ft6x06.h"
+#include "io_expander.h"
+#include "buttons.h"
+
+// The payload is volatile too, so its stores can not move after the head
+// store that publishes it
+static volatile event_t queue[EVENT_QUEUE_SIZE];
+static volatile uint8_t head = 0;
+static volatile uint8_t tail = 0;
+static volatile uint32_t dropped = 0;
+static uint32_t droppedSeen = 0;
+
+// TIMER4 time outs, events_dispatch hands the scene one sample per tick
+static volatile uint32_t ticks = 0;
+
+// what the interrupts last saw
+static int16_t isrTilt = 0;
+static uint8_t isrTouches = 0;
+static int16_t isrTouchX = 0;
+static int16_t isrTouchY = 0;
+static gesture_state_t gestures;
+static debounce_t buttons;
+
+// the expander buttons are sampled from its INT until they settle
+static bool expanderActive = false;
+
+// what the main loop last saw
+static int16_t tilt = 0;
+static uint8_t touches = 0;
+static uint32_t ticksSeen = 0;
+
+// latency of the frame being drawn
+static bool reacting = false;
+static uint32_t reactFrom;
+static event_latency_t latency = {0, 0, 0xFFFFFFFF, 0, 0};
+
+bool events_push(const event_t *event)
+{
+	uint8_t next = (head + 1) & (EVENT_QUEUE_SIZE - 1);
+
+	if (next == tail)
+	{
+		dropped++;
+		return false;
+	}
+	queue[head] = *event;
+	head = next;
+	return true;
+}
+
+bool events_pop(event_t *event)
+{
+	if (tail == head)
+	{
+		return false;
+	}
+	*event = queue[tail];
+	tail = (tail + 1) & (EVENT_QUEUE_SIZE - 1);
+	return true;
+}
+
+static void push(uint32_t time, event_type_t type, uint8_t code, int16_t x, int16_t y)
+{
+	event_t event;
+
+	event.time = time;
+	event.type = type;
+	event.code = code;
+	event.dir = 0;
+	event.x = x;
+	event.y = y;
+	event.dx = 0;
+	event.dy = 0;
+	events_push(&event);
+}
+
+static void push_buttons(uint32_t time, event_type_t type, uint8_t mask)
+{
+	uint8_t i;
+
+	for (i = 0; mask != 0; i++, mask >>= 1)
+	{
+		if (mask & 1)
+		{
+			push(time, type, i, 0, 0);
+		}
+	}
+}
+
+//*****************************************************************************
+// TIMER4, the accelerometer and the buttons
+//*****************************************************************************
+static void tick_isr(void)
+{
+	uint32_t now = timebase_now();
+	int16_t x = accel_read_x();
+	uint8_t raw = buttons_read_launchpad();
+	uint8_t valid = BUTTONS_LAUNCHPAD_M;
+	debounce_events_t changes;
+
+	ticks++;
+
+	// the expander's one transfer this tick, an LED change can take the
+	// place of a button sample
+	if (io_expander_tick(expanderActive))
+	{
+		// port B reads low for a pressed button
+		raw |= ~io_expander_buttons() & BUTTONS_EXPANDER_M;
+		valid |= BUTTONS_EXPANDER_M;
+	}
+	if (debounce_sample(&buttons, raw, valid, &changes))
+	{
+		push_buttons(now, EVENT_BUTTON_DOWN, changes.pressed);
+		push_buttons(now, EVENT_BUTTON_UP, changes.released);
+		push_buttons(now, EVENT_BUTTON_LONG, changes.long_pressed);
+		push_buttons(now, EVENT_BUTTON_REPEAT, changes.repeated);
+	}
+	if ((valid & BUTTONS_EXPANDER_M) && debounce_settled(&buttons, BUTTONS_EXPANDER_M))
+	{
+		expanderActive = false;
+	}
+
+	if (x - isrTilt >= EVENT_TILT_STEP || isrTilt - x >= EVENT_TILT_STEP)
+	{
+		push(now, EVENT_TILT, 0, x, 0);
+		isrTilt = x;
+	}
+}
+
+//*****************************************************************************
+// The FT6x06 INT, one new report
+//*****************************************************************************
+static void touch_isr(uint32_t now)
+{
+	ft6x06_report_t report;
+	gesture_t gesture;
+	event_t event;
+
+	if (!ft6x06_read_report(&report))
+	{
+		return;
+	}
+
+	if (report.count > 0)
+	{
+		if (isrTouches == 0)
+		{
+			push(now, EVENT_TOUCH_BEGIN, report.count, report.x[0], report.y[0]);
+		}
+		else if (report.x[0] != isrTouchX || report.y[0] != isrTouchY || report.count != isrTouches)
+		{
+			push(now, EVENT_TOUCH_MOVE, report.count, report.x[0], report.y[0]);
+		}
+		isrTouchX = report.x[0];
+		isrTouchY = report.y[0];
+	}
+	else if (isrTouches > 0)
+	{
+		push(now, EVENT_TOUCH_END, 0, isrTouchX, isrTouchY);
+	}
+	isrTouches = report.count;
+
+	if (gesture_feed(&gestures, now, report.count, report.x, report.y, &gesture))
+	{
+		event.time = now;
+		event.type = EVENT_GESTURE;
+		event.code = gesture.type;
+		event.dir = gesture.dir;
+		event.x = gesture.x;
+		event.y = gesture.y;
+		event.dx = gesture.dx;
+		event.dy = gesture.dy;
+		events_push(&event);
+	}
+}
+
+//*****************************************************************************
+// The MCP23017 INT, a button changed.  Reading the capture clears the INT,
+// the buttons are sampled from the next tick until they settle.
+//*****************************************************************************
+static void buttons_isr(void)
+{
+	uint8_t intf;
+	uint8_t intcap;
+
+	io_expander_irq(&intf, &intcap);
+	expanderActive = true;
+}
+
+//*****************************************************************************
+// GPIOF, both INT lines are on port F
+//*****************************************************************************
+static void port_f_isr(uint8_t pins)
+{
+	uint32_t now = timebase_now();
+
+	if (pins & IO_EXPANDER_IRQ_PIN_NUM)
+	{
+		buttons_isr();
+	}
+	if (pins & FT6X06_IRQ_PIN_NUM)
+	{
+		touch_isr(now);
+	}
+}
+
+void events_init(void)
+{
+	isrTilt = accel_read_x();
+	tilt = isrTilt;
+	ticksSeen = ticks;
+	gesture_init(&gestures, NULL);
+	debounce_init(&buttons, EVENT_LONG_MS / EVENT_TICK_MS, EVENT_REPEAT_MS / EVENT_TICK_MS);
+	timer4a_hook = tick_isr;
+	gpiof_hook = port_f_isr;
+}
+
+void events_dispatch(void)
+{
+	event_t event;
+	gesture_t gesture;
+	uint8_t frameTouches = touches;
+	uint32_t n;
+
+	while (events_pop(&event))
+	{
+		if (!reacting)
+		{
+			reacting = true;
+			reactFrom = event.time;
+		}
+
+		switch (event.type)
+		{
+			case EVENT_BUTTON_REPEAT:
+				// a held left or right keeps cycling the colors
+				if (event.code != DIR_BTN_LEFT_PIN && event.code != DIR_BTN_RIGHT_PIN)
+				{
+					break;
+				}
+				// falls through
+			case EVENT_BUTTON_DOWN:
+				// the game takes the port B value with the one button low
+				if (event.code <= DIR_BTN_RIGHT_PIN)
+				{
+					scene_button(BTN_NONE & ~(1 << event.code));
+				}
+				break;
+
+			case EVENT_TOUCH_BEGIN:
+			case EVENT_TOUCH_MOVE:
+				touches = event.code;
+				break;
+
+			case EVENT_TOUCH_END:
+				touches = 0;
+				break;
+
+			case EVENT_TILT:
+				tilt = event.x;
+				break;
+
+			case EVENT_GESTURE:
+				gesture.type = event.code;
+				gesture.dir = event.dir;
+				gesture.x = event.x;
+				gesture.y = event.y;
+				gesture.dx = event.dx;
+				gesture.dy = event.dy;
+				scene_gesture(&gesture);
+				break;
+
+			default:
+				break;
+		}
+
+		// a tap that begins and ends within one frame still counts
+		frameTouches = (touches > frameTouches) ? touches : frameTouches;
+	}
+
+	n = ticks - ticksSeen;
+	ticksSeen += n;
+	if (n > EVENT_TICKS_MAX)
+	{
+		n = EVENT_TICKS_MAX;
+	}
+	while (n-- > 0)
+	{
+		scene_sample(tilt, frameTouches);
+	}
+}
+
+void events_reacted(void)
+{
+	uint32_t elapsed;
+
+	if (!reacting)
+	{
+		return;
+	}
+	reacting = false;
+
+	elapsed = (timebase_now() - reactFrom) / TIMEBASE_TICKS_PER_US;
+	latency.frames++;
+	latency.total += elapsed;
+	latency.min = (elapsed < latency.min) ? elapsed : latency.min;
+	latency.max = (elapsed > latency.max) ? elapsed : latency.max;
+}
+
+void events_latency(event_latency_t *out)
+{
+	uint32_t total = dropped;
+
+	*out = latency;
+	out->dropped = total - droppedSeen;
+	droppedSeen = total;
+
+	latency.frames = 0;
+	latency.total = 0;
+	latency.min = 0xFFFFFFFF;
+	latency.max = 0;
+}
+
+void events_hold(void)
+{
+	NVIC_DisableIRQ(TIMER4A_IRQn);
+	NVIC_DisableIRQ(GPIOF_IRQn);
+}
+
+void events_release(void)
+{
+	NVIC_EnableIRQ(TIMER4A_IRQn);
+	NVIC_EnableIRQ(GPIOF_IRQn);
+}
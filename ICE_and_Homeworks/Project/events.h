@@ -0,0 +1,130 @@
+#ifndef __EVENTS_H__
+#define __EVENTS_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gesture.h"
+#include "debounce.h"
+
+// Events the queue holds, a power of 2
+#define EVENT_QUEUE_SIZE		32
+
+// accelerometer x counts the tilt has to move for an EVENT_TILT
+#define EVENT_TILT_STEP			250
+
+// TIMER4 ticks handed to the scene per frame at most, the rest are dropped
+#define EVENT_TICKS_MAX			8
+
+// the TIMER4 period, and how long a button is held for a long press and
+// then for each repeat
+#define EVENT_TICK_MS				8
+#define EVENT_LONG_MS				500
+#define EVENT_REPEAT_MS			150
+
+// event_t types
+typedef enum
+{
+	EVENT_BUTTON_DOWN,				// code is the DIR_BTN_*_PIN or BUTTON_SW1/2
+	EVENT_BUTTON_UP,
+	EVENT_BUTTON_LONG,
+	EVENT_BUTTON_REPEAT,
+	EVENT_TOUCH_BEGIN,				// x and y are the first touch point
+	EVENT_TOUCH_MOVE,
+	EVENT_TOUCH_END,
+	EVENT_TILT,								// x is the accelerometer x
+	EVENT_GESTURE							// code is the gesture_type_t, the rest as
+														// in gesture_t
+} event_type_t;
+
+typedef struct
+{
+	uint32_t	time;						// timebase_now in the interrupt
+	uint8_t		type;
+	uint8_t		code;
+	uint8_t		dir;
+	int16_t		x;
+	int16_t		y;
+	int16_t		dx;
+	int16_t		dy;
+} event_t;
+
+// Input to reaction latency, in microseconds
+typedef struct
+{
+	uint32_t	frames;					// frames that reacted to an event
+	uint32_t	total;
+	uint32_t	min;
+	uint32_t	max;
+	uint32_t	dropped;				// events lost to a full queue
+} event_latency_t;
+
+//*****************************************************************************
+// Input events
+//
+// The TIMER4 interrupt reads the accelerometer and debounces the push
+// buttons, and the port F interrupt reads the touch screen when the
+// FT6x06's INT fires.  The expander's buttons are only read while they are
+// settling: its INT starts the sampling and the debouncer stops it once
+// they read steady, see debounce.h.  They queue what changed, stamped with the
+// timebase, so an input is seen when it happens and not when the main loop
+// gets around to it.  The touch reports also run through a gesture
+// recognizer, see gesture.h.  The main loop takes everything queued once per
+// frame with events_dispatch.
+//
+// The queue is lock free with one producer and one consumer: only the
+// interrupts write head and only events_dispatch writes tail.  Both
+// interrupts run at priority 2 so they never preempt each other and count
+// as the one producer.
+//
+// The interrupts share I2C1 with the EEPROM.  Main loop code that uses
+// I2C1 goes between events_hold and events_release.  The LEDs are set
+// through the expander's shadow and written by the tick, see io_expander.h.
+//*****************************************************************************
+
+//*****************************************************************************
+// Hooks the interrupts up.  Call after accel_initialize, ft6x06_init_irq and
+// io_expander_init.
+//*****************************************************************************
+void events_init(void);
+
+//*****************************************************************************
+// Adds an event.  Only from the priority 2 interrupts.
+//
+// Returns false if the queue was full and the event was dropped.
+//*****************************************************************************
+bool events_push(const event_t *event);
+
+//*****************************************************************************
+// Takes the oldest event.  Only from the main loop.
+//
+// Returns false if the queue is empty.
+//*****************************************************************************
+bool events_pop(event_t *event);
+
+//*****************************************************************************
+// Hands every queued button press and gesture to the current scene, a held
+// left or right repeats as more presses.  Then one
+// sample per TIMER4 tick since the last call with the latest tilt and touch
+// count.  Call once per frame, before the scene renders.
+//*****************************************************************************
+void events_dispatch(void);
+
+//*****************************************************************************
+// Call once the frame events_dispatch handed input to has been drawn.  The
+// time from the oldest event it handed over goes into the latency.
+//*****************************************************************************
+void events_reacted(void);
+
+//*****************************************************************************
+// Copies out the latency since the last call and starts over.
+//*****************************************************************************
+void events_latency(event_latency_t *latency);
+
+//*****************************************************************************
+// Keeps the input interrupts off I2C1 while the main loop uses it.  Anything
+// that comes in meanwhile is handled on events_release.
+//*****************************************************************************
+void events_hold(void);
+void events_release(void);
+
+#endif
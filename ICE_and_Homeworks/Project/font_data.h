@@ -0,0 +1,19 @@
+#ifndef __FONT_DATA_H__
+#define __FONT_DATA_H__
+
+#include "fonts.h"
+
+// Font ids, in the order init_hardware registers the fonts
+#define FONT_SANS8          0
+#define FONT_SANS8_BOLD     1
+#define FONT_SANS8_X2       2
+
+// Regenerate with:
+//    fontconv -n font_sans8 fonts/ms_sans_8.bdf > font_sans8.c
+//    fontconv -n font_sans8_bold -b fonts/ms_sans_8.bdf > font_sans8_bold.c
+//    fontconv -n font_sans8_x2 -s 2 fonts/ms_sans_8.bdf > font_sans8_x2.c
+extern const font_t font_sans8;
+extern const font_t font_sans8_bold;
+extern const font_t font_sans8_x2;
+
+#endif
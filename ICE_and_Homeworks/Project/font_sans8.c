@@ -0,0 +1,306 @@
+// Generated by tools/fontconv from fonts/ms_sans_8.bdf
+// Do not edit by hand, regenerate the file instead.
+
+#include "fonts.h"
+
+static const uint8_t font_sans8_runs[] =
+{
+  /* ' ' */
+  42, 
+  /* '0' */
+  7, 3, 2, 1, 3, 1, 1, 1, 3, 1, 1, 1, 3, 1, 1, 1,
+  3, 1, 1, 1, 3, 1, 1, 1, 3, 1, 1, 1, 3, 1, 2, 3,
+  26, 
+  /* '1' */
+  5, 1, 2, 2, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1,
+  2, 3, 17, 
+  /* '2' */
+  7, 3, 2, 1, 3, 1, 5, 1, 4, 1, 4, 1, 4, 1, 4, 1,
+  5, 1, 5, 5, 25, 
+  /* '3' */
+  7, 3, 2, 1, 3, 1, 5, 1, 5, 1, 2, 3, 6, 1, 5, 1,
+  1, 1, 3, 1, 2, 3, 26, 
+  /* '4' */
+  11, 1, 5, 2, 4, 1, 1, 1, 3, 1, 2, 1, 2, 1, 3, 1,
+  2, 6, 5, 1, 6, 1, 6, 1, 30, 
+  /* '5' */
+  6, 5, 1, 1, 5, 1, 5, 1, 1, 2, 2, 2, 2, 1, 1, 1,
+  3, 1, 5, 1, 1, 1, 3, 1, 2, 3, 26, 
+  /* '6' */
+  9, 1, 4, 1, 4, 1, 4, 4, 2, 1, 3, 1, 1, 1, 3, 1,
+  1, 1, 3, 1, 1, 1, 3, 1, 2, 3, 26, 
+  /* '7' */
+  8, 7, 6, 1, 6, 1, 7, 1, 6, 1, 7, 1, 6, 1, 7, 1,
+  7, 1, 37, 
+  /* '8' */
+  7, 3, 2, 1, 3, 1, 1, 1, 3, 1, 1, 1, 3, 1, 2, 3,
+  2, 1, 3, 1, 1, 1, 3, 1, 1, 1, 3, 1, 2, 3, 26, 
+  /* '9' */
+  7, 3, 2, 1, 3, 1, 1, 1, 3, 1, 1, 1, 3, 1, 1, 1,
+  3, 1, 2, 4, 4, 1, 4, 1, 4, 1, 28, 
+  /* 'A' */
+  12, 1, 7, 1, 6, 1, 1, 1, 5, 1, 1, 1, 4, 1, 2, 1,
+  4, 4, 3, 1, 4, 1, 2, 1, 4, 1, 1, 1, 5, 1, 33, 
+  /* 'B' */
+  6, 4, 2, 1, 3, 1, 1, 1, 3, 1, 1, 1, 3, 1, 1, 4,
+  2, 1, 2, 1, 2, 1, 3, 1, 1, 1, 3, 1, 1, 4, 26, 
+  /* 'C' */
+  10, 3, 3, 1, 2, 1, 2, 1, 6, 1, 5, 1, 6, 1, 6, 1,
+  6, 1, 4, 1, 2, 4, 30, 
+  /* 'D' */
+  8, 2, 6, 1, 1, 2, 4, 1, 3, 1, 3, 1, 4, 1, 2, 1,
+  5, 1, 1, 1, 5, 1, 1, 1, 5, 1, 1, 1, 4, 1, 3, 4,
+  35, 
+  /* 'E' */
+  7, 6, 1, 1, 6, 1, 6, 1, 6, 6, 1, 1, 6, 1, 6, 1,
+  7, 5, 29, 
+  /* 'F' */
+  7, 6, 1, 1, 6, 1, 6, 1, 6, 5, 2, 1, 6, 1, 6, 1,
+  6, 1, 34, 
+  /* 'G' */
+  10, 3, 4, 1, 3, 1, 3, 1, 6, 1, 7, 1, 1, 5, 1, 1,
+  5, 1, 1, 1, 5, 1, 1, 1, 4, 1, 3, 4, 35, 
+  /* 'H' */
+  8, 1, 5, 1, 1, 1, 5, 1, 1, 1, 5, 1, 1, 1, 5, 1,
+  1, 7, 1, 1, 5, 1, 1, 1, 5, 1, 1, 1, 5, 1, 1, 1,
+  5, 1, 33, 
+  /* 'I' */
+  6, 5, 3, 1, 5, 1, 5, 1, 5, 1, 5, 1, 5, 1, 5, 1,
+  3, 5, 25, 
+  /* 'J' */
+  10, 5, 5, 1, 7, 1, 7, 1, 7, 1, 7, 1, 3, 1, 3, 1,
+  3, 1, 3, 1, 4, 4, 35, 
+  /* 'K' */
+  7, 1, 4, 1, 1, 1, 3, 1, 2, 1, 2, 1, 3, 3, 4, 2,
+  5, 2, 5, 1, 1, 1, 4, 1, 2, 1, 3, 1, 3, 2, 29, 
+  /* 'L' */
+  6, 1, 5, 1, 5, 1, 5, 1, 5, 1, 5, 1, 5, 1, 5, 1,
+  5, 5, 25, 
+  /* 'M' */
+  12, 1, 3, 1, 5, 1, 3, 1, 5, 1, 3, 1, 4, 1, 1, 1,
+  1, 2, 4, 1, 1, 1, 1, 1, 1, 1, 3, 1, 1, 1, 1, 1,
+  1, 1, 3, 1, 1, 1, 1, 1, 1, 1, 2, 1, 3, 1, 3, 1,
+  1, 1, 3, 1, 3, 1, 41, 
+  /* 'N' */
+  9, 1, 6, 1, 1, 2, 5, 1, 1, 1, 1, 1, 4, 1, 1, 1,
+  2, 1, 3, 1, 1, 1, 2, 1, 3, 1, 1, 1, 3, 1, 2, 1,
+  1, 1, 4, 1, 1, 1, 1, 1, 5, 2, 1, 1, 6, 1, 37, 
+  /* 'O' */
+  12, 3, 5, 1, 3, 1, 3, 1, 5, 1, 1, 1, 6, 1, 1, 1,
+  6, 1, 1, 1, 6, 1, 1, 1, 5, 1, 3, 1, 4, 1, 4, 4,
+  39, 
+  /* 'P' */
+  5, 3, 2, 1, 2, 1, 1, 1, 2, 1, 1, 1, 2, 1, 1, 1,
+  2, 1, 1, 3, 2, 1, 4, 1, 4, 1, 24, 
+  /* 'Q' */
+  11, 4, 4, 1, 4, 1, 2, 1, 6, 1, 1, 1, 6, 1, 1, 1,
+  6, 1, 1, 1, 6, 1, 1, 1, 3, 1, 2, 1, 2, 1, 3, 3,
+  3, 5, 8, 2, 8, 1, 19, 
+  /* 'R' */
+  6, 3, 3, 1, 2, 1, 2, 1, 3, 1, 1, 1, 3, 1, 1, 1,
+  3, 1, 1, 4, 2, 1, 1, 1, 3, 1, 2, 1, 2, 1, 3, 1,
+  25, 
+  /* 'S' */
+  11, 4, 3, 1, 6, 1, 7, 1, 8, 4, 8, 1, 7, 1, 1, 1,
+  4, 1, 3, 4, 35, 
+  /* 'T' */
+  8, 7, 4, 1, 7, 1, 7, 1, 7, 1, 7, 1, 7, 1, 7, 1,
+  7, 1, 36, 
+  /* 'U' */
+  8, 1, 5, 1, 1, 1, 5, 1, 1, 1, 5, 1, 1, 1, 5, 1,
+  1, 1, 5, 1, 1, 1, 5, 1, 1, 1, 5, 1, 2, 1, 3, 1,
+  4, 3, 35, 
+  /* 'V' */
+  8, 1, 5, 1, 1, 1, 5, 1, 1, 1, 4, 1, 3, 1, 3, 1,
+  3, 1, 3, 1, 4, 1, 1, 1, 5, 1, 1, 1, 5, 2, 7, 1,
+  36, 
+  /* 'W' */
+  12, 1, 4, 1, 4, 1, 1, 1, 4, 1, 4, 1, 2, 1, 3, 1,
+  3, 1, 3, 1, 2, 1, 1, 1, 2, 1, 3, 1, 2, 1, 1, 1,
+  2, 1, 3, 1, 1, 1, 2, 1, 1, 1, 4, 1, 1, 1, 2, 1,
+  1, 1, 5, 1, 3, 1, 1, 1, 5, 1, 4, 1, 52, 
+  /* 'X' */
+  9, 1, 6, 1, 2, 1, 4, 1, 4, 1, 2, 1, 6, 2, 7, 2,
+  7, 2, 6, 1, 2, 1, 4, 1, 4, 1, 2, 1, 6, 1, 37, 
+  /* 'Y' */
+  8, 1, 5, 1, 2, 1, 3, 1, 3, 1, 3, 1, 4, 1, 2, 1,
+  4, 1, 1, 1, 6, 2, 6, 1, 7, 1, 6, 1, 37, 
+  /* 'Z' */
+  9, 8, 7, 1, 7, 1, 7, 1, 7, 1, 7, 1, 7, 1, 7, 1,
+  8, 8, 37, 
+  /* 'a' */
+  30, 3, 3, 1, 2, 1, 2, 1, 3, 1, 2, 1, 3, 1, 2, 1,
+  3, 1, 3, 3, 1, 1, 29, 
+  /* 'b' */
+  0, 1, 5, 1, 5, 1, 5, 1, 5, 4, 2, 1, 3, 1, 1, 1,
+  3, 1, 1, 1, 3, 1, 1, 1, 3, 1, 1, 4, 26, 
+  /* 'c' */
+  26, 2, 3, 1, 2, 1, 1, 1, 5, 1, 5, 1, 3, 1, 2, 3,
+  26, 
+  /* 'd' */
+  4, 1, 5, 1, 5, 1, 5, 1, 2, 4, 1, 1, 3, 1, 1, 1,
+  3, 1, 1, 1, 3, 1, 1, 1, 3, 1, 2, 4, 25, 
+  /* 'e' */
+  25, 3, 2, 1, 3, 1, 1, 1, 2, 1, 2, 3, 3, 1, 3, 1,
+  2, 3, 26, 
+  /* 'f' */
+  3, 2, 3, 1, 5, 1, 5, 1, 3, 5, 3, 1, 5, 1, 5, 1,
+  5, 1, 5, 1, 27, 
+  /* 'g' */
+  26, 2, 3, 1, 2, 1, 1, 1, 3, 1, 1, 1, 3, 1, 1, 1,
+  3, 1, 2, 4, 5, 1, 5, 1, 1, 4, 8, 
+  /* 'h' */
+  0, 1, 5, 1, 5, 1, 5, 1, 5, 1, 1, 2, 2, 2, 2, 1,
+  1, 1, 3, 1, 1, 1, 3, 1, 1, 1, 3, 1, 1, 1, 3, 1,
+  25, 
+  /* 'i' */
+  4, 1, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 
+  /* 'j' */
+  13, 1, 9, 1, 4, 1, 4, 1, 4, 1, 4, 1, 4, 1, 4, 1,
+  4, 1, 1, 1, 2, 1, 2, 2, 2, 
+  /* 'k' */
+  0, 1, 5, 1, 5, 1, 5, 1, 5, 1, 2, 1, 2, 1, 1, 1,
+  3, 3, 3, 2, 1, 1, 2, 1, 2, 1, 2, 1, 3, 1, 25, 
+  /* 'l' */
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 9, 
+  /* 'm' */
+  32, 1, 1, 1, 2, 1, 2, 2, 1, 2, 1, 1, 1, 1, 2, 1,
+  2, 1, 1, 1, 2, 1, 2, 1, 1, 1, 2, 1, 2, 1, 1, 1,
+  2, 1, 2, 1, 33, 
+  /* 'n' */
+  24, 1, 1, 2, 2, 2, 2, 1, 1, 1, 3, 1, 1, 1, 3, 1,
+  1, 1, 3, 1, 1, 1, 3, 1, 25, 
+  /* 'o' */
+  25, 3, 2, 1, 3, 1, 1, 1, 3, 1, 1, 1, 3, 1, 1, 1,
+  3, 1, 2, 3, 26, 
+  /* 'p' */
+  24, 4, 2, 1, 3, 1, 1, 1, 3, 1, 1, 1, 3, 1, 1, 1,
+  3, 1, 1, 4, 2, 1, 5, 1, 5, 1, 11, 
+  /* 'q' */
+  26, 3, 2, 1, 2, 1, 1, 1, 3, 1, 1, 1, 3, 1, 1, 1,
+  3, 1, 2, 4, 5, 1, 5, 1, 5, 1, 7, 
+  /* 'r' */
+  20, 1, 1, 2, 1, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 1,
+  4, 1, 24, 
+  /* 's' */
+  25, 4, 1, 1, 3, 1, 2, 2, 6, 1, 6, 1, 1, 4, 26, 
+  /* 't' */
+  14, 1, 5, 1, 3, 5, 3, 1, 5, 1, 5, 1, 5, 1, 5, 1,
+  27, 
+  /* 'u' */
+  24, 1, 3, 1, 1, 1, 3, 1, 1, 1, 3, 1, 1, 1, 3, 1,
+  1, 1, 3, 1, 2, 4, 25, 
+  /* 'v' */
+  24, 1, 3, 1, 1, 1, 3, 1, 2, 1, 1, 1, 3, 1, 1, 1,
+  4, 1, 5, 1, 27, 
+  /* 'w' */
+  32, 1, 2, 1, 2, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 2,
+  1, 1, 2, 1, 1, 2, 1, 1, 3, 1, 1, 1, 1, 1, 3, 1,
+  2, 1, 35, 
+  /* 'x' */
+  28, 1, 4, 1, 2, 1, 2, 1, 4, 2, 5, 2, 4, 1, 2, 1,
+  2, 1, 4, 1, 29, 
+  /* 'y' */
+  28, 1, 4, 1, 2, 1, 2, 1, 3, 1, 2, 1, 4, 2, 5, 2,
+  5, 1, 6, 1, 5, 1, 6, 1, 12, 
+  /* 'z' */
+  20, 4, 4, 1, 3, 1, 3, 1, 3, 1, 4, 4, 21, 
+};
+
+static const font_glyph_t font_sans8_glyphs[] =
+{
+  { 3,  3,     0,   1},   /* fallback */
+  { 3,  3,     0,   1},   /* ' ' */
+  { 6,  6,     1,  33},   /* '0' */
+  { 4,  4,    34,  19},   /* '1' */
+  { 6,  6,    53,  21},   /* '2' */
+  { 6,  6,    74,  23},   /* '3' */
+  { 7,  7,    97,  25},   /* '4' */
+  { 6,  6,   122,  27},   /* '5' */
+  { 6,  6,   149,  27},   /* '6' */
+  { 8,  8,   176,  19},   /* '7' */
+  { 6,  6,   195,  31},   /* '8' */
+  { 6,  6,   226,  27},   /* '9' */
+  { 8,  8,   253,  31},   /* 'A' */
+  { 6,  6,   284,  31},   /* 'B' */
+  { 7,  7,   315,  23},   /* 'C' */
+  { 8,  8,   338,  33},   /* 'D' */
+  { 7,  7,   371,  19},   /* 'E' */
+  { 7,  7,   390,  19},   /* 'F' */
+  { 8,  8,   409,  29},   /* 'G' */
+  { 8,  8,   438,  35},   /* 'H' */
+  { 6,  6,   473,  19},   /* 'I' */
+  { 8,  8,   492,  23},   /* 'J' */
+  { 7,  7,   515,  31},   /* 'K' */
+  { 6,  6,   546,  19},   /* 'L' */
+  {10, 10,   565,  55},   /* 'M' */
+  { 9,  9,   620,  47},   /* 'N' */
+  { 9,  9,   667,  33},   /* 'O' */
+  { 5,  5,   700,  27},   /* 'P' */
+  { 9,  9,   727,  39},   /* 'Q' */
+  { 6,  6,   766,  33},   /* 'R' */
+  { 8,  8,   799,  21},   /* 'S' */
+  { 8,  8,   820,  19},   /* 'T' */
+  { 8,  8,   839,  35},   /* 'U' */
+  { 8,  8,   874,  33},   /* 'V' */
+  {12, 12,   907,  61},   /* 'W' */
+  { 9,  9,   968,  31},   /* 'X' */
+  { 8,  8,   999,  29},   /* 'Y' */
+  { 9,  9,  1028,  19},   /* 'Z' */
+  { 7,  7,  1047,  23},   /* 'a' */
+  { 6,  6,  1070,  29},   /* 'b' */
+  { 6,  6,  1099,  17},   /* 'c' */
+  { 6,  6,  1116,  29},   /* 'd' */
+  { 6,  6,  1145,  19},   /* 'e' */
+  { 6,  6,  1164,  21},   /* 'f' */
+  { 6,  6,  1185,  27},   /* 'g' */
+  { 6,  6,  1212,  33},   /* 'h' */
+  { 2,  2,  1245,  15},   /* 'i' */
+  { 5,  5,  1260,  25},   /* 'j' */
+  { 6,  6,  1285,  31},   /* 'k' */
+  { 2,  2,  1316,  21},   /* 'l' */
+  { 8,  8,  1337,  37},   /* 'm' */
+  { 6,  6,  1374,  25},   /* 'n' */
+  { 6,  6,  1399,  21},   /* 'o' */
+  { 6,  6,  1420,  27},   /* 'p' */
+  { 6,  6,  1447,  27},   /* 'q' */
+  { 5,  5,  1474,  19},   /* 'r' */
+  { 6,  6,  1493,  15},   /* 's' */
+  { 6,  6,  1508,  17},   /* 't' */
+  { 6,  6,  1525,  23},   /* 'u' */
+  { 6,  6,  1548,  21},   /* 'v' */
+  { 8,  8,  1569,  35},   /* 'w' */
+  { 7,  7,  1604,  21},   /* 'x' */
+  { 7,  7,  1625,  25},   /* 'y' */
+  { 5,  5,  1650,  13},   /* 'z' */
+};
+
+static const uint8_t font_sans8_map[256] =
+{
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    2,   3,   4,   5,   6,   7,   8,   9,  10,  11,   0,   0,   0,   0,   0,   0,
+    0,  12,  13,  14,  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,
+   27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,   0,   0,   0,   0,   0,
+    0,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  51,  52,
+   53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+};
+
+const font_t font_sans8 =
+{
+  14,                    // height
+  64,                    // glyph count, including the fallback
+  font_sans8_map,
+  font_sans8_glyphs,
+  font_sans8_runs
+};
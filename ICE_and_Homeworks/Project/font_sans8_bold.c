@@ -0,0 +1,297 @@
+// Generated by tools/fontconv from fonts/ms_sans_8.bdf (bold)
+// Do not edit by hand, regenerate the file instead.
+
+#include "fonts.h"
+
+static const uint8_t font_sans8_bold_runs[] =
+{
+  /* ' ' */
+  56, 
+  /* '0' */
+  8, 4, 2, 2, 2, 2, 1, 2, 2, 2, 1, 2, 2, 2, 1, 2,
+  2, 2, 1, 2, 2, 2, 1, 2, 2, 2, 1, 2, 2, 2, 2, 4,
+  30, 
+  /* '1' */
+  6, 2, 2, 3, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2,
+  2, 4, 21, 
+  /* '2' */
+  8, 4, 2, 2, 2, 2, 5, 2, 4, 2, 4, 2, 4, 2, 4, 2,
+  5, 2, 5, 6, 29, 
+  /* '3' */
+  8, 4, 2, 2, 2, 2, 5, 2, 5, 2, 2, 4, 6, 2, 5, 2,
+  1, 2, 2, 2, 2, 4, 30, 
+  /* '4' */
+  12, 2, 5, 3, 4, 4, 3, 2, 1, 2, 2, 2, 2, 2, 2, 7,
+  5, 2, 6, 2, 6, 2, 34, 
+  /* '5' */
+  7, 6, 1, 2, 5, 2, 5, 5, 2, 3, 1, 2, 1, 2, 2, 2,
+  5, 2, 1, 2, 2, 2, 2, 4, 30, 
+  /* '6' */
+  10, 2, 4, 2, 4, 2, 4, 5, 2, 2, 2, 2, 1, 2, 2, 2,
+  1, 2, 2, 2, 1, 2, 2, 2, 2, 4, 30, 
+  /* '7' */
+  9, 8, 6, 2, 6, 2, 7, 2, 6, 2, 7, 2, 6, 2, 7, 2,
+  7, 2, 41, 
+  /* '8' */
+  8, 4, 2, 2, 2, 2, 1, 2, 2, 2, 1, 2, 2, 2, 2, 4,
+  2, 2, 2, 2, 1, 2, 2, 2, 1, 2, 2, 2, 2, 4, 30, 
+  /* '9' */
+  8, 4, 2, 2, 2, 2, 1, 2, 2, 2, 1, 2, 2, 2, 1, 2,
+  2, 2, 2, 5, 4, 2, 4, 2, 4, 2, 32, 
+  /* 'A' */
+  13, 2, 7, 2, 6, 4, 5, 4, 4, 2, 1, 2, 4, 5, 3, 2,
+  3, 2, 2, 2, 3, 2, 1, 2, 4, 2, 37, 
+  /* 'B' */
+  7, 5, 2, 2, 2, 2, 1, 2, 2, 2, 1, 2, 2, 2, 1, 5,
+  2, 2, 1, 2, 2, 2, 2, 2, 1, 2, 2, 2, 1, 5, 30, 
+  /* 'C' */
+  11, 4, 3, 2, 1, 2, 2, 2, 6, 2, 5, 2, 6, 2, 6, 2,
+  6, 2, 3, 2, 2, 5, 34, 
+  /* 'D' */
+  9, 3, 6, 5, 4, 2, 2, 2, 3, 2, 3, 2, 2, 2, 4, 2,
+  1, 2, 4, 2, 1, 2, 4, 2, 1, 2, 3, 2, 3, 5, 39, 
+  /* 'E' */
+  8, 7, 1, 2, 6, 2, 6, 2, 6, 7, 1, 2, 6, 2, 6, 2,
+  7, 6, 33, 
+  /* 'F' */
+  8, 7, 1, 2, 6, 2, 6, 2, 6, 6, 2, 2, 6, 2, 6, 2,
+  6, 2, 38, 
+  /* 'G' */
+  11, 4, 4, 2, 2, 2, 3, 2, 6, 2, 7, 8, 1, 2, 4, 2,
+  1, 2, 4, 2, 1, 2, 3, 2, 3, 5, 39, 
+  /* 'H' */
+  9, 2, 4, 2, 1, 2, 4, 2, 1, 2, 4, 2, 1, 2, 4, 2,
+  1, 8, 1, 2, 4, 2, 1, 2, 4, 2, 1, 2, 4, 2, 1, 2,
+  4, 2, 37, 
+  /* 'I' */
+  7, 6, 3, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2,
+  3, 6, 29, 
+  /* 'J' */
+  11, 6, 5, 2, 7, 2, 7, 2, 7, 2, 7, 2, 3, 2, 2, 2,
+  3, 2, 2, 2, 4, 5, 39, 
+  /* 'K' */
+  8, 2, 3, 2, 1, 2, 2, 2, 2, 2, 1, 2, 3, 4, 4, 3,
+  5, 3, 5, 4, 4, 2, 1, 2, 3, 2, 2, 3, 33, 
+  /* 'L' */
+  7, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2,
+  5, 6, 29, 
+  /* 'M' */
+  13, 2, 2, 2, 5, 2, 2, 2, 5, 2, 2, 2, 4, 7, 4, 8,
+  3, 8, 3, 8, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2,
+  45, 
+  /* 'N' */
+  10, 2, 5, 2, 1, 3, 4, 2, 1, 4, 3, 2, 1, 2, 1, 2,
+  2, 2, 1, 2, 1, 2, 2, 2, 1, 2, 2, 2, 1, 2, 1, 2,
+  3, 4, 1, 2, 4, 3, 1, 2, 5, 2, 41, 
+  /* 'O' */
+  13, 4, 5, 2, 2, 2, 3, 2, 4, 2, 1, 2, 5, 2, 1, 2,
+  5, 2, 1, 2, 5, 2, 1, 2, 4, 2, 3, 2, 3, 2, 4, 5,
+  43, 
+  /* 'P' */
+  6, 4, 2, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+  1, 2, 1, 4, 2, 2, 4, 2, 4, 2, 28, 
+  /* 'Q' */
+  12, 5, 4, 2, 3, 2, 2, 2, 5, 2, 1, 2, 5, 2, 1, 2,
+  5, 2, 1, 2, 5, 2, 1, 2, 2, 2, 1, 2, 2, 2, 2, 4,
+  3, 6, 8, 3, 8, 2, 21, 
+  /* 'R' */
+  7, 4, 3, 2, 1, 2, 2, 2, 2, 2, 1, 2, 2, 2, 1, 2,
+  2, 2, 1, 5, 2, 4, 3, 2, 1, 2, 2, 2, 2, 2, 29, 
+  /* 'S' */
+  12, 5, 3, 2, 6, 2, 7, 2, 8, 5, 8, 2, 7, 2, 1, 2,
+  3, 2, 3, 5, 39, 
+  /* 'T' */
+  9, 8, 4, 2, 7, 2, 7, 2, 7, 2, 7, 2, 7, 2, 7, 2,
+  7, 2, 40, 
+  /* 'U' */
+  9, 2, 4, 2, 1, 2, 4, 2, 1, 2, 4, 2, 1, 2, 4, 2,
+  1, 2, 4, 2, 1, 2, 4, 2, 1, 2, 4, 2, 2, 2, 2, 2,
+  4, 4, 39, 
+  /* 'V' */
+  9, 2, 4, 2, 1, 2, 4, 2, 1, 2, 3, 2, 3, 2, 2, 2,
+  3, 2, 2, 2, 4, 4, 5, 4, 5, 3, 7, 2, 40, 
+  /* 'W' */
+  13, 2, 3, 2, 3, 2, 1, 2, 3, 2, 3, 2, 2, 2, 2, 2,
+  2, 2, 3, 2, 1, 4, 1, 2, 3, 2, 1, 4, 1, 2, 3, 4,
+  1, 4, 4, 4, 1, 4, 5, 2, 2, 4, 5, 2, 3, 2, 56, 
+  /* 'X' */
+  10, 2, 5, 2, 2, 2, 3, 2, 4, 2, 1, 2, 6, 3, 7, 3,
+  7, 3, 6, 2, 1, 2, 4, 2, 3, 2, 2, 2, 5, 2, 41, 
+  /* 'Y' */
+  9, 2, 4, 2, 2, 2, 2, 2, 3, 2, 2, 2, 4, 2, 1, 2,
+  4, 4, 6, 3, 6, 2, 7, 2, 6, 2, 41, 
+  /* 'Z' */
+  10, 9, 7, 2, 7, 2, 7, 2, 7, 2, 7, 2, 7, 2, 7, 2,
+  8, 9, 41, 
+  /* 'a' */
+  34, 4, 3, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 3, 6, 33, 
+  /* 'b' */
+  0, 2, 5, 2, 5, 2, 5, 2, 5, 5, 2, 2, 2, 2, 1, 2,
+  2, 2, 1, 2, 2, 2, 1, 2, 2, 2, 1, 5, 30, 
+  /* 'c' */
+  30, 3, 3, 2, 1, 2, 1, 2, 5, 2, 5, 2, 2, 2, 2, 4,
+  30, 
+  /* 'd' */
+  4, 2, 5, 2, 5, 2, 5, 2, 2, 5, 1, 2, 2, 2, 1, 2,
+  2, 2, 1, 2, 2, 2, 1, 2, 2, 2, 2, 5, 29, 
+  /* 'e' */
+  29, 4, 2, 2, 2, 2, 1, 2, 1, 2, 2, 4, 3, 2, 2, 2,
+  2, 4, 30, 
+  /* 'f' */
+  3, 3, 3, 2, 5, 2, 5, 2, 3, 6, 3, 2, 5, 2, 5, 2,
+  5, 2, 5, 2, 31, 
+  /* 'g' */
+  30, 3, 3, 2, 1, 2, 1, 2, 2, 2, 1, 2, 2, 2, 1, 2,
+  2, 2, 2, 5, 5, 2, 5, 2, 1, 5, 9, 
+  /* 'h' */
+  0, 2, 5, 2, 5, 2, 5, 2, 5, 5, 2, 3, 1, 2, 1, 2,
+  2, 2, 1, 2, 2, 2, 1, 2, 2, 2, 1, 2, 2, 2, 29, 
+  /* 'i' */
+  6, 2, 4, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 13, 
+  /* 'j' */
+  15, 2, 10, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2,
+  4, 2, 1, 2, 1, 2, 2, 3, 2, 
+  /* 'k' */
+  0, 2, 5, 2, 5, 2, 5, 2, 5, 2, 1, 2, 2, 4, 3, 4,
+  3, 5, 2, 2, 1, 2, 2, 2, 2, 2, 29, 
+  /* 'l' */
+  0, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+  1, 2, 1, 2, 13, 
+  /* 'm' */
+  36, 4, 1, 2, 2, 8, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+  1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 37, 
+  /* 'n' */
+  28, 5, 2, 3, 1, 2, 1, 2, 2, 2, 1, 2, 2, 2, 1, 2,
+  2, 2, 1, 2, 2, 2, 29, 
+  /* 'o' */
+  29, 4, 2, 2, 2, 2, 1, 2, 2, 2, 1, 2, 2, 2, 1, 2,
+  2, 2, 2, 4, 30, 
+  /* 'p' */
+  28, 5, 2, 2, 2, 2, 1, 2, 2, 2, 1, 2, 2, 2, 1, 2,
+  2, 2, 1, 5, 2, 2, 5, 2, 5, 2, 12, 
+  /* 'q' */
+  30, 4, 2, 2, 1, 2, 1, 2, 2, 2, 1, 2, 2, 2, 1, 2,
+  2, 2, 2, 5, 5, 2, 5, 2, 5, 2, 8, 
+  /* 'r' */
+  24, 5, 1, 5, 1, 2, 1, 2, 1, 2, 4, 2, 4, 2, 28, 
+  /* 's' */
+  29, 5, 1, 2, 2, 2, 2, 3, 6, 2, 6, 2, 1, 5, 30, 
+  /* 't' */
+  16, 2, 5, 2, 3, 6, 3, 2, 5, 2, 5, 2, 5, 2, 5, 2,
+  31, 
+  /* 'u' */
+  28, 2, 2, 2, 1, 2, 2, 2, 1, 2, 2, 2, 1, 2, 2, 2,
+  1, 2, 2, 2, 2, 5, 29, 
+  /* 'v' */
+  28, 2, 2, 2, 1, 2, 2, 2, 2, 4, 3, 4, 4, 2, 5, 2,
+  31, 
+  /* 'w' */
+  36, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 7, 2, 7,
+  3, 6, 3, 2, 1, 2, 39, 
+  /* 'x' */
+  32, 2, 3, 2, 2, 2, 1, 2, 4, 3, 5, 3, 4, 2, 1, 2,
+  2, 2, 3, 2, 33, 
+  /* 'y' */
+  32, 2, 3, 2, 2, 2, 1, 2, 3, 2, 1, 2, 4, 3, 5, 3,
+  5, 2, 6, 2, 5, 2, 6, 2, 13, 
+  /* 'z' */
+  24, 5, 4, 2, 3, 2, 3, 2, 3, 2, 4, 5, 25, 
+};
+
+static const font_glyph_t font_sans8_bold_glyphs[] =
+{
+  { 4,  4,     0,   1},   /* fallback */
+  { 4,  4,     0,   1},   /* ' ' */
+  { 7,  7,     1,  33},   /* '0' */
+  { 5,  5,    34,  19},   /* '1' */
+  { 7,  7,    53,  21},   /* '2' */
+  { 7,  7,    74,  23},   /* '3' */
+  { 8,  8,    97,  23},   /* '4' */
+  { 7,  7,   120,  25},   /* '5' */
+  { 7,  7,   145,  27},   /* '6' */
+  { 9,  9,   172,  19},   /* '7' */
+  { 7,  7,   191,  31},   /* '8' */
+  { 7,  7,   222,  27},   /* '9' */
+  { 9,  9,   249,  27},   /* 'A' */
+  { 7,  7,   276,  31},   /* 'B' */
+  { 8,  8,   307,  23},   /* 'C' */
+  { 9,  9,   330,  31},   /* 'D' */
+  { 8,  8,   361,  19},   /* 'E' */
+  { 8,  8,   380,  19},   /* 'F' */
+  { 9,  9,   399,  27},   /* 'G' */
+  { 9,  9,   426,  35},   /* 'H' */
+  { 7,  7,   461,  19},   /* 'I' */
+  { 9,  9,   480,  23},   /* 'J' */
+  { 8,  8,   503,  29},   /* 'K' */
+  { 7,  7,   532,  19},   /* 'L' */
+  {11, 11,   551,  33},   /* 'M' */
+  {10, 10,   584,  43},   /* 'N' */
+  {10, 10,   627,  33},   /* 'O' */
+  { 6,  6,   660,  27},   /* 'P' */
+  {10, 10,   687,  39},   /* 'Q' */
+  { 7,  7,   726,  31},   /* 'R' */
+  { 9,  9,   757,  21},   /* 'S' */
+  { 9,  9,   778,  19},   /* 'T' */
+  { 9,  9,   797,  35},   /* 'U' */
+  { 9,  9,   832,  29},   /* 'V' */
+  {13, 13,   861,  47},   /* 'W' */
+  {10, 10,   908,  31},   /* 'X' */
+  { 9,  9,   939,  27},   /* 'Y' */
+  {10, 10,   966,  19},   /* 'Z' */
+  { 8,  8,   985,  21},   /* 'a' */
+  { 7,  7,  1006,  29},   /* 'b' */
+  { 7,  7,  1035,  17},   /* 'c' */
+  { 7,  7,  1052,  29},   /* 'd' */
+  { 7,  7,  1081,  19},   /* 'e' */
+  { 7,  7,  1100,  21},   /* 'f' */
+  { 7,  7,  1121,  27},   /* 'g' */
+  { 7,  7,  1148,  31},   /* 'h' */
+  { 3,  3,  1179,  15},   /* 'i' */
+  { 6,  6,  1194,  25},   /* 'j' */
+  { 7,  7,  1219,  27},   /* 'k' */
+  { 3,  3,  1246,  21},   /* 'l' */
+  { 9,  9,  1267,  31},   /* 'm' */
+  { 7,  7,  1298,  23},   /* 'n' */
+  { 7,  7,  1321,  21},   /* 'o' */
+  { 7,  7,  1342,  27},   /* 'p' */
+  { 7,  7,  1369,  27},   /* 'q' */
+  { 6,  6,  1396,  15},   /* 'r' */
+  { 7,  7,  1411,  15},   /* 's' */
+  { 7,  7,  1426,  17},   /* 't' */
+  { 7,  7,  1443,  23},   /* 'u' */
+  { 7,  7,  1466,  17},   /* 'v' */
+  { 9,  9,  1483,  23},   /* 'w' */
+  { 8,  8,  1506,  21},   /* 'x' */
+  { 8,  8,  1527,  25},   /* 'y' */
+  { 6,  6,  1552,  13},   /* 'z' */
+};
+
+static const uint8_t font_sans8_bold_map[256] =
+{
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    2,   3,   4,   5,   6,   7,   8,   9,  10,  11,   0,   0,   0,   0,   0,   0,
+    0,  12,  13,  14,  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,
+   27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,   0,   0,   0,   0,   0,
+    0,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  51,  52,
+   53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+};
+
+const font_t font_sans8_bold =
+{
+  14,                    // height
+  64,                    // glyph count, including the fallback
+  font_sans8_bold_map,
+  font_sans8_bold_glyphs,
+  font_sans8_bold_runs
+};
@@ -0,0 +1,407 @@
+// Generated by tools/fontconv from fonts/ms_sans_8.bdf (x2)
+// Do not edit by hand, regenerate the file instead.
+
+#include "fonts.h"
+
+static const uint8_t font_sans8_x2_runs[] =
+{
+  /* ' ' */
+  168, 
+  /* '0' */
+  26, 6, 6, 6, 4, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 4, 6, 6, 6,
+  100, 
+  /* '1' */
+  18, 2, 6, 2, 4, 4, 4, 4, 6, 2, 6, 2, 6, 2, 6, 2,
+  6, 2, 6, 2, 6, 2, 6, 2, 6, 2, 6, 2, 6, 2, 6, 2,
+  4, 6, 2, 6, 66, 
+  /* '2' */
+  26, 6, 6, 6, 4, 2, 6, 2, 2, 2, 6, 2, 10, 2, 10, 2,
+  8, 2, 10, 2, 8, 2, 10, 2, 8, 2, 10, 2, 8, 2, 10, 2,
+  10, 2, 10, 2, 10, 10, 2, 10, 98, 
+  /* '3' */
+  26, 6, 6, 6, 4, 2, 6, 2, 2, 2, 6, 2, 10, 2, 10, 2,
+  10, 2, 10, 2, 4, 6, 6, 6, 12, 2, 10, 2, 10, 2, 10, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 4, 6, 6, 6, 100, 
+  /* '4' */
+  36, 2, 12, 2, 10, 4, 10, 4, 8, 2, 2, 2, 8, 2, 2, 2,
+  6, 2, 4, 2, 6, 2, 4, 2, 4, 2, 6, 2, 4, 2, 6, 2,
+  4, 12, 2, 12, 10, 2, 12, 2, 12, 2, 12, 2, 12, 2, 12, 2,
+  116, 
+  /* '5' */
+  24, 10, 2, 10, 2, 2, 10, 2, 10, 2, 10, 2, 10, 2, 2, 4,
+  4, 2, 2, 4, 4, 4, 4, 2, 2, 4, 4, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 10, 2, 10, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  4, 6, 6, 6, 100, 
+  /* '6' */
+  30, 2, 10, 2, 8, 2, 10, 2, 8, 2, 10, 2, 8, 8, 4, 8,
+  4, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  4, 6, 6, 6, 100, 
+  /* '7' */
+  32, 14, 2, 14, 12, 2, 14, 2, 12, 2, 14, 2, 14, 2, 14, 2,
+  12, 2, 14, 2, 14, 2, 14, 2, 12, 2, 14, 2, 14, 2, 14, 2,
+  14, 2, 14, 2, 138, 
+  /* '8' */
+  26, 6, 6, 6, 4, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 4, 6, 6, 6,
+  4, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 4, 6, 6, 6, 100, 
+  /* '9' */
+  26, 6, 6, 6, 4, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 4, 8, 4, 8, 8, 2, 10, 2, 8, 2, 10, 2,
+  8, 2, 10, 2, 104, 
+  /* 'A' */
+  40, 2, 14, 2, 14, 2, 14, 2, 12, 2, 2, 2, 10, 2, 2, 2,
+  10, 2, 2, 2, 10, 2, 2, 2, 8, 2, 4, 2, 8, 2, 4, 2,
+  8, 8, 8, 8, 6, 2, 8, 2, 4, 2, 8, 2, 4, 2, 8, 2,
+  4, 2, 8, 2, 2, 2, 10, 2, 2, 2, 10, 2, 130, 
+  /* 'B' */
+  24, 8, 4, 8, 4, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 8, 4, 8,
+  4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 2, 8, 4, 8, 100, 
+  /* 'C' */
+  34, 6, 8, 6, 6, 2, 4, 2, 6, 2, 4, 2, 4, 2, 12, 2,
+  12, 2, 12, 2, 10, 2, 12, 2, 12, 2, 12, 2, 12, 2, 12, 2,
+  12, 2, 8, 2, 2, 2, 8, 2, 4, 8, 6, 8, 116, 
+  /* 'D' */
+  32, 4, 12, 4, 12, 2, 2, 4, 8, 2, 2, 4, 8, 2, 6, 2,
+  6, 2, 6, 2, 6, 2, 8, 2, 4, 2, 8, 2, 4, 2, 10, 2,
+  2, 2, 10, 2, 2, 2, 10, 2, 2, 2, 10, 2, 2, 2, 10, 2,
+  2, 2, 10, 2, 2, 2, 8, 2, 4, 2, 8, 2, 6, 8, 8, 8,
+  134, 
+  /* 'E' */
+  28, 12, 2, 12, 2, 2, 12, 2, 12, 2, 12, 2, 12, 2, 12, 2,
+  12, 12, 2, 12, 2, 2, 12, 2, 12, 2, 12, 2, 12, 2, 12, 2,
+  14, 10, 4, 10, 114, 
+  /* 'F' */
+  28, 12, 2, 12, 2, 2, 12, 2, 12, 2, 12, 2, 12, 2, 12, 2,
+  12, 10, 4, 10, 4, 2, 12, 2, 12, 2, 12, 2, 12, 2, 12, 2,
+  12, 2, 12, 2, 124, 
+  /* 'G' */
+  36, 6, 10, 6, 8, 2, 6, 2, 6, 2, 6, 2, 6, 2, 14, 2,
+  12, 2, 14, 2, 14, 2, 2, 10, 2, 2, 2, 10, 2, 2, 10, 2,
+  2, 2, 10, 2, 2, 2, 10, 2, 2, 2, 10, 2, 2, 2, 8, 2,
+  4, 2, 8, 2, 6, 8, 8, 8, 134, 
+  /* 'H' */
+  32, 2, 10, 2, 2, 2, 10, 2, 2, 2, 10, 2, 2, 2, 10, 2,
+  2, 2, 10, 2, 2, 2, 10, 2, 2, 2, 10, 2, 2, 2, 10, 2,
+  2, 14, 2, 14, 2, 2, 10, 2, 2, 2, 10, 2, 2, 2, 10, 2,
+  2, 2, 10, 2, 2, 2, 10, 2, 2, 2, 10, 2, 2, 2, 10, 2,
+  2, 2, 10, 2, 130, 
+  /* 'I' */
+  24, 10, 2, 10, 6, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2,
+  10, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2,
+  6, 10, 2, 10, 98, 
+  /* 'J' */
+  36, 10, 6, 10, 10, 2, 14, 2, 14, 2, 14, 2, 14, 2, 14, 2,
+  14, 2, 14, 2, 14, 2, 14, 2, 6, 2, 6, 2, 6, 2, 6, 2,
+  6, 2, 6, 2, 6, 2, 6, 2, 8, 8, 8, 8, 134, 
+  /* 'K' */
+  28, 2, 8, 2, 2, 2, 8, 2, 2, 2, 6, 2, 4, 2, 6, 2,
+  4, 2, 4, 2, 6, 2, 4, 2, 6, 6, 8, 6, 8, 4, 10, 4,
+  10, 4, 10, 4, 10, 2, 2, 2, 8, 2, 2, 2, 8, 2, 4, 2,
+  6, 2, 4, 2, 6, 2, 6, 4, 2, 2, 6, 4, 114, 
+  /* 'L' */
+  24, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2,
+  10, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2,
+  10, 10, 2, 10, 98, 
+  /* 'M' */
+  44, 2, 6, 2, 10, 2, 6, 2, 10, 2, 6, 2, 10, 2, 6, 2,
+  10, 2, 6, 2, 10, 2, 6, 2, 8, 2, 2, 2, 2, 4, 8, 2,
+  2, 2, 2, 4, 8, 2, 2, 2, 2, 2, 2, 2, 6, 2, 2, 2,
+  2, 2, 2, 2, 6, 2, 2, 2, 2, 2, 2, 2, 6, 2, 2, 2,
+  2, 2, 2, 2, 6, 2, 2, 2, 2, 2, 2, 2, 6, 2, 2, 2,
+  2, 2, 2, 2, 4, 2, 6, 2, 6, 2, 2, 2, 6, 2, 6, 2,
+  2, 2, 6, 2, 6, 2, 2, 2, 6, 2, 6, 2, 162, 
+  /* 'N' */
+  36, 2, 12, 2, 2, 2, 12, 2, 2, 4, 10, 2, 2, 4, 10, 2,
+  2, 2, 2, 2, 8, 2, 2, 2, 2, 2, 8, 2, 2, 2, 4, 2,
+  6, 2, 2, 2, 4, 2, 6, 2, 2, 2, 4, 2, 6, 2, 2, 2,
+  4, 2, 6, 2, 2, 2, 6, 2, 4, 2, 2, 2, 6, 2, 4, 2,
+  2, 2, 8, 2, 2, 2, 2, 2, 8, 2, 2, 2, 2, 2, 10, 4,
+  2, 2, 10, 4, 2, 2, 12, 2, 2, 2, 12, 2, 146, 
+  /* 'O' */
+  42, 6, 12, 6, 10, 2, 6, 2, 8, 2, 6, 2, 6, 2, 10, 2,
+  4, 2, 10, 2, 2, 2, 12, 2, 2, 2, 12, 2, 2, 2, 12, 2,
+  2, 2, 12, 2, 2, 2, 12, 2, 2, 2, 12, 2, 2, 2, 10, 2,
+  4, 2, 10, 2, 6, 2, 8, 2, 6, 2, 8, 2, 8, 8, 10, 8,
+  150, 
+  /* 'P' */
+  20, 6, 4, 6, 4, 2, 4, 2, 2, 2, 4, 2, 2, 2, 4, 2,
+  2, 2, 4, 2, 2, 2, 4, 2, 2, 2, 4, 2, 2, 2, 4, 2,
+  2, 2, 4, 2, 2, 6, 4, 6, 4, 2, 8, 2, 8, 2, 8, 2,
+  8, 2, 8, 2, 88, 
+  /* 'Q' */
+  40, 8, 10, 8, 8, 2, 8, 2, 6, 2, 8, 2, 4, 2, 12, 2,
+  2, 2, 12, 2, 2, 2, 12, 2, 2, 2, 12, 2, 2, 2, 12, 2,
+  2, 2, 12, 2, 2, 2, 12, 2, 2, 2, 12, 2, 2, 2, 6, 2,
+  4, 2, 2, 2, 6, 2, 4, 2, 4, 2, 6, 6, 4, 2, 6, 6,
+  6, 10, 8, 10, 16, 4, 14, 4, 16, 2, 16, 2, 74, 
+  /* 'R' */
+  24, 6, 6, 6, 6, 2, 4, 2, 4, 2, 4, 2, 4, 2, 6, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 2, 8, 4, 8, 4, 2, 2, 2, 6, 2, 2, 2,
+  6, 2, 4, 2, 4, 2, 4, 2, 4, 2, 6, 2, 2, 2, 6, 2,
+  98, 
+  /* 'S' */
+  38, 8, 8, 8, 6, 2, 14, 2, 12, 2, 14, 2, 14, 2, 14, 2,
+  16, 8, 8, 8, 16, 2, 14, 2, 14, 2, 14, 2, 2, 2, 8, 2,
+  4, 2, 8, 2, 6, 8, 8, 8, 134, 
+  /* 'T' */
+  32, 14, 2, 14, 8, 2, 14, 2, 14, 2, 14, 2, 14, 2, 14, 2,
+  14, 2, 14, 2, 14, 2, 14, 2, 14, 2, 14, 2, 14, 2, 14, 2,
+  14, 2, 14, 2, 136, 
+  /* 'U' */
+  32, 2, 10, 2, 2, 2, 10, 2, 2, 2, 10, 2, 2, 2, 10, 2,
+  2, 2, 10, 2, 2, 2, 10, 2, 2, 2, 10, 2, 2, 2, 10, 2,
+  2, 2, 10, 2, 2, 2, 10, 2, 2, 2, 10, 2, 2, 2, 10, 2,
+  2, 2, 10, 2, 2, 2, 10, 2, 4, 2, 6, 2, 6, 2, 6, 2,
+  8, 6, 10, 6, 134, 
+  /* 'V' */
+  32, 2, 10, 2, 2, 2, 10, 2, 2, 2, 10, 2, 2, 2, 10, 2,
+  2, 2, 8, 2, 4, 2, 8, 2, 6, 2, 6, 2, 6, 2, 6, 2,
+  6, 2, 6, 2, 6, 2, 6, 2, 8, 2, 2, 2, 10, 2, 2, 2,
+  10, 2, 2, 2, 10, 2, 2, 2, 10, 4, 12, 4, 14, 2, 14, 2,
+  136, 
+  /* 'W' */
+  48, 2, 8, 2, 8, 2, 2, 2, 8, 2, 8, 2, 2, 2, 8, 2,
+  8, 2, 2, 2, 8, 2, 8, 2, 4, 2, 6, 2, 6, 2, 6, 2,
+  6, 2, 6, 2, 6, 2, 4, 2, 2, 2, 4, 2, 6, 2, 4, 2,
+  2, 2, 4, 2, 6, 2, 4, 2, 2, 2, 4, 2, 6, 2, 4, 2,
+  2, 2, 4, 2, 6, 2, 2, 2, 4, 2, 2, 2, 8, 2, 2, 2,
+  4, 2, 2, 2, 8, 2, 2, 2, 4, 2, 2, 2, 8, 2, 2, 2,
+  4, 2, 2, 2, 10, 2, 6, 2, 2, 2, 10, 2, 6, 2, 2, 2,
+  10, 2, 8, 2, 12, 2, 8, 2, 200, 
+  /* 'X' */
+  36, 2, 12, 2, 2, 2, 12, 2, 4, 2, 8, 2, 6, 2, 8, 2,
+  8, 2, 4, 2, 10, 2, 4, 2, 12, 4, 14, 4, 14, 4, 14, 4,
+  14, 4, 14, 4, 12, 2, 4, 2, 10, 2, 4, 2, 8, 2, 8, 2,
+  6, 2, 8, 2, 4, 2, 12, 2, 2, 2, 12, 2, 146, 
+  /* 'Y' */
+  32, 2, 10, 2, 2, 2, 10, 2, 4, 2, 6, 2, 6, 2, 6, 2,
+  6, 2, 6, 2, 6, 2, 6, 2, 8, 2, 4, 2, 8, 2, 4, 2,
+  8, 2, 2, 2, 10, 2, 2, 2, 12, 4, 12, 4, 12, 2, 14, 2,
+  14, 2, 14, 2, 12, 2, 14, 2, 138, 
+  /* 'Z' */
+  36, 16, 2, 16, 14, 2, 16, 2, 14, 2, 16, 2, 14, 2, 16, 2,
+  14, 2, 16, 2, 14, 2, 16, 2, 14, 2, 16, 2, 14, 2, 16, 2,
+  16, 16, 2, 16, 146, 
+  /* 'a' */
+  116, 6, 8, 6, 6, 2, 4, 2, 6, 2, 4, 2, 4, 2, 6, 2,
+  4, 2, 6, 2, 4, 2, 6, 2, 4, 2, 6, 2, 4, 2, 6, 2,
+  4, 2, 6, 2, 6, 6, 2, 2, 4, 6, 2, 2, 114, 
+  /* 'b' */
+  0, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2,
+  10, 8, 4, 8, 4, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 2, 8, 4, 8, 100, 
+  /* 'c' */
+  100, 4, 8, 4, 6, 2, 4, 2, 4, 2, 4, 2, 2, 2, 10, 2,
+  10, 2, 10, 2, 10, 2, 6, 2, 2, 2, 6, 2, 4, 6, 6, 6,
+  100, 
+  /* 'd' */
+  8, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2,
+  4, 8, 4, 8, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 4, 8, 4, 8, 98, 
+  /* 'e' */
+  98, 6, 6, 6, 4, 2, 6, 2, 2, 2, 6, 2, 2, 2, 4, 2,
+  4, 2, 4, 2, 4, 6, 6, 6, 6, 2, 6, 2, 2, 2, 6, 2,
+  4, 6, 6, 6, 100, 
+  /* 'f' */
+  6, 4, 8, 4, 6, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2,
+  6, 10, 2, 10, 6, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2,
+  10, 2, 10, 2, 10, 2, 10, 2, 102, 
+  /* 'g' */
+  100, 4, 8, 4, 6, 2, 4, 2, 4, 2, 4, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 4, 8, 4, 8, 10, 2, 10, 2, 10, 2, 10, 2,
+  2, 8, 4, 8, 28, 
+  /* 'h' */
+  0, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2,
+  10, 2, 2, 4, 4, 2, 2, 4, 4, 4, 4, 2, 2, 4, 4, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  98, 
+  /* 'i' */
+  16, 2, 2, 2, 10, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 34, 
+  /* 'j' */
+  46, 2, 8, 2, 28, 2, 8, 2, 8, 2, 8, 2, 8, 2, 8, 2,
+  8, 2, 8, 2, 8, 2, 8, 2, 8, 2, 8, 2, 8, 2, 8, 2,
+  8, 2, 8, 2, 2, 2, 4, 2, 2, 2, 4, 2, 4, 4, 6, 4,
+  4, 
+  /* 'k' */
+  0, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2,
+  10, 2, 4, 2, 4, 2, 4, 2, 4, 2, 2, 2, 6, 2, 2, 2,
+  6, 6, 6, 6, 6, 4, 2, 2, 4, 4, 2, 2, 4, 2, 4, 2,
+  4, 2, 4, 2, 4, 2, 6, 2, 2, 2, 6, 2, 98, 
+  /* 'l' */
+  0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 34, 
+  /* 'm' */
+  128, 2, 2, 2, 4, 2, 4, 2, 2, 2, 4, 2, 4, 4, 2, 4,
+  2, 2, 2, 4, 2, 4, 2, 2, 2, 2, 4, 2, 4, 2, 2, 2,
+  4, 2, 4, 2, 2, 2, 4, 2, 4, 2, 2, 2, 4, 2, 4, 2,
+  2, 2, 4, 2, 4, 2, 2, 2, 4, 2, 4, 2, 2, 2, 4, 2,
+  4, 2, 2, 2, 4, 2, 4, 2, 130, 
+  /* 'n' */
+  96, 2, 2, 4, 4, 2, 2, 4, 4, 4, 4, 2, 2, 4, 4, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  98, 
+  /* 'o' */
+  98, 6, 6, 6, 4, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 4, 6, 6, 6, 100, 
+  /* 'p' */
+  96, 8, 4, 8, 4, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 2, 8, 4, 8, 4, 2, 10, 2, 10, 2, 10, 2,
+  10, 2, 10, 2, 34, 
+  /* 'q' */
+  100, 6, 6, 6, 4, 2, 4, 2, 4, 2, 4, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 4, 8, 4, 8, 10, 2, 10, 2, 10, 2, 10, 2,
+  10, 2, 10, 2, 26, 
+  /* 'r' */
+  80, 2, 2, 4, 2, 2, 2, 4, 2, 4, 2, 2, 2, 4, 2, 2,
+  2, 2, 4, 2, 2, 2, 4, 2, 2, 2, 8, 2, 8, 2, 8, 2,
+  8, 2, 8, 2, 88, 
+  /* 's' */
+  98, 8, 4, 8, 2, 2, 6, 2, 2, 2, 6, 2, 4, 4, 8, 4,
+  12, 2, 10, 2, 12, 2, 10, 2, 2, 8, 4, 8, 100, 
+  /* 't' */
+  52, 2, 10, 2, 10, 2, 10, 2, 6, 10, 2, 10, 6, 2, 10, 2,
+  10, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2, 10, 2,
+  102, 
+  /* 'u' */
+  96, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  2, 2, 6, 2, 2, 2, 6, 2, 4, 8, 4, 8, 98, 
+  /* 'v' */
+  96, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+  4, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2,
+  8, 2, 10, 2, 10, 2, 10, 2, 102, 
+  /* 'w' */
+  128, 2, 4, 2, 4, 2, 2, 2, 4, 2, 4, 2, 2, 2, 4, 2,
+  4, 2, 2, 2, 4, 2, 4, 2, 2, 2, 2, 4, 2, 2, 4, 2,
+  2, 4, 2, 2, 4, 2, 2, 4, 2, 2, 4, 2, 2, 4, 2, 2,
+  6, 2, 2, 2, 2, 2, 6, 2, 2, 2, 2, 2, 6, 2, 4, 2,
+  8, 2, 4, 2, 134, 
+  /* 'x' */
+  112, 2, 8, 2, 2, 2, 8, 2, 4, 2, 4, 2, 6, 2, 4, 2,
+  8, 4, 10, 4, 10, 4, 10, 4, 8, 2, 4, 2, 6, 2, 4, 2,
+  4, 2, 8, 2, 2, 2, 8, 2, 114, 
+  /* 'y' */
+  112, 2, 8, 2, 2, 2, 8, 2, 4, 2, 4, 2, 6, 2, 4, 2,
+  6, 2, 4, 2, 6, 2, 4, 2, 8, 4, 10, 4, 10, 4, 10, 4,
+  10, 2, 12, 2, 12, 2, 12, 2, 10, 2, 12, 2, 12, 2, 12, 2,
+  38, 
+  /* 'z' */
+  80, 8, 2, 8, 8, 2, 8, 2, 6, 2, 8, 2, 6, 2, 8, 2,
+  6, 2, 8, 2, 8, 8, 2, 8, 82, 
+};
+
+static const font_glyph_t font_sans8_x2_glyphs[] =
+{
+  { 6,  6,     0,   1},   /* fallback */
+  { 6,  6,     0,   1},   /* ' ' */
+  {12, 12,     1,  65},   /* '0' */
+  { 8,  8,    66,  37},   /* '1' */
+  {12, 12,   103,  41},   /* '2' */
+  {12, 12,   144,  45},   /* '3' */
+  {14, 14,   189,  49},   /* '4' */
+  {12, 12,   238,  53},   /* '5' */
+  {12, 12,   291,  53},   /* '6' */
+  {16, 16,   344,  37},   /* '7' */
+  {12, 12,   381,  61},   /* '8' */
+  {12, 12,   442,  53},   /* '9' */
+  {16, 16,   495,  61},   /* 'A' */
+  {12, 12,   556,  61},   /* 'B' */
+  {14, 14,   617,  45},   /* 'C' */
+  {16, 16,   662,  65},   /* 'D' */
+  {14, 14,   727,  37},   /* 'E' */
+  {14, 14,   764,  37},   /* 'F' */
+  {16, 16,   801,  57},   /* 'G' */
+  {16, 16,   858,  69},   /* 'H' */
+  {12, 12,   927,  37},   /* 'I' */
+  {16, 16,   964,  45},   /* 'J' */
+  {14, 14,  1009,  61},   /* 'K' */
+  {12, 12,  1070,  37},   /* 'L' */
+  {20, 20,  1107, 109},   /* 'M' */
+  {18, 18,  1216,  93},   /* 'N' */
+  {18, 18,  1309,  65},   /* 'O' */
+  {10, 10,  1374,  53},   /* 'P' */
+  {18, 18,  1427,  77},   /* 'Q' */
+  {12, 12,  1504,  65},   /* 'R' */
+  {16, 16,  1569,  41},   /* 'S' */
+  {16, 16,  1610,  37},   /* 'T' */
+  {16, 16,  1647,  69},   /* 'U' */
+  {16, 16,  1716,  65},   /* 'V' */
+  {24, 24,  1781, 121},   /* 'W' */
+  {18, 18,  1902,  61},   /* 'X' */
+  {16, 16,  1963,  57},   /* 'Y' */
+  {18, 18,  2020,  37},   /* 'Z' */
+  {14, 14,  2057,  45},   /* 'a' */
+  {12, 12,  2102,  57},   /* 'b' */
+  {12, 12,  2159,  33},   /* 'c' */
+  {12, 12,  2192,  57},   /* 'd' */
+  {12, 12,  2249,  37},   /* 'e' */
+  {12, 12,  2286,  41},   /* 'f' */
+  {12, 12,  2327,  53},   /* 'g' */
+  {12, 12,  2380,  65},   /* 'h' */
+  { 4,  4,  2445,  29},   /* 'i' */
+  {10, 10,  2474,  49},   /* 'j' */
+  {12, 12,  2523,  61},   /* 'k' */
+  { 4,  4,  2584,  41},   /* 'l' */
+  {16, 16,  2625,  73},   /* 'm' */
+  {12, 12,  2698,  49},   /* 'n' */
+  {12, 12,  2747,  41},   /* 'o' */
+  {12, 12,  2788,  53},   /* 'p' */
+  {12, 12,  2841,  53},   /* 'q' */
+  {10, 10,  2894,  37},   /* 'r' */
+  {12, 12,  2931,  29},   /* 's' */
+  {12, 12,  2960,  33},   /* 't' */
+  {12, 12,  2993,  45},   /* 'u' */
+  {12, 12,  3038,  41},   /* 'v' */
+  {16, 16,  3079,  69},   /* 'w' */
+  {14, 14,  3148,  41},   /* 'x' */
+  {14, 14,  3189,  49},   /* 'y' */
+  {10, 10,  3238,  25},   /* 'z' */
+};
+
+static const uint8_t font_sans8_x2_map[256] =
+{
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    2,   3,   4,   5,   6,   7,   8,   9,  10,  11,   0,   0,   0,   0,   0,   0,
+    0,  12,  13,  14,  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,
+   27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,   0,   0,   0,   0,   0,
+    0,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  51,  52,
+   53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+};
+
+const font_t font_sans8_x2 =
+{
+  28,                    // height
+  64,                    // glyph count, including the fallback
+  font_sans8_x2_map,
+  font_sans8_x2_glyphs,
+  font_sans8_x2_runs
+};
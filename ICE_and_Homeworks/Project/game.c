@@ -1,405 +1,425 @@
 #include "game.h"
-extern bool readyShoot;
-extern uint8_t touch_event;
 
 
+const tilemap_t* game_background = &ocean_background;
+
 int score = 0;
-int numBullets = 7;
+int numBullets = START_BULLETS;
 bool fishHit = false;
 
+bool showHUD = true;
+bool pause = true;
+bool colorChange = false;
+uint8_t colorArrayIndex = 0;
+
+widget_t hud[HUD_WIDGETS];
+
+int16_t x_accel;
+volatile uint8_t touch_event = 0;
+volatile bool readyShoot = false;
+static uint8_t sampleCount = 0;
+
+// fish speeds and colors
+static rng_t gameRng;
+
 // possible colors for the fish
 uint16_t colorArray[6] = {LCD_COLOR_RED, LCD_COLOR_GREEN, LCD_COLOR_ORANGE,
 													LCD_COLOR_WHITE, LCD_COLOR_BLACK, LCD_COLOR_YELLOW};
 
-_GameCharacter octopus ={58,54, //width, height
-												120,OCTOPUS_Y_MAX, //x, y
-												octopus_Bitmap,
-												LCD_COLOR_WHITE,
-												LCD_COLOR_BLUE,
-												"character",
-												OCTOPUS_X_MAX,
-												OCTOPUS_X_MIN,
-												false, // unneeded for octopus
-												false};
-
-												
-												
-										
-_GameCharacter fishArray[] =
+entity_t octopus = ENTITY_NONE;
+
+// starting places, centers for the sprites
+typedef struct
 {
-	
-	//Fish 0
-	{
-		39, 31, // width,height
-		130, 205, // xPos, yPos
-		fishLeft_Bitmap,
-		LCD_COLOR_BLACK,
-		BG_COLOR,
-		"character",
-		FISH_X_MAX,
-		FISH_Y_MIN,
-		false,				// move right
-		false
-	},
-
-	//Fish 1
-	{
-		39, 31, // width,height
-		10, 19,
-		fishRight_Bitmap,
-		LCD_COLOR_GREEN,
-		BG_COLOR,
-		"character",
-		FISH_X_MAX,
-		FISH_Y_MIN,
-		true,
-		false
-	},
-	
-	//Fish 2
-	{
-		39, 31, // width,height
-		210, 100, // x, y
-		fishRight_Bitmap,
-		LCD_COLOR_ORANGE,
-		BG_COLOR,
-		"character",
-		FISH_X_MAX,
-		FISH_Y_MIN,
-		true,
-		false
-	},
-	
-	//Fish 3
-	{
-		39, 31, // width,height
-		75, 150, // x, y
-		fishLeft_Bitmap,
-		LCD_COLOR_YELLOW,
-		BG_COLOR,
-		"character",
-		FISH_X_MAX,
-		FISH_Y_MIN,
-		false,
-		false
-	}
-	
+	int16_t x;
+	int16_t y;
+	bool moveRight;
+	uint16_t fColor;
+} fishStart_t;
+
+typedef struct
+{
+	int16_t x;
+	int16_t y;
+	uint8_t width;
+	uint8_t height;
+	int16_t max_X;
+	bool moveRight;
+	uint16_t fColor;
+} shieldStart_t;
+
+static const fishStart_t fishStart[NUM_FISH] =
+{
+	{130, 205, false, LCD_COLOR_BLACK},
+	{ 10,  19, true,  LCD_COLOR_GREEN},
+	{210, 100, true,  LCD_COLOR_ORANGE},
+	{ 75, 150, false, LCD_COLOR_YELLOW}
 };
-							
 
+static const shieldStart_t shieldStart[NUM_SHIELDS] =
+{
+	{100,  50, 50, 5, 239 - 50, true,  LCD_COLOR_YELLOW},
+	{ 10, 120, 30, 7, 239 - 30, false, LCD_COLOR_BLACK},
+	{  5, 250, 30, 6, 239 - 70, false, LCD_COLOR_WHITE}
+};
 
-_GameObj shieldArray[] =
-{	
-	// Rectangle 0
-	{50, 5, 1, 			// width, height, border
-	100, 50, 					//x,y
-	LCD_COLOR_YELLOW,		// fill
-	BG_COLOR,  //border	
-	"object",
-	239 - 50,					// max x
-	1,								// min y (top of screen)
-	true,
-	false},
+void game_create_entities(void)
+{
+	entity_t e;
+	uint8_t i;
 	
-	//Rectangle 1
-	{30, 7, 1, 				// width, height, border
-	10, 120, 						//x,y
-	LCD_COLOR_BLACK,		// fill
-	BG_COLOR,  	//border	
-	"object",
-	239 - 30,
-	10,									// min y
-	false,							// moveRight
-	false},
+	entity_reset();
 	
-	//Rectangle 2
-	{30, 6, 1, 				// width, height, border
-	5, 250, 					//x,y
-	LCD_COLOR_WHITE,		// fill
-	BG_COLOR,  				//border	
-	"object",
-	239 - 70,
-	20,								// min y
-	false,						// moveRight
-	false}
+	// the sprite limits are for its center, the store's for the corner
+	octopus = entity_create(ENTITY_PLAYER, 0, 0, 0, 0);
+	entity_set_sprite(octopus, &octopus_image, 0, LCD_COLOR_WHITE, LCD_COLOR_BLUE);
+	entities.x[octopus] = 120 - entities.width[octopus] / 2;
+	entities.y[octopus] = OCTOPUS_Y_MAX - entities.height[octopus] / 2;
+	entities.min_x[octopus] = OCTOPUS_X_MIN - entities.width[octopus] / 2;
+	entities.max_x[octopus] = OCTOPUS_X_MAX - entities.width[octopus] / 2;
 	
-
-																				
-};				
-
-uint8_t numShields = sizeof(shieldArray)/ sizeof(shieldArray[0]);
-uint8_t numFish = sizeof(fishArray) / sizeof(fishArray[0]);
-
-_GameObj bullet = {10, 10, 1, 			// width, height, border
-									0, 0, 					//x,y
-									LCD_COLOR_RED,		// fill
-									BG_COLOR,  //border	
-									"object",
-									239 - 10,
-									1,							//min y, probably take out
-									false}; 
-											
-void move_Left(uint16_t xPos, 
-							uint16_t yPos, 
-							uint32_t num_pixels, 
-							uint16_t minX,
-							const char type[],
-							void* ptr)
-{
-	// loop variable
-	uint16_t i;
+	for (i = 0; i < NUM_FISH; i++)
+	{
+		e = entity_create(ENTITY_FISH, 0, 0, 0, 0);
+		entity_set_sprite(e, &fishRight_image, fishStart[i].moveRight ? 0 : IMAGE_FLIP_H,
+											fishStart[i].fColor, BG_COLOR);
+		entities.x[e] = fishStart[i].x - entities.width[e] / 2;
+		entities.y[e] = fishStart[i].y - entities.height[e] / 2;
+		entities.min_x[e] = FISH_X_MIN - entities.width[e] / 2;
+		entities.max_x[e] = FISH_X_MAX - entities.width[e] / 2;
+		entities.vx[e] = fishStart[i].moveRight ? 1 : -1;
+	}
 	
-	// check if going to hit left of screen
-	if ((int)(xPos - num_pixels) < minX){
-		// draw saucer left until reach left of screen
-		// flip its direction
-		for(i = xPos; i >= minX; i--){
-			// update x, keep y fixed
-			//lcd_clear_screen(LCD_COLOR_GREEN);
-			if (!strcmp(type,"character")) drawCharacter((_GameCharacter*)ptr, i, yPos); 
-			else if (!strcmp(type, "object"))  drawObject((_GameObj*) ptr, i, yPos);
-		}
+	for (i = 0; i < NUM_SHIELDS; i++)
+	{
+		e = entity_create(ENTITY_SHIELD, shieldStart[i].x, shieldStart[i].y,
+											shieldStart[i].width, shieldStart[i].height);
+		entity_set_box(e, 1, shieldStart[i].fColor, BG_COLOR);
+		entities.min_x[e] = 1;
+		entities.max_x[e] = shieldStart[i].max_X;
+		entities.vx[e] = shieldStart[i].moveRight ? 1 : -1;
 	}
-	else {
-		// must save because xPos is updated every iteration in the loop
-		uint16_t final_x = xPos - num_pixels;
-		// draw saucer left the correct # of pixels
-		// start at xPos and go until you hit (xPos - num_pixels)
-		for(i = xPos; i >= final_x; i--){
-			// update x, keep y fixed
-			//lcd_clear_screen(LCD_COLOR_GREEN);
-			if (!strcmp(type,"character")) drawCharacter((_GameCharacter*)ptr, i, yPos); 
-			else if (!strcmp(type, "object"))  drawObject((_GameObj*) ptr, i, yPos);
-		}
+	
+	// nothing is on the LCD yet
+	for (e = 0; e < entities.count; e++)
+	{
+		entity_drawn(e);
+		entities.flags[e] |= ENTITY_MOVED;
 	}
 }
 
+void movePlayer(int8_t dx)
+{
+	entities.vx[octopus] = dx;
+	entity_update(ENTITY_MASK(ENTITY_PLAYER));
+	entities.vx[octopus] = 0;
+	drawEntity(octopus);
+}
 
-void move_Right(uint16_t xPos, 
-								uint16_t yPos, 
-								uint32_t num_pixels, 
-								uint16_t maxX,
-								const char type[],
-								void* ptr)
+// a fish of the same color as the bullet, the bullet passes the others
+static entity_t fishHitBy(entity_t bullet)
 {
-	// loop variable
+	uint16_t count = entities.count;
 	uint16_t i;
 	
-	// check if going to hit right of screen
-	if ((xPos + num_pixels) > maxX){
-		// draw saucer right until reach right of screen
-		for(i = xPos; i <= maxX; i++){
-			// update x, keep y fixed
-			//lcd_clear_screen(LCD_COLOR_GREEN);
-			if (!strcmp(type,"character")) drawCharacter((_GameCharacter*)ptr, i, yPos);
-			else if (!strcmp(type, "object"))  drawObject((_GameObj*) ptr, i, yPos);
-		}
-	}
-	else {
-		// must save because xPos is updated every iteration in the loop
-		uint16_t final_x = xPos + num_pixels;
-		// draw saucer right the correct # of pixels
-		// start at xPos and go until you hit (xPos + num_pixels)
-		for(i = xPos; i <= final_x; i++){
-			// update x, keep y fixed
-			//lcd_clear_screen(LCD_COLOR_GREEN);
-			if (!strcmp(type,"character")) drawCharacter((_GameCharacter*)ptr, i, yPos); 
-			else if (!strcmp(type, "object"))  drawObject((_GameObj*) ptr, i, yPos);
+	for (i = 0; i < count; i++)
+	{
+		if ((entities.flags[i] & ENTITY_ACTIVE) && entities.type[i] == ENTITY_FISH &&
+				entities.fColor[i] == entities.fColor[bullet] &&
+				entities.x[i] < entities.x[bullet] + entities.width[bullet] &&
+				entities.x[bullet] < entities.x[i] + entities.width[i] &&
+				entities.y[i] < entities.y[bullet] + entities.height[bullet] &&
+				entities.y[bullet] < entities.y[i] + entities.height[i])
+		{
+			return i;
 		}
 	}
+	return ENTITY_NONE;
 }
 
-
-
-void shootBullet (uint16_t xPos, 
-								  uint16_t yPos, 
-								  _GameObj* obj)
+void shootBullet(int16_t x, int16_t y, uint16_t color)
 {	
 	// loop variable
 	uint16_t i,j;
-	obj->yPos = yPos;
-	obj->xPos = xPos;
+	entity_t bullet;
+	bool hit = false;
+	
+	bullet = entity_create(ENTITY_BULLET, x, y, BULLET_SIZE, BULLET_SIZE);
+	if (bullet == ENTITY_NONE)
+	{
+		return;
+	}
+	entity_set_box(bullet, 1, color, BG_COLOR);
+	entities.vy[bullet] = -1;
 	
 	// while bullet hasnt reached top of screen or hit a shield
-	while ( (obj->yPos > 1) && !obj->hit)
+	while ((entities.y[bullet] > 1) && !hit)
 	{
-		obj->yPos--;
-		
-		drawObject(obj, obj->xPos, obj->yPos);
+		entity_update(ENTITY_MASK(ENTITY_BULLET));
+		drawEntity(bullet);
 		
 		// Check if bullet has hit any shields
-		 for (i = 0; i < numShields; i++)
+		if (entity_collide(bullet, ENTITY_MASK(ENTITY_SHIELD)) != ENTITY_NONE)
 		{
-					 if (obj->yPos == (shieldArray[i].yPos + shieldArray[i].height) &&
-						   obj->xPos < (shieldArray[i].xPos + shieldArray[i].width) &&
-							 (obj->xPos + obj->width) >= shieldArray[i].xPos)
-					 {
-						 obj->hit = true;
-		
-					 }	 
-		// empty loop to make bullet move slower
-		for (j = 0; j<5000; j++){}
+			hit = true;
 		}
 		
 		// Check if bullet has hit any fish
-		 for (i = 0; i < numFish; i++)
+		if (!hit && fishHitBy(bullet) != ENTITY_NONE)
 		{
-					 if (obj->yPos == (fishArray[i].yPos + fishArray[i].height) && // height collison
-						   obj->xPos < (fishArray[i].xPos + fishArray[i].width/2) && // less than right side of fish
-							 (obj->xPos + obj->width + 13) >= fishArray[i].xPos && 	 // greater than left side of fish]
-					     obj->fColor == fishArray[i].fColor)  												// same color bullet as fish
-				
-					 {
-						 obj->hit = true;
-						 fishHit = true;
-						 fishArray[i].hit = true;
-						 numBullets++;
-						 score++;
-						 break;
-					 }	 
+			hit = true;
+			fishHit = true;
+			numBullets++;
+			score++;
 		}
 		
-		
 		// empty loop to make bullet move slower
-	for (j = 0; j<5000; j++){}
+		for (j = 0; j<20000; j++){}
 		
 		if (fishHit == true)
 		{
-			for (i = 0; i < numFish; i++)
+			for (i = 0; i < entities.count; i++)
 			{
+				if (!(entities.flags[i] & ENTITY_ACTIVE) || entities.type[i] != ENTITY_FISH)
+				{
+					continue;
+				}
+				
 				// erase old fish
-				lcd_draw_image
-				(
-        fishArray[i].xPos,                         // X Pos
-        fishArray[i].width,        // Image Horizontal Width
-        fishArray[i].yPos,                       // Y Pos
-        fishArray[i].height,       // Image Vertical Height
-        fishArray[i].bitmap,            // Image
-        fishArray[i].bColor,              // Foreground Color
-        fishArray[i].bColor              // Background Color
-				);
+				eraseRect(entities.drawn_x[i], entities.drawn_y[i], entities.width[i], entities.height[i]);
 				
-				// randomly switch color of fish
-				fishArray[i].fColor = colorArray[(rand() % 6)];
-				fishArray[i].xPos = rand() % 200;
+				// randomly switch color of fish, it shows up on its next move
+				entities.fColor[i] = colorArray[rng_below(&gameRng, 6)];
+				entities.x[i] = rng_below(&gameRng, 200) - entities.width[i] / 2;
+				entity_drawn(i);
+				entities.flags[i] |= ENTITY_MOVED;
 			}
 		}
 	}
 	
+	// erase bullet, the box covers width + 1 columns
+	eraseRect(entities.drawn_x[bullet], entities.drawn_y[bullet],
+						entities.width[bullet] + 1, entities.height[bullet]);
+	entity_destroy(bullet);
+}
+
+
+// paints the playfield background over a rectangle
+void eraseRect(int16_t x0, int16_t y0, uint16_t width, uint16_t height)
+{
+	if (game_background != NULL)
+	{
+		tilemap_erase(game_background, x0, y0, width, height);
+	}
+	else
+	{
+		dl_fill_rect(x0, y0, width, height, BG_COLOR);
+	}
+}
+
+// erases the part of old that cover does not hide, at most four strips
+static void eraseUncovered(lcd_rect_t old, const lcd_rect_t* cover)
+{
+	if (old.x1 < cover->x0 || old.x0 > cover->x1 || old.y1 < cover->y0 || old.y0 > cover->y1)
+	{
+		eraseRect(old.x0, old.y0, old.x1 - old.x0 + 1, old.y1 - old.y0 + 1);
+		return;
+	}
 	
+	if (old.y0 < cover->y0)
+	{
+		eraseRect(old.x0, old.y0, old.x1 - old.x0 + 1, cover->y0 - old.y0);
+		old.y0 = cover->y0;
+	}
+	if (old.y1 > cover->y1)
+	{
+		eraseRect(old.x0, cover->y1 + 1, old.x1 - old.x0 + 1, old.y1 - cover->y1);
+		old.y1 = cover->y1;
+	}
+	if (old.x0 < cover->x0)
+	{
+		eraseRect(old.x0, old.y0, cover->x0 - old.x0, old.y1 - old.y0 + 1);
+	}
+	if (old.x1 > cover->x1)
+	{
+		eraseRect(cover->x1 + 1, old.y0, old.x1 - cover->x1, old.y1 - old.y0 + 1);
+	}
+}
+
+// indexed sprites keep their shading, only palette entry 0 (background) and
+// entry 1 (body) are swapped for the entity's colors
+static const uint16_t* entityPalette(entity_t e, uint16_t palette[16])
+{
+	const image_t* image = entities.image[e];
 	
-	// erase bullet
-	lcd_draw_box(obj->xPos, //x start
-								obj->width, // x len
-								obj->yPos, //y s start
-								obj->height, // y len
-								BG_COLOR, //border
-								BG_COLOR, //fill
-								obj->border_weight
-								);
-	obj->hit = false;
+	if (IMAGE_IS_INDEXED(image->format) && image->palette_size >= 2 && image->palette_size <= 16)
+	{
+		memcpy(palette, image->palette, image->palette_size * sizeof(uint16_t));
+		palette[0] = entities.bColor[e];
+		palette[1] = entities.fColor[e];
+		return palette;
+	}
+	return NULL;
 }
 
+// display list callback, the sprite over the background inside the clip
+// rect.  It runs at dl_end, so it always draws the sprite where it is now.
+static void drawSpriteOverBackground(void* context)
+{
+	entity_t e = (entity_t)(uintptr_t)context;
+	uint16_t palette[16];
+	lcd_rect_t clip = lcd_get_clip();
+	tilemap_sprite_t sprite;
+	
+	sprite.image = entities.image[e];
+	sprite.x_center = entity_center_x(e);
+	sprite.y_center = entity_center_y(e);
+	sprite.flags = entities.image_flags[e];
+	sprite.fColor = entities.fColor[e];
+	sprite.palette = entityPalette(e, palette);
+	tilemap_draw(game_background, clip.x0, clip.y0, clip.x1, clip.y1, &sprite, 1);
+}
 
-// draw the character based on struct
-void drawCharacter(_GameCharacter* character, uint16_t x, uint16_t y) 
+// sprites are centered on their bounding box
+static void drawSprite(entity_t e)
 {		
-	// update x and y struct variables
-	character->yPos = y;
-	character->xPos = x;
-	lcd_draw_image
-    (
-        x,         							// X Pos
-        character->width,        // Image Horizontal Width
-        y,         							// Y Pos
-        character->height,       // Image Vertical Height
-        character->bitmap,       // Image
-        character->fColor,       // Foreground Color
-        character->bColor        // Background Color
-    );
+	uint16_t palette[16];
+	int16_t x = entities.x[e];
+	int16_t y = entities.y[e];
+	int16_t old_x = entities.drawn_x[e];
+	int16_t old_y = entities.drawn_y[e];
+	int16_t width = entities.width[e];
+	int16_t height = entities.height[e];
+	
+	// over a tile map the sprite is composed with the background under
+	// both its old and new position, which erases and draws in one pass
+	if (game_background != NULL)
+	{
+		dl_draw(
+			(old_x < x) ? old_x : x,
+			(old_y < y) ? old_y : y,
+			((old_x > x) ? old_x : x) + width - 1,
+			((old_y > y) ? old_y : y) + height - 1,
+			true,
+			drawSpriteOverBackground,
+			(void*)(uintptr_t)e
+		);
+		return;
+	}
+	
+	dl_image(entities.image[e], entity_center_x(e), entity_center_y(e), entities.image_flags[e],
+					 entities.fColor[e], entities.bColor[e], entityPalette(e, palette));
 }
 
-
-void drawObject(_GameObj* obj, uint16_t x, uint16_t y)
+static void drawBox(entity_t e)
 {
-	//printf("x: %d\n", x);
-	obj->yPos = y;
-	obj->xPos = x;
+	lcd_rect_t old;
+	lcd_rect_t now;
+	int16_t x = entities.x[e];
+	int16_t y = entities.y[e];
+	uint16_t border = entities.bColor[e];
 	
-	lcd_draw_box(
+	// the border is BG_COLOR so a box moving less than its border width
+	// erases its own trail.  Over a tile map the uncovered strip is redrawn
+	// from the map instead and the border takes the fill color.
+	if (game_background != NULL)
+	{
+		old.x0 = entities.drawn_x[e];
+		old.y0 = entities.drawn_y[e];
+		old.x1 = old.x0 + entities.width[e];
+		old.y1 = old.y0 + entities.height[e] - 1;
+		now.x0 = x;
+		now.y0 = y;
+		now.x1 = x + entities.width[e];
+		now.y1 = y + entities.height[e] - 1;
+		eraseUncovered(old, &now);
+		border = entities.fColor[e];
+	}
+	
+	dl_draw_box(
 			x, //x start
-			obj->width, // x len
+			entities.width[e], // x len
 			y, //y s start
-			obj->height, // y len
-			obj->bColor, //border
-			obj->fColor, //fill
-			obj->border_weight
+			entities.height[e], // y len
+			border, //border
+			entities.fColor[e], //fill
+			entities.border[e]
 		);
 }
 
-void moveShields()
+void drawEntity(entity_t e)
+{
+	if (entities.image[e] != NULL)
 	{
-		int numPixels,i;
-			// Move the shields
-			for (i = 0; i < numShields; i++)
-			{
-				// generate random number to move by in range 1 to 10
-				numPixels = (rand() % 10) + 1;
-				
-				if (shieldArray[i].moveRight) 
-				{
-						// check if should switch direction
-						if (shieldArray[i].xPos + numPixels >= shieldArray[i].max_X) shieldArray[i].moveRight = false;
-						move_Right(shieldArray[i].xPos, shieldArray[i].yPos, numPixels, shieldArray[i].max_X, shieldArray[i].type, &shieldArray[i]);
-					
-				}
-				else
-				{
-					if (shieldArray[i].xPos - numPixels <= 1) shieldArray[i].moveRight = true;
-					move_Left(shieldArray[i].xPos, shieldArray[i].yPos, numPixels, 1, shieldArray[i].type, &shieldArray[i]);
-				}
-			}
+		drawSprite(e);
+	}
+	else
+	{
+		drawBox(e);
+	}
+	entity_drawn(e);
+}
+
+void drawEntities(uint8_t types)
+{
+	uint16_t i;
+	
+	for (i = 0; i < entities.count; i++)
+	{
+		if ((entities.flags[i] & (ENTITY_ACTIVE | ENTITY_MOVED)) == (ENTITY_ACTIVE | ENTITY_MOVED) &&
+				(types & ENTITY_MASK(entities.type[i])))
+		{
+			drawEntity(i);
+		}
+	}
+}
+
+// each move is a new random 1 to 10 pixels in the direction it is going
+static void randomSpeed(uint8_t types)
+{
+	uint16_t i;
+	int8_t speed;
+	
+	for (i = 0; i < entities.count; i++)
+	{
+		if ((entities.flags[i] & ENTITY_ACTIVE) && (types & ENTITY_MASK(entities.type[i])))
+		{
+			speed = rng_below(&gameRng, 10) + 1;
+			entities.vx[i] = (entities.vx[i] < 0) ? -speed : speed;
 		}
+	}
+}
+
+void moveShields()
+{
+	randomSpeed(ENTITY_MASK(ENTITY_SHIELD));
+	entity_update(ENTITY_MASK(ENTITY_SHIELD));
+	drawEntities(ENTITY_MASK(ENTITY_SHIELD));
+}
 	
 void moveFish()
+{
+	uint16_t i;
+	
+	randomSpeed(ENTITY_MASK(ENTITY_FISH));
+	entity_update(ENTITY_MASK(ENTITY_FISH));
+	
+	// fish face the way they swim
+	for (i = 0; i < entities.count; i++)
 	{
-		int numPixels,i;
-			// Move the shields
-			for (i = 0; i < numFish; i++)
-			{
-				// generate random number to move by in range 1 to 10
-				numPixels = (rand() % 10) + 1;
-				if (fishArray[i].moveRight) 
-				{
-						// check if should switch direction
-						if (fishArray[i].xPos + numPixels >= fishArray[i].max_X - 10)
-						{
-							fishArray[i].moveRight = false;
-							fishArray[i].bitmap = fishLeft_Bitmap;
-						}
-
-						move_Right(fishArray[i].xPos, fishArray[i].yPos, numPixels, fishArray[i].max_X, fishArray[i].type, &fishArray[i]);
-				}
-				else
-				{
-					if (fishArray[i].xPos - numPixels <= 20)
-					{
-						fishArray[i].moveRight = true;
-						
-						
-						
-						fishArray[i].bitmap = fishRight_Bitmap;
-					}
-					move_Left(fishArray[i].xPos, fishArray[i].yPos, numPixels, 1, fishArray[i].type, &fishArray[i]);
-				}
-			}
+		if (entities.type[i] == ENTITY_FISH)
+		{
+			entities.image_flags[i] = (entities.vx[i] < 0) ? IMAGE_FLIP_H : 0;
 		}
+	}
+	drawEntities(ENTITY_MASK(ENTITY_FISH));
+}
 
 
 void checkShooting()
 {
-			int i;
- 
+	bool recording;
+	
 				// after moving check if you should shoot
 			if (readyShoot && (touch_event > 0))
 				 {
@@ -407,8 +427,170 @@ void checkShooting()
 					 // have to wait again until ready to shoot
 					 readyShoot = false;
 					 numBullets--;
-					 shootBullet(octopus.xPos -5, octopus.yPos - octopus.height/2 - 9, &bullet);
+					 
+					 // the bullet's flight blocks and draws every step as it
+					 // goes, so it never runs inside a display list frame
+					 recording = dl_recording();
+					 if (recording)
+					 {
+						 dl_end();
+					 }
+					 shootBullet(entity_center_x(octopus) - 5, entities.y[octopus] - 9,
+											 entities.fColor[octopus]);
+					 if (recording)
+					 {
+						 dl_begin();
+					 }
 				 }
 }
 
+//*****************************************************************************
+//*****************************************************************************
+void hud_init(void) {
+		// num bullets. Depending on bullet color, BG COLOR will be different.
+		widget_init(&hud[HUD_BULLETS], WIDGET_COUNTER, 0, 300, 80, 20,
+			LCD_COLOR_WHITE, LCD_COLOR_RED, LCD_COLOR_BLACK, 2);
+		hud[HUD_BULLETS].format = "%d bullets:";
+	
+		// score
+		widget_init(&hud[HUD_SCORE], WIDGET_COUNTER, 0, 280, 80, 20,
+			LCD_COLOR_BLACK, LCD_COLOR_GREEN, LCD_COLOR_BLACK, 2);
+		hud[HUD_SCORE].format = "score %d:";
+}
+
+//*****************************************************************************
+//*****************************************************************************
+void drawInitialImages(void) {
+		dl_begin();
+		
+		drawEntities(ENTITY_ALL);
+		
+		dl_end();
+}
+
+void game_sample(int16_t x, uint8_t touches)
+{
+	if (sampleCount == 0)
+	{
+		readyShoot = true;
+	}
+	touch_event = touches;
+	x_accel = x;
+	// can shoot about ~0.5s
+	sampleCount = (sampleCount + 1) % SHOOT_SAMPLES;
+}
+
+void game_button(uint8_t btn)
+{
+	switch (btn)
+	{
+		case BTN_L:
+			// loop around array
+			if (colorArrayIndex == 0) colorArrayIndex = 5;
+			else colorArrayIndex--;
+			colorChange = true;
+			break;
+		
+		case BTN_R:
+			colorArrayIndex = (colorArrayIndex + 1) % 6;
+			colorChange = true;
+			break;
+			
+		case BTN_U:
+			showHUD = !showHUD;
+			break;
+		
+		case BTN_D:
+			pause = !pause;
+			break;
+		
+		default:
+			break;
+	}
+}
+
+void game_start(uint32_t seed)
+{
+	rng_seed(&gameRng, seed);
+	score = 0;
+	numBullets = START_BULLETS;
+	eraseRect(0, 0, COLS, ROWS);
+	game_create_entities();
+	drawInitialImages();
+	hud_init();
+}
 
+bool game_frame(void)
+{
+	// update octopus color, bullets take the octopus' color
+	entities.fColor[octopus] = colorArray[colorArrayIndex];
+	
+	// redraw octopus if color changed
+	if (colorChange == true) 
+	{
+		drawEntity(octopus);
+		// wait until another button press
+		colorChange = false;
+	}
+	
+	// the shields and fish are drawn as one display list frame so
+	// only the last position of each plus the strips it left behind
+	// reach the LCD
+	dl_begin();
+	moveShields();
+	moveFish();
+	dl_end();
+	
+	//check numBullets
+	if (numBullets == 0)
+	{
+		return false;
+	}
+	
+	// a shot before the move is drawn on its own
+	checkShooting();
+	
+	// the player and the HUD are one display list frame, so the HUD hides
+	// the part of the octopus under it and a redrawn widget's text hides
+	// the fill under it.  A shot after the move ends the frame first.
+	dl_begin();
+	
+	// Check x values of accelerometer
+	if (x_accel > MOVE_LEFT)
+	{
+		movePlayer(-4);
+		checkShooting();
+	}
+	else if (x_accel < MOVE_RIGHT)
+	{
+		movePlayer(4);
+		checkShooting();
+	}
+	
+	// the octopus can swim over the HUD
+	if (x_accel > MOVE_LEFT || x_accel < MOVE_RIGHT)
+	{
+		widget_damage(hud, HUD_WIDGETS,
+			entities.x[octopus], entities.y[octopus],
+			entities.x[octopus] + entities.width[octopus] - 1,
+			entities.y[octopus] + entities.height[octopus] - 1);
+	}
+	
+	// check if user wants to see this printed out or not.  The widgets
+	// only redraw when their value changes or something drew over them.
+	if (showHUD) {
+		widget_show(&hud[HUD_BULLETS]);
+		widget_show(&hud[HUD_SCORE]);
+	}
+	else
+	{
+		widget_hide(&hud[HUD_BULLETS], BG_COLOR);
+		widget_hide(&hud[HUD_SCORE], BG_COLOR);
+	}
+	widget_set_value(&hud[HUD_BULLETS], numBullets);
+	widget_set_value(&hud[HUD_SCORE], score);
+	widget_update(&hud[HUD_BULLETS]);
+	widget_update(&hud[HUD_SCORE]);
+	dl_end();
+	return true;
+}
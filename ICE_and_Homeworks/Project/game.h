@@ -2,6 +2,10 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include "lcd.h"
+#include "display_list.h"
+#include "tilemap.h"
+#include "entity.h"
+#include "rng.h"
 #include "images.h"
 #include <string.h>
 #include "validate.h"
@@ -9,6 +13,7 @@
 #include "timers.h"
 #include "io_expander.h"
 #include "eeprom.h"
+#include "widgets.h"
 
 #define UFO_X_MAX 214
 #define UFO_X_MIN 26
@@ -20,8 +25,10 @@
 #define OCTOPUS_Y_MAX		293
 #define OCTOPUS_Y_MIN		27
 
-#define FISH_X_MAX 		221
-#define FISH_X_MIN 		19
+// fish turn around once half of them has swum off the screen, the draws
+// are clipped so the rest of the sprite is simply not sent
+#define FISH_X_MAX 		(COLS - 1)
+#define FISH_X_MIN 		0
 #define FISH_Y_MAX 		305
 #define FISH_Y_MIN 		15
 
@@ -32,80 +39,81 @@
 
 #define BG_COLOR     LCD_COLOR_BLUE
 
+// the playfield background is one screen of 16x16 tiles
+#define OCEAN_COLUMNS		(COLS / 16)
+#define OCEAN_ROWS			(ROWS / 16)
 
-// for things that need a bitmap
-typedef struct _GameCharacter
-{
-	 const uint16_t width;
-	 const uint16_t height;
-	 uint16_t xPos;					// width, in bits (or pixels), of the character
-	 uint16_t yPos;					// offset of the character's bitmap, in bytes, into the the FONT_INFO's data array
-	 const uint8_t* bitmap;
-	 uint16_t fColor;
-	 uint16_t bColor;
-	 const char* type;
-	 uint16_t max_X;
-	 uint16_t min_X;
-	 bool moveRight;
-	 bool hit;
-}_GameCharacter;
-
-// for rectangle obstacles
-typedef struct _GameObj
-{
-	 uint16_t width;
-	 uint16_t height;
-	 uint16_t border_weight;
-	 uint16_t xPos;					// width, in bits (or pixels), of the character
-	 uint16_t yPos;					// offset of the character's bitmap, in bytes, into the the FONT_INFO's data array
-	 uint16_t fColor;
-	 uint16_t bColor;
-	 const char* type;
-	 uint16_t max_X;
-	 uint16_t min_Y;
-	 bool moveRight;
-	 bool hit;
-}_GameObj;
-
-
-
-extern _GameCharacter ufo;
-extern _GameCharacter octopus;
-
-extern _GameObj shieldArray[];
-extern _GameCharacter fishArray[];
-extern uint8_t numFish;
-extern uint8_t numShields;
+
+#define NUM_FISH			4
+#define NUM_SHIELDS		3
+
+// bullets are boxes fired up from the octopus
+#define BULLET_SIZE		10
+#define START_BULLETS	7
+
+// accelerometer samples between shots, about 0.5s
+#define SHOOT_SAMPLES	30
+
+// HUD widgets in the lower left corner
+#define HUD_BULLETS   0
+#define HUD_SCORE     1
+#define HUD_WIDGETS   2
+
+extern entity_t octopus;
 
 extern uint16_t colorArray[6];
+extern uint8_t colorArrayIndex;
+
+extern int score, numBullets;
+extern bool fishHit;
+extern bool showHUD;
+extern bool pause;
+
+// the input the game plays from, set by game_sample
+extern int16_t x_accel;
+extern volatile uint8_t touch_event;
+extern volatile bool readyShoot;
+
+// one accelerometer x and touch sample, from the TIMER4 tick
+void game_sample(int16_t x, uint8_t touches);
 
+// one push button, the MCP23017 port B capture
+void game_button(uint8_t btn);
 
-extern _GameObj bullet;
-extern _GameObj eraseBullet;
+// clears the screen, puts everything at its starting place and resets the
+// score and bullets.  The fish move the same way every game with one seed.
+void game_start(uint32_t seed);
 
-void move_Right(uint16_t xPos, 
-								uint16_t yPos, 
-								uint32_t num_pixels, 
-								uint16_t maxX,
-								const char type[],
-								void* ptr);
+// one frame of play.  Returns false once the bullets have run out.
+bool game_frame(void);
 
-void move_Left(uint16_t xPos, 
-							uint16_t yPos, 
-							uint32_t num_pixels, 
-							uint16_t minX,
-							const char type[],
-							void* ptr);
-	
-// used to shoot bullet up
-void shootBullet	 (uint16_t xPos, 
-								uint16_t yPos, 
-								_GameObj* obj);
+// creates the octopus, fish and shields at their starting places
+void game_create_entities(void);
 
+// moves the octopus dx pixels, it stops at the sides
+void movePlayer(int8_t dx);
+
+// used to shoot bullet up, x and y are the bullet's upper left corner
+void shootBullet(int16_t x, int16_t y, uint16_t color);
+
+
+// background drawn under everything, NULL for a flat BG_COLOR playfield
+extern const tilemap_t ocean_background;
+extern const tilemap_t* game_background;
+
+// paints the playfield background over a rectangle
+void eraseRect(int16_t x0, int16_t y0, uint16_t width, uint16_t height);
+
+// moves the entity on the LCD from where it was drawn to where it is
+void drawEntity(entity_t e);
+
+// draws the entities of the types in mask that moved
+void drawEntities(uint8_t types);
 
-void drawCharacter(_GameCharacter* character, uint16_t x, uint16_t y); 
-void drawObject(_GameObj* obj, uint16_t x, uint16_t y);
 void checkShooting();
 void moveShields();
 void moveFish();
+
+void hud_init(void);
+void drawInitialImages(void);
 	
\ No newline at end of file
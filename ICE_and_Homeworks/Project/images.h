@@ -23,6 +23,7 @@
 #define __IMAGES_H__
 
 #include <stdint.h>
+#include "image.h"
 
 /* Bitmap info for space_ship */
 extern const uint8_t hotdog_Bitmap[];
@@ -31,21 +32,25 @@ extern const uint8_t hotdog_height;
 
 extern const uint8_t octopus_width;
 extern const uint8_t octopus_height;
-extern const uint8_t octopus_Bitmap[];
+
+// 2bpp indexed: background, body and shading.  Regenerate with
+//    imgconv -f i2 -n octopus_image bmp/octopus.bmp > octopus_image.c
+extern const image_t octopus_image;
+
+// 4bpp tileset, six 16x16 tiles stacked top to bottom.  Regenerate with
+//    imgconv -f i4 -n ocean_tiles_image bmp/ocean_tiles.bmp > ocean_tiles_image.c
+extern const image_t ocean_tiles_image;
 
 extern const uint8_t fish_width;
 extern const uint8_t fish_height;
 extern const uint8_t fishRight_Bitmap[];
-extern const uint8_t fishLeft_Bitmap[];
-
-
-// maybe put in other file
-
+extern const image_t fishRight_image;        // draw with IMAGE_FLIP_H to face left
 
-extern const uint8_t start_map[];
-extern const uint16_t start_width;
-extern const uint16_t start_height;
 
-extern const uint8_t endscreen_Bitmap[];
+// Full screen art, run length encoded.  Regenerate from the Project folder:
+//    imgconv -n start_image bmp/start.bmp > start_image.c
+//    imgconv -n endscreen_image bmp/endscreen.bmp > endscreen_image.c
+extern const image_t start_image;
+extern const image_t endscreen_image;
 
 #endif
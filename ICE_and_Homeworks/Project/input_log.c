@@ -0,0 +1,107 @@
+#include "input_log.h"
+#include "game.h"
+
+static input_log_sink_t recordSink = NULL;
+
+static const input_event_t *replayLog = NULL;
+static uint32_t replayLength = 0;
+static uint32_t replayNext = 0;
+
+// game frames played since input_record or input_replay
+static uint32_t frames = 0;
+
+static void record(char type, int32_t value, uint8_t touches)
+{
+	input_event_t event;
+	
+	if (recordSink == NULL)
+	{
+		return;
+	}
+	event.frame = frames;
+	event.type = type;
+	event.value = value;
+	event.touches = touches;
+	recordSink(&event);
+}
+
+void input_record(input_log_sink_t sink)
+{
+	recordSink = sink;
+	frames = 0;
+}
+
+void input_replay(const input_event_t *log, uint32_t length)
+{
+	replayLog = log;
+	replayLength = length;
+	replayNext = 0;
+	frames = 0;
+}
+
+bool input_replaying(void)
+{
+	return replayNext < replayLength;
+}
+
+void input_poll(void)
+{
+	const input_event_t *event;
+	
+	// a game start waits for input_game_start
+	while (input_replaying() && replayLog[replayNext].frame <= frames &&
+				 replayLog[replayNext].type != INPUT_GAME)
+	{
+		event = &replayLog[replayNext++];
+		if (event->type == INPUT_SAMPLE)
+		{
+			game_sample(event->value, event->touches);
+		}
+		else if (event->type == INPUT_BUTTON)
+		{
+			game_button(event->value);
+		}
+		record(event->type, event->value, event->touches);
+	}
+}
+
+void input_sample(int16_t x, uint8_t touches)
+{
+	if (input_replaying())
+	{
+		return;
+	}
+	game_sample(x, touches);
+	record(INPUT_SAMPLE, x, touches);
+}
+
+void input_button(uint8_t btn)
+{
+	if (input_replaying())
+	{
+		return;
+	}
+	game_button(btn);
+	record(INPUT_BUTTON, btn, 0);
+}
+
+void input_game_start(uint32_t seed)
+{
+	input_poll();
+	if (input_replaying() && replayLog[replayNext].type == INPUT_GAME)
+	{
+		seed = (uint32_t)replayLog[replayNext++].value;
+	}
+	game_start(seed);
+	record(INPUT_GAME, seed, 0);
+}
+
+bool input_game_frame(void)
+{
+	bool playing;
+	
+	input_poll();
+	playing = game_frame();
+	frames++;
+	return playing;
+}
@@ -0,0 +1,79 @@
+#ifndef __INPUT_LOG_H__
+#define __INPUT_LOG_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// input_event_t types
+#define INPUT_GAME				'G'		// game_start, value is the seed
+#define INPUT_SAMPLE			'S'		// game_sample, value is accelerometer x
+#define INPUT_BUTTON			'B'		// game_button, value is the button
+
+typedef struct
+{
+	uint32_t	frame;						// game frames played before it
+	char			type;
+	int32_t		value;
+	uint8_t		touches;					// INPUT_SAMPLE only
+} input_event_t;
+
+// One event as a line of C.  The lines of a recording pasted between braces
+// are an input_event_t array, see replay_log.c.
+#define INPUT_LOG_FORMAT		"{%lu, '%c', %ld, %u},\n"
+
+typedef void (*input_log_sink_t)(const input_event_t *event);
+
+// The recording the board replays, in replay_log.c
+extern const input_event_t replay_log[];
+extern const uint32_t replay_log_length;
+
+//*****************************************************************************
+// Input log
+//
+// Everything the game takes from outside goes through here: the seed its
+// random numbers start from, every accelerometer and touch sample and every
+// button.  Each input is stamped with the number of game frames played so
+// far, which is all that orders it against the game.  An input stamped n
+// came after frame n and before frame n + 1.
+//
+// Recording hands every input to a sink, ex printf to the debug UART.  A
+// replay ignores the live input and feeds the game a recording instead,
+// each input between the same two frames as when it was recorded, so the
+// game plays out frame for frame the same on the board or in tools/gamesim.
+// Live input takes over again at the end of the recording.
+//*****************************************************************************
+
+//*****************************************************************************
+// Starts recording, every input from here on goes to sink.  The frame count
+// starts over.
+//*****************************************************************************
+void input_record(input_log_sink_t sink);
+
+//*****************************************************************************
+// Starts replaying the length events in log.  The frame count starts over.
+//*****************************************************************************
+void input_replay(const input_event_t *log, uint32_t length);
+
+// True until a replay has fed its last event
+bool input_replaying(void);
+
+//*****************************************************************************
+// Feeds a replay's inputs up to the current frame.  Call it every pass of the
+// main loop, paused or not.
+//*****************************************************************************
+void input_poll(void);
+
+//*****************************************************************************
+// The live input, the game gets it unless a replay is running.
+//*****************************************************************************
+void input_sample(int16_t x, uint8_t touches);
+void input_button(uint8_t btn);
+
+//*****************************************************************************
+// game_start and game_frame, for the frame count.  A replay starts the game
+// with its recorded seed instead of seed.
+//*****************************************************************************
+void input_game_start(uint32_t seed);
+bool input_game_frame(void);
+
+#endif
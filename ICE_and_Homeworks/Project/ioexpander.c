@@ -6,7 +6,18 @@
 
 extern bool alert_btn;
 
-    
+// What the expander's registers hold, as far as the last transfers know
+static uint8_t olatA = 0;
+static uint8_t gpioB = BTN_NONE;
+static uint8_t intfB = 0;
+static uint8_t intcapB = BTN_NONE;
+
+// olatA has changed since it was last written
+static bool olatADirty = false;
+
+// ticks until a flash turns the LEDs off, 0 for no flash
+static uint16_t flashTicks = 0;
+
 
 uint8_t io_expander_read_reg(uint8_t addr) {
 	uint8_t data_read;
@@ -99,65 +110,108 @@ bool io_expander_init()
 
 
 										
-void disableLeds(void) {
-	io_expander_write_reg(MCP23017_GPIOA_R, 0x00);
+//*****************************************************************************
+// Reads count registers from reg up in one sequential transfer.  IOCON.SEQOP
+// is 0, so the expander moves to the next register after each byte.
+//*****************************************************************************
+static bool io_expander_read_burst(uint8_t reg, uint8_t *data, uint8_t count)
+{
+	uint8_t mcs;
+	uint8_t i;
+	
+	while (I2CMasterBusy(I2C1_BASE)){}
+	
+	if (i2cSetSlaveAddr(I2C1_BASE, MCP23017_DEV_ID, I2C_WRITE) != I2C_OK)
+		return false;
+	if (i2cSendByte(I2C1_BASE, reg, I2C_MCS_START | I2C_MCS_RUN) != I2C_OK)
+		return false;
+	if (i2cSetSlaveAddr(I2C1_BASE, MCP23017_DEV_ID, I2C_READ) != I2C_OK)
+		return false;
+	
+	// every byte but the last is acknowledged so the expander keeps going
+	for (i = 0; i < count; i++)
+	{
+		mcs = I2C_MCS_RUN;
+		mcs |= (i == 0) ? I2C_MCS_START : 0;
+		mcs |= (i == count - 1) ? I2C_MCS_STOP : I2C_MCS_ACK;
+		if (i2cGetByte(I2C1_BASE, &data[i], mcs) != I2C_OK)
+			return false;
+	}
+	return true;
 }
 
-void enableLeds(void) {
-	io_expander_write_reg(MCP23017_GPIOA_R,0xFF);
+void io_expander_set_leds(uint8_t leds)
+{
+	flashTicks = 0;
+	if (leds != olatA)
+	{
+		olatA = leds;
+		olatADirty = true;
+	}
 }
 
-uint8_t debounce_expander_fsm(uint8_t buttons_pressed) {
-	static DEBOUNCE_STATES state = DEBOUNCE_ONE;	
-	static uint8_t curr_btn_val = BTN_NONE;
-	static uint8_t last_btn_val = BTN_NONE;
-		
-	curr_btn_val = buttons_pressed;
-	
-	switch(state) {
-		case DEBOUNCE_ONE:
-			if(curr_btn_val != BTN_NONE) {
-				state = DEBOUNCE_1ST_ZERO;
-				last_btn_val = curr_btn_val;
-			}
-			return BTN_NONE;
-			
-		case DEBOUNCE_1ST_ZERO:
-			if(curr_btn_val == last_btn_val) state = DEBOUNCE_2ND_ZERO;
-			else {
-				last_btn_val = curr_btn_val;
-				state = DEBOUNCE_ONE;
-			}
-			break;
-			
-		case DEBOUNCE_2ND_ZERO:
-			if(curr_btn_val == last_btn_val) state = DEBOUNCE_PRESSED;
-			else {
-				last_btn_val = curr_btn_val;
-				state = DEBOUNCE_ONE;
-			}
-			return BTN_NONE;
-			
-		case DEBOUNCE_PRESSED:
-			if(curr_btn_val == last_btn_val) {
-				state = DEBOUNCE_DONE;
-			}
-			else {
-				last_btn_val = curr_btn_val;
-				state = DEBOUNCE_ONE;
-			}
-			return curr_btn_val;
-			
-		case DEBOUNCE_DONE:
-			if(curr_btn_val == last_btn_val) {
-				state = DEBOUNCE_DONE;
-			}
-			else {
-				last_btn_val = curr_btn_val;
-				state = DEBOUNCE_ONE;
-			}
-			return BTN_NONE;
+void io_expander_flash_leds(uint8_t leds, uint16_t ticks)
+{
+	io_expander_set_leds(leds);
+	flashTicks = ticks;
+}
+
+uint8_t io_expander_leds(void)
+{
+	return olatA;
+}
+
+uint8_t io_expander_buttons(void)
+{
+	return gpioB;
+}
+
+bool io_expander_tick(bool sample_buttons)
+{
+	uint8_t data;
+	
+	if (flashTicks > 0 && --flashTicks == 0 && olatA != 0)
+	{
+		olatA = 0;
+		olatADirty = true;
+	}
+	
+	// one transfer a tick, the LEDs first
+	if (olatADirty)
+	{
+		io_expander_write_reg(MCP23017_OLATA_R, olatA);
+		olatADirty = false;
+		return false;
+	}
+	
+	if (sample_buttons && io_expander_read_burst(MCP23017_GPIOB_R, &data, 1))
+	{
+		gpioB = data;
+		return true;
 	}
+	return false;
+}
+
+bool io_expander_irq(uint8_t *intf, uint8_t *intcap)
+{
+	uint8_t data[3];
+	
+	// INTFB, INTCAPA, INTCAPB.  Reading INTCAPB clears the INT.
+	if (!io_expander_read_burst(MCP23017_INTFB_R, data, 3))
+		return false;
 	
+	intfB = data[0];
+	intcapB = data[2];
+	gpioB = intcapB;
+	*intf = intfB;
+	*intcap = intcapB;
+	return true;
+}
+
+void disableLeds(void) {
+	io_expander_set_leds(0x00);
 }
 
+void enableLeds(void) {
+	io_expander_set_leds(0xFF);
+}
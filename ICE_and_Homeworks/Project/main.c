@@ -26,61 +26,94 @@
 uint16_t ufo_xPos, ufo_yPos;
 extern void hw1_search_memory(uint32_t addr); 
 
-char bulletString[80], scoreString[80];
-
-int16_t x_accel, y_accel, z_accel;
+int16_t y_accel, z_accel;
 uint16_t x_touch, y_touch;
 char en_command[] = "LOAD LED00000FF LED10000FF  LED20000FF  LED30000FF LED40000FF  LED50000FF LED60000FF  LED70000FF HALT";
 char clear_command[] = "LOAD LED000000 LED1000000  LED2000000  LED3000000  LED4000000  LED5000000 LED6000000 LED7000000 HALT";
 
-extern bool alert_T4A;
 extern bool alert_T1A;
-volatile bool readyShoot = false;
-volatile uint8_t touch_event = 0;
-extern bool alert_btn, fishHit;
-extern int score, numBullets;
 
 
-int i,j;
+int i;
 int count1A = 0;
 uint8_t btn_dir;
 uint8_t sw_val;
 
-bool debounce = true;
-
 uint16_t fcolor;
 uint16_t bcolor;
 
-bool showHUD = true;
-bool pause = true;
-bool HUD_erased = false;
-bool gameStarted = false;
-bool colorChange = false;
+// start and instruction screen colors
+rng_t menuRng;
 
+// the game scene starts a new game on its first frame
+bool gameStarted = false;
 
-extern uint16_t colorArray[6];
-	
-
+//*****************************************************************************
+// input_log sink, one line of C per input
+//*****************************************************************************
+void printInput(const input_event_t *event)
+{
+		printf(INPUT_LOG_FORMAT, (unsigned long)event->frame, event->type,
+			(long)event->value, event->touches);
+}
 
-uint8_t colorArrayIndex=0;
+//*****************************************************************************
+// Input latency over the last LATENCY_REPORT_FRAMES frames
+//*****************************************************************************
+void printLatency(void)
+{
+		static uint32_t frames = 0;
+		event_latency_t latency;
+		
+		if (++frames < LATENCY_REPORT_FRAMES)
+		{
+			return;
+		}
+		frames = 0;
+		
+		events_latency(&latency);
+		if (latency.frames == 0)
+		{
+			return;
+		}
+		printf("Input latency: %lu frames, min %lu us, avg %lu us, max %lu us, %lu dropped\n",
+			(unsigned long)latency.frames, (unsigned long)latency.min,
+			(unsigned long)(latency.total / latency.frames), (unsigned long)latency.max,
+			(unsigned long)latency.dropped);
+}
 
 //*****************************************************************************
 //*****************************************************************************
 void init_hardware(void)
 {
+		uint32_t boot_start;
+		uint32_t lcd_us;
+	
     DisableInterrupts();
+		
+		// boot time is measured from here, the C runtime start up is not counted
+		timebase_init();
+		boot_start = timebase_now();
+		
     //************************************************************************
     // Configures the serial debug interface at 115200.
     // UART IRQs can be anbled using the two paramters to the function.
     //************************************************************************
     init_serial_debug(true, true);
+		
+    // start the LCD, its reset and sleep out waits overlap the rest of the
+    // hardware init below.  Nothing may touch the LCD until lcd_init_finish.
+    lcd_config_gpio();
+    lcd_init_start();
+		
 		eeprom_init();
     // initialize launchpad
     lp_io_init();
-    //enable LCD stuff
-    lcd_config_gpio();
-    lcd_config_screen();
-    lcd_clear_screen(BG_COLOR);
+
+		// text fonts, FONT_SANS8 is the default font
+		font_register(&font_sans8);
+		font_register(&font_sans8_bold);
+		font_register(&font_sans8_x2);
 		
 		// Initialize the GPIO Port D
 		gpio_enable_port(GPIOD_BASE);
@@ -96,8 +129,9 @@ void init_hardware(void)
 	 // enable io expander
 	 io_expander_init();
  
-		// I2C touchscreen
+		// I2C touchscreen, read only when its INT pin says there is a new report
 		 ft6x06_init();
+		 ft6x06_init_irq(2);
 		 
 		 // joystick
 		 //ps2_initialize(); 
@@ -105,7 +139,28 @@ void init_hardware(void)
     //enable accelerometer
     accel_initialize();
 		
+		// the TIMER4 and expander interrupts queue the input from here on
+		events_init();
+		
+		lcd_us = lcd_init_finish();
+#if SCREEN_CAPTURE
+		serial_debug_capture_start();
+#endif
+    lcd_clear_screen(BG_COLOR);
+#if SCREEN_CONSOLE
+		lcd_console_init(FONT_SANS8, 0, SCREEN_CONSOLE_LINES, LCD_COLOR_WHITE, LCD_COLOR_BLACK);
+		lcd_console_stdout = true;
+#endif
+		
+		// frames are locked to the panel refresh through the LCD's TE line,
+		// which is an input on port D, on boards that have it wired
+		present_init(LCD_TE_WIRED ? 1 : 0, 1);
+		
     EnableInterrupts();
+		
+		printf("Boot: %lu us (LCD init %lu us)\n",
+			(unsigned long)((timebase_now() - boot_start) / TIMEBASE_TICKS_PER_US),
+			(unsigned long)lcd_us);
 }
 
 void DisableInterrupts(void)
@@ -131,97 +186,125 @@ void EnableInterrupts(void)
 
 
 //*****************************************************************************
+// Start page, the title in changing colors until a button is pressed
 //*****************************************************************************
-void drawInitialImages() {
-		lcd_draw_image
-    (
-        octopus.xPos,                         // X Pos
-        octopus.width,        // Image Horizontal Width
-        octopus.yPos,                       // Y Pos
-        octopus.height,       // Image Vertical Height
-        octopus.bitmap,            // Image
-        octopus.fColor,              // Foreground Color
-        octopus.bColor              // Background Color
-    );
-		
-		lcd_draw_image
-    (
-        fishArray[0].xPos,                         // X Pos
-          fishArray[0].width,        // Image Horizontal Width
-          fishArray[0].yPos,                       // Y Pos
-          fishArray[0].height,       // Image Vertical Height
-          fishArray[0].bitmap,            // Image
-          fishArray[0].fColor,              // Foreground Color
-          fishArray[0].bColor              // Background Color
-    );
-		
-		lcd_draw_image
-    (
-        fishArray[1].xPos,                         // X Pos
-          fishArray[1].width,        // Image Horizontal Width
-          fishArray[1].yPos,                       // Y Pos
-          fishArray[1].height,       // Image Vertical Height
-          fishArray[1].bitmap,            // Image
-          fishArray[1].fColor,              // Foreground Color
-          fishArray[1].bColor              // Background Color
-    );
-			
-			
-		// black shield
-		lcd_draw_box(
-			shieldArray[1].xPos, //x start
-			shieldArray[1].width, // x len
-			shieldArray[1].yPos, //y s start
-			shieldArray[1].height, // y len
-			shieldArray[1].bColor, //border
-			shieldArray[1].fColor, //fill
-			shieldArray[1].border_weight
-		);
-		// blue shield
-			lcd_draw_box(
-			shieldArray[0].xPos, //x start
-			shieldArray[0].width, // x len
-			shieldArray[0].yPos, //y s start
-			shieldArray[0].height, // y len
-			shieldArray[0].bColor, //border
-			shieldArray[0].fColor, //fill
-			shieldArray[0].border_weight
-		);
+static void start_render(void)
+{
+		if (scene_frames() % START_BLINK_FRAMES == 0)
+		{
+			fcolor = rng_next(&menuRng);
+			bcolor = rng_next(&menuRng);
+			image_draw(&start_image, MID_X, MID_Y, fcolor, bcolor);
+		}
 }
 
-void printStartPage() {
-			while(1) {
-				fcolor = rand();
-				bcolor = rand();  
-				for(i = 0; i < 100000; i++){}		//to change color slower
-				lcd_draw_image(MID_X,start_width,MID_Y,start_height,start_map,  fcolor , bcolor);
-					
-				if(alert_btn) {
-					btn_dir = io_expander_read_reg(MCP23017_INTCAPB_R);
-					//btn_dir = debounce_expander_fsm(btn_dir);
-					//printf("%d\n",btn_dir);
-					//if(btn_dir == 15) {//when BUTTON is in IDLE state, the value is 0xf
-						if(!debounce) {
-							eeprom_init_write_read();
-							debounce = true;
-							break;
-						}
-					debounce = false;
-					alert_btn = false;
-				}
-			}	
+static void start_button(uint8_t btn)
+{
+		// the release is captured too, only a press is one of the buttons
+		if (btn == BTN_L || btn == BTN_R || btn == BTN_U || btn == BTN_D)
+		{
+			scene_change(&instruction_scene);
+		}
+}
+
+static void start_gesture(const gesture_t *gesture)
+{
+		if (gesture->type == GESTURE_TAP)
+		{
+			scene_change(&instruction_scene);
+		}
+}
+
+static void start_exit(void)
+{
+		events_hold();
+		eeprom_init_write_read();
+		events_release();
+}
+
+//*****************************************************************************
+// Instructions, shown for INSTRUCTION_MS or until a button is pressed
+//*****************************************************************************
+static void instruction_enter(void)
+{
+		lcd_clear_screen(LCD_COLOR_BLACK);
+		scene_change_after(&game_scene, INSTRUCTION_MS);
+}
+
+static void instruction_render(void)
+{
+		if (scene_frames() % INSTRUCTION_BLINK_FRAMES != 0)
+		{
+			return;
+		}
+		fcolor = rng_next(&menuRng);
+		lcd_draw_image(20,ARROWS_WIDTH_PIXELS,20,ARROWS_HEIGHT_PIXELS,down_arrowBitmaps,fcolor,LCD_COLOR_BLACK);
+		print_string_toLCD("Hide the H U D", MID_X,15,fcolor,LCD_COLOR_BLACK);
+		lcd_draw_image(20,ARROWS_WIDTH_PIXELS,120,ARROWS_HEIGHT_PIXELS,up_arrowBitmaps,fcolor,LCD_COLOR_BLACK);
+		print_string_toLCD("Pause and Unpause", MID_X,120,fcolor,LCD_COLOR_BLACK);
+		lcd_draw_image(20,ARROWS_WIDTH_PIXELS,220,ARROWS_HEIGHT_PIXELS,left_arrowBitmaps,fcolor,LCD_COLOR_BLACK);
+		print_string_toLCD("Change colors", MID_X,220,fcolor,LCD_COLOR_BLACK);
+		lcd_draw_image(20,ARROWS_WIDTH_PIXELS,300,ARROWS_HEIGHT_PIXELS,right_arrowBitmaps,fcolor,LCD_COLOR_BLACK);
+		print_string_toLCD("Change colors", MID_X,300,fcolor,LCD_COLOR_BLACK);
+}
+
+static void instruction_button(uint8_t btn)
+{
+		if (btn == BTN_L || btn == BTN_R || btn == BTN_U || btn == BTN_D)
+		{
+			scene_change(&game_scene);
+		}
+}
+
+static void instruction_gesture(const gesture_t *gesture)
+{
+		if (gesture->type == GESTURE_TAP)
+		{
+			scene_change(&game_scene);
+		}
 }
 
-// function prints end screen and stays there until user presses reset
-void printEndPage() {
-		//char startPrompt[80] = "Please press SW2 to begin.\n";
-		//print_string_toLCD(startPrompt, 40, 160, LCD_COLOR_WHITE, BG_COLOR);
+//*****************************************************************************
+// The game.  The first frame after the player unpauses starts a new game,
+// after a game over pause is already off and the next game starts right
+// away.
+//*****************************************************************************
+static void game_enter(void)
+{
+		gameStarted = false;
+}
+
+static void game_render(void)
+{
+		if (pause)
+		{
+			return;
+		}
+		
+		// the time the player took to get here seeds the game
+		if (gameStarted == false) {
+			input_game_start(timebase_now());
+			gameStarted = true;
+		}
+		
+		if (!input_game_frame())
+		{
+			scene_change(&end_scene);
+		}
+}
+
+//*****************************************************************************
+// Game over, the score and the high score.  A button after END_HOLD_MS
+// starts the next game.
+//*****************************************************************************
+static void end_enter(void)
+{
 		uint8_t highScore;
 		char finalScoreString[80];
 		char highScoreString[80];
-
 		
 		// get the current high score out of the eeprom
+		events_hold();
 		eeprom_byte_read(I2C1_BASE,350,&highScore);
 		sprintf(highScoreString, "%d", highScore);
 	
@@ -231,9 +314,10 @@ void printEndPage() {
 			eeprom_byte_write(I2C1_BASE,350,score);
 			sprintf(highScoreString, "%d", score);
 		}
+		events_release();
 		
 		// the game over screen
-		lcd_draw_image(MID_X,240,MID_Y,320,endscreen_Bitmap,LCD_COLOR_BLACK,LCD_COLOR_BLUE2);
+		image_draw(&endscreen_image, MID_X, MID_Y, LCD_COLOR_BLACK, LCD_COLOR_BLUE2);
 		
 		sprintf(finalScoreString, "%d", score);
 	
@@ -242,115 +326,57 @@ void printEndPage() {
 		
 		printf("\n~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
 		printf("Your Score: %d\n", score);
-		printf("High Score: %d", highScore);
-		
-	
-		while(1){};
+		printf("High Score: %d\n", highScore);
 }
 
-void instructionScreen() {
-	lcd_clear_screen(LCD_COLOR_BLACK);
-
-		for(i = 0; i < 50; i++) {
-		fcolor = rand();
-		bcolor = rand();
-		lcd_draw_image(20,ARROWS_WIDTH_PIXELS,20,ARROWS_HEIGHT_PIXELS,down_arrowBitmaps,fcolor,LCD_COLOR_BLACK);
-		print_string_toLCD("Hide the H U D", MID_X,15,fcolor,LCD_COLOR_BLACK);
-		lcd_draw_image(20,ARROWS_WIDTH_PIXELS,120,ARROWS_HEIGHT_PIXELS,up_arrowBitmaps,fcolor,LCD_COLOR_BLACK);
-		print_string_toLCD("Pause and Unpause", MID_X,120,fcolor,LCD_COLOR_BLACK);
-		lcd_draw_image(20,ARROWS_WIDTH_PIXELS,220,ARROWS_HEIGHT_PIXELS,left_arrowBitmaps,fcolor,LCD_COLOR_BLACK);
-		print_string_toLCD("Change colors", MID_X,220,fcolor,LCD_COLOR_BLACK);
-		lcd_draw_image(20,ARROWS_WIDTH_PIXELS,300,ARROWS_HEIGHT_PIXELS,right_arrowBitmaps,fcolor,LCD_COLOR_BLACK);
-		print_string_toLCD("Change colors", MID_X,300,fcolor,LCD_COLOR_BLACK);
-		for(j = 0; j < 200000; j++){}
+static void end_button(uint8_t btn)
+{
+		// a button held from the last shot does not skip the screen
+		if (scene_ms() >= END_HOLD_MS &&
+			(btn == BTN_L || btn == BTN_R || btn == BTN_U || btn == BTN_D))
+		{
+			scene_change(&game_scene);
 		}
 }
 
-void printGameScreen() {	
-			moveShields();
-	
-	
-			moveFish();
-			
-	
-	
-			//check numBullets
-			if (numBullets == 0)
-			{
-				printEndPage();
-			}
-	
-			// Check x values of accelerometer
-			//printf("touch_event: %d \n", touch_event);
-     // sprintf(msg,"X: %d\n\r",x);
-			//checkShooting();
-      if (x_accel > MOVE_LEFT)
-      {
-        //put_string("Move left\n\r");
-				checkShooting();
-				move_Left(octopus.xPos, octopus.yPos, 4, octopus.min_X, octopus.type, &octopus);
-				checkShooting();
-				//move_Right(shieldArray[0].xPos, shieldArray[0].yPos, 5, shieldArray[0].max_X, shieldArray[0].type, &shieldArray[0]);
-				//move_Left(shieldArray[1].xPos, shieldArray[1].yPos, 10,1, shieldArray[1].type, &shieldArray[1]);
-      }
-      else if (x_accel < MOVE_RIGHT)
-      {
-				
-			  checkShooting();
-				move_Right(octopus.xPos, octopus.yPos, 4, octopus.max_X, octopus.type, &octopus);
-				checkShooting();
-				//move_Right(shieldArray[1].xPos, shieldArray[1].yPos, 5, shieldArray[1].max_X, shieldArray[1].type, &shieldArray[1]);
-				//move_Left(shieldArray[0].xPos, shieldArray[0].yPos, 10,1, shieldArray[0].type, &shieldArray[0]);
-      
-      }
-      else
-      {
-					checkShooting();
-      }
-			
-			
-				// check if user wants to see this printed out or not
-			if (showHUD) {
-				HUD_erased = false;
-				// num bullets. Depending on bullet color, BG COLOR will be different.
-				lcd_draw_box(0,65, 300, 20, LCD_COLOR_BLACK, LCD_COLOR_RED, 2); // only do if bullets changed
-				sprintf(bulletString,"%d bullets:",numBullets);
-				print_string_toLCD(bulletString, 7, 310, LCD_COLOR_WHITE, LCD_COLOR_RED);
-				
-				// score
-				lcd_draw_box(0,65, 280, 20, LCD_COLOR_BLACK, LCD_COLOR_GREEN, 2); // only do if score changed
-				sprintf(scoreString,"score %d:", score);
-				print_string_toLCD(scoreString, 6, 290, LCD_COLOR_BLACK, LCD_COLOR_GREEN);
-				// call method to move shields back and forth
-			}
-			else
-			{
-				
-				if (HUD_erased == false) 
-				{
-					lcd_draw_box(0,65, 280, 40, BG_COLOR, BG_COLOR, 0);
-					HUD_erased = true;
-				}
-			}
+static void end_gesture(const gesture_t *gesture)
+{
+		if (scene_ms() >= END_HOLD_MS && gesture->type == GESTURE_TAP)
+		{
+			scene_change(&game_scene);
+		}
 }
+
+const scene_t start_scene = {"start", NULL, NULL, start_render, start_exit, NULL, start_button, start_gesture};
+const scene_t instruction_scene = {"instructions", instruction_enter, NULL, instruction_render, NULL, NULL, instruction_button, instruction_gesture};
+const scene_t game_scene = {"game", game_enter, NULL, game_render, NULL, input_sample, input_button, NULL};
+const scene_t end_scene = {"end", end_enter, NULL, NULL, NULL, NULL, end_button, end_gesture};
+
 /*Thought: have difficulty of Hard and Easy. Both have 30 bullets with a goal of 20 hits. For Hard mode fish will move faster. May have 'bonus' fish*/
 int main(void)
 {
-	int count;
   init_hardware();
+	rng_seed(&menuRng, timebase_now());
 	
-	//print out setup message
-	put_string("\n\r");
-  put_string("******************************\n\r");
-	put_string("ECE353 SP19 Final Project\n\r");
-	put_string("******************************\n\r");
-	printStartPage();
-	instructionScreen();
-	
-		// draw all initial things to screen
+	//print out setup message.  printf, as the boot line before it goes
+	//through the same TX buffer and would otherwise come out split.
+	printf("\n");
+	printf("******************************\n");
+	printf("ECE353 SP19 Final Project\n");
+	printf("******************************\n");
+	scene_change(&start_scene);
+		
+#if INPUT_RECORD
+		input_record(printInput);
+#endif
+#if INPUT_REPLAY
+		input_replay(replay_log, replay_log_length);
+#endif
 		
     while(1) //infinite loop of the whole game
     {
+				// a replay's inputs come in here
+				input_poll();
 	
 				// Blink red LEDS
 				if(alert_T1A) 
@@ -368,104 +394,30 @@ int main(void)
 					count1A = (count1A + 1) % 2;
 				}
 		
-				if(alert_T4A)
-				{
-					 if (count == 0)
-					 {
-						 readyShoot = true;
-					 }
-					 // check touchscreen
-					 touch_event = ft6x06_read_td_status();
-					 // read accelerometer
-						x_accel = accel_read_x();
-						z_accel = accel_read_z();
-					 // can shoot abo ut ~0.5s
-						count = (count + 1) % 30;
-						alert_T4A = false;
-				}
-
-				
-				// Push buttons
-				if(alert_btn) {
-					btn_dir = io_expander_read_reg(MCP23017_INTCAPB_R);
-						
-						switch (btn_dir)
-						{
-							case BTN_L:
-								// loop around array
-								if (colorArrayIndex == 0) colorArrayIndex = 5;
-								else colorArrayIndex--;
-								colorChange = true;
-								break;
-							
-							case BTN_R:
-								colorArrayIndex = (colorArrayIndex + 1) % 6;
-								colorChange = true;
-								break;
-								
-							case BTN_U:
-								showHUD = !showHUD;
-								break;
-							
-							case BTN_D:
-								pause = !pause;
-								break;
-							
-							default:
-								break;
-						}	
-					alert_btn = false;
-			}
-			
-			
 				 // blink top leds if fish was hit
 				if (fishHit == true)
 				{
-					enableLeds();
-					
-					for (i = 0; i < 100000; i++) {}
-
-					disableLeds();
-			
+					io_expander_flash_leds(0xFF, LED_FLASH_TICKS);
 					fishHit = false;
 					//hw1_search_memory((uint32_t) clear_command);
 				}
 				
 				
-				// if game not started, draw images 
-				
-				// if not pausing, print everything out
-				if (pause == false) 
+				// the current screen, it draws once per panel refresh with the
+				// input that came in since the last one
+				scene_update();
+				if (present_frame_due())
 				{
-					// update bullet color and octopus color
-					bullet.fColor = colorArray[colorArrayIndex];
-					octopus.fColor = colorArray[colorArrayIndex];
-					
-					// if haven't been drawn yet, draw initial images
-					if (gameStarted == false) {
-						lcd_clear_screen(BG_COLOR);
-						drawInitialImages();
-						gameStarted = true;
-					}
-					
-					// redraw octopus if color changed
-					if (colorChange == true) 
-					{
-						lcd_draw_image
-						(
-								octopus.xPos,                         // X Pos
-								octopus.width,        // Image Horizontal Width
-								octopus.yPos,                       // Y Pos
-								octopus.height,       // Image Vertical Height
-								octopus.bitmap,            // Image
-								octopus.fColor,              // Foreground Color
-								octopus.bColor              // Background Color
-						);
-						// wait until another button press
-						colorChange = false;
-					}
-				
-					printGameScreen();
+					events_dispatch();
+					scene_render();
+					events_reacted();
+#if SCREEN_CONSOLE
+					// at most a line of text per frame
+					lcd_console_service(LCD_CONSOLE_MAX_COLS);
+#endif
+#if INPUT_LATENCY
+					printLatency();
+#endif
 				}
 		}	
 		
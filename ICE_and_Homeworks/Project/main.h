@@ -36,8 +36,15 @@ extern void serialDebugInit(void);
 
 
 #include "TM4C123.h"
-#include "alphabet.h"
+#include "fonts.h"
+#include "font_data.h"
+#include "widgets.h"
+#include "present.h"
 #include "game.h"
+#include "input_log.h"
+#include "rng.h"
+#include "scene.h"
+#include "events.h"
 #include "buttons.h"
 #include "ioexpander.h"
 
@@ -71,6 +78,7 @@ extern void serialDebugInit(void);
 #include "serial_debug.h"
 #include "eeprom.h"
 #include "lcd.h"
+#include "lcd_console.h"
 #include "lcd_images.h"
 #include "buttons.h"
 
@@ -88,5 +96,51 @@ extern void serialDebugInit(void);
 #define MID_X 		  120
 #define MID_Y       160
 
+// 1 locks frames to the panel refresh through the LCD's TE output, which
+// has to be wired to PD2.  0 paces frames with the timebase instead, one
+// every PRESENT_REFRESH_MS.
+#define LCD_TE_WIRED    0
+
+// 1 streams the screen out the debug UART for tools/capview, the serial
+// terminal then shows the text mixed with binary packets
+#define SCREEN_CAPTURE  0
+
+// 1 copies the debug UART text to a console over the top
+// SCREEN_CONSOLE_LINES lines of text on the screen.  The console scrolls
+// that band in hardware, so what the game draws there scrolls with it.
+#define SCREEN_CONSOLE        0
+#define SCREEN_CONSOLE_LINES  4
+
+// 1 prints every input the game takes to the debug UART as a line of C,
+// the lines starting with { make a recording for replay_log.c
+#define INPUT_RECORD    0
+
+// 1 plays the game from the recording in replay_log.c instead of the
+// accelerometer, touch screen and buttons
+#define INPUT_REPLAY    0
+
+// 1 prints the input to reaction latency to the debug UART every
+// LATENCY_REPORT_FRAMES frames
+#define INPUT_LATENCY          0
+#define LATENCY_REPORT_FRAMES  600
+
+// the screens, in main.c
+extern const scene_t start_scene;
+extern const scene_t instruction_scene;
+extern const scene_t game_scene;
+extern const scene_t end_scene;
+
+// frames between color changes on the start and instruction screens
+#define START_BLINK_FRAMES        6
+#define INSTRUCTION_BLINK_FRAMES  3
+
+// the instructions stay up this long unless a button is pressed
+#define INSTRUCTION_MS            4000
+
+// TIMER4 ticks the LEDs stay on when a fish is hit, 40ms
+#define LED_FLASH_TICKS           5
+
+// the game over screen ignores buttons this long
+#define END_HOLD_MS               1000
 
 #endif
@@ -0,0 +1,75 @@
+// Generated by tools/imgconv from bmp/octopus.bmp (58x54)
+// Do not edit by hand, regenerate the file instead.
+
+#include "image.h"
+
+static const uint8_t octopus_image_data[] =
+{
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x40, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x40, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00,
+  0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x00, 0x05,
+  0x15, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x15, 0x50, 0x15, 0x00,
+  0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x01, 0x54, 0x54, 0x00, 0x00,
+  0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0x00, 0x05,
+  0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55, 0x00, 0x14,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x15, 0x54, 0x11, 0x55, 0x55, 0x55, 0x00, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x15, 0x54, 0x10, 0x58, 0x55, 0x59, 0x40, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x05, 0x15, 0x54, 0x10, 0x50, 0x55, 0x50, 0x40, 0x01, 0x40, 0x00, 0x00,
+  0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0x10, 0x50, 0x00, 0x00, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x04, 0x00, 0x00, 0x10, 0x40, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x14,
+  0x00, 0x04, 0x00, 0x00, 0x10, 0x40, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x04, 0x00, 0x00, 0x10, 0x50, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x14, 0x00, 0x05,
+  0x00, 0x00, 0x50, 0x50, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x40,
+  0x01, 0x40, 0x15, 0x00, 0x01, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55,
+  0x40, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x04, 0x00, 0x00, 0x40,
+  0x00, 0x00, 0x14, 0x15, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x04, 0x50, 0x14, 0x40, 0x00,
+  0x05, 0x55, 0x51, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x50, 0x14, 0x40, 0x00, 0x01,
+  0x54, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x05, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x54,
+  0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00,
+  0x00, 0x01, 0x55, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x55, 0x50, 0x00, 0x00,
+  0x01, 0x54, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
+  0x55, 0x55, 0x40, 0x01, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x55, 0x40, 0x01, 0x00, 0x10, 0x41, 0x00, 0x14, 0x00, 0x05, 0x40, 0x01, 0x40, 0x00, 0x00, 0x55,
+  0x00, 0x05, 0x00, 0x10, 0x41, 0x00, 0x04, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x15, 0x54, 0x00,
+  0x04, 0x00, 0x10, 0x41, 0x00, 0x00, 0x00, 0x01, 0x55, 0x41, 0x40, 0x01, 0x50, 0x40, 0x00, 0x00,
+  0x00, 0x10, 0x41, 0x00, 0x00, 0x00, 0x04, 0x44, 0x05, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x15, 0x55, 0x05, 0x00, 0x00, 0x15,
+  0x55, 0x00, 0x00, 0x01, 0x55, 0x55, 0x50, 0x00, 0x00, 0x05, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x45, 0x55, 0x40, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x50, 0x01, 0x00, 0x00, 0x10, 0x00,
+  0x15, 0x40, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0x40, 0x50, 0x01, 0x40, 0x40, 0x14, 0x04, 0x41,
+  0x55, 0x50, 0x00, 0x00, 0x15, 0x55, 0x40, 0x05, 0x40, 0x05, 0x40, 0x00, 0x11, 0x50, 0x01, 0x05,
+  0x40, 0x00, 0x00, 0x14, 0x04, 0x04, 0x54, 0x40, 0x15, 0x40, 0x04, 0x10, 0x15, 0x55, 0x55, 0x00,
+  0x00, 0x00, 0x05, 0x55, 0x55, 0x05, 0x10, 0x10, 0x50, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x55, 0x50, 0x05, 0x00, 0x10, 0x15, 0x40, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x54, 0x45, 0x40, 0x15, 0x55, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x44, 0x55, 0x40, 0x00, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x55, 0x55, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const uint16_t octopus_image_palette[] =
+{
+  0xFFFF, 0x0000, 0xC618,
+};
+
+const image_t octopus_image =
+{
+  58,                     // width
+  54,                     // height
+  IMAGE_2BPP,
+  810,                    // bytes of data
+  octopus_image_data,
+  octopus_image_palette,
+  3                       // palette entries
+};
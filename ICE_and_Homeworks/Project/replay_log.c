@@ -0,0 +1,15 @@
+#include "input_log.h"
+
+// The recording played with INPUT_REPLAY in main.h.  Record a game with
+// INPUT_RECORD and paste the lines of the debug output that start with {
+// in here, ex
+//    grep '^{' putty.log
+// The one below presses BTN_D (0x0D) to unpause and starts the game with
+// seed 1, then the live input takes over.
+const input_event_t replay_log[] =
+{
+	{0, 'B', 13, 0},
+	{0, 'G', 1, 0},
+};
+
+const uint32_t replay_log_length = sizeof(replay_log) / sizeof(replay_log[0]);
@@ -0,0 +1,101 @@
+#include "scene.h"
+#include "timers.h"
+
+static const scene_t *current = NULL;
+static const scene_t *pending = NULL;
+
+// a timed change happens once the timebase passes changeAt
+static bool timed = false;
+static uint32_t changeAt;
+
+static uint32_t enteredAt;
+static uint32_t frames;
+
+void scene_change(const scene_t *next)
+{
+	pending = next;
+	timed = false;
+}
+
+void scene_change_after(const scene_t *next, uint32_t ms)
+{
+	pending = next;
+	timed = true;
+	changeAt = timebase_now() + ms * TIMEBASE_TICKS_PER_MS;
+}
+
+const scene_t* scene_current(void)
+{
+	return current;
+}
+
+uint32_t scene_ms(void)
+{
+	return (timebase_now() - enteredAt) / TIMEBASE_TICKS_PER_MS;
+}
+
+uint32_t scene_frames(void)
+{
+	return frames;
+}
+
+void scene_update(void)
+{
+	const scene_t *next = pending;
+
+	// signed difference, correct across a timebase wrap
+	if (next != NULL && (!timed || (int32_t)(timebase_now() - changeAt) >= 0))
+	{
+		pending = NULL;
+		timed = false;
+		if (current != NULL && current->exit != NULL)
+		{
+			current->exit();
+		}
+		current = next;
+		enteredAt = timebase_now();
+		frames = 0;
+		if (current->enter != NULL)
+		{
+			current->enter();
+		}
+	}
+
+	if (current != NULL && current->update != NULL)
+	{
+		current->update();
+	}
+}
+
+void scene_render(void)
+{
+	if (current != NULL && current->render != NULL)
+	{
+		current->render();
+		frames++;
+	}
+}
+
+void scene_sample(int16_t x, uint8_t touches)
+{
+	if (current != NULL && current->sample != NULL)
+	{
+		current->sample(x, touches);
+	}
+}
+
+void scene_button(uint8_t btn)
+{
+	if (current != NULL && current->button != NULL)
+	{
+		current->button(btn);
+	}
+}
+
+void scene_gesture(const gesture_t *gesture)
+{
+	if (current != NULL && current->gesture != NULL)
+	{
+		current->gesture(gesture);
+	}
+}
@@ -0,0 +1,79 @@
+#ifndef __SCENE_H__
+#define __SCENE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gesture.h"
+
+//*****************************************************************************
+// Scenes
+//
+// One screen of the program, ex the start page or the game, as a set of
+// hooks the main loop calls.  None of them may block: the main loop keeps
+// servicing the timers, the accelerometer and the buttons between calls, on
+// every screen.  Any hook can be NULL.
+//
+//    enter    once, when the scene becomes current
+//    update   every pass of the main loop
+//    render   once per presented frame
+//    exit     once, before the next scene's enter
+//    sample   an accelerometer x and touch sample, from the TIMER4 tick
+//    button   a push button, the MCP23017 port B capture
+//    gesture  a touch screen gesture
+//
+// A change asked for from inside a hook happens on the next scene_update, so
+// a scene always finishes the call it is in.
+//*****************************************************************************
+typedef struct
+{
+	const char	*name;
+	void				(*enter)(void);
+	void				(*update)(void);
+	void				(*render)(void);
+	void				(*exit)(void);
+	void				(*sample)(int16_t x, uint8_t touches);
+	void				(*button)(uint8_t btn);
+	void				(*gesture)(const gesture_t *gesture);
+} scene_t;
+
+//*****************************************************************************
+// Makes next the current scene on the next scene_update.  Replaces a change
+// that has not happened yet, timed or not.
+//*****************************************************************************
+void scene_change(const scene_t *next);
+
+//*****************************************************************************
+// Makes next the current scene ms milliseconds from now.  A scene_change
+// before then replaces it.  At most about 85 seconds, see timebase_now.
+//*****************************************************************************
+void scene_change_after(const scene_t *next, uint32_t ms);
+
+// The current scene, NULL before the first scene_update
+const scene_t* scene_current(void);
+
+// Milliseconds since the current scene was entered, good for ~85 seconds
+uint32_t scene_ms(void);
+
+// Frames rendered since the current scene was entered
+uint32_t scene_frames(void);
+
+//*****************************************************************************
+// Runs a pending change, then the current scene's update.  Call it every
+// pass of the main loop.
+//*****************************************************************************
+void scene_update(void);
+
+//*****************************************************************************
+// Draws the current scene's frame.  Call it when present_frame_due returns
+// true.
+//*****************************************************************************
+void scene_render(void);
+
+//*****************************************************************************
+// Hands an input to the current scene.
+//*****************************************************************************
+void scene_sample(int16_t x, uint8_t touches);
+void scene_button(uint8_t btn);
+void scene_gesture(const gesture_t *gesture);
+
+#endif
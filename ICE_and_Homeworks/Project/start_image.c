@@ -0,0 +1,120 @@
+// Generated by tools/imgconv from bmp/start.bmp (240x320)
+// Do not edit by hand, regenerate the file instead.
+
+#include "image.h"
+
+static const uint8_t start_image_data[] =
+{
+  0x00, 0xCF, 0x16, 0x0A, 0x01, 0x07, 0x1A, 0x06, 0x24, 0x14, 0x01, 0x06, 0x25, 0x05, 0x03, 0x03,
+  0x22, 0x04, 0x29, 0x0A, 0x01, 0x07, 0x1B, 0x05, 0x24, 0x14, 0x02, 0x05, 0x21, 0x05, 0x06, 0x04,
+  0x22, 0x04, 0x2C, 0x05, 0x05, 0x03, 0x04, 0x06, 0x02, 0x05, 0x08, 0x02, 0x03, 0x04, 0x06, 0x05,
+  0x07, 0x06, 0x02, 0x02, 0x08, 0x04, 0x04, 0x05, 0x04, 0x03, 0x03, 0x04, 0x02, 0x05, 0x08, 0x05,
+  0x0D, 0x0B, 0x0A, 0x05, 0x09, 0x07, 0x07, 0x04, 0x2C, 0x05, 0x05, 0x03, 0x05, 0x06, 0x03, 0x04,
+  0x04, 0x05, 0x02, 0x05, 0x03, 0x04, 0x04, 0x03, 0x05, 0x06, 0x01, 0x03, 0x0F, 0x05, 0x0A, 0x05,
+  0x03, 0x05, 0x03, 0x04, 0x04, 0x03, 0x0B, 0x0E, 0x03, 0x04, 0x04, 0x03, 0x04, 0x03, 0x04, 0x04,
+  0x05, 0x04, 0x2C, 0x05, 0x05, 0x03, 0x06, 0x04, 0x05, 0x04, 0x03, 0x04, 0x04, 0x04, 0x02, 0x0D,
+  0x05, 0x04, 0x14, 0x05, 0x0A, 0x04, 0x05, 0x04, 0x02, 0x0D, 0x0E, 0x0B, 0x01, 0x0D, 0x0A, 0x05,
+  0x05, 0x03, 0x2C, 0x05, 0x05, 0x03, 0x06, 0x04, 0x05, 0x04, 0x03, 0x04, 0x04, 0x04, 0x03, 0x04,
+  0x0D, 0x04, 0x14, 0x05, 0x0A, 0x04, 0x05, 0x04, 0x03, 0x04, 0x11, 0x04, 0x07, 0x04, 0x03, 0x04,
+  0x0B, 0x04, 0x04, 0x04, 0x34, 0x0C, 0x06, 0x05, 0x05, 0x04, 0x03, 0x05, 0x02, 0x05, 0x03, 0x05,
+  0x04, 0x03, 0x04, 0x05, 0x11, 0x0B, 0x06, 0x05, 0x04, 0x05, 0x03, 0x05, 0x04, 0x03, 0x09, 0x05,
+  0x06, 0x04, 0x03, 0x05, 0x04, 0x03, 0x03, 0x04, 0x03, 0x05, 0x01, 0x01, 0x02, 0x04, 0x2E, 0x09,
+  0x06, 0x08, 0x01, 0x08, 0x04, 0x03, 0x02, 0x06, 0x05, 0x05, 0x06, 0x08, 0x0F, 0x0B, 0x05, 0x07,
+  0x02, 0x08, 0x05, 0x05, 0x0C, 0x04, 0x02, 0x06, 0x0A, 0x05, 0x08, 0x03, 0x04, 0x04, 0x03, 0x04,
+  0xB9, 0x0D, 0x0F, 0x45, 0x05, 0x03, 0x03, 0x02, 0x09, 0x01, 0x08, 0x01, 0x07, 0x05, 0x06, 0x0F,
+  0x02, 0x3A, 0x04, 0x1B, 0x12, 0x3E, 0x05, 0x06, 0x04, 0x02, 0x09, 0x01, 0x08, 0x01, 0x07, 0x02,
+  0x0C, 0x0B, 0x03, 0x3A, 0x04, 0x1E, 0x05, 0x05, 0x06, 0x01, 0x06, 0x02, 0x03, 0x05, 0x05, 0x0A,
+  0x04, 0x02, 0x02, 0x05, 0x04, 0x02, 0x02, 0x08, 0x0B, 0x09, 0x06, 0x02, 0x06, 0x03, 0x03, 0x04,
+  0x03, 0x05, 0x06, 0x07, 0x08, 0x08, 0x03, 0x10, 0x06, 0x04, 0x02, 0x07, 0x03, 0x07, 0x04, 0x1E,
+  0x0F, 0x03, 0x06, 0x01, 0x03, 0x02, 0x04, 0x04, 0x03, 0x04, 0x04, 0x09, 0x04, 0x10, 0x0E, 0x06,
+  0x05, 0x01, 0x08, 0x01, 0x03, 0x05, 0x02, 0x06, 0x05, 0x0A, 0x04, 0x06, 0x05, 0x01, 0x05, 0x08,
+  0x04, 0x04, 0x05, 0x02, 0x01, 0x03, 0x05, 0x01, 0x05, 0x03, 0x04, 0x1E, 0x0C, 0x07, 0x04, 0x06,
+  0x0D, 0x04, 0x04, 0x09, 0x04, 0x13, 0x0B, 0x06, 0x07, 0x01, 0x08, 0x0A, 0x06, 0x0D, 0x04, 0x05,
+  0x05, 0x03, 0x04, 0x0A, 0x09, 0x07, 0x05, 0x03, 0x04, 0x04, 0x03, 0x1E, 0x05, 0x0E, 0x04, 0x07,
+  0x04, 0x10, 0x06, 0x07, 0x06, 0x08, 0x04, 0x07, 0x04, 0x07, 0x06, 0x03, 0x06, 0x09, 0x02, 0x13,
+  0x04, 0x02, 0x01, 0x03, 0x04, 0x03, 0x04, 0x0A, 0x02, 0x0F, 0x04, 0x03, 0x04, 0x22, 0x0A, 0x0B,
+  0x05, 0x07, 0x05, 0x04, 0x03, 0x0B, 0x03, 0x0A, 0x03, 0x08, 0x05, 0x06, 0x04, 0x08, 0x04, 0x05,
+  0x05, 0x07, 0x03, 0x06, 0x04, 0x0A, 0x04, 0x02, 0x01, 0x03, 0x05, 0x01, 0x05, 0x09, 0x03, 0x0F,
+  0x05, 0x01, 0x05, 0x03, 0x04, 0x1B, 0x0A, 0x0A, 0x08, 0x09, 0x05, 0x06, 0x04, 0x01, 0x04, 0x04,
+  0x04, 0x01, 0x04, 0x0A, 0x04, 0x02, 0x06, 0x0C, 0x03, 0x06, 0x03, 0x08, 0x0D, 0x0B, 0x04, 0x08,
+  0x05, 0x0D, 0x0F, 0x05, 0x05, 0x06, 0x04, 0xCC, 0x01, 0x02, 0x09, 0x04, 0xE2, 0x01, 0x0C, 0xE3,
+  0x80, 0x01, 0x06, 0xE5, 0x01, 0x10, 0xDE, 0x01, 0x15, 0xD8, 0x01, 0x1A, 0xD4, 0x01, 0x1E, 0xD0,
+  0x01, 0x21, 0xCD, 0x01, 0x25, 0xCA, 0x01, 0x27, 0xC8, 0x01, 0x29, 0xC6, 0x01, 0x2B, 0xC3, 0x01,
+  0x2E, 0xC1, 0x01, 0x30, 0xBF, 0x01, 0x33, 0xBC, 0x01, 0x35, 0xBA, 0x01, 0x36, 0xB9, 0x01, 0x38,
+  0xB7, 0x01, 0x3A, 0xB5, 0x01, 0x3B, 0xB4, 0x01, 0x3D, 0xB2, 0x01, 0x3F, 0xB1, 0x01, 0x3F, 0xB0,
+  0x01, 0x41, 0xAE, 0x01, 0x42, 0xAE, 0x01, 0x43, 0xAC, 0x01, 0x44, 0xAB, 0x01, 0x05, 0x01, 0x40,
+  0xAA, 0x01, 0x04, 0x02, 0x41, 0xA8, 0x01, 0x05, 0x01, 0x42, 0xA7, 0x01, 0x06, 0x01, 0x42, 0xA7,
+  0x01, 0x06, 0x01, 0x43, 0xA5, 0x01, 0x4B, 0xA5, 0x01, 0x4C, 0xA4, 0x01, 0x4C, 0xA3, 0x01, 0x4E,
+  0xA2, 0x01, 0x4E, 0xA1, 0x01, 0x4F, 0xA1, 0x01, 0x50, 0x9F, 0x01, 0x51, 0x9F, 0x01, 0x51, 0x9F,
+  0x01, 0x52, 0x9D, 0x01, 0x53, 0x9D, 0x01, 0x53, 0x9C, 0x01, 0x55, 0x9B, 0x01, 0x55, 0x9B, 0x01,
+  0x55, 0x9B, 0x01, 0x55, 0x9A, 0x01, 0x57, 0x99, 0x01, 0x57, 0x99, 0x01, 0x57, 0x99, 0x01, 0x57,
+  0x98, 0x01, 0x58, 0x98, 0x01, 0x59, 0x97, 0x01, 0x59, 0x97, 0x01, 0x59, 0x97, 0x01, 0x59, 0x97,
+  0x01, 0x59, 0x96, 0x01, 0x5A, 0x5B, 0x01, 0x3A, 0x5A, 0x5A, 0x03, 0x39, 0x5B, 0x59, 0x04, 0x38,
+  0x5B, 0x59, 0x05, 0x37, 0x5B, 0x58, 0x06, 0x37, 0x5B, 0x58, 0x06, 0x37, 0x5B, 0x58, 0x06, 0x36,
+  0x5C, 0x58, 0x06, 0x36, 0x5C, 0x58, 0x07, 0x35, 0x5C, 0x58, 0x07, 0x35, 0x5C, 0x57, 0x08, 0x35,
+  0x5C, 0x57, 0x08, 0x35, 0x5C, 0x57, 0x08, 0x35, 0x5C, 0x57, 0x08, 0x35, 0x5D, 0x56, 0x08, 0x35,
+  0x5D, 0x56, 0x09, 0x34, 0x5D, 0x56, 0x09, 0x34, 0x5D, 0x39, 0x02, 0x1B, 0x09, 0x34, 0x5D, 0x38,
+  0x04, 0x1A, 0x09, 0x33, 0x5E, 0x37, 0x05, 0x1A, 0x09, 0x33, 0x5E, 0x37, 0x05, 0x1A, 0x0A, 0x32,
+  0x5E, 0x37, 0x05, 0x1A, 0x0A, 0x32, 0x5E, 0x36, 0x06, 0x1B, 0x09, 0x0B, 0x02, 0x25, 0x5E, 0x36,
+  0x01, 0x01, 0x04, 0x1B, 0x0A, 0x09, 0x04, 0x24, 0x5E, 0x36, 0x06, 0x1B, 0x0A, 0x09, 0x04, 0x24,
+  0x5E, 0x35, 0x07, 0x1B, 0x0B, 0x08, 0x05, 0x23, 0x5E, 0x35, 0x07, 0x1B, 0x0B, 0x08, 0x05, 0x23,
+  0x5E, 0x35, 0x08, 0x1A, 0x0B, 0x07, 0x07, 0x22, 0x5E, 0x35, 0x08, 0x1B, 0x0B, 0x06, 0x07, 0x22,
+  0x5D, 0x36, 0x08, 0x1B, 0x0C, 0x05, 0x07, 0x22, 0x5D, 0x35, 0x09, 0x1B, 0x0C, 0x05, 0x02, 0x01,
+  0x05, 0x22, 0x5C, 0x35, 0x08, 0x1C, 0x0D, 0x05, 0x07, 0x22, 0x5C, 0x35, 0x08, 0x1C, 0x0D, 0x05,
+  0x01, 0x01, 0x05, 0x22, 0x5C, 0x35, 0x08, 0x1C, 0x0E, 0x04, 0x01, 0x01, 0x06, 0x21, 0x5C, 0x34,
+  0x09, 0x1C, 0x0F, 0x02, 0x02, 0x01, 0x03, 0x01, 0x02, 0x21, 0x5C, 0x34, 0x09, 0x1C, 0x0F, 0x02,
+  0x09, 0x21, 0x5C, 0x34, 0x08, 0x1D, 0x1B, 0x20, 0x5C, 0x33, 0x09, 0x1E, 0x17, 0x01, 0x02, 0x20,
+  0x5C, 0x33, 0x09, 0x1E, 0x1A, 0x20, 0x5B, 0x24, 0x01, 0x0E, 0x0A, 0x1E, 0x1B, 0x1F, 0x5B, 0x23,
+  0x03, 0x0D, 0x0A, 0x1E, 0x1B, 0x20, 0x5A, 0x21, 0x05, 0x0C, 0x0B, 0x1D, 0x1D, 0x1F, 0x5A, 0x21,
+  0x05, 0x0C, 0x0B, 0x1D, 0x01, 0x01, 0x1B, 0x1F, 0x20, 0x04, 0x12, 0x03, 0x21, 0x20, 0x06, 0x0B,
+  0x0B, 0x20, 0x1C, 0x1E, 0x1F, 0x05, 0x11, 0x05, 0x1F, 0x20, 0x07, 0x0A, 0x0C, 0x20, 0x1D, 0x1E,
+  0x1D, 0x07, 0x0F, 0x06, 0x1F, 0x20, 0x07, 0x0A, 0x0C, 0x1F, 0x1F, 0x0C, 0x02, 0x0F, 0x1C, 0x09,
+  0x0D, 0x08, 0x1E, 0x1F, 0x08, 0x09, 0x0D, 0x1F, 0x20, 0x08, 0x0A, 0x0A, 0x1C, 0x09, 0x0D, 0x08,
+  0x1E, 0x1E, 0x08, 0x09, 0x0E, 0x20, 0x34, 0x07, 0x1C, 0x09, 0x0C, 0x0A, 0x1D, 0x1E, 0x08, 0x08,
+  0x0E, 0x21, 0x35, 0x06, 0x1C, 0x0A, 0x0B, 0x0A, 0x1D, 0x1D, 0x09, 0x07, 0x10, 0x20, 0x38, 0x02,
+  0x1C, 0x0B, 0x0B, 0x0A, 0x1C, 0x1D, 0x0A, 0x06, 0x11, 0x21, 0x55, 0x0B, 0x0B, 0x0B, 0x1B, 0x1C,
+  0x0B, 0x05, 0x10, 0x01, 0x01, 0x21, 0x55, 0x0B, 0x0A, 0x0C, 0x1B, 0x1C, 0x0C, 0x03, 0x11, 0x01,
+  0x01, 0x21, 0x55, 0x07, 0x01, 0x04, 0x09, 0x0C, 0x1B, 0x1B, 0x0E, 0x01, 0x14, 0x21, 0x55, 0x05,
+  0x05, 0x02, 0x09, 0x02, 0x04, 0x06, 0x1B, 0x06, 0x0A, 0x0A, 0x23, 0x23, 0x54, 0x04, 0x06, 0x02,
+  0x09, 0x01, 0x06, 0x05, 0x1A, 0x05, 0x0F, 0x05, 0x25, 0x23, 0x54, 0x03, 0x08, 0x01, 0x09, 0x01,
+  0x06, 0x05, 0x1A, 0x03, 0x3B, 0x23, 0x54, 0x03, 0x08, 0x01, 0x11, 0x04, 0x1A, 0x02, 0x3B, 0x25,
+  0x53, 0x03, 0x1A, 0x04, 0x57, 0x15, 0x02, 0x0E, 0x53, 0x02, 0x1C, 0x03, 0x57, 0x14, 0x05, 0x0D,
+  0x52, 0x02, 0x1C, 0x03, 0x57, 0x13, 0x07, 0x0C, 0x52, 0x02, 0x1C, 0x02, 0x57, 0x14, 0x08, 0x0C,
+  0x51, 0x02, 0x1C, 0x02, 0x57, 0x14, 0x08, 0x0C, 0x51, 0x02, 0x1C, 0x02, 0x56, 0x15, 0x09, 0x0C,
+  0x51, 0x01, 0x1C, 0x02, 0x56, 0x15, 0x0A, 0x0B, 0x51, 0x01, 0x1C, 0x01, 0x57, 0x15, 0x0B, 0x0B,
+  0x50, 0x02, 0x1A, 0x02, 0x56, 0x16, 0x0C, 0x0B, 0x4F, 0x02, 0x1A, 0x02, 0x56, 0x17, 0x0C, 0x0A,
+  0x50, 0x01, 0x1A, 0x01, 0x57, 0x17, 0x0D, 0x0A, 0x50, 0x01, 0x18, 0x01, 0x57, 0x18, 0x0D, 0x0A,
+  0x51, 0x01, 0x16, 0x02, 0x57, 0x18, 0x0E, 0x0A, 0xBF, 0x01, 0x19, 0x0F, 0x09, 0xBF, 0x01, 0x1A,
+  0x0F, 0x09, 0xBD, 0x01, 0x1B, 0x11, 0x08, 0xBB, 0x01, 0x1C, 0x12, 0x07, 0xBB, 0x01, 0x1D, 0x14,
+  0x04, 0xBA, 0x01, 0x1E, 0xD1, 0x01, 0x10, 0x01, 0x0D, 0xD2, 0x01, 0x0F, 0x02, 0x0D, 0xD1, 0x01,
+  0x0E, 0x04, 0x0D, 0xD0, 0x01, 0x0E, 0x05, 0x0E, 0xCE, 0x01, 0x0E, 0x06, 0x0E, 0xCE, 0x01, 0x0D,
+  0x07, 0x0E, 0xCD, 0x01, 0x0D, 0x08, 0x0F, 0xCB, 0x01, 0x0D, 0x09, 0x0F, 0xCB, 0x01, 0x0C, 0x0A,
+  0x10, 0xC9, 0x01, 0x0C, 0x0B, 0x10, 0xC8, 0x01, 0x0C, 0x0C, 0x11, 0xC7, 0x01, 0x0B, 0x0D, 0x11,
+  0xC7, 0x01, 0x09, 0x0F, 0x12, 0xC7, 0x01, 0x06, 0x11, 0x12, 0xDE, 0x01, 0x13, 0xDD, 0x01, 0x13,
+  0xDD, 0x01, 0x14, 0xDC, 0x01, 0x15, 0xDB, 0x01, 0x15, 0xDB, 0x01, 0x16, 0xDA, 0x01, 0x17, 0xD9,
+  0x01, 0x18, 0xD8, 0x01, 0x18, 0xD7, 0x01, 0x1A, 0xD6, 0x01, 0x1B, 0xD4, 0x01, 0x1D, 0xD2, 0x01,
+  0x1F, 0xD1, 0x01, 0x20, 0xCF, 0x01, 0x22, 0xCE, 0x01, 0x24, 0xCB, 0x01, 0x27, 0xC8, 0x01, 0x2B,
+  0xC4, 0x01, 0x2D, 0xC2, 0x01, 0x30, 0xC0, 0x01, 0x31, 0xBE, 0x01, 0x33, 0xBC, 0x01, 0x35, 0xBA,
+  0x01, 0x36, 0xB9, 0x01, 0x38, 0xB7, 0x01, 0x3A, 0xB5, 0x01, 0x3B, 0xB4, 0x01, 0x3D, 0xB2, 0x01,
+  0x3F, 0xAF, 0x01, 0x41, 0xAB, 0x01, 0x46, 0xA6, 0x01, 0x4B, 0xA3, 0x01, 0x4E, 0xA1, 0x01, 0x4F,
+  0xA0, 0x01, 0x51, 0x9D, 0x01, 0x54, 0x4A, 0x01, 0x50, 0x55, 0x47, 0x07, 0x4C, 0x57, 0x45, 0x09,
+  0x4B, 0x58, 0x43, 0x0B, 0x49, 0x59, 0x42, 0x0D, 0x47, 0x5B, 0x40, 0x0E, 0x46, 0x5D, 0x3E, 0x10,
+  0x44, 0x5E, 0x3D, 0x12, 0x43, 0x5F, 0x3C, 0x12, 0x41, 0x62, 0x3A, 0x14, 0x3F, 0x64, 0x38, 0x16,
+  0x3E, 0x65, 0x36, 0x17, 0x3D, 0x66, 0x35, 0x19, 0x3B, 0x68, 0x34, 0x1A, 0x39, 0x6A, 0x32, 0x1B,
+  0x39, 0x6B, 0x30, 0x1D, 0x37, 0x6D, 0x2E, 0x1E, 0x36, 0x6F, 0x2C, 0x20, 0x34, 0x72, 0x29, 0x22,
+  0x31, 0x75, 0x26, 0x25, 0x2F, 0x77, 0x24, 0x27, 0x2D, 0x7A, 0x21, 0x29, 0x2B, 0x7D, 0x1E, 0x2B,
+  0x29, 0x80, 0x01, 0x1A, 0x2F, 0x26, 0x83, 0x01, 0x16, 0x32, 0x24, 0x87, 0x01, 0x0F, 0x38, 0x20,
+  0xD2, 0x01, 0x1D, 0xD6, 0x01, 0x18, 0xDA, 0x01, 0x14, 0xE0, 0x01, 0x0E, 0xE6, 0x01, 0x06, 0xB5,
+  0x02,
+};
+
+const image_t start_image =
+{
+  240,                    // width
+  320,                    // height
+  IMAGE_1BPP_RLE,
+  1601,                   // bytes of data
+  start_image_data,
+  NULL,                   // no palette
+  0
+};
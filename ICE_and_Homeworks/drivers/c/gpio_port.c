@@ -26,6 +26,7 @@
 #define GPIO_IBE_MASK 0xFF  
 #define GPIO_IEV_MASK 0xFF
 volatile bool alert_btn = false;
+void (*volatile gpiof_hook)(uint8_t pins) = NULL;
 //*****************************************************************************
 // Verifies that the base address is a valid GPIO base address
 //*****************************************************************************
@@ -505,10 +506,36 @@ bool  gpio_config_falling_edge_irq(uint32_t gpioBase, uint8_t pins)
     
   return false;
 }
+//*****************************************************************************
+// Enabling a GPIO pin to generate and interrupt on the rising edge of a signal
+//*****************************************************************************
+bool  gpio_config_rising_edge_irq(uint32_t gpioBase, uint8_t pins)
+{
+  GPIOA_Type  *gpioPort;
+
+  if (verify_base_addr(gpioBase))
+  {
+    gpioPort = (GPIOA_Type *) gpioBase;
+    gpioPort->IM &= ~(pins & GPIO_IM_GPIO_M);   // mask while configuring
+    gpioPort->IS &= ~(pins & GPIO_IS_MASK);     // edge sensitive
+    gpioPort->IBE &= ~(pins & GPIO_IBE_MASK);   // one edge, chosen by IEV
+    gpioPort->IEV |= (pins & GPIO_IEV_MASK);    // rising edge
+    gpioPort->ICR = (pins & GPIO_ICR_GPIO_M);   // drop anything pending
+    gpioPort->IM |= (pins & GPIO_IM_GPIO_M);
+    return true;
+  }
+  return false;
+}
+
 void GPIOF_Handler() {
+	uint8_t pins = GPIOF->MIS & GPIO_MIS_GPIO_M;
+	
 	//printf("entered GPIOF_handler\n");
-	if(GPIOF->MIS & (PF0 & GPIO_MIS_GPIO_M)) {
+	if(pins & PF0) {
 		alert_btn = true;
-		GPIOF->ICR |= ( PF0 & GPIO_ICR_GPIO_M);
+	}
+	GPIOF->ICR = pins & GPIO_ICR_GPIO_M;
+	if(gpiof_hook != NULL) {
+		gpiof_hook(pins);
 	}
 }
@@ -7,6 +7,7 @@ volatile int16_t x,y,z;
 extern void hw1_search_memory(uint32_t addr);
 volatile bool alert_T1A = false;
 volatile bool alert_T4A = false;
+void (*volatile timer4a_hook)(void) = NULL;
 
 //*****************************************************************************
 // Verifies that the base address is a valid GPIO base address
@@ -257,6 +258,39 @@ bool gp_timer_config_16(uint32_t base_addr, uint32_t mode, bool count_up, bool e
   return true;  
 }
 
+//*****************************************************************************
+// Starts TIMER5 as a 32-bit up counter that wraps at 0xFFFFFFFF.
+//*****************************************************************************
+bool timebase_init(void)
+{
+  // already counting, keep the timestamps taken so far
+  if ( (SYSCTL->RCGCTIMER & SYSCTL_RCGCTIMER_R5) && (TIMER5->CTL & TIMER_CTL_TAEN) )
+  {
+    return true;
+  }
+  
+  return gp_timer_config_32(TIMEBASE_BASE, TIMER_TAMR_TAMR_PERIOD, true, false, 0xFFFFFFFF);
+}
+
+//*****************************************************************************
+// Returns the current timebase count in system clock ticks
+//*****************************************************************************
+uint32_t timebase_now(void)
+{
+  return TIMER5->TAV;
+}
+
+//*****************************************************************************
+// Waits until 'us' microseconds have passed on the timebase
+//*****************************************************************************
+void timebase_delay_us(uint32_t us)
+{
+  uint32_t start = timebase_now();
+  uint32_t ticks = us * TIMEBASE_TICKS_PER_US;
+  
+  while( (uint32_t)(timebase_now() - start) < ticks) {};
+}
+
 // LED BLINKER
 void TIMER1A_Handler(void){
 		//puts("entered timer1A handler\n");
@@ -272,6 +306,9 @@ void TIMER4A_Handler(void){
 	if(TIMER4->MIS & TIMER_MIS_TATOMIS) {
 			alert_T4A = true;
 			TIMER4->ICR |= TIMER_ICR_TATOCINT;
+			if(timer4a_hook != NULL) {
+				timer4a_hook();
+			}
 	}
 }
 
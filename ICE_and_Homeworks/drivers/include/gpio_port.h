@@ -171,4 +171,27 @@ bool  gpio_config_open_drain(uint32_t gpioBase, uint8_t pins);
 //      false   if gpioBase is not a valid GPIO Port Address 
 //*****************************************************************************
 bool  gpio_config_falling_edge_irq(uint32_t gpioBase, uint8_t pins);
+
+//******************************************************************************
+// Enabling a GPIO pin to generate and interrupt on the rising edge of a signal
+//
+// Paramters
+//    baseAddr - Base address of GPIO port that is being enabled.
+//    pins  -   A bit mask indicating which pins should be configured to 
+//              generate a rising edge interrupt.  A 1 in the bitmask
+//              indicates that the pin will generate an interrupt.  A 0 in the 
+//              bit mask indicates that the pin should not be modifed from
+//              its current configuration.
+//
+// Returns
+//      true    if gpioBase is a valid GPIO Port  Address
+//      false   if gpioBase is not a valid GPIO Port Address 
+//*****************************************************************************
+bool  gpio_config_rising_edge_irq(uint32_t gpioBase, uint8_t pins);
+
+//******************************************************************************
+// Called from GPIOF_Handler with the port F pins that interrupted, after they
+// are cleared and alert_btn is set for PF0.  NULL for none.
+//******************************************************************************
+extern void (*volatile gpiof_hook)(uint8_t pins);
 #endif
@@ -36,6 +36,28 @@ volatile extern int16_t x,y,z;
 
 bool gp_timer_wait(uint32_t base_addr, uint32_t ticks);
 
+//*****************************************************************************
+// Free running timebase.  TIMER5 counts up through all 32 bits at the 50MHz
+// system clock and never interrupts, so the difference of two reads of
+// timebase_now() is correct across a wrap for intervals up to ~85 seconds.
+//*****************************************************************************
+#define TIMEBASE_BASE           TIMER5_BASE
+#define TIMEBASE_TICKS_PER_US   50
+#define TIMEBASE_TICKS_PER_MS   50000
+
+//*****************************************************************************
+// Starts the timebase.  Safe to call more than once, a running timebase is
+// left alone so earlier timestamps stay valid.
+//*****************************************************************************
+bool timebase_init(void);
+
+uint32_t timebase_now(void);
+
+//*****************************************************************************
+// Busy waits 'us' microseconds against the timebase.
+//*****************************************************************************
+void timebase_delay_us(uint32_t us);
+
 void enableTimerIRQ(uint32_t base);
 	
 IRQn_Type timerA_get_irq_num(uint32_t base);
@@ -44,6 +66,12 @@ void timer4A_Handler(void);
 	
 void timer1A_Handler(void);
 
+//*****************************************************************************
+// Called from TIMER4A_Handler on every time out, after alert_T4A is set.
+// NULL for none.
+//*****************************************************************************
+extern void (*volatile timer4a_hook)(void);
+
 
 
 
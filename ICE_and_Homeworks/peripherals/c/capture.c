@@ -0,0 +1,432 @@
+#include <string.h>
+#include "capture.h"
+#include "lcd.h"
+#include "timers.h"
+
+#define CAPTURE_SYNC        0xF5
+#define CAPTURE_MASK        (CAPTURE_BUFFER_SIZE - 1)
+
+// Space only mirror, scroll and frame packets may use, so the host never
+// loses the LCD's state to a burst of pixels
+#define CAPTURE_RESERVE     32
+
+// frame packet flags
+#define CAPTURE_FRAME_DAMAGED   0x01
+
+bool capture_enabled = false;
+uint16_t capture_run_color;
+uint32_t capture_run_length = 0;
+
+// Single producer (the application), single consumer (the transport), so
+// each index is only written by one side
+static uint8_t ring[CAPTURE_BUFFER_SIZE];
+static volatile uint16_t produce = 0;
+static volatile uint16_t consume = 0;
+static uint16_t packet_left = 0;          // bytes of the packet being read
+
+static capture_kick_t capture_kick = NULL;
+static capture_stats_t stats;
+
+static uint16_t literal[CAPTURE_LITERAL_MAX];
+static uint8_t literal_count = 0;
+
+static lcd_rect_t window;
+static bool window_lost;                // part of the window was dropped
+static lcd_rect_t damage;
+static bool damaged = false;
+static bool frame_dirty = false;        // packets since the last frame packet
+static bool state_lost = false;         // a mirror or scroll packet was dropped
+
+static uint8_t mirror[2] = {0, 0};
+static uint16_t scroll[3] = {0, ROWS, 0};
+
+static __inline uint8_t *put_u16(uint8_t *p, uint16_t v)
+{
+  *p++ = v;
+  *p++ = v >> 8;
+  return p;
+}
+
+static __inline uint8_t *put_u32(uint8_t *p, uint32_t v)
+{
+  p = put_u16(p, v);
+  return put_u16(p, v >> 16);
+}
+
+static uint16_t space(void)
+{
+  return CAPTURE_BUFFER_SIZE - (uint16_t)(produce - consume);
+}
+
+//*****************************************************************************
+// Queues one packet, or nothing if it does not fit.  The packet is copied in
+// before produce moves, so the transport never sees part of one.
+//*****************************************************************************
+static bool capture_put(uint8_t type, const uint8_t *payload, uint8_t length)
+{
+  uint16_t head = produce;
+  uint16_t need = 3 + length;
+  bool state = (type == 'M' || type == 'S' || type == 'F');
+
+  if(space() < need + (state ? 0 : CAPTURE_RESERVE))
+  {
+    stats.dropped++;
+    return false;
+  }
+
+  ring[head++ & CAPTURE_MASK] = CAPTURE_SYNC;
+  ring[head++ & CAPTURE_MASK] = type;
+  ring[head++ & CAPTURE_MASK] = length;
+  while(length--)
+  {
+    ring[head++ & CAPTURE_MASK] = *payload++;
+  }
+  produce = head;
+
+  stats.bytes += need;
+  if(type != 'F')
+  {
+    frame_dirty = true;
+  }
+  if(capture_kick != NULL)
+  {
+    capture_kick();
+  }
+  return true;
+}
+
+//*****************************************************************************
+// Maps a rectangle between logical coordinates and GRAM through the current
+// mirror.  It is its own inverse.
+//*****************************************************************************
+static lcd_rect_t mirror_rect(lcd_rect_t rect)
+{
+  int16_t t;
+
+  if(mirror[0])
+  {
+    t = rect.x0;
+    rect.x0 = COLS - 1 - rect.x1;
+    rect.x1 = COLS - 1 - t;
+  }
+  if(mirror[1])
+  {
+    t = rect.y0;
+    rect.y0 = ROWS - 1 - rect.y1;
+    rect.y1 = ROWS - 1 - t;
+  }
+  return rect;
+}
+
+//*****************************************************************************
+// The rest of the window can not be placed on the host any more, so it all
+// goes to the damage rectangle and nothing more is sent until a new window.
+// Damage is kept in GRAM coordinates, the mirror may change before it is
+// repaired.
+//*****************************************************************************
+static void lose_window(void)
+{
+  lcd_rect_t lost = mirror_rect(window);
+
+  if(!damaged)
+  {
+    damage = lost;
+    damaged = true;
+  }
+  else
+  {
+    if(lost.x0 < damage.x0) damage.x0 = lost.x0;
+    if(lost.y0 < damage.y0) damage.y0 = lost.y0;
+    if(lost.x1 > damage.x1) damage.x1 = lost.x1;
+    if(lost.y1 > damage.y1) damage.y1 = lost.y1;
+  }
+  window_lost = true;
+}
+
+static void flush_literal(void)
+{
+  uint8_t payload[2 * CAPTURE_LITERAL_MAX];
+  uint8_t *p = payload;
+  uint8_t i;
+
+  if(literal_count == 0)
+  {
+    return;
+  }
+
+  if(!window_lost)
+  {
+    for(i = 0; i < literal_count; i++)
+    {
+      p = put_u16(p, literal[i]);
+    }
+    if(!capture_put('P', payload, p - payload))
+    {
+      lose_window();
+    }
+  }
+  literal_count = 0;
+}
+
+//*****************************************************************************
+// Sends the pending run, as a run packet if it is long enough to pay for
+// splitting the literal packet
+//*****************************************************************************
+static void end_run(void)
+{
+  uint8_t payload[6];
+
+  stats.pixels += capture_run_length;
+
+  if(capture_run_length >= CAPTURE_MIN_RUN)
+  {
+    flush_literal();
+    if(!window_lost)
+    {
+      put_u32(put_u16(payload, capture_run_color), capture_run_length);
+      if(!capture_put('R', payload, sizeof(payload)))
+      {
+        lose_window();
+      }
+    }
+  }
+  else
+  {
+    while(capture_run_length != 0)
+    {
+      capture_run_length--;
+      literal[literal_count++] = capture_run_color;
+      if(literal_count == CAPTURE_LITERAL_MAX)
+      {
+        flush_literal();
+      }
+    }
+  }
+  capture_run_length = 0;
+}
+
+static void flush(void)
+{
+  end_run();
+  flush_literal();
+}
+
+void capture_color_change(uint16_t color)
+{
+  end_run();
+  capture_run_color = color;
+  capture_run_length = 1;
+}
+
+void capture_run(uint16_t color, uint32_t count)
+{
+  if(color != capture_run_color)
+  {
+    end_run();
+    capture_run_color = color;
+  }
+  capture_run_length += count;
+}
+
+void capture_window(uint16_t x0, uint16_t x1, uint16_t y0, uint16_t y1)
+{
+  uint8_t payload[8];
+
+  flush();
+
+  window.x0 = x0;
+  window.x1 = x1;
+  window.y0 = y0;
+  window.y1 = y1;
+  window_lost = false;
+
+  put_u16(put_u16(put_u16(put_u16(payload, x0), x1), y0), y1);
+  if(!capture_put('W', payload, sizeof(payload)))
+  {
+    lose_window();
+  }
+}
+
+static bool send_mirror(void)
+{
+  return capture_put('M', mirror, sizeof(mirror));
+}
+
+static bool send_scroll(void)
+{
+  uint8_t payload[6];
+
+  put_u16(put_u16(put_u16(payload, scroll[0]), scroll[1]), scroll[2]);
+  return capture_put('S', payload, sizeof(payload));
+}
+
+void capture_mirror(bool mirror_x, bool mirror_y)
+{
+  mirror[0] = mirror_x;
+  mirror[1] = mirror_y;
+
+  if(capture_enabled)
+  {
+    flush();
+    state_lost |= !send_mirror();
+  }
+}
+
+void capture_scroll(uint16_t top, uint16_t height, uint16_t offset)
+{
+  scroll[0] = top;
+  scroll[1] = height;
+  scroll[2] = offset;
+
+  if(capture_enabled)
+  {
+    flush();
+    state_lost |= !send_scroll();
+  }
+}
+
+//*****************************************************************************
+// Reads damaged rows back out of GRAM, top down, while a worst case row
+// still fits.  Encoded pixels never cost more than 2 bytes each plus packet
+// headers, 3 bytes a pixel covers both.
+//*****************************************************************************
+static void repair(void)
+{
+  uint16_t line[COLS];
+  lcd_rect_t row;
+  uint16_t width;
+  uint16_t i;
+  uint8_t rows;
+
+  for(rows = 0; damaged && rows < CAPTURE_REPAIR_ROWS; rows++)
+  {
+    width = damage.x1 - damage.x0 + 1;
+    if(space() < 11 + 3 * width + CAPTURE_RESERVE)
+    {
+      return;
+    }
+
+    // The top damaged GRAM row, wherever the mirror puts it
+    row = damage;
+    row.y1 = row.y0;
+    row = mirror_rect(row);
+
+    lcd_read_rect(row.x0, row.y0, width, 1, line);
+
+    capture_window(row.x0, row.x1, row.y0, row.y1);
+    for(i = 0; i < width; i++)
+    {
+      capture_pixel(line[i]);
+    }
+    flush();
+    if(window_lost)
+    {
+      return;
+    }
+
+    stats.repaired++;
+    if(damage.y0 == damage.y1)
+    {
+      damaged = false;
+    }
+    else
+    {
+      damage.y0++;
+    }
+  }
+}
+
+void capture_start(capture_kick_t kick)
+{
+  capture_kick = kick;
+  memset(&stats, 0, sizeof(stats));
+  capture_run_length = 0;
+  literal_count = 0;
+  capture_enabled = true;
+
+  send_mirror();
+  send_scroll();
+  state_lost = false;
+
+  // Nothing before the first window can be placed, and the whole screen is
+  // resent as the key frame
+  window.x0 = 0;
+  window.y0 = 0;
+  window.x1 = COLS - 1;
+  window.y1 = ROWS - 1;
+  damaged = false;
+  lose_window();
+}
+
+void capture_stop(void)
+{
+  if(capture_enabled)
+  {
+    flush();
+    capture_enabled = false;
+  }
+}
+
+void capture_frame(void)
+{
+  uint8_t payload[9];
+  uint8_t *p;
+
+  if(!capture_enabled)
+  {
+    return;
+  }
+
+  flush();
+
+  if(state_lost)
+  {
+    state_lost = !(send_mirror() && send_scroll());
+  }
+
+  repair();
+
+  if(!frame_dirty)
+  {
+    return;
+  }
+
+  p = put_u32(put_u32(payload, stats.frames), timebase_now());
+  *p = damaged ? CAPTURE_FRAME_DAMAGED : 0;
+  if(capture_put('F', payload, sizeof(payload)))
+  {
+    frame_dirty = false;
+    stats.frames++;
+  }
+}
+
+bool capture_read_byte(uint8_t *data)
+{
+  uint16_t tail = consume;
+
+  if(tail == produce)
+  {
+    return false;
+  }
+
+  // The first byte of a packet, its length is two bytes on
+  if(packet_left == 0)
+  {
+    packet_left = 3 + ring[(uint16_t)(tail + 2) & CAPTURE_MASK];
+  }
+
+  *data = ring[tail & CAPTURE_MASK];
+  packet_left--;
+  consume = tail + 1;
+  return true;
+}
+
+bool capture_mid_packet(void)
+{
+  return packet_left != 0;
+}
+
+capture_stats_t capture_get_stats(void)
+{
+  return stats;
+}
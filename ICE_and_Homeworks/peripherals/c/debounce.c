@@ -0,0 +1,73 @@
+#include "debounce.h"
+
+void debounce_init(debounce_t *debounce, uint16_t long_ticks, uint16_t repeat_ticks)
+{
+  uint8_t i;
+
+  debounce->state = 0;
+  debounce->ct0 = 0xFF;
+  debounce->ct1 = 0xFF;
+  debounce->long_ticks = long_ticks;
+  debounce->repeat_ticks = repeat_ticks;
+  for (i = 0; i < DEBOUNCE_INPUTS; i++)
+  {
+    debounce->held[i] = 0;
+  }
+}
+
+bool debounce_sample(debounce_t *debounce, uint8_t raw, uint8_t valid, debounce_events_t *events)
+{
+  uint8_t changed;
+  uint8_t bit;
+  uint8_t i;
+
+  raw = (raw & valid) | (debounce->state & ~valid);
+
+  // Each counter counts down while its input differs from the debounced
+  // state and is reset by any sample that agrees.  changed is left with the
+  // inputs whose counter ran out this sample.
+  changed = debounce->state ^ raw;
+  debounce->ct0 = ~(debounce->ct0 & changed);
+  debounce->ct1 = debounce->ct0 ^ (debounce->ct1 & changed);
+  changed &= debounce->ct0 & debounce->ct1;
+  debounce->state ^= changed;
+
+  events->pressed = debounce->state & changed;
+  events->released = ~debounce->state & changed;
+  events->long_pressed = 0;
+  events->repeated = 0;
+
+  if (debounce->state != 0 && debounce->long_ticks != 0)
+  {
+    for (i = 0, bit = 1; i < DEBOUNCE_INPUTS; i++, bit <<= 1)
+    {
+      if (events->pressed & bit)
+      {
+        debounce->held[i] = 0;
+      }
+      else if (debounce->state & bit)
+      {
+        debounce->held[i]++;
+        if (debounce->held[i] == debounce->long_ticks)
+        {
+          events->long_pressed |= bit;
+        }
+        else if (debounce->repeat_ticks != 0 &&
+                 debounce->held[i] == debounce->long_ticks + debounce->repeat_ticks)
+        {
+          // back to the long press, so the count never wraps
+          debounce->held[i] = debounce->long_ticks;
+          events->repeated |= bit;
+        }
+      }
+    }
+  }
+
+  return (events->pressed | events->released | events->long_pressed | events->repeated) != 0;
+}
+
+bool debounce_settled(const debounce_t *debounce, uint8_t mask)
+{
+  // a counter is back at 11 after any sample that agreed with the state
+  return (debounce->ct0 & debounce->ct1 & mask) == mask;
+}
@@ -0,0 +1,518 @@
+#include <string.h>
+#include "display_list.h"
+
+#define DL_FILL         0
+#define DL_IMAGE        1
+#define DL_DRAW         2
+
+typedef struct
+{
+  uint8_t           type;
+  bool              opaque;
+  lcd_rect_t        rect;             // part of the command still showing
+  union
+  {
+    uint16_t        color;
+    struct
+    {
+      const image_t   *image;
+      int16_t         x_center;
+      int16_t         y_center;
+      uint8_t         flags;
+      uint16_t        fColor;
+      uint16_t        bColor;
+      const uint16_t  *palette;       // NULL when palette_copy is used
+      uint16_t        palette_copy[DL_PALETTE_SIZE];
+    } image;
+    struct
+    {
+      dl_draw_t       draw;
+      void            *context;
+    } draw;
+  } u;
+} dl_command_t;
+
+bool dl_count_visible = false;
+
+static dl_command_t commands[DL_MAX_COMMANDS];
+static uint8_t command_count = 0;
+static bool recording = false;
+static dl_stats_t stats;
+
+//*****************************************************************************
+// Rectangle helpers, all rectangles are inclusive
+//*****************************************************************************
+static uint32_t rect_area(const lcd_rect_t *r)
+{
+  return (uint32_t)(r->x1 - r->x0 + 1) * (r->y1 - r->y0 + 1);
+}
+
+static bool rect_overlaps(const lcd_rect_t *a, const lcd_rect_t *b)
+{
+  return a->x0 <= b->x1 && b->x0 <= a->x1 && a->y0 <= b->y1 && b->y0 <= a->y1;
+}
+
+static bool rect_contains(const lcd_rect_t *outer, const lcd_rect_t *inner)
+{
+  return outer->x0 <= inner->x0 && outer->x1 >= inner->x1 &&
+         outer->y0 <= inner->y0 && outer->y1 >= inner->y1;
+}
+
+//*****************************************************************************
+// Cuts r back to the part not under cover when cover hides a whole edge
+// strip of it.  Returns false if cover hides all of r.
+//*****************************************************************************
+static bool rect_trim(lcd_rect_t *r, const lcd_rect_t *cover)
+{
+  if (rect_contains(cover, r))
+  {
+    return false;
+  }
+
+  if (!rect_overlaps(cover, r))
+  {
+    return true;
+  }
+
+  // cover spans every column, trim rows off the top or bottom
+  if (cover->x0 <= r->x0 && cover->x1 >= r->x1)
+  {
+    if (cover->y0 <= r->y0)
+    {
+      r->y0 = cover->y1 + 1;
+    }
+    else if (cover->y1 >= r->y1)
+    {
+      r->y1 = cover->y0 - 1;
+    }
+  }
+  // cover spans every row, trim columns off the left or right
+  else if (cover->y0 <= r->y0 && cover->y1 >= r->y1)
+  {
+    if (cover->x0 <= r->x0)
+    {
+      r->x0 = cover->x1 + 1;
+    }
+    else if (cover->x1 >= r->x1)
+    {
+      r->x1 = cover->x0 - 1;
+    }
+  }
+
+  return true;
+}
+
+//*****************************************************************************
+// Sum of the areas of the union of the first count rectangles.  The plane is
+// cut on every rectangle edge and each cell is tested, O(n^3), which is why
+// it only runs when dl_count_visible is set.
+//*****************************************************************************
+static void sort_edges(int16_t *edges, uint8_t count)
+{
+  uint8_t i;
+  uint8_t j;
+  int16_t edge;
+
+  for (i = 1; i < count; i++)
+  {
+    edge = edges[i];
+    for (j = i; j > 0 && edges[j - 1] > edge; j--)
+    {
+      edges[j] = edges[j - 1];
+    }
+    edges[j] = edge;
+  }
+}
+
+static uint32_t union_area(uint8_t count)
+{
+  int16_t xs[2 * DL_MAX_COMMANDS];
+  int16_t ys[2 * DL_MAX_COMMANDS];
+  uint8_t i;
+  uint8_t j;
+  uint8_t k;
+  uint32_t area = 0;
+  const lcd_rect_t *r;
+
+  for (i = 0; i < count; i++)
+  {
+    xs[2 * i] = commands[i].rect.x0;
+    xs[2 * i + 1] = commands[i].rect.x1 + 1;
+    ys[2 * i] = commands[i].rect.y0;
+    ys[2 * i + 1] = commands[i].rect.y1 + 1;
+  }
+  sort_edges(xs, 2 * count);
+  sort_edges(ys, 2 * count);
+
+  for (i = 0; i + 1 < 2 * count; i++)
+  {
+    if (xs[i] == xs[i + 1])
+    {
+      continue;
+    }
+    for (j = 0; j + 1 < 2 * count; j++)
+    {
+      if (ys[j] == ys[j + 1])
+      {
+        continue;
+      }
+      for (k = 0; k < count; k++)
+      {
+        r = &commands[k].rect;
+        if (r->x0 <= xs[i] && r->x1 >= xs[i] && r->y0 <= ys[j] && r->y1 >= ys[j])
+        {
+          area += (uint32_t)(xs[i + 1] - xs[i]) * (ys[j + 1] - ys[j]);
+          break;
+        }
+      }
+    }
+  }
+
+  return area;
+}
+
+//*****************************************************************************
+// Draws one command, images and custom draws through a clip rect of what is
+// still showing.
+//*****************************************************************************
+static void execute(const dl_command_t *cmd)
+{
+  lcd_rect_t clip;
+
+  if (cmd->type == DL_FILL)
+  {
+    lcd_fill_rect(cmd->rect.x0, cmd->rect.y0, cmd->rect.x1 - cmd->rect.x0 + 1,
+                  cmd->rect.y1 - cmd->rect.y0 + 1, cmd->u.color);
+    return;
+  }
+
+  clip = lcd_get_clip();
+  lcd_set_clip(cmd->rect.x0, cmd->rect.y0, cmd->rect.x1, cmd->rect.y1);
+
+  if (cmd->type == DL_IMAGE)
+  {
+    image_blit(cmd->u.image.image, cmd->u.image.x_center, cmd->u.image.y_center,
+               cmd->u.image.flags, cmd->u.image.fColor, cmd->u.image.bColor,
+               cmd->u.image.palette != NULL ? cmd->u.image.palette : cmd->u.image.palette_copy);
+  }
+  else
+  {
+    cmd->u.draw.draw(cmd->u.draw.context);
+  }
+
+  lcd_set_clip(clip.x0, clip.y0, clip.x1, clip.y1);
+}
+
+//*****************************************************************************
+// Sorts the list into panel scan order and runs it.  The panel scans GRAM
+// line 0 first, which with the default MADCTL is the bottom row of the
+// screen, so the commands go out from the bottom row up.  A command is never moved past one
+// it overlaps, so what ends up on top does not change.
+//*****************************************************************************
+static void flush(void)
+{
+  dl_command_t cmd;
+  uint8_t i;
+  uint8_t j;
+
+  for (i = 1; i < command_count; i++)
+  {
+    cmd = commands[i];
+    for (j = i; j > 0; j--)
+    {
+      if (commands[j - 1].rect.y1 >= cmd.rect.y1 ||
+          rect_overlaps(&commands[j - 1].rect, &cmd.rect))
+      {
+        break;
+      }
+      commands[j] = commands[j - 1];
+    }
+    commands[j] = cmd;
+  }
+
+  for (i = 0; i < command_count; i++)
+  {
+    execute(&commands[i]);
+    stats.pixels_written += rect_area(&commands[i].rect);
+  }
+  stats.executed += command_count;
+
+  if (dl_count_visible)
+  {
+    stats.pixels_visible += union_area(command_count);
+  }
+
+  command_count = 0;
+}
+
+//*****************************************************************************
+// Takes a new command whose rect is the part of the screen it paints.  Opaque
+// commands cut back or drop what they cover, and a fill is merged into an
+// earlier one of the same color if the two make a rectangle.
+//*****************************************************************************
+static void record(const dl_command_t *cmd)
+{
+  lcd_rect_t rect = cmd->rect;
+  dl_command_t *prev;
+  uint8_t kept;
+  uint8_t i;
+
+  stats.recorded++;
+
+  if (!lcd_clip(&rect))
+  {
+    stats.culled++;
+    return;
+  }
+  stats.pixels_recorded += rect_area(&rect);
+
+  if (cmd->opaque)
+  {
+    kept = 0;
+    for (i = 0; i < command_count; i++)
+    {
+      if (!rect_trim(&commands[i].rect, &rect))
+      {
+        stats.culled++;
+        continue;
+      }
+      if (kept != i)
+      {
+        commands[kept] = commands[i];
+      }
+      kept++;
+    }
+    command_count = kept;
+  }
+
+  // Search back for a fill to extend.  Anything in between that overlaps
+  // the new fill would end up under it, so the search stops there.
+  if (cmd->type == DL_FILL)
+  {
+    for (i = command_count; i > 0; i--)
+    {
+      prev = &commands[i - 1];
+      if (prev->type == DL_FILL && prev->u.color == cmd->u.color)
+      {
+        if (prev->rect.x0 == rect.x0 && prev->rect.x1 == rect.x1 &&
+            prev->rect.y0 <= rect.y1 + 1 && rect.y0 <= prev->rect.y1 + 1)
+        {
+          prev->rect.y0 = (rect.y0 < prev->rect.y0) ? rect.y0 : prev->rect.y0;
+          prev->rect.y1 = (rect.y1 > prev->rect.y1) ? rect.y1 : prev->rect.y1;
+          stats.merged++;
+          return;
+        }
+        if (prev->rect.y0 == rect.y0 && prev->rect.y1 == rect.y1 &&
+            prev->rect.x0 <= rect.x1 + 1 && rect.x0 <= prev->rect.x1 + 1)
+        {
+          prev->rect.x0 = (rect.x0 < prev->rect.x0) ? rect.x0 : prev->rect.x0;
+          prev->rect.x1 = (rect.x1 > prev->rect.x1) ? rect.x1 : prev->rect.x1;
+          stats.merged++;
+          return;
+        }
+      }
+      if (rect_overlaps(&prev->rect, &rect))
+      {
+        break;
+      }
+    }
+  }
+
+  if (command_count == DL_MAX_COMMANDS)
+  {
+    flush();
+  }
+
+  commands[command_count] = *cmd;
+  commands[command_count].rect = rect;
+  command_count++;
+}
+
+//*****************************************************************************
+// Frame control
+//*****************************************************************************
+void dl_begin(void)
+{
+  memset(&stats, 0, sizeof(stats));
+  command_count = 0;
+  recording = true;
+}
+
+void dl_end(void)
+{
+  if (!recording)
+  {
+    return;
+  }
+
+  flush();
+  recording = false;
+}
+
+bool dl_recording(void)
+{
+  return recording;
+}
+
+//*****************************************************************************
+// Draw calls
+//*****************************************************************************
+void dl_fill_rect(int16_t x0, int16_t y0, uint16_t width, uint16_t height, uint16_t color)
+{
+  dl_command_t cmd;
+
+  if (!recording)
+  {
+    lcd_fill_rect(x0, y0, width, height, color);
+    return;
+  }
+
+  if (width == 0 || height == 0)
+  {
+    return;
+  }
+
+  cmd.type = DL_FILL;
+  cmd.opaque = true;
+  cmd.rect.x0 = x0;
+  cmd.rect.y0 = y0;
+  cmd.rect.x1 = ((int32_t)x0 + width - 1 > INT16_MAX) ? INT16_MAX : x0 + width - 1;
+  cmd.rect.y1 = ((int32_t)y0 + height - 1 > INT16_MAX) ? INT16_MAX : y0 + height - 1;
+  cmd.u.color = color;
+  record(&cmd);
+}
+
+void dl_draw_box(
+  int16_t x_start,
+  uint16_t x_len,
+  int16_t y_start,
+  uint16_t y_len,
+  uint16_t border_color,
+  uint16_t fill_color,
+  uint16_t border_width
+)
+{
+  // same geometry as lcd_draw_box
+  uint16_t width = x_len + 1;
+  uint16_t height = y_len;
+
+  if (2 * border_width >= width || 2 * border_width >= height)
+  {
+    dl_fill_rect(x_start, y_start, width, height, border_color);
+    return;
+  }
+
+  dl_fill_rect(x_start, y_start, width, border_width, border_color);
+  dl_fill_rect(x_start, y_start + height - border_width, width, border_width, border_color);
+  dl_fill_rect(x_start, y_start + border_width, border_width,
+               height - 2 * border_width, border_color);
+  dl_fill_rect(x_start + width - border_width, y_start + border_width, border_width,
+               height - 2 * border_width, border_color);
+  dl_fill_rect(x_start + border_width, y_start + border_width, width - 2 * border_width,
+               height - 2 * border_width, fill_color);
+}
+
+void dl_image(
+  const image_t *image,
+  int16_t x_center,
+  int16_t y_center,
+  uint8_t flags,
+  uint16_t fColor,
+  uint16_t bColor,
+  const uint16_t *palette
+)
+{
+  dl_command_t cmd;
+  uint16_t width;
+  uint16_t height;
+  uint16_t entries;
+
+  if (!recording)
+  {
+    image_blit(image, x_center, y_center, flags, fColor, bColor, palette);
+    return;
+  }
+
+  if (image == NULL || image->width == 0 || image->height == 0)
+  {
+    return;
+  }
+
+  // Same placement as image_blit.  Every pixel of the rectangle is written,
+  // 1 bpp images paint their background in bColor.
+  width = image->width * IMAGE_SCALE(flags);
+  height = image->height * IMAGE_SCALE(flags);
+  cmd.type = DL_IMAGE;
+  cmd.opaque = true;
+  cmd.rect.x0 = x_center - width / 2;
+  cmd.rect.y0 = y_center - height / 2;
+  cmd.rect.x1 = ((int32_t)cmd.rect.x0 + width - 1 > INT16_MAX) ? INT16_MAX : cmd.rect.x0 + width - 1;
+  cmd.rect.y1 = ((int32_t)cmd.rect.y0 + height - 1 > INT16_MAX) ? INT16_MAX : cmd.rect.y0 + height - 1;
+  cmd.u.image.image = image;
+  cmd.u.image.x_center = x_center;
+  cmd.u.image.y_center = y_center;
+  cmd.u.image.flags = flags;
+  cmd.u.image.fColor = fColor;
+  cmd.u.image.bColor = bColor;
+  cmd.u.image.palette = (palette != NULL) ? palette : image->palette;
+
+  if (IMAGE_IS_INDEXED(image->format) && cmd.u.image.palette == NULL)
+  {
+    return;
+  }
+
+  // A short caller palette is copied, it may not outlive this call
+  if (palette != NULL && IMAGE_IS_INDEXED(image->format))
+  {
+    entries = 1 << (1 << (image->format - IMAGE_2BPP + 1));
+    if (entries <= DL_PALETTE_SIZE)
+    {
+      memcpy(cmd.u.image.palette_copy, palette, entries * sizeof(uint16_t));
+      cmd.u.image.palette = NULL;
+    }
+  }
+
+  record(&cmd);
+}
+
+void dl_draw(
+  int16_t x0,
+  int16_t y0,
+  int16_t x1,
+  int16_t y1,
+  bool opaque,
+  dl_draw_t draw,
+  void *context
+)
+{
+  dl_command_t cmd;
+
+  cmd.type = DL_DRAW;
+  cmd.opaque = opaque;
+  cmd.rect.x0 = x0;
+  cmd.rect.y0 = y0;
+  cmd.rect.x1 = x1;
+  cmd.rect.y1 = y1;
+  cmd.u.draw.draw = draw;
+  cmd.u.draw.context = context;
+
+  if (!recording)
+  {
+    // same clip rect as a recorded draw would run with
+    if (lcd_clip(&cmd.rect))
+    {
+      execute(&cmd);
+    }
+    return;
+  }
+
+  record(&cmd);
+}
+
+//*****************************************************************************
+// Statistics
+//*****************************************************************************
+void dl_get_stats(dl_stats_t *out)
+{
+  *out = stats;
+}
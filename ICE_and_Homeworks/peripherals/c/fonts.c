@@ -0,0 +1,153 @@
+#include "fonts.h"
+#include "lcd.h"
+
+static const font_t *font_table[FONT_MAX_FONTS];
+static uint8_t font_count = 0;
+
+//*****************************************************************************
+// Adds a font to the font table.
+//*****************************************************************************
+uint8_t font_register(const font_t *font)
+{
+  uint8_t i;
+
+  if(font == NULL)
+  {
+    return FONT_INVALID;
+  }
+
+  // Registering the same font twice hands back the original id
+  for(i = 0; i < font_count; i++)
+  {
+    if(font_table[i] == font)
+    {
+      return i;
+    }
+  }
+
+  if(font_count >= FONT_MAX_FONTS)
+  {
+    return FONT_INVALID;
+  }
+
+  font_table[font_count] = font;
+  return font_count++;
+}
+
+//*****************************************************************************
+// Returns the font registered under id, or NULL.
+//*****************************************************************************
+const font_t *font_get(uint8_t id)
+{
+  if(id >= font_count)
+  {
+    return NULL;
+  }
+  return font_table[id];
+}
+
+//*****************************************************************************
+// Draws one glyph with its upper left corner at x, y.
+//*****************************************************************************
+uint16_t font_draw_char(
+  const font_t *font,
+  uint8_t c,
+  uint16_t x,
+  uint16_t y,
+  uint16_t fColor,
+  uint16_t bColor
+)
+{
+  const font_glyph_t *glyph = FONT_GLYPH(font, c);
+
+  if(glyph->width != 0)
+  {
+    lcd_draw_runs(x, y, glyph->width, font->height,
+                  &font->runs[glyph->run_offset], glyph->run_count,
+                  fColor, bColor);
+  }
+  return glyph->advance;
+}
+
+//*****************************************************************************
+// Draws a string with its upper left corner at x, y using font id.
+//*****************************************************************************
+uint16_t font_draw_string(
+  uint8_t id,
+  const char *string,
+  uint16_t x,
+  uint16_t y,
+  uint16_t fColor,
+  uint16_t bColor
+)
+{
+  const font_t *font = font_get(id);
+
+  if(font == NULL || string == NULL)
+  {
+    return x;
+  }
+
+  while(*string != '\0')
+  {
+    x += font_draw_char(font, (uint8_t)*string, x, y, fColor, bColor);
+    string++;
+  }
+  return x;
+}
+
+//*****************************************************************************
+// Returns the width in pixels of string when drawn with font id.
+//*****************************************************************************
+uint16_t font_string_width(uint8_t id, const char *string)
+{
+  const font_t *font = font_get(id);
+  uint16_t width = 0;
+
+  if(font == NULL || string == NULL)
+  {
+    return 0;
+  }
+
+  while(*string != '\0')
+  {
+    width += FONT_GLYPH(font, *string)->advance;
+    string++;
+  }
+  return width;
+}
+
+//*****************************************************************************
+// Legacy text output using the default font.
+//*****************************************************************************
+void print_string_toLCD(char string[],
+  uint16_t x_start,
+  uint16_t y_start,
+  uint16_t fColor,
+  uint16_t bColor)
+{
+  const font_t *font = font_get(0);
+  const font_glyph_t *glyph;
+  uint16_t xPos = x_start;
+
+  if(font == NULL)
+  {
+    return;
+  }
+
+  while(*string != '\0')
+  {
+    glyph = FONT_GLYPH(font, *string);
+
+    if(glyph->width != 0)
+    {
+      lcd_draw_runs(xPos - (glyph->width / 2), y_start - (font->height / 2),
+                    glyph->width, font->height,
+                    &font->runs[glyph->run_offset], glyph->run_count,
+                    fColor, bColor);
+    }
+
+    xPos += glyph->width / 2 + 4;
+    string++;
+  }
+}
@@ -85,6 +85,30 @@ static i2c_status_t ft6x06_read_data
 }
 
 
+//*****************************************************************************
+// Writes one FT6x06 register
+//*****************************************************************************
+static i2c_status_t ft6x06_write_reg(uint32_t i2c_base, uint8_t reg_address, uint8_t data)
+{
+  i2c_status_t status;
+  
+  while ( I2CMasterBusy(i2c_base)) {};
+
+  status = i2cSetSlaveAddr(i2c_base, FT6X06_DEV_ID, I2C_WRITE);
+  if ( status != I2C_OK )
+  {
+    return status;
+  }
+  
+  status = i2cSendByte(i2c_base, reg_address, I2C_MCS_START | I2C_MCS_RUN);
+  if ( status != I2C_OK )
+  {
+    return status;
+  }
+  
+  return i2cSendByte(i2c_base, data, I2C_MCS_RUN | I2C_MCS_STOP);
+}
+
 //*****************************************************************************
 // Read the number of active touch points.
 //*****************************************************************************
@@ -165,6 +189,85 @@ uint16_t ft6x06_read_y(void)
 	return 320 - (((YH << 8) + YL) % 321);
 } 
 
+//*****************************************************************************
+// Reads TD_STATUS through P2_MISC in one burst
+//*****************************************************************************
+bool ft6x06_read_report(ft6x06_report_t *report)
+{
+  uint8_t data[FT6X06_REPORT_BYTES];
+  uint8_t mcs;
+  uint8_t i;
+  uint8_t p;
+  uint8_t *point;
+  
+  if (ft6x06_set_addr(FT6X06_I2C_BASE, FT6X06_TD_STATUS_R) != I2C_OK)
+    return false;
+  
+  if (i2cSetSlaveAddr(FT6X06_I2C_BASE, FT6X06_DEV_ID, I2C_READ) != I2C_OK)
+    return false;
+  
+  // every byte but the last is acknowledged so the controller keeps going
+  for (i = 0; i < FT6X06_REPORT_BYTES; i++)
+  {
+    mcs = I2C_MCS_RUN;
+    mcs |= (i == 0) ? I2C_MCS_START : 0;
+    mcs |= (i == FT6X06_REPORT_BYTES - 1) ? I2C_MCS_STOP : I2C_MCS_ACK;
+    if (i2cGetByte(FT6X06_I2C_BASE, &data[i], mcs) != I2C_OK)
+      return false;
+  }
+  
+  report->count = (data[0] & 0x0F) <= 2 ? (data[0] & 0x0F) : 0;
+  for (p = 0; p < 2; p++)
+  {
+    // XH, XL, YH, YL of the point
+    point = &data[(p == 0 ? FT6X06_P1_XH_R : FT6X06_P2_XH_R) - FT6X06_TD_STATUS_R];
+    report->x[p] = 239 - ((((point[0] & 0xF) << 8) + point[1]) % 240);
+    report->y[p] = 320 - ((((point[2] & 0xF) << 8) + point[3]) % 321);
+  }
+  return true;
+}
+
+//*****************************************************************************
+// Trigger mode and the INT pin interrupt
+//*****************************************************************************
+bool ft6x06_init_irq(uint8_t priority)
+{
+  if(gpio_enable_port(FT6X06_IRQ_GPIO_BASE) == false)
+  {
+    return false;
+  }
+  
+  if(gpio_config_digital_enable(FT6X06_IRQ_GPIO_BASE, FT6X06_IRQ_PIN_NUM) == false)
+  {
+    return false;
+  }
+  
+  if(gpio_config_enable_input(FT6X06_IRQ_GPIO_BASE, FT6X06_IRQ_PIN_NUM) == false)
+  {
+    return false;
+  }
+  
+  // INT is open drain on the controller
+  if(gpio_config_enable_pullup(FT6X06_IRQ_GPIO_BASE, FT6X06_IRQ_PIN_NUM) == false)
+  {
+    return false;
+  }
+  
+  if (ft6x06_write_reg(FT6X06_I2C_BASE, FT6X06_G_MODE_R, FT6X06_G_MODE_TRIGGER) != I2C_OK)
+  {
+    return false;
+  }
+  
+  if(gpio_config_falling_edge_irq(FT6X06_IRQ_GPIO_BASE, FT6X06_IRQ_PIN_NUM) == false)
+  {
+    return false;
+  }
+  
+  NVIC_SetPriority(GPIOF_IRQn, priority);
+  NVIC_EnableIRQ(GPIOF_IRQn);
+  return true;
+}
+
 //*****************************************************************************
 // Test the ft6x06
 //*****************************************************************************
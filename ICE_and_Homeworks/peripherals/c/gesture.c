@@ -0,0 +1,209 @@
+#include "gesture.h"
+#include "timers.h"
+
+// gesture_state_t.state
+#define STATE_IDLE      0
+#define STATE_DOWN      1             // one finger, within slop
+#define STATE_MOVING    2             // past slop, a swipe so far
+#define STATE_DRAGGING  3
+#define STATE_PINCH     4
+#define STATE_WAIT_UP   5             // rest of a pinch, ignored
+
+const gesture_config_t gesture_default_config =
+{
+  GESTURE_TAP_MS,
+  GESTURE_DOUBLE_TAP_MS,
+  GESTURE_SWIPE_MS,
+  GESTURE_SLOP,
+  GESTURE_SWIPE_DISTANCE,
+  GESTURE_PINCH_STEP
+};
+
+uint16_t gesture_distance(int16_t dx, int16_t dy)
+{
+  uint16_t ax = (dx < 0) ? -dx : dx;
+  uint16_t ay = (dy < 0) ? -dy : dy;
+
+  return (ax > ay) ? ax + ay / 2 : ay + ax / 2;
+}
+
+void gesture_init(gesture_state_t *state, const gesture_config_t *config)
+{
+  state->config = (config != NULL) ? config : &gesture_default_config;
+  state->state = STATE_IDLE;
+  state->tapped = false;
+}
+
+static void set(gesture_t *out, gesture_type_t type, int16_t x, int16_t y, int16_t dx, int16_t dy)
+{
+  out->type = type;
+  out->dir = 0;
+  out->x = x;
+  out->y = y;
+  out->dx = dx;
+  out->dy = dy;
+}
+
+static void start_pinch(gesture_state_t *state, const uint16_t x[2], const uint16_t y[2])
+{
+  state->pinch_start = gesture_distance(x[1] - x[0], y[1] - y[0]);
+  state->pinch_last = state->pinch_start;
+  state->state = STATE_PINCH;
+}
+
+//*****************************************************************************
+// The end of a one finger touch
+//*****************************************************************************
+static bool release(gesture_state_t *state, uint32_t time, gesture_t *out)
+{
+  const gesture_config_t *config = state->config;
+  uint32_t elapsed = time - state->down_time;
+  int16_t dx = state->last_x - state->down_x;
+  int16_t dy = state->last_y - state->down_y;
+  uint8_t was = state->state;
+
+  state->state = STATE_IDLE;
+
+  if (was == STATE_DRAGGING)
+  {
+    set(out, GESTURE_DRAG_END, state->last_x, state->last_y, 0, 0);
+    return true;
+  }
+
+  if (was == STATE_MOVING)
+  {
+    if (elapsed > config->swipe_ms * TIMEBASE_TICKS_PER_MS ||
+        gesture_distance(dx, dy) < config->swipe_distance)
+    {
+      return false;
+    }
+    set(out, GESTURE_SWIPE, state->down_x, state->down_y, dx, dy);
+    if (((dx < 0) ? -dx : dx) >= ((dy < 0) ? -dy : dy))
+    {
+      out->dir = (dx < 0) ? GESTURE_LEFT : GESTURE_RIGHT;
+    }
+    else
+    {
+      out->dir = (dy < 0) ? GESTURE_UP : GESTURE_DOWN;
+    }
+    return true;
+  }
+
+  // STATE_DOWN, held too long for a tap
+  if (elapsed > config->tap_ms * TIMEBASE_TICKS_PER_MS)
+  {
+    return false;
+  }
+
+  if (state->tapped &&
+      time - state->tap_time <= config->double_tap_ms * TIMEBASE_TICKS_PER_MS &&
+      gesture_distance(state->down_x - state->tap_x, state->down_y - state->tap_y) <= config->slop)
+  {
+    state->tapped = false;
+    set(out, GESTURE_DOUBLE_TAP, state->down_x, state->down_y, 0, 0);
+    return true;
+  }
+
+  state->tapped = true;
+  state->tap_time = time;
+  state->tap_x = state->down_x;
+  state->tap_y = state->down_y;
+  set(out, GESTURE_TAP, state->down_x, state->down_y, 0, 0);
+  return true;
+}
+
+bool gesture_feed(gesture_state_t *state, uint32_t time, uint8_t count,
+                  const uint16_t x[2], const uint16_t y[2], gesture_t *out)
+{
+  const gesture_config_t *config = state->config;
+  uint16_t distance;
+  bool dragging;
+
+  switch (state->state)
+  {
+    case STATE_IDLE:
+      if (count >= 2)
+      {
+        start_pinch(state, x, y);
+      }
+      else if (count == 1)
+      {
+        state->state = STATE_DOWN;
+        state->down_time = time;
+        state->down_x = x[0];
+        state->down_y = y[0];
+        state->last_x = x[0];
+        state->last_y = y[0];
+      }
+      return false;
+
+    case STATE_PINCH:
+      if (count < 2)
+      {
+        state->state = (count == 0) ? STATE_IDLE : STATE_WAIT_UP;
+        return false;
+      }
+      distance = gesture_distance(x[1] - x[0], y[1] - y[0]);
+      if (distance + config->pinch_step > state->pinch_last &&
+          distance < state->pinch_last + config->pinch_step)
+      {
+        return false;
+      }
+      state->pinch_last = distance;
+      set(out, GESTURE_PINCH, (x[0] + x[1]) / 2, (y[0] + y[1]) / 2,
+          (int16_t)distance - (int16_t)state->pinch_start, 0);
+      return true;
+
+    case STATE_WAIT_UP:
+      if (count == 0)
+      {
+        state->state = STATE_IDLE;
+      }
+      return false;
+
+    default:
+      break;
+  }
+
+  // one finger states
+  if (count == 0)
+  {
+    return release(state, time, out);
+  }
+
+  if (count >= 2)
+  {
+    // a second finger turns the touch into a pinch
+    dragging = (state->state == STATE_DRAGGING);
+    start_pinch(state, x, y);
+    if (dragging)
+    {
+      set(out, GESTURE_DRAG_END, state->last_x, state->last_y, 0, 0);
+    }
+    return dragging;
+  }
+
+  if (state->state == STATE_DOWN &&
+      gesture_distance(x[0] - state->down_x, y[0] - state->down_y) > config->slop)
+  {
+    state->state = STATE_MOVING;
+  }
+
+  if (state->state == STATE_MOVING &&
+      time - state->down_time > config->swipe_ms * TIMEBASE_TICKS_PER_MS)
+  {
+    state->state = STATE_DRAGGING;
+  }
+
+  if (state->state == STATE_DRAGGING && (x[0] != state->last_x || y[0] != state->last_y))
+  {
+    set(out, GESTURE_DRAG, x[0], y[0], x[0] - state->last_x, y[0] - state->last_y);
+    state->last_x = x[0];
+    state->last_y = y[0];
+    return true;
+  }
+
+  state->last_x = x[0];
+  state->last_y = y[0];
+  return false;
+}
@@ -0,0 +1,629 @@
+#include "image.h"
+#include "lcd.h"
+
+static const uint8_t image_bpp[] = {1, 1, 2, 4, 8};
+
+// Position in an IMAGE_1BPP_RLE stream.  Saving and restoring it lets a row
+// be decoded again for vertical scaling.
+typedef struct
+{
+  const uint8_t   *data;
+  const uint8_t   *end;
+  uint32_t        run;              // pixels left in the current run
+  bool            foreground;
+} image_rle_cursor_t;
+
+// The part of a blit that survives clipping, in destination (scaled) pixels
+// and in the order they are streamed to the window, so after a flip col0 is
+// the rightmost visible screen column.
+typedef struct
+{
+  uint16_t        col0;
+  uint16_t        col1;
+  uint16_t        row0;
+  uint16_t        row1;
+} image_view_t;
+
+//*****************************************************************************
+// Reads the next LEB128 run length and switches color.  Past the end of the
+// data everything is background.
+//*****************************************************************************
+static void image_rle_next(image_rle_cursor_t *cursor)
+{
+  uint8_t shift = 0;
+
+  cursor->foreground = !cursor->foreground;
+  cursor->run = 0;
+
+  if(cursor->data >= cursor->end)
+  {
+    cursor->foreground = false;
+    cursor->run = 0xFFFFFFFF;
+    return;
+  }
+
+  do
+  {
+    cursor->run |= (uint32_t)(*cursor->data & 0x7F) << shift;
+    shift += 7;
+  } while((*cursor->data++ & 0x80) && cursor->data < cursor->end);
+}
+
+//*****************************************************************************
+// Decodes IMAGE_1BPP_RLE data into the active LCD window.  Every run goes
+// out as one lcd_write_run burst, so long stretches of background cost one
+// chip select transaction no matter how many rows they cover.
+//*****************************************************************************
+static void image_draw_rle(const image_t *image, uint16_t fColor, uint16_t bColor)
+{
+  image_rle_cursor_t cursor;
+  uint32_t remaining = (uint32_t)image->width * image->height;
+  uint32_t count;
+
+  cursor.data = image->data;
+  cursor.end = image->data + image->size;
+  cursor.foreground = true;
+  image_rle_next(&cursor);
+
+  while(remaining != 0)
+  {
+    // Never write past the window, a corrupt asset would wrap around
+    count = (cursor.run > remaining) ? remaining : cursor.run;
+
+    lcd_write_run(cursor.foreground ? fColor : bColor, count);
+    remaining -= count;
+    image_rle_next(&cursor);
+  }
+}
+
+//*****************************************************************************
+// Scaled RLE.  A row is replayed scale times from a saved cursor, and every
+// run within the row is simply scale times longer.
+//*****************************************************************************
+static void image_draw_rle_scaled(
+  const image_t *image,
+  uint8_t scale,
+  uint16_t fColor,
+  uint16_t bColor
+)
+{
+  image_rle_cursor_t cursor;
+  image_rle_cursor_t row_start;
+  uint16_t y;
+  uint16_t left;
+  uint16_t count;
+  uint8_t i;
+
+  cursor.data = image->data;
+  cursor.end = image->data + image->size;
+  cursor.foreground = true;
+  image_rle_next(&cursor);
+
+  for(y = 0; y < image->height; y++)
+  {
+    row_start = cursor;
+    for(i = 0; i < scale; i++)
+    {
+      cursor = row_start;
+      left = image->width;
+      while(left != 0)
+      {
+        if(cursor.run == 0)
+        {
+          image_rle_next(&cursor);
+          continue;
+        }
+        count = (cursor.run > left) ? left : (uint16_t)cursor.run;
+        lcd_write_run(cursor.foreground ? fColor : bColor, (uint32_t)count * scale);
+        cursor.run -= count;
+        left -= count;
+      }
+    }
+  }
+}
+
+//*****************************************************************************
+// Clipped RLE, any scale.  Runs can not be found without decoding the ones
+// before them, so hidden rows are still decoded, but only visible pixels
+// reach the bus and decoding stops after the last visible row.
+//*****************************************************************************
+static void image_draw_rle_clipped(
+  const image_t *image,
+  uint8_t scale,
+  const image_view_t *view,
+  uint16_t fColor,
+  uint16_t bColor
+)
+{
+  image_rle_cursor_t cursor;
+  image_rle_cursor_t row_start;
+  lcd_clip_stream_t stream;
+  uint16_t y;
+  uint16_t left;
+  uint16_t count;
+  uint8_t i;
+
+  stream.width = image->width * scale;
+  stream.col0 = view->col0;
+  stream.col1 = view->col1;
+  stream.row0 = view->row0;
+  stream.row1 = view->row1;
+  stream.col = 0;
+  stream.row = 0;
+
+  cursor.data = image->data;
+  cursor.end = image->data + image->size;
+  cursor.foreground = true;
+  image_rle_next(&cursor);
+
+  for(y = 0; y <= view->row1 / scale; y++)
+  {
+    row_start = cursor;
+    for(i = 0; i < scale; i++)
+    {
+      cursor = row_start;
+      left = image->width;
+      while(left != 0)
+      {
+        if(cursor.run == 0)
+        {
+          image_rle_next(&cursor);
+          continue;
+        }
+        count = (cursor.run > left) ? left : (uint16_t)cursor.run;
+        lcd_clip_stream_run(&stream, cursor.foreground ? fColor : bColor,
+                            (uint32_t)count * scale);
+        cursor.run -= count;
+        left -= count;
+      }
+    }
+  }
+}
+
+//*****************************************************************************
+// Draws the view of IMAGE_1BPP data.  Equal pixels within a row are merged
+// into runs, so each row costs a handful of bursts rather than a write per
+// pixel.
+//*****************************************************************************
+static void image_draw_1bpp(
+  const image_t *image,
+  uint8_t scale,
+  const image_view_t *view,
+  uint16_t fColor,
+  uint16_t bColor
+)
+{
+  uint16_t bytes_per_row = (image->width + 7) / 8;
+  const uint8_t *row;
+  uint16_t x;
+  uint16_t y;
+  uint16_t left;
+  uint16_t n;
+  uint16_t run;
+  bool pixel;
+  bool color;
+
+  // Only the source rows and columns under the view are read
+  for(y = view->row0; y <= view->row1; y++)
+  {
+    row = image->data + (uint32_t)(y / scale) * bytes_per_row;
+    x = view->col0 / scale;
+    n = scale - view->col0 % scale;
+    left = view->col1 - view->col0 + 1;
+    color = (row[x / 8] & (0x80 >> (x % 8))) != 0;
+    run = 0;
+    while(left != 0)
+    {
+      if(n > left)
+      {
+        n = left;
+      }
+      pixel = (row[x / 8] & (0x80 >> (x % 8))) != 0;
+      if(pixel != color)
+      {
+        lcd_write_run(color ? fColor : bColor, run);
+        color = pixel;
+        run = 0;
+      }
+      run += n;
+      left -= n;
+      x++;
+      n = scale;
+    }
+    lcd_write_run(color ? fColor : bColor, run);
+  }
+}
+
+//*****************************************************************************
+// Expands the view of an indexed image into the active LCD window one row at
+// a time.  Rows are padded to a byte, so an unclipped, unscaled image whose
+// rows fill their last byte exactly (every 8bpp image, or any width that is
+// a multiple of 8/bpp) goes out in a single burst.
+//*****************************************************************************
+static void image_draw_indexed(
+  const image_t *image,
+  uint8_t scale,
+  const image_view_t *view,
+  const uint16_t *palette
+)
+{
+  uint8_t bpp = image_bpp[image->format];
+  uint16_t bytes_per_row = ((uint32_t)image->width * bpp + 7) / 8;
+  const uint8_t *row;
+  uint16_t x;
+  uint16_t y;
+  uint16_t left;
+  uint16_t n;
+  bool whole = view->col0 == 0 && view->col1 == image->width * scale - 1 &&
+               view->row0 == 0 && view->row1 == image->height * scale - 1;
+
+  if(whole && scale == 1 && ((uint32_t)image->width * bpp) % 8 == 0)
+  {
+    lcd_write_indexed(image->data, bpp, 0, (uint32_t)image->width * image->height, palette, 1);
+    return;
+  }
+
+  for(y = view->row0; y <= view->row1; y++)
+  {
+    row = image->data + (uint32_t)(y / scale) * bytes_per_row;
+    x = view->col0 / scale;
+    left = view->col1 - view->col0 + 1;
+
+    // A pixel cut by the left edge of the view is repeated fewer times
+    n = scale - view->col0 % scale;
+    if(n != scale)
+    {
+      if(n > left)
+      {
+        n = left;
+      }
+      lcd_write_indexed(row, bpp, x, 1, palette, n);
+      x++;
+      left -= n;
+    }
+
+    n = left / scale;
+    lcd_write_indexed(row, bpp, x, n, palette, scale);
+    x += n;
+    left -= n * scale;
+
+    // and so is one cut by the right edge
+    if(left != 0)
+    {
+      lcd_write_indexed(row, bpp, x, 1, palette, left);
+    }
+  }
+}
+
+//*****************************************************************************
+// Draws an image centered on x_center, y_center with flips and scaling.
+//*****************************************************************************
+bool image_blit(
+  const image_t *image,
+  int16_t x_center,
+  int16_t y_center,
+  uint8_t flags,
+  uint16_t fColor,
+  uint16_t bColor,
+  const uint16_t *palette
+)
+{
+  uint8_t scale = IMAGE_SCALE(flags);
+  uint16_t width;
+  uint16_t height;
+  int16_t x0;
+  int16_t y0;
+  lcd_rect_t rect;
+  image_view_t view;
+  bool whole;
+
+  if(image == NULL || image->width == 0 || image->height == 0)
+  {
+    return false;
+  }
+
+  if(IMAGE_IS_INDEXED(image->format))
+  {
+    if(palette == NULL)
+    {
+      palette = image->palette;
+    }
+    if(palette == NULL)
+    {
+      return false;
+    }
+  }
+  else if(image->format != IMAGE_1BPP && image->format != IMAGE_1BPP_RLE)
+  {
+    return false;
+  }
+
+  width = image->width * scale;
+  height = image->height * scale;
+  x0 = x_center - width / 2;
+  y0 = y_center - height / 2;
+
+  rect.x0 = x0;
+  rect.y0 = y0;
+  rect.x1 = ((int32_t)x0 + width - 1 > INT16_MAX) ? INT16_MAX : x0 + width - 1;
+  rect.y1 = ((int32_t)y0 + height - 1 > INT16_MAX) ? INT16_MAX : y0 + height - 1;
+
+  // Nothing visible, nothing sent
+  if(!lcd_clip(&rect))
+  {
+    return true;
+  }
+
+  // The visible screen rectangle in stream order.  A flip streams the
+  // destination columns (rows) from the right (bottom) edge of the image.
+  if(flags & IMAGE_FLIP_H)
+  {
+    view.col0 = (x0 + width - 1) - rect.x1;
+    view.col1 = (x0 + width - 1) - rect.x0;
+  }
+  else
+  {
+    view.col0 = rect.x0 - x0;
+    view.col1 = rect.x1 - x0;
+  }
+  if(flags & IMAGE_FLIP_V)
+  {
+    view.row0 = (y0 + height - 1) - rect.y1;
+    view.row1 = (y0 + height - 1) - rect.y0;
+  }
+  else
+  {
+    view.row0 = rect.y0 - y0;
+    view.row1 = rect.y1 - y0;
+  }
+  whole = view.col0 == 0 && view.col1 == width - 1 &&
+          view.row0 == 0 && view.row1 == height - 1;
+
+  // A flipped window is addressed in mirrored coordinates
+  if(flags & (IMAGE_FLIP_H | IMAGE_FLIP_V))
+  {
+    lcd_set_mirror((flags & IMAGE_FLIP_H) != 0, (flags & IMAGE_FLIP_V) != 0);
+  }
+  if(flags & IMAGE_FLIP_H)
+  {
+    x0 = COLS - 1 - rect.x1;
+    rect.x1 = COLS - 1 - rect.x0;
+    rect.x0 = x0;
+  }
+  if(flags & IMAGE_FLIP_V)
+  {
+    y0 = ROWS - 1 - rect.y1;
+    rect.y1 = ROWS - 1 - rect.y0;
+    rect.y0 = y0;
+  }
+
+  lcd_set_pos(rect.x0, rect.x1, rect.y0, rect.y1);
+
+  switch(image->format)
+  {
+    case IMAGE_1BPP:
+    {
+      image_draw_1bpp(image, scale, &view, fColor, bColor);
+      break;
+    }
+    case IMAGE_1BPP_RLE:
+    {
+      if(!whole)
+      {
+        image_draw_rle_clipped(image, scale, &view, fColor, bColor);
+      }
+      else if(scale == 1)
+      {
+        image_draw_rle(image, fColor, bColor);
+      }
+      else
+      {
+        image_draw_rle_scaled(image, scale, fColor, bColor);
+      }
+      break;
+    }
+    default:
+    {
+      image_draw_indexed(image, scale, &view, palette);
+      break;
+    }
+  }
+
+  if(flags & (IMAGE_FLIP_H | IMAGE_FLIP_V))
+  {
+    lcd_set_mirror(false, false);
+  }
+  return true;
+}
+
+//*****************************************************************************
+// Draws an image with its upper left corner at x0, y0.
+//*****************************************************************************
+bool image_draw_at(
+  const image_t *image,
+  int16_t x0,
+  int16_t y0,
+  uint16_t fColor,
+  uint16_t bColor
+)
+{
+  if(image == NULL)
+  {
+    return false;
+  }
+  return image_blit(image, x0 + image->width / 2, y0 + image->height / 2,
+                    0, fColor, bColor, NULL);
+}
+
+//*****************************************************************************
+// Draws an image centered on x_center, y_center.
+//*****************************************************************************
+bool image_draw(
+  const image_t *image,
+  int16_t x_center,
+  int16_t y_center,
+  uint16_t fColor,
+  uint16_t bColor
+)
+{
+  return image_blit(image, x_center, y_center, 0, fColor, bColor, NULL);
+}
+
+//*****************************************************************************
+// Draws an indexed image through a caller supplied palette.
+//*****************************************************************************
+bool image_draw_palette(
+  const image_t *image,
+  int16_t x_center,
+  int16_t y_center,
+  const uint16_t *palette
+)
+{
+  if(image == NULL || palette == NULL || !IMAGE_IS_INDEXED(image->format))
+  {
+    return false;
+  }
+  return image_blit(image, x_center, y_center, 0, 0, 0, palette);
+}
+
+//*****************************************************************************
+// Composes one screen row of an image into a line buffer.  The source row
+// is walked left to right, which RLE data needs anyway, and every opaque
+// source pixel is copied to the scale destination columns it lands on.
+//*****************************************************************************
+bool image_compose_row(
+  const image_t *image,
+  int16_t x_center,
+  int16_t y_center,
+  uint8_t flags,
+  uint16_t fColor,
+  const uint16_t *palette,
+  int16_t y,
+  int16_t x0,
+  uint16_t count,
+  uint16_t *span
+)
+{
+  uint8_t scale = IMAGE_SCALE(flags);
+  uint8_t bpp;
+  uint16_t width;
+  uint16_t height;
+  int16_t left;
+  int16_t top;
+  int32_t dest;
+  int32_t end;
+  uint16_t src_row;
+  uint16_t x;
+  uint8_t index;
+  uint32_t skip;
+  const uint8_t *row = NULL;
+  image_rle_cursor_t cursor;
+  uint16_t color;
+  uint8_t i;
+
+  if(image == NULL || image->width == 0 || image->height == 0)
+  {
+    return false;
+  }
+
+  if(IMAGE_IS_INDEXED(image->format))
+  {
+    if(palette == NULL)
+    {
+      palette = image->palette;
+    }
+    if(palette == NULL)
+    {
+      return false;
+    }
+  }
+  else if(image->format != IMAGE_1BPP && image->format != IMAGE_1BPP_RLE)
+  {
+    return false;
+  }
+
+  width = image->width * scale;
+  height = image->height * scale;
+  left = x_center - width / 2;
+  top = y_center - height / 2;
+
+  // Row not covered, or the image is entirely left or right of the span
+  if(y < top || y >= top + height || left >= x0 + count || left + width <= x0)
+  {
+    return true;
+  }
+
+  src_row = (y - top) / scale;
+  if(flags & IMAGE_FLIP_V)
+  {
+    src_row = image->height - 1 - src_row;
+  }
+
+  bpp = image_bpp[image->format];
+  if(image->format == IMAGE_1BPP_RLE)
+  {
+    // Decode up to the start of the row
+    cursor.data = image->data;
+    cursor.end = image->data + image->size;
+    cursor.foreground = true;
+    image_rle_next(&cursor);
+    skip = (uint32_t)src_row * image->width;
+    while(skip != 0)
+    {
+      if(cursor.run >= skip)
+      {
+        cursor.run -= skip;
+        break;
+      }
+      skip -= cursor.run;
+      image_rle_next(&cursor);
+    }
+  }
+  else
+  {
+    row = image->data + (uint32_t)src_row * (((uint32_t)image->width * bpp + 7) / 8);
+  }
+
+  for(x = 0; x < image->width; x++)
+  {
+    if(image->format == IMAGE_1BPP_RLE)
+    {
+      while(cursor.run == 0)
+      {
+        image_rle_next(&cursor);
+      }
+      cursor.run--;
+      if(!cursor.foreground)
+      {
+        continue;
+      }
+      color = fColor;
+    }
+    else
+    {
+      index = (row[(x * bpp) / 8] >> (8 - bpp - (x * bpp) % 8)) & ((1 << bpp) - 1);
+      if(index == 0)
+      {
+        continue;
+      }
+      color = (bpp == 1) ? fColor : palette[index];
+    }
+
+    dest = left + (int32_t)((flags & IMAGE_FLIP_H) ? image->width - 1 - x : x) * scale;
+    end = dest + scale;
+    if(dest < x0)
+    {
+      dest = x0;
+    }
+    if(end > x0 + count)
+    {
+      end = x0 + count;
+    }
+    for(i = 0; dest + i < end; i++)
+    {
+      span[dest + i - x0] = color;
+    }
+  }
+
+  return true;
+}
@@ -1,20 +1,15 @@
 #include "lcd.h"
-#include "string.h"
-/*******************************************************************************
-* Function Name: delayms
-********************************************************************************
-* Summary: Adds delay in between function calls.
-* Return:
-*  Nothing
-*******************************************************************************/
-static void delayms(uint16_t count)
-{
-    int i,j;                                                                                
-    for(i=0;i<count;i++)                                                                    
-       {
-       for(j=0;j<5000;j++);
-       }                                                                                     
-}
+#include "capture.h"
+
+// Screen capture hooks, see capture.h.  Unless the project defines
+// LCD_CAPTURE as 1 they are not in the pixel loops at all.
+#if LCD_CAPTURE
+#define CAPTURE_PIXELS(call)    if(capture_enabled) { call; }
+#define CAPTURE_STATE(call)     call
+#else
+#define CAPTURE_PIXELS(call)
+#define CAPTURE_STATE(call)
+#endif
 
 /*******************************************************************************
 * Function Name: lcd_write_cmd_u8
@@ -95,15 +90,14 @@ __INLINE void lcd_write_data_u16(uint16_t y)
 }
 
 /*******************************************************************************
-* Function Name: lcd_set_pos
+* Function Name: lcd_set_window
 ********************************************************************************
-* Summary: Sets the boundries of the active portion of the screen.  When data
-*          is written to the LCD, it will be written at addr of x0,y0.  
+* Summary: Sets the column and page addresses of the next memory access
 *
 * Return:
 *  Nothing
 *******************************************************************************/
-void lcd_set_pos(uint16_t x0,uint16_t x1,uint16_t y0,uint16_t y1)
+static void lcd_set_window(uint16_t x0,uint16_t x1,uint16_t y0,uint16_t y1)
 {
   lcd_write_cmd_u8(LCD_CMD_SET_COLUMN_ADDR);
   lcd_write_data_u16(x0);
@@ -111,7 +105,771 @@ void lcd_set_pos(uint16_t x0,uint16_t x1,uint16_t y0,uint16_t y1)
   lcd_write_cmd_u8(LCD_CMD_SET_PAGE_ADDR);
   lcd_write_data_u16(y0);
   lcd_write_data_u16(y1);
+}
+
+/*******************************************************************************
+* Function Name: lcd_set_pos
+********************************************************************************
+* Summary: Sets the boundries of the active portion of the screen.  When data
+*          is written to the LCD, it will be written at addr of x0,y0.  
+*
+* Return:
+*  Nothing
+*******************************************************************************/
+void lcd_set_pos(uint16_t x0,uint16_t x1,uint16_t y0,uint16_t y1)
+{
+  lcd_set_window(x0, x1, y0, y1);
   lcd_write_cmd_u8(LCD_CMD_MEMORY_WRITE);
+  CAPTURE_PIXELS(capture_window(x0, x1, y0, y1));
+}
+
+/*******************************************************************************
+* Function Name: lcd_write_run
+********************************************************************************
+* Summary: Writes count pixels of a single color to the active window in one
+*          chip select transaction.
+* Return:
+*  Nothing
+*******************************************************************************/
+void lcd_write_run(uint16_t color, uint32_t count)
+{
+  uint8_t DH = color >> 8;
+  uint8_t DL = color;
+
+  if(count == 0)
+  {
+    return;
+  }
+  CAPTURE_PIXELS(capture_run(color, count));
+
+  LCD_CSX = LINE_LOW;
+  while(count--)
+  {
+    LCD_DATA = DH;
+    LCD_WRX = LINE_LOW;
+    LCD_WRX = LINE_HIGH;
+    LCD_DATA = DL;
+    LCD_WRX = LINE_LOW;
+    LCD_WRX = LINE_HIGH;
+  }
+  LCD_CSX = LINE_HIGH;
+}
+
+/*******************************************************************************
+* Clip rectangle, always inside the screen
+*******************************************************************************/
+static lcd_rect_t lcd_clip_rect = {0, 0, COLS - 1, ROWS - 1};
+
+/*******************************************************************************
+* Function Name: lcd_set_clip
+********************************************************************************
+* Summary: Sets the clip rectangle, limited to the screen
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_set_clip(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+  lcd_clip_rect.x0 = (x0 < 0) ? 0 : x0;
+  lcd_clip_rect.y0 = (y0 < 0) ? 0 : y0;
+  lcd_clip_rect.x1 = (x1 > COLS - 1) ? COLS - 1 : x1;
+  lcd_clip_rect.y1 = (y1 > ROWS - 1) ? ROWS - 1 : y1;
+}
+
+/*******************************************************************************
+* Function Name: lcd_reset_clip
+********************************************************************************
+* Summary: Clips to the whole screen
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_reset_clip(void)
+{
+  lcd_set_clip(0, 0, COLS - 1, ROWS - 1);
+}
+
+/*******************************************************************************
+* Function Name: lcd_get_clip
+********************************************************************************
+* Summary: Returns the clip rectangle
+* Returns:
+*  The clip rectangle
+*******************************************************************************/
+lcd_rect_t lcd_get_clip(void)
+{
+  return lcd_clip_rect;
+}
+
+/*******************************************************************************
+* Function Name: lcd_clip
+********************************************************************************
+* Summary: Intersects rect with the clip rectangle
+* Returns:
+*  false if the intersection is empty
+*******************************************************************************/
+bool lcd_clip(lcd_rect_t *rect)
+{
+  // Fast reject, most invisible draws are entirely off one side
+  if(rect->x1 < lcd_clip_rect.x0 || rect->x0 > lcd_clip_rect.x1 ||
+     rect->y1 < lcd_clip_rect.y0 || rect->y0 > lcd_clip_rect.y1 ||
+     rect->x0 > rect->x1 || rect->y0 > rect->y1)
+  {
+    return false;
+  }
+
+  if(rect->x0 < lcd_clip_rect.x0)
+  {
+    rect->x0 = lcd_clip_rect.x0;
+  }
+  if(rect->y0 < lcd_clip_rect.y0)
+  {
+    rect->y0 = lcd_clip_rect.y0;
+  }
+  if(rect->x1 > lcd_clip_rect.x1)
+  {
+    rect->x1 = lcd_clip_rect.x1;
+  }
+  if(rect->y1 > lcd_clip_rect.y1)
+  {
+    rect->y1 = lcd_clip_rect.y1;
+  }
+  return true;
+}
+
+/*******************************************************************************
+* Function Name: lcd_clip_stream_run
+********************************************************************************
+* Summary: Walks count pixels through the unclipped window a row at a time and
+*          writes the part of each row that falls in the visible columns
+* Returns:
+*  false when the stream has passed the last visible row
+*******************************************************************************/
+bool lcd_clip_stream_run(lcd_clip_stream_t *stream, uint16_t color, uint32_t count)
+{
+  uint32_t n;
+  uint16_t first;
+  uint16_t last;
+
+  while(count != 0)
+  {
+    if(stream->row > stream->row1)
+    {
+      return false;
+    }
+
+    n = stream->width - stream->col;
+    if(n > count)
+    {
+      n = count;
+    }
+
+    if(stream->row >= stream->row0)
+    {
+      first = (stream->col > stream->col0) ? stream->col : stream->col0;
+      last = stream->col + n - 1;
+      if(last > stream->col1)
+      {
+        last = stream->col1;
+      }
+      if(first <= last)
+      {
+        lcd_write_run(color, last - first + 1);
+      }
+    }
+
+    stream->col += n;
+    count -= n;
+    if(stream->col == stream->width)
+    {
+      stream->col = 0;
+      stream->row++;
+    }
+  }
+  return stream->row <= stream->row1;
+}
+
+/*******************************************************************************
+* Function Name: lcd_fill_rect
+********************************************************************************
+* Summary: Fills the visible part of a width x height rectangle whose upper
+*          left corner is x0,y0 with a single color
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_fill_rect(int16_t x0, int16_t y0, uint16_t width, uint16_t height, uint16_t color)
+{
+  lcd_rect_t rect;
+
+  if(width == 0 || height == 0)
+  {
+    return;
+  }
+
+  rect.x0 = x0;
+  rect.y0 = y0;
+  rect.x1 = ((int32_t)x0 + width - 1 > INT16_MAX) ? INT16_MAX : x0 + width - 1;
+  rect.y1 = ((int32_t)y0 + height - 1 > INT16_MAX) ? INT16_MAX : y0 + height - 1;
+  if(!lcd_clip(&rect))
+  {
+    return;
+  }
+
+  lcd_set_pos(rect.x0, rect.x1, rect.y0, rect.y1);
+  lcd_write_run(color, (uint32_t)(rect.x1 - rect.x0 + 1) * (rect.y1 - rect.y0 + 1));
+}
+
+/*******************************************************************************
+* Function Name: lcd_draw_runs
+********************************************************************************
+* Summary: Fills a window from a list of alternating bColor/fColor run lengths
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_draw_runs(
+  int16_t x0,
+  int16_t y0,
+  uint16_t width,
+  uint16_t height,
+  const uint8_t *runs,
+  uint16_t run_count,
+  uint16_t fColor,
+  uint16_t bColor
+)
+{
+  lcd_rect_t rect;
+  lcd_clip_stream_t stream;
+  uint16_t i;
+  bool foreground = false;
+
+  if(width == 0 || height == 0)
+  {
+    return;
+  }
+
+  rect.x0 = x0;
+  rect.y0 = y0;
+  rect.x1 = ((int32_t)x0 + width - 1 > INT16_MAX) ? INT16_MAX : x0 + width - 1;
+  rect.y1 = ((int32_t)y0 + height - 1 > INT16_MAX) ? INT16_MAX : y0 + height - 1;
+  if(!lcd_clip(&rect))
+  {
+    return;
+  }
+
+  lcd_set_pos(rect.x0, rect.x1, rect.y0, rect.y1);
+
+  // All of it visible, the runs map straight onto the window
+  if(rect.x1 - rect.x0 + 1 == width && rect.y1 - rect.y0 + 1 == height)
+  {
+    for(i = 0; i < run_count; i++)
+    {
+      lcd_write_run(foreground ? fColor : bColor, runs[i]);
+      foreground = !foreground;
+    }
+    return;
+  }
+
+  stream.width = width;
+  stream.col0 = rect.x0 - x0;
+  stream.col1 = rect.x1 - x0;
+  stream.row0 = rect.y0 - y0;
+  stream.row1 = rect.y1 - y0;
+  stream.col = 0;
+  stream.row = 0;
+  for(i = 0; i < run_count; i++)
+  {
+    if(!lcd_clip_stream_run(&stream, foreground ? fColor : bColor, runs[i]))
+    {
+      break;
+    }
+    foreground = !foreground;
+  }
+}
+
+/*******************************************************************************
+* Function Name: lcd_burst_u16
+********************************************************************************
+* Summary: Clocks out one pixel.  The caller holds LCD_CSX low for the whole
+*          burst.
+* Return:
+*  Nothing
+*******************************************************************************/
+__INLINE static void lcd_burst_u16(uint16_t color)
+{
+  CAPTURE_PIXELS(capture_pixel(color));
+  LCD_DATA = color >> 8;
+  LCD_WRX = LINE_LOW;
+  LCD_WRX = LINE_HIGH;
+  LCD_DATA = color;
+  LCD_WRX = LINE_LOW;
+  LCD_WRX = LINE_HIGH;
+}
+
+/*******************************************************************************
+* Function Name: lcd_write_pixels
+********************************************************************************
+* Summary: Streams a buffer of pixels to the active window
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_write_pixels(const uint16_t *pixels, uint32_t count)
+{
+  if(count == 0)
+  {
+    return;
+  }
+
+  LCD_CSX = LINE_LOW;
+  while(count--)
+  {
+    lcd_burst_u16(*pixels++);
+  }
+  LCD_CSX = LINE_HIGH;
+}
+
+/*******************************************************************************
+* Function Name: lcd_write_indexed
+********************************************************************************
+* Summary: Expands count packed palette indexes to RGB565 and writes them to
+*          the active window in one chip select transaction.  Indexes are
+*          packed MSB first; unscaled and starting on a byte, a whole byte
+*          is expanded per iteration.
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_write_indexed(
+  const uint8_t *indexes,
+  uint8_t bpp,
+  uint32_t skip,
+  uint32_t count,
+  const uint16_t *palette,
+  uint8_t scale
+)
+{
+  uint8_t data;
+  uint8_t shift;
+  uint8_t mask;
+  uint8_t i;
+
+  if(count == 0)
+  {
+    return;
+  }
+
+  indexes += (skip * bpp) / 8;
+  shift = 8 - (skip * bpp) % 8;
+
+  LCD_CSX = LINE_LOW;
+
+  // Scaled or clipped mid byte rows are rare, keep them out of the unrolled
+  // loops
+  if(scale > 1 || shift != 8)
+  {
+    mask = (1 << bpp) - 1;
+    data = *indexes++;
+    while(count--)
+    {
+      if(shift == 0)
+      {
+        data = *indexes++;
+        shift = 8;
+      }
+      shift -= bpp;
+      for(i = 0; i < scale; i++)
+      {
+        lcd_burst_u16(palette[(data >> shift) & mask]);
+      }
+    }
+    LCD_CSX = LINE_HIGH;
+    return;
+  }
+
+  switch(bpp)
+  {
+    case 2:
+    {
+      while(count >= 4)
+      {
+        data = *indexes++;
+        lcd_burst_u16(palette[data >> 6]);
+        lcd_burst_u16(palette[(data >> 4) & 0x3]);
+        lcd_burst_u16(palette[(data >> 2) & 0x3]);
+        lcd_burst_u16(palette[data & 0x3]);
+        count -= 4;
+      }
+      data = *indexes;
+      while(count--)
+      {
+        lcd_burst_u16(palette[data >> 6]);
+        data <<= 2;
+      }
+      break;
+    }
+    case 4:
+    {
+      while(count >= 2)
+      {
+        data = *indexes++;
+        lcd_burst_u16(palette[data >> 4]);
+        lcd_burst_u16(palette[data & 0xF]);
+        count -= 2;
+      }
+      if(count)
+      {
+        lcd_burst_u16(palette[*indexes >> 4]);
+      }
+      break;
+    }
+    case 8:
+    {
+      while(count--)
+      {
+        lcd_burst_u16(palette[*indexes++]);
+      }
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
+  LCD_CSX = LINE_HIGH;
+}
+
+/*******************************************************************************
+* Function Name: lcd_set_mirror
+********************************************************************************
+* Summary: Reverses the column and/or page address order through MADCTL
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_set_mirror(bool mirror_x, bool mirror_y)
+{
+  uint8_t madctl = LCD_MADCTL_DEFAULT;
+
+  if(mirror_x)
+  {
+    madctl ^= LCD_MADCTL_MX;
+  }
+  if(mirror_y)
+  {
+    madctl ^= LCD_MADCTL_MY;
+  }
+  lcd_write_cmd_u8(LCD_CMD_MEMORY_ACCESS_CONTROL);
+  lcd_write_data_u8(madctl);
+  CAPTURE_STATE(capture_mirror(mirror_x, mirror_y));
+}
+
+/*******************************************************************************
+* Vertical scrolling state, in logical rows.  Screen row scroll_top + s of
+* the scrolling area shows GRAM row scroll_top + (scroll_offset + s) mod
+* scroll_height.
+*******************************************************************************/
+static uint16_t scroll_top = 0;
+static uint16_t scroll_height = ROWS;
+static uint16_t scroll_offset = 0;
+
+/*******************************************************************************
+* Function Name: lcd_scroll_write_start
+********************************************************************************
+* Summary: Sends VSCRSADD for the current scroll_offset.  The controller counts
+*          lines from the GRAM top, which is the logical bottom, so the offset
+*          is applied in the opposite direction.
+* Returns:
+*  Nothing
+*******************************************************************************/
+static void lcd_scroll_write_start(void)
+{
+  uint16_t bottom_fixed = ROWS - scroll_top - scroll_height;
+  uint16_t start = bottom_fixed + (scroll_height - scroll_offset) % scroll_height;
+
+  lcd_write_cmd_u8(LCD_CMD_VERTICAL_SCROLLING_START);
+  lcd_write_data_u16(start);
+  CAPTURE_STATE(capture_scroll(scroll_top, scroll_height, scroll_offset));
+}
+
+/*******************************************************************************
+* Function Name: lcd_scroll_define
+********************************************************************************
+* Summary: Sets the fixed areas and resets the scroll offset
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_scroll_define(uint16_t top_fixed, uint16_t bottom_fixed)
+{
+  if(top_fixed + bottom_fixed >= ROWS)
+  {
+    return;
+  }
+
+  scroll_top = top_fixed;
+  scroll_height = ROWS - top_fixed - bottom_fixed;
+  scroll_offset = 0;
+
+  // TFA, VSA, BFA in GRAM order
+  lcd_write_cmd_u8(LCD_CMD_VERTICAL_SCROLL_DEFINITION);
+  lcd_write_data_u16(bottom_fixed);
+  lcd_write_data_u16(scroll_height);
+  lcd_write_data_u16(top_fixed);
+
+  lcd_scroll_write_start();
+}
+
+/*******************************************************************************
+* Function Name: lcd_scroll
+********************************************************************************
+* Summary: Scrolls the scrolling area and hands the exposed band to repaint
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_scroll(int16_t lines, lcd_scroll_repaint_t repaint)
+{
+  uint16_t count;
+  uint16_t first;             // offset into the area of the band's first row
+  uint16_t screen_y;
+  uint16_t part;
+
+  if(lines == 0)
+  {
+    return;
+  }
+
+  count = (lines > 0) ? lines : -lines;
+  if(count > scroll_height)
+  {
+    count = scroll_height;
+  }
+
+  if(lines > 0)
+  {
+    // The rows that were at the top of the area come back in at the bottom
+    first = scroll_offset;
+    scroll_offset = (scroll_offset + count) % scroll_height;
+    screen_y = scroll_top + scroll_height - count;
+  }
+  else
+  {
+    scroll_offset = (scroll_offset + scroll_height - count) % scroll_height;
+    first = scroll_offset;
+    screen_y = scroll_top;
+  }
+
+  lcd_scroll_write_start();
+
+  if(repaint == NULL)
+  {
+    return;
+  }
+
+  // The band is contiguous on screen but may wrap in GRAM
+  part = scroll_height - first;
+  if(part > count)
+  {
+    part = count;
+  }
+  repaint(screen_y, scroll_top + first, part);
+  if(part < count)
+  {
+    repaint(screen_y + part, scroll_top, count - part);
+  }
+}
+
+/*******************************************************************************
+* Function Name: lcd_scroll_row
+********************************************************************************
+* Summary: Maps a screen row to the GRAM row shown there
+* Returns:
+*  GRAM row
+*******************************************************************************/
+uint16_t lcd_scroll_row(uint16_t screen_y)
+{
+  if(screen_y < scroll_top || screen_y >= scroll_top + scroll_height)
+  {
+    return screen_y;
+  }
+  return scroll_top + (screen_y - scroll_top + scroll_offset) % scroll_height;
+}
+
+/*******************************************************************************
+* Function Name: lcd_read_u8
+********************************************************************************
+* Summary: Clocks one byte out of the LCD with RDX.  Frame memory reads need
+*          RDX low for at least 355ns and high for 90ns, longer than a single
+*          GPIO access, so the strobe is stretched with extra accesses.
+*          LCD_CSX must be low and the data bus an input.
+* Return:
+*  The byte on the data bus
+*******************************************************************************/
+static uint8_t lcd_read_u8(void)
+{
+  uint8_t data;
+  uint8_t i;
+
+  LCD_RDX = LINE_LOW;
+  for(i = 0; i < LCD_READ_STRETCH; i++)
+  {
+    data = LCD_DATA;
+  }
+  data = LCD_DATA;
+  LCD_RDX = LINE_HIGH;
+  for(i = 0; i < LCD_READ_STRETCH / 4; i++)
+  {
+    LCD_RDX = LINE_HIGH;
+  }
+  return data;
+}
+
+/*******************************************************************************
+* Function Name: lcd_read_rect
+********************************************************************************
+* Summary: Reads a width x height rectangle of GRAM with Memory Read
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_read_rect(
+  uint16_t x0,
+  uint16_t y0,
+  uint16_t width,
+  uint16_t height,
+  uint16_t *pixels
+)
+{
+  uint32_t count = (uint32_t)width * height;
+  uint8_t r;
+  uint8_t g;
+  uint8_t b;
+
+  if(count == 0)
+  {
+    return;
+  }
+
+  // Not lcd_set_pos, nothing is written so the capture stream gets no window
+  lcd_set_window(x0, x0 + width - 1, y0, y0 + height - 1);
+
+  LCD_CSX = LINE_LOW;
+  LCD_DCX = LCD_DCX_CMD_PACKET;
+  LCD_DATA = LCD_CMD_MEMORY_READ;
+  LCD_WRX = LINE_LOW;
+  LCD_WRX = LINE_HIGH;
+  LCD_DCX = LCD_DCX_DATA_PACKET;
+
+  // Turn the data bus around
+  LCD_DATA_PORT->DIR &= ~LCD_DATA_PINS;
+
+  // The first read after the command is a dummy
+  lcd_read_u8();
+
+  // Memory Read always returns 18 bit pixels, one byte per color with the
+  // 6 significant bits at the top
+  while(count--)
+  {
+    r = lcd_read_u8();
+    g = lcd_read_u8();
+    b = lcd_read_u8();
+    *pixels++ = RGB565(r, g, b);
+  }
+
+  LCD_CSX = LINE_HIGH;
+  LCD_DATA_PORT->DIR |= LCD_DATA_PINS;
+}
+
+/*******************************************************************************
+* Function Name: lcd_write_rect
+********************************************************************************
+* Summary: Writes the visible part of a width x height rectangle of RGB565
+*          pixels in one burst
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_write_rect(
+  int16_t x0,
+  int16_t y0,
+  uint16_t width,
+  uint16_t height,
+  const uint16_t *pixels
+)
+{
+  lcd_rect_t rect;
+  uint16_t visible;
+  uint16_t rows;
+  uint16_t i;
+
+  if(width == 0 || height == 0)
+  {
+    return;
+  }
+
+  rect.x0 = x0;
+  rect.y0 = y0;
+  rect.x1 = ((int32_t)x0 + width - 1 > INT16_MAX) ? INT16_MAX : x0 + width - 1;
+  rect.y1 = ((int32_t)y0 + height - 1 > INT16_MAX) ? INT16_MAX : y0 + height - 1;
+  if(!lcd_clip(&rect))
+  {
+    return;
+  }
+
+  lcd_set_pos(rect.x0, rect.x1, rect.y0, rect.y1);
+
+  // Step over the hidden rows and the hidden columns of each row
+  visible = rect.x1 - rect.x0 + 1;
+  rows = rect.y1 - rect.y0 + 1;
+  pixels += (uint32_t)(rect.y0 - y0) * width + (rect.x0 - x0);
+
+  LCD_CSX = LINE_LOW;
+  while(rows--)
+  {
+    for(i = 0; i < visible; i++)
+    {
+      lcd_burst_u16(pixels[i]);
+    }
+    pixels += width;
+  }
+  LCD_CSX = LINE_HIGH;
+}
+
+/*******************************************************************************
+* Function Name: lcd_screenshot
+********************************************************************************
+* Summary: Reads the screen one row at a time and hands each row to sink
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_screenshot(lcd_row_sink_t sink)
+{
+  uint16_t row[COLS];
+  uint16_t y;
+
+  for(y = 0; y < ROWS; y++)
+  {
+    lcd_read_rect(0, lcd_scroll_row(y), COLS, 1, row);
+    sink(y, row, COLS);
+  }
+}
+
+/*******************************************************************************
+* Function Name: lcd_te_enable
+********************************************************************************
+* Summary: Turns the tearing effect output and its GPIO interrupt on or off
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_te_enable(bool enable)
+{
+  if(enable)
+  {
+    gpio_enable_port(LCD_TE_GPIO_BASE);
+    gpio_config_digital_enable(LCD_TE_GPIO_BASE, LCD_TE_PIN);
+    gpio_config_enable_input(LCD_TE_GPIO_BASE, LCD_TE_PIN);
+    gpio_config_rising_edge_irq(LCD_TE_GPIO_BASE, LCD_TE_PIN);
+
+    // M = 0, the pulse only marks V-blank
+    lcd_write_cmd_u8(LCD_CMD_TEARING_EFFECT_LINE_ON);
+    lcd_write_data_u8(0x00);
+  }
+  else
+  {
+    LCD_TE_PORT->IM &= ~LCD_TE_PIN;
+    lcd_write_cmd_u8(LCD_CMD_TEARING_EFFECT_LINE_OFF);
+  }
 }
 
 /*******************************************************************************
@@ -126,6 +884,7 @@ void lcd_clear_screen(uint16_t bColor)
 {
   uint16_t i,j;
   lcd_set_pos(0,COLS - 1, 0,ROWS - 1);
+  CAPTURE_PIXELS(capture_run(bColor, (uint32_t)ROWS * COLS));
   
   for (i=0;i< ROWS ;i++)
   {
@@ -144,39 +903,47 @@ void lcd_clear_screen(uint16_t bColor)
 *  Nothing
 *******************************************************************************/
 void lcd_draw_image(
-  uint16_t x_start, 
+  int16_t x_start, 
   uint16_t image_width_bits, 
-  uint16_t y_start, 
+  int16_t y_start, 
   uint16_t image_height_pixels, 
   const uint8_t *image, 
   uint16_t fColor, 
   uint16_t bColor
 )
 {
-  uint16_t i,j;
-  uint8_t data;
-  uint16_t byte_index;
+  lcd_rect_t rect;
+  const uint8_t *row;
   uint16_t bytes_per_row;
-  uint16_t x0;
-  uint16_t x1;
-  uint16_t y0;
-  uint16_t y1;
+  uint16_t x;
+  uint16_t y;
+  uint16_t col0;
+  uint16_t col1;
+  uint16_t run;
+  int16_t x0;
+  int16_t y0;
+  bool pixel;
+  bool color;
  
-  x0 = x_start - (image_width_bits/2);
-  x1 = x_start + (image_width_bits/2);
-  if( (image_width_bits & 0x01) == 0x00)
+  if(image_width_bits == 0 || image_height_pixels == 0)
   {
-    x1--;
+    return;
   }
   
-  y0 = y_start  - (image_height_pixels/2);
-  y1 = y_start  + (image_height_pixels/2) ;
-  if( (image_height_pixels & 0x01) == 0x00)
+  // Signed, so an image near the left or top edge does not wrap around
+  x0 = x_start - (image_width_bits/2);
+  y0 = y_start - (image_height_pixels/2);
+  
+  rect.x0 = x0;
+  rect.y0 = y0;
+  rect.x1 = ((int32_t)x0 + image_width_bits - 1 > INT16_MAX) ? INT16_MAX : x0 + image_width_bits - 1;
+  rect.y1 = ((int32_t)y0 + image_height_pixels - 1 > INT16_MAX) ? INT16_MAX : y0 + image_height_pixels - 1;
+  if(!lcd_clip(&rect))
   {
-    y1--;
+    return;
   }
   
-  lcd_set_pos(x0, x1, y0, y1);
+  lcd_set_pos(rect.x0, rect.x1, rect.y0, rect.y1);
   
   bytes_per_row = image_width_bits / 8;
   if( (image_width_bits % 8) != 0)
@@ -184,25 +951,28 @@ void lcd_draw_image(
     bytes_per_row++;
   }
   
-  for (i=0;i< image_height_pixels ;i++)
+  // Only the visible rows and columns of the bitmap are read, equal pixels
+  // in a row go out as one run
+  col0 = rect.x0 - x0;
+  col1 = rect.x1 - x0;
+  row = image + (uint32_t)(rect.y0 - y0) * bytes_per_row;
+  for(y = rect.y0; y <= rect.y1; y++)
   {
-        for(j= 0; j < image_width_bits; j++)
-        {
-            if( (j %8) == 0)
-            {
-              byte_index = (i*bytes_per_row) + j/8;
-              data = image[byte_index];
-            }
-            if ( data & 0x80)
-            {
-                lcd_write_data_u16(fColor);
-            }
-            else
-            {
-                lcd_write_data_u16(bColor);
-            }
-            data  = data << 1;
-        }
+    color = (row[col0 / 8] & (0x80 >> (col0 % 8))) != 0;
+    run = 0;
+    for(x = col0; x <= col1; x++)
+    {
+      pixel = (row[x / 8] & (0x80 >> (x % 8))) != 0;
+      if(pixel != color)
+      {
+        lcd_write_run(color ? fColor : bColor, run);
+        color = pixel;
+        run = 0;
+      }
+      run++;
+    }
+    lcd_write_run(color ? fColor : bColor, run);
+    row += bytes_per_row;
   }
 }
 
@@ -240,6 +1010,13 @@ void lcd_config_gpio(void)
   gpio_config_enable_pullup( LCD_WRX_GPIO_BASE, LCD_WRX_PIN);
  LCD_WRX = LINE_HIGH;
   
+  // Configure Read Signal
+  gpio_enable_port(LCD_RDX_GPIO_BASE);
+  gpio_config_digital_enable( LCD_RDX_GPIO_BASE, LCD_RDX_PIN);
+  gpio_config_enable_output( LCD_RDX_GPIO_BASE, LCD_RDX_PIN);
+  gpio_config_enable_pullup( LCD_RDX_GPIO_BASE, LCD_RDX_PIN);
+  LCD_RDX = LINE_HIGH;
+  
   // Configure the Data pins
   gpio_enable_port(LCD_DATA_GPIO_BASE);
   gpio_config_digital_enable( LCD_DATA_GPIO_BASE, LCD_DATA_PINS);
@@ -248,131 +1025,146 @@ void lcd_config_gpio(void)
   LCD_DATA = 0x00;
 }
 
+//*****************************************************************************
+// ILI9341 initialization table.  Each entry is a command, a count byte
+// holding the number of arguments (ORed with LCD_INIT_DELAY when a wait
+// follows), the arguments, then the wait in ms.  The waits are the datasheet
+// minimums: 5ms after a software reset and 120ms after a sleep out.  The
+// registers can be written while the panel is still asleep, so the sleep out
+// is sent once after the configuration instead of on both sides of it.
+//*****************************************************************************
+#define LCD_INIT_DELAY        0x80
+#define LCD_INIT_COUNT_M      0x7F
+
+// waits shorter than this are spun in lcd_init_start
+#define LCD_INIT_YIELD_MS     10
+
+static const uint8_t lcd_init_table[] =
+{
+  LCD_CMD_SOFTWARE_RESET,             LCD_INIT_DELAY | 0, 5,
+  0xCF,                               3, 0x00, 0x83, 0x30,
+  0xED,                               4, 0x64, 0x03, 0x12, 0x81,
+  0xE8,                               3, 0x85, 0x01, 0x79,
+  0xCB,                               5, 0x39, 0x2C, 0x00, 0x34, 0x02,
+  0xF7,                               1, 0x20,
+  0xEA,                               2, 0x00, 0x00,
+  LCD_CMD_POWER_CONTROL_2,            1, 0x11,          // SAP[2:0];BT[3:0]
+  LCD_CMD_VCOMM_CONTROL_1,            2, 0x34, 0x3D,
+  LCD_CMD_VCOMM_CONTROL_2,            1, 0xC0,
+  LCD_CMD_MEMORY_ACCESS_CONTROL,      1, LCD_MADCTL_DEFAULT,
+  LCD_CMD_PIXEL_FORMAT_SET,           1, 0x55,          // 16 bit
+  LCD_CMD_FRAME_CONTROL_NORMAL_MODE,  2, 0x00, 0x1D,    // 61Hz
+  0xB6,                               4, 0x0A, 0xA2, 0x27, 0x00,
+  LCD_CMD_ENTRY_MODE_SET,             1, 0x07,
+  LCD_CMD_DISPLAY_FUNCTION_CONTROL,   1, 0x08,          // 3 gamma disable
+  LCD_CMD_GAMMA_SET,                  1, 0x01,
+  LCD_CMD_POSITIVE_GAMMA_CORRECTION,  15, 0x1f, 0x1a, 0x18, 0x0a, 0x0f, 0x06,
+                                      0x45, 0x87, 0x32, 0x0a, 0x07, 0x02,
+                                      0x07, 0x05, 0x00,
+  LCD_CMD_NEGATIVE_GAMMA_CORRECTION,  15, 0x00, 0x25, 0x27, 0x05, 0x10, 0x09,
+                                      0x3a, 0x78, 0x4d, 0x05, 0x18, 0x0d,
+                                      0x38, 0x3a, 0x1f,
+  LCD_CMD_SLEEP_OUT,                  LCD_INIT_DELAY | 0, 120,
+  LCD_CMD_DISPLAY_ON,                 0,
+};
+
+static const uint8_t *init_next = lcd_init_table;
+static uint32_t init_start_time;
+static uint32_t init_wait_start;
+static uint32_t init_wait_ticks;
+
+/*******************************************************************************
+* Function Name: lcd_init_service
+********************************************************************************
+* Summary: Runs the initialization table until it is done or a wait has not
+*          expired yet.
+* Returns:
+*  true when the table is complete
+*******************************************************************************/
+bool lcd_init_service(void)
+{
+  uint8_t count;
+  
+  while(1)
+  {
+    if (init_wait_ticks != 0)
+    {
+      if ((uint32_t)(timebase_now() - init_wait_start) < init_wait_ticks)
+      {
+        return false;
+      }
+      init_wait_ticks = 0;
+    }
+    
+    if (init_next >= lcd_init_table + sizeof(lcd_init_table))
+    {
+      return true;
+    }
+    
+    lcd_write_cmd_u8(*init_next++);
+    count = *init_next++;
+    for (; (count & LCD_INIT_COUNT_M) != 0; count--)
+    {
+      lcd_write_data_u8(*init_next++);
+    }
+    
+    if (count & LCD_INIT_DELAY)
+    {
+      init_wait_start = timebase_now();
+      init_wait_ticks = *init_next++ * TIMEBASE_TICKS_PER_MS;
+    }
+  }
+}
+
+/*******************************************************************************
+* Function Name: lcd_init_start
+********************************************************************************
+* Summary: Restarts the initialization table and runs it up to the first long
+*          wait.
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_init_start(void)
+{
+  timebase_init();
+  
+  LCD_RDX = 0xFF;
+  init_next = lcd_init_table;
+  init_wait_ticks = 0;
+  init_start_time = timebase_now();
+  
+  while ( !lcd_init_service() && 
+           init_wait_ticks < LCD_INIT_YIELD_MS * TIMEBASE_TICKS_PER_MS) {};
+}
+
+/*******************************************************************************
+* Function Name: lcd_init_finish
+********************************************************************************
+* Summary: Waits out the rest of the initialization table.
+* Returns:
+*  Microseconds spent since lcd_init_start
+*******************************************************************************/
+uint32_t lcd_init_finish(void)
+{
+  while ( !lcd_init_service() ) {};
+  
+  return (timebase_now() - init_start_time) / TIMEBASE_TICKS_PER_US;
+}
+
 /*******************************************************************************
 * Function Name: lcd_config_screen
 ********************************************************************************
 * Summary: After the configuration of the gpio pins, this function configures
-*          the internal LCD controller chip.
+*          the internal LCD controller chip.  Blocks for the whole sequence,
+*          see lcd_init_start to overlap the waits with other work.
 * Returns:
 *  Nothing
 *******************************************************************************/  
 void lcd_config_screen(void)
-
 { 
   lcd_config_gpio();
-  
-  lcd_write_cmd_u8(LCD_CMD_SOFTWARE_RESET); //software reset
-  delayms(5);
-
-  lcd_write_cmd_u8(LCD_CMD_SLEEP_OUT);
-  delayms(120);
-   lcd_write_cmd_u8(0xCF);   
-  lcd_write_data_u8(0x00); 
-  lcd_write_data_u8(0x83); 
-  lcd_write_data_u8(0X30);    
-      
-   lcd_write_cmd_u8(0xED);   
-  lcd_write_data_u8(0x64); 
-  lcd_write_data_u8(0x03); 
-  lcd_write_data_u8(0X12); 
-  lcd_write_data_u8(0X81); 
-      
-   lcd_write_cmd_u8(0xE8);   
-  lcd_write_data_u8(0x85); 
-  lcd_write_data_u8(0x01); 
-  lcd_write_data_u8(0x79); 
-      
-   lcd_write_cmd_u8(0xCB);   
-  lcd_write_data_u8(0x39); 
-  lcd_write_data_u8(0x2C); 
-  lcd_write_data_u8(0x00); 
-  lcd_write_data_u8(0x34); 
-  lcd_write_data_u8(0x02); 
-      
-   lcd_write_cmd_u8(0xF7);   
-  lcd_write_data_u8(0x20); 
-      
-   lcd_write_cmd_u8(0xEA);   
-  lcd_write_data_u8(0x00); 
-  lcd_write_data_u8(0x00);  
-    
-   lcd_write_cmd_u8(LCD_CMD_POWER_CONTROL_2);    //Power control 
-  lcd_write_data_u8(0x11);   //SAP[2:0];BT[3:0] 
-      
-   lcd_write_cmd_u8(LCD_CMD_VCOMM_CONTROL_1);    //VCM control 1 
-  lcd_write_data_u8(0x34); 
-  lcd_write_data_u8(0x3D); 
-      
-   lcd_write_cmd_u8(LCD_CMD_VCOMM_CONTROL_2);    //VCM control 2 
-  lcd_write_data_u8(0xC0); 
-    
-   lcd_write_cmd_u8(LCD_CMD_MEMORY_ACCESS_CONTROL);    // Memory Access Control 
-  lcd_write_data_u8(0xC8); 
-      
-   lcd_write_cmd_u8(LCD_CMD_PIXEL_FORMAT_SET);      // Pixel format 
-  lcd_write_data_u8(0x55);  //16bit 
-    
-   lcd_write_cmd_u8(LCD_CMD_FRAME_CONTROL_NORMAL_MODE);        // Frame rate
-  lcd_write_data_u8(0x00);   
-  lcd_write_data_u8(0x1D);  //61Hz
-      
-   lcd_write_cmd_u8(0xB6);    // Display Function Control 
-  lcd_write_data_u8(0x0A); 
-  lcd_write_data_u8(0xA2); 
-  lcd_write_data_u8(0x27);
-  lcd_write_data_u8(0x00);
-
-  lcd_write_cmd_u8(LCD_CMD_ENTRY_MODE_SET); //Entry mode 
-  lcd_write_data_u8(0x07);
-    
-      
-   lcd_write_cmd_u8(LCD_CMD_DISPLAY_FUNCTION_CONTROL);    // 3Gamma Function Disable 
-  lcd_write_data_u8(0x08); 
-      
-   lcd_write_cmd_u8(LCD_CMD_GAMMA_SET);    //Gamma curve selected 
-  lcd_write_data_u8(0x01); 
-      
-
-  lcd_write_cmd_u8(LCD_CMD_POSITIVE_GAMMA_CORRECTION); //positive gamma correction
-  lcd_write_data_u8(0x1f);
-  lcd_write_data_u8(0x1a);
-  lcd_write_data_u8(0x18);
-  lcd_write_data_u8(0x0a);
-  lcd_write_data_u8(0x0f);
-  lcd_write_data_u8(0x06);
-  lcd_write_data_u8(0x45);
-  lcd_write_data_u8(0x87);
-  lcd_write_data_u8(0x32);
-  lcd_write_data_u8(0x0a);
-  lcd_write_data_u8(0x07);
-  lcd_write_data_u8(0x02);
-  lcd_write_data_u8(0x07);
-  lcd_write_data_u8(0x05);
-  lcd_write_data_u8(0x00);
-  
-  lcd_write_cmd_u8(LCD_CMD_NEGATIVE_GAMMA_CORRECTION); //negamma correction
-  lcd_write_data_u8(0x00);
-  lcd_write_data_u8(0x25);
-  lcd_write_data_u8(0x27);
-  lcd_write_data_u8(0x05);
-  lcd_write_data_u8(0x10);
-  lcd_write_data_u8(0x09);
-  lcd_write_data_u8(0x3a);
-  lcd_write_data_u8(0x78);
-  lcd_write_data_u8(0x4d);
-  lcd_write_data_u8(0x05);
-  lcd_write_data_u8(0x18);
-  lcd_write_data_u8(0x0d);
-  lcd_write_data_u8(0x38);
-  lcd_write_data_u8(0x3a);
-  lcd_write_data_u8(0x1f);
-      
-   lcd_write_cmd_u8(LCD_CMD_SLEEP_OUT);    //Exit Sleep 
-  delayms(120);
-   lcd_write_cmd_u8(LCD_CMD_DISPLAY_ON);    //Display on 
-  delayms(50);
-  LCD_RDX=0xFF;  
-
+  lcd_init_start();
+  lcd_init_finish();
 }
 
 
@@ -386,56 +1178,25 @@ void lcd_draw_box(
   uint16_t border_width
 )
 {
-	uint16_t y_index,x_index;
-	
-	lcd_set_pos(x_start, x_start+x_len, y_start, y_start+y_len);
-	for (y_index = y_start; y_index < y_start + y_len; y_index++) 
-	{
-		for (x_index = x_start; x_index <= x_start+x_len; x_index++) 
-		{
-			// logic or when to fill in box and not draw border
-			if ((y_index >= border_width+y_start) && (y_index < y_start + y_len-border_width)
-					 && (x_index >= border_width+x_start) && (x_index <= x_start+x_len-border_width))
-			{
-				lcd_write_data_u16(fill_color);
-			}
-			//otherwise draw border around square
-			else
-			{
-				lcd_write_data_u16(border_color);
-			}
-		}
-	}
-	return;
-}
-
-void print_string_toLCD(char string[], 
-	uint16_t x_start, 
-	uint16_t y_start, 
-	uint16_t fColor, 
-	uint16_t bColor)
-{
-	char c1, c2;
-	int i,j, xPos;
-	xPos = x_start;
-	c1 =' ';
-	
-	for (i = 0; i < strlen(string); i++)
-	{
-		c2 = string[i]; 
-		
-		lcd_draw_image(xPos, alphabet_Descriptors[c2-c1].widthBits, y_start, 14,
-									&alphabet_Bitmap[alphabet_Descriptors[c2-c1].offset], fColor, bColor);
-		/*
-		// draw in between the spaces
-		for (j = xPos; j < alphabet_Descriptors[c2-c1].widthBits/2 + 4; j++)
-		{
-			lcd_draw_image(xPos, j, y_start, 14,
-									&alphabet_Bitmap[0], fColor, bColor);
-		}
-		*/
-		
-		xPos += alphabet_Descriptors[c2-c1].widthBits/2 + 4;
-	}
+  // the box covers columns x_start..x_start+x_len and rows
+  // y_start..y_start+y_len-1
+  uint16_t width = x_len + 1;
+  uint16_t height = y_len;
+  
+  // all border when the two sides meet
+  if (2 * border_width >= width || 2 * border_width >= height)
+  {
+    lcd_fill_rect(x_start, y_start, width, height, border_color);
+    return;
+  }
+  
+  // top, bottom, left and right borders, then the inside
+  lcd_fill_rect(x_start, y_start, width, border_width, border_color);
+  lcd_fill_rect(x_start, y_start + height - border_width, width, border_width, border_color);
+  lcd_fill_rect(x_start, y_start + border_width, border_width, 
+                height - 2 * border_width, border_color);
+  lcd_fill_rect(x_start + width - border_width, y_start + border_width, border_width, 
+                height - 2 * border_width, border_color);
+  lcd_fill_rect(x_start + border_width, y_start + border_width, width - 2 * border_width, 
+                height - 2 * border_width, fill_color);
 }
-
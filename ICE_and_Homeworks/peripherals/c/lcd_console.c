@@ -0,0 +1,297 @@
+#include "lcd_console.h"
+#include "serial_debug.h"
+#include "pc_buffer.h"
+#include <string.h>
+
+// MicroLIB's FILE is only the handle, and the stream is only ever compared
+static struct __FILE lcd_console_file = { LCD_CONSOLE_HANDLE };
+FILE *LCD_CONSOLE = (FILE *)&lcd_console_file;
+bool lcd_console_stdout = false;
+
+static PC_Buffer console_buffer;
+static bool console_ready = false;
+
+static const font_t *console_font;
+static uint16_t console_top;
+static uint8_t console_rows;
+static uint8_t console_cols;
+static uint8_t cell_width;
+static uint8_t cursor_row;            // screen line
+static uint8_t cursor_col;            // console_cols after a full line
+static uint16_t console_fColor;
+static uint16_t console_bColor;
+
+// What is drawn on every text line, indexed by the line's position in GRAM
+// so it stays valid across hardware scrolls.  0 never matches a character,
+// it marks a cell that has to be drawn.
+static char line_cache[LCD_CONSOLE_MAX_ROWS][LCD_CONSOLE_MAX_COLS];
+
+//*****************************************************************************
+// GRAM line holding screen line row
+//*****************************************************************************
+static uint8_t console_gram_line(uint8_t row)
+{
+  return (lcd_scroll_row(console_top + row * console_font->height) - console_top) /
+         console_font->height;
+}
+
+//*****************************************************************************
+// Repaint callback for lcd_scroll.  The band that scrolls in is the line that
+// just scrolled off the top, so it is blanked and its cache cleared.
+//*****************************************************************************
+static void console_blank_band(uint16_t screen_y, uint16_t y, uint16_t height)
+{
+  uint8_t line = (y - console_top) / console_font->height;
+
+  (void)screen_y;
+
+  lcd_fill_rect(0, y, COLS, height, console_bColor);
+  memset(line_cache[line], ' ', LCD_CONSOLE_MAX_COLS);
+}
+
+//*****************************************************************************
+// Moves the cursor to the start of the next line, scrolling at the bottom.
+//*****************************************************************************
+static void console_newline(void)
+{
+  cursor_col = 0;
+  if(cursor_row + 1 < console_rows)
+  {
+    cursor_row++;
+  }
+  else
+  {
+    lcd_scroll(console_font->height, console_blank_band);
+  }
+}
+
+//*****************************************************************************
+// Clears the console and homes the cursor
+//*****************************************************************************
+static void console_clear(void)
+{
+  lcd_scroll_define(console_top, ROWS - console_top - console_rows * console_font->height);
+  lcd_fill_rect(0, console_top, COLS, console_rows * console_font->height, console_bColor);
+  memset(line_cache, ' ', sizeof(line_cache));
+  cursor_row = 0;
+  cursor_col = 0;
+}
+
+//*****************************************************************************
+// Draws one character at the cursor unless the cell already shows it.  A
+// full line wraps when the next character comes, so a '\n' right after it
+// does not leave a blank line.
+//*****************************************************************************
+static void console_draw(char c)
+{
+  uint8_t line;
+  uint16_t x;
+  uint16_t y;
+  uint16_t advance;
+
+  if(cursor_col >= console_cols)
+  {
+    console_newline();
+  }
+  line = console_gram_line(cursor_row);
+  x = cursor_col * cell_width;
+  y = console_top + line * console_font->height;
+
+  if(line_cache[line][cursor_col] != c)
+  {
+    advance = font_draw_char(console_font, (uint8_t)c, x, y, console_fColor, console_bColor);
+    if(advance < cell_width)
+    {
+      lcd_fill_rect(x + advance, y, cell_width - advance, console_font->height, console_bColor);
+    }
+    line_cache[line][cursor_col] = c;
+  }
+
+  cursor_col++;
+}
+
+//*****************************************************************************
+// Interprets one character
+//*****************************************************************************
+static void console_output(char c)
+{
+  switch(c)
+  {
+    case '\n':
+    {
+      console_newline();
+      break;
+    }
+    case '\r':
+    {
+      cursor_col = 0;
+      break;
+    }
+    case '\b':
+    {
+      if(cursor_col > 0)
+      {
+        cursor_col--;
+      }
+      break;
+    }
+    case '\t':
+    {
+      do
+      {
+        console_draw(' ');
+      } while((cursor_col % 4) != 0 && cursor_col < console_cols);
+      break;
+    }
+    case '\f':
+    {
+      console_clear();
+      break;
+    }
+    default:
+    {
+      console_draw(c);
+      break;
+    }
+  }
+}
+
+//*****************************************************************************
+// serial_debug's fputc hook.  LCD_CONSOLE is the console's alone, stdout is
+// copied when lcd_console_stdout is set.
+//*****************************************************************************
+static bool console_fputc(int c, FILE *stream)
+{
+  if(stream == LCD_CONSOLE)
+  {
+    lcd_console_putc(c);
+    return true;
+  }
+  if(lcd_console_stdout)
+  {
+    lcd_console_putc(c);
+  }
+  return false;
+}
+
+//*****************************************************************************
+// Turns a band of the screen into a text console
+//*****************************************************************************
+bool lcd_console_init(
+  uint8_t font,
+  uint16_t top,
+  uint8_t rows,
+  uint16_t fColor,
+  uint16_t bColor
+)
+{
+  uint16_t i;
+
+  console_font = font_get(font);
+  if(console_font == NULL || rows == 0 || rows > LCD_CONSOLE_MAX_ROWS ||
+     top + rows * console_font->height > ROWS)
+  {
+    return false;
+  }
+
+  // Fixed width cells, as wide as the widest glyph
+  cell_width = 0;
+  for(i = 0; i < console_font->glyph_count; i++)
+  {
+    if(console_font->glyphs[i].advance > cell_width)
+    {
+      cell_width = console_font->glyphs[i].advance;
+    }
+  }
+  if(cell_width == 0)
+  {
+    return false;
+  }
+
+  console_top = top;
+  console_rows = rows;
+  console_cols = COLS / cell_width;
+  if(console_cols > LCD_CONSOLE_MAX_COLS)
+  {
+    console_cols = LCD_CONSOLE_MAX_COLS;
+  }
+  console_fColor = fColor;
+  console_bColor = bColor;
+
+  if(!console_ready)
+  {
+    pc_buffer_init(&console_buffer, LCD_CONSOLE_BUFFER_SIZE);
+    serial_debug_set_hook(console_fputc);
+    console_ready = true;
+  }
+
+  console_clear();
+  return true;
+}
+
+//*****************************************************************************
+// Queues one character, drawing some of the queue first if it is full
+//*****************************************************************************
+void lcd_console_putc(char c)
+{
+  if(!console_ready)
+  {
+    return;
+  }
+
+  if(pc_buffer_full(&console_buffer))
+  {
+    lcd_console_service(LCD_CONSOLE_BUFFER_SIZE / 4);
+  }
+  pc_buffer_add(&console_buffer, c);
+}
+
+//*****************************************************************************
+// Draws at most budget queued characters
+//*****************************************************************************
+uint16_t lcd_console_service(uint16_t budget)
+{
+  char c;
+
+  if(!console_ready)
+  {
+    return 0;
+  }
+
+  while(budget != 0 && !pc_buffer_empty(&console_buffer))
+  {
+    pc_buffer_remove(&console_buffer, &c);
+    console_output(c);
+    budget--;
+  }
+  return console_buffer.produce_count - console_buffer.consume_count;
+}
+
+//*****************************************************************************
+// Draws everything that is queued
+//*****************************************************************************
+void lcd_console_flush(void)
+{
+  while(lcd_console_service(LCD_CONSOLE_BUFFER_SIZE) != 0)
+  {
+  }
+}
+
+//*****************************************************************************
+// Changes the colors of text written from now on
+//*****************************************************************************
+void lcd_console_set_colors(uint16_t fColor, uint16_t bColor)
+{
+  if(fColor == console_fColor && bColor == console_bColor)
+  {
+    return;
+  }
+
+  // Text already queued keeps the old colors
+  lcd_console_flush();
+  console_fColor = fColor;
+  console_bColor = bColor;
+
+  // Cached cells no longer match what a redraw would produce
+  memset(line_cache, 0, sizeof(line_cache));
+}
@@ -0,0 +1,53 @@
+#include "lcd_effects.h"
+
+/*******************************************************************************
+* Function Name: lcd_tint_rect
+********************************************************************************
+* Summary: Blends color into a rectangle of the screen, one row at a time
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_tint_rect(
+  int16_t x0,
+  int16_t y0,
+  uint16_t width,
+  uint16_t height,
+  uint16_t color,
+  uint8_t alpha
+)
+{
+  uint16_t row[COLS];
+  lcd_rect_t rect;
+  uint16_t count;
+  int16_t y;
+
+  if(width == 0 || height == 0 || alpha == 0)
+  {
+    return;
+  }
+
+  rect.x0 = x0;
+  rect.y0 = y0;
+  rect.x1 = ((int32_t)x0 + width - 1 > INT16_MAX) ? INT16_MAX : x0 + width - 1;
+  rect.y1 = ((int32_t)y0 + height - 1 > INT16_MAX) ? INT16_MAX : y0 + height - 1;
+  if(!lcd_clip(&rect))
+  {
+    return;
+  }
+
+  count = rect.x1 - rect.x0 + 1;
+
+  // Fully opaque needs no read back
+  if(alpha >= RGB565_ALPHA_MAX)
+  {
+    lcd_fill_rect(rect.x0, rect.y0, count, rect.y1 - rect.y0 + 1, color);
+    return;
+  }
+
+  for(y = rect.y0; y <= rect.y1; y++)
+  {
+    lcd_read_rect(rect.x0, y, count, 1, row);
+    rgb565_fade_buf(row, row, count, color, alpha);
+    lcd_write_rect(rect.x0, y, count, 1, row);
+  }
+}
@@ -0,0 +1,463 @@
+#include "lcd_shapes.h"
+
+//*****************************************************************************
+// Fills the rectangle x0,y0 to x1,y1 inclusive after clipping it, see
+// lcd_set_clip.  Every span ends up here as one windowed burst.
+//*****************************************************************************
+static void fill_clipped(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+  lcd_rect_t rect;
+
+  rect.x0 = x0;
+  rect.y0 = y0;
+  rect.x1 = x1;
+  rect.y1 = y1;
+  if(!lcd_clip(&rect))
+  {
+    return;
+  }
+
+  lcd_fill_rect(rect.x0, rect.y0, rect.x1 - rect.x0 + 1, rect.y1 - rect.y0 + 1, color);
+}
+
+void lcd_hline(int16_t x0, int16_t x1, int16_t y, uint16_t color)
+{
+  if(x0 > x1)
+  {
+    fill_clipped(x1, y, x0, y, color);
+  }
+  else
+  {
+    fill_clipped(x0, y, x1, y, color);
+  }
+}
+
+void lcd_vline(int16_t x, int16_t y0, int16_t y1, uint16_t color)
+{
+  if(y0 > y1)
+  {
+    fill_clipped(x, y1, x, y0, color);
+  }
+  else
+  {
+    fill_clipped(x, y0, x, y1, color);
+  }
+}
+
+//*****************************************************************************
+// Bresenham along the longer axis.  A run of pixels ends when the error term
+// steps the short axis, and the whole run goes out as one span.
+//*****************************************************************************
+void lcd_draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+  int16_t dx = (x1 > x0) ? (x1 - x0) : (x0 - x1);
+  int16_t dy = (y1 > y0) ? (y1 - y0) : (y0 - y1);
+  int16_t err;
+  int16_t step;
+  int16_t run;
+  int16_t temp;
+
+  if(dx >= dy)
+  {
+    // walk left to right, rows change
+    if(x0 > x1)
+    {
+      temp = x0; x0 = x1; x1 = temp;
+      temp = y0; y0 = y1; y1 = temp;
+    }
+    step = (y0 < y1) ? 1 : -1;
+    err = dx / 2;
+    run = x0;
+
+    for(; x0 <= x1; x0++)
+    {
+      err -= dy;
+      if(err < 0)
+      {
+        lcd_hline(run, x0, y0, color);
+        y0 += step;
+        err += dx;
+        run = x0 + 1;
+      }
+    }
+    if(run <= x1)
+    {
+      lcd_hline(run, x1, y0, color);
+    }
+  }
+  else
+  {
+    // walk top to bottom, columns change
+    if(y0 > y1)
+    {
+      temp = x0; x0 = x1; x1 = temp;
+      temp = y0; y0 = y1; y1 = temp;
+    }
+    step = (x0 < x1) ? 1 : -1;
+    err = dy / 2;
+    run = y0;
+
+    for(; y0 <= y1; y0++)
+    {
+      err -= dx;
+      if(err < 0)
+      {
+        lcd_vline(x0, run, y0, color);
+        x0 += step;
+        err += dy;
+        run = y0 + 1;
+      }
+    }
+    if(run <= y1)
+    {
+      lcd_vline(x0, run, y1, color);
+    }
+  }
+}
+
+//*****************************************************************************
+// Midpoint circle outline.  The right half is moved over by stretch_x and the
+// bottom half down by stretch_y, which turns the four quadrants into the
+// corners of a rounded rectangle.
+//
+// While x runs from 0 to the diagonal, y only steps now and then.  The x
+// values sharing one y form a horizontal run on the top and bottom octants
+// and a vertical run on the left and right octants.
+//*****************************************************************************
+static void circle_outline(
+  int16_t xc,
+  int16_t yc,
+  int16_t r,
+  int16_t stretch_x,
+  int16_t stretch_y,
+  uint16_t color
+)
+{
+  int16_t x = 0;
+  int16_t y = r;
+  int16_t d = 1 - r;
+  int16_t run = 0;
+  bool step_y;
+
+  while(x <= y)
+  {
+    step_y = (d >= 0);
+
+    if(step_y || x + 1 > y)
+    {
+      // rows at the top and bottom
+      lcd_hline(xc - x, xc - run, yc - y, color);
+      lcd_hline(xc + stretch_x + run, xc + stretch_x + x, yc - y, color);
+      lcd_hline(xc - x, xc - run, yc + stretch_y + y, color);
+      lcd_hline(xc + stretch_x + run, xc + stretch_x + x, yc + stretch_y + y, color);
+
+      // columns on the left and right
+      lcd_vline(xc - y, yc - x, yc - run, color);
+      lcd_vline(xc - y, yc + stretch_y + run, yc + stretch_y + x, color);
+      lcd_vline(xc + stretch_x + y, yc - x, yc - run, color);
+      lcd_vline(xc + stretch_x + y, yc + stretch_y + run, yc + stretch_y + x, color);
+
+      run = x + 1;
+    }
+
+    if(step_y)
+    {
+      d += 2 * (x - y) + 5;
+      y--;
+    }
+    else
+    {
+      d += 2 * x + 3;
+    }
+    x++;
+  }
+}
+
+//*****************************************************************************
+// Midpoint filled circle, stretched the same way as circle_outline.  Each
+// step fills the rows x away from the center; the rows y away are filled
+// only on the last x before y steps, so no row is sent more than twice.
+//*****************************************************************************
+static void circle_fill(
+  int16_t xc,
+  int16_t yc,
+  int16_t r,
+  int16_t stretch_x,
+  int16_t stretch_y,
+  uint16_t color
+)
+{
+  int16_t x = 0;
+  int16_t y = r;
+  int16_t d = 1 - r;
+
+  while(x <= y)
+  {
+    lcd_hline(xc - y, xc + stretch_x + y, yc - x, color);
+    if(x != 0 || stretch_y != 0)
+    {
+      lcd_hline(xc - y, xc + stretch_x + y, yc + stretch_y + x, color);
+    }
+
+    if(d >= 0)
+    {
+      if(x != y)
+      {
+        lcd_hline(xc - x, xc + stretch_x + x, yc - y, color);
+        lcd_hline(xc - x, xc + stretch_x + x, yc + stretch_y + y, color);
+      }
+      d += 2 * (x - y) + 5;
+      y--;
+    }
+    else
+    {
+      d += 2 * x + 3;
+    }
+    x++;
+  }
+}
+
+void lcd_draw_circle(int16_t xc, int16_t yc, int16_t r, uint16_t color)
+{
+  if(r < 0)
+  {
+    return;
+  }
+  circle_outline(xc, yc, r, 0, 0, color);
+}
+
+void lcd_fill_circle(int16_t xc, int16_t yc, int16_t r, uint16_t color)
+{
+  if(r < 0)
+  {
+    return;
+  }
+  circle_fill(xc, yc, r, 0, 0, color);
+}
+
+//*****************************************************************************
+// Sorts the corners by row, then walks the long edge 0-2 against the short
+// edges 0-1 and 1-2.  The edge positions are kept as running sums so each
+// row costs one divide per edge.
+//*****************************************************************************
+void lcd_fill_triangle(
+  int16_t x0, int16_t y0,
+  int16_t x1, int16_t y1,
+  int16_t x2, int16_t y2,
+  uint16_t color
+)
+{
+  int16_t temp;
+  int16_t y;
+  int16_t last;
+  int16_t a;
+  int16_t b;
+  int32_t sa;
+  int32_t sb;
+  int16_t dx01, dy01, dx02, dy02, dx12, dy12;
+
+  if(y0 > y1) { temp = y0; y0 = y1; y1 = temp; temp = x0; x0 = x1; x1 = temp; }
+  if(y1 > y2) { temp = y1; y1 = y2; y2 = temp; temp = x1; x1 = x2; x2 = temp; }
+  if(y0 > y1) { temp = y0; y0 = y1; y1 = temp; temp = x0; x0 = x1; x1 = temp; }
+
+  // all on one row
+  if(y0 == y2)
+  {
+    a = b = x0;
+    if(x1 < a) a = x1; else if(x1 > b) b = x1;
+    if(x2 < a) a = x2; else if(x2 > b) b = x2;
+    lcd_hline(a, b, y0, color);
+    return;
+  }
+
+  dx01 = x1 - x0;  dy01 = y1 - y0;
+  dx02 = x2 - x0;  dy02 = y2 - y0;
+  dx12 = x2 - x1;  dy12 = y2 - y1;
+  sa = 0;
+  sb = 0;
+
+  // upper half.  A flat bottom takes row y1 here, otherwise the lower half
+  // does
+  last = (y1 == y2) ? y1 : y1 - 1;
+  for(y = y0; y <= last; y++)
+  {
+    a = x0 + sa / dy01;
+    b = x0 + sb / dy02;
+    sa += dx01;
+    sb += dx02;
+    lcd_hline(a, b, y, color);
+  }
+
+  // lower half
+  sa = (int32_t)dx12 * (y - y1);
+  sb = (int32_t)dx02 * (y - y0);
+  for(; y <= y2; y++)
+  {
+    a = x1 + sa / dy12;
+    b = x0 + sb / dy02;
+    sa += dx12;
+    sb += dx02;
+    lcd_hline(a, b, y, color);
+  }
+}
+
+void lcd_draw_polygon(const lcd_point_t *points, uint8_t count, uint16_t color)
+{
+  uint8_t i;
+  uint8_t j;
+
+  if(count < 2)
+  {
+    return;
+  }
+
+  for(i = 0, j = count - 1; i < count; j = i++)
+  {
+    lcd_draw_line(points[j].x, points[j].y, points[i].x, points[i].y, color);
+  }
+}
+
+//*****************************************************************************
+// Scanline fill.  Each row collects the x where the edges cross it, sorts
+// them and fills between pairs.  An edge covers the rows from its upper end
+// up to, but not including, its lower end, so the bottom row of the polygon
+// is left open and polygons sharing an edge do not draw it twice.
+//*****************************************************************************
+bool lcd_fill_polygon(const lcd_point_t *points, uint8_t count, uint16_t color)
+{
+  int16_t nodes[LCD_POLYGON_MAX_POINTS];
+  lcd_rect_t clip;
+  uint8_t num_nodes;
+  int16_t y;
+  int16_t y_min;
+  int16_t y_max;
+  int16_t temp;
+  uint8_t i;
+  uint8_t j;
+
+  if(count < 3 || count > LCD_POLYGON_MAX_POINTS)
+  {
+    return false;
+  }
+
+  y_min = y_max = points[0].y;
+  for(i = 1; i < count; i++)
+  {
+    if(points[i].y < y_min) y_min = points[i].y;
+    if(points[i].y > y_max) y_max = points[i].y;
+  }
+
+  // rows outside the clip rectangle are not scanned at all
+  clip = lcd_get_clip();
+  if(y_min < clip.y0) y_min = clip.y0;
+  if(y_max > clip.y1 + 1) y_max = clip.y1 + 1;
+
+  for(y = y_min; y < y_max; y++)
+  {
+    num_nodes = 0;
+    for(i = 0, j = count - 1; i < count; j = i++)
+    {
+      if((points[i].y <= y && points[j].y > y) ||
+          (points[j].y <= y && points[i].y > y))
+      {
+        nodes[num_nodes++] = points[i].x +
+          (int32_t)(y - points[i].y) * (points[j].x - points[i].x) /
+          (points[j].y - points[i].y);
+      }
+    }
+
+    // insertion sort, there are never more than a handful
+    for(i = 1; i < num_nodes; i++)
+    {
+      temp = nodes[i];
+      for(j = i; j > 0 && nodes[j - 1] > temp; j--)
+      {
+        nodes[j] = nodes[j - 1];
+      }
+      nodes[j] = temp;
+    }
+
+    for(i = 0; i + 1 < num_nodes; i += 2)
+    {
+      lcd_hline(nodes[i], nodes[i + 1], y, color);
+    }
+  }
+
+  return true;
+}
+
+//*****************************************************************************
+// Shrinks the corner radius until both corners fit along each side
+//*****************************************************************************
+static int16_t round_rect_radius(int16_t width, int16_t height, int16_t r)
+{
+  if(r > width / 2)
+  {
+    r = width / 2;
+  }
+  if(r > height / 2)
+  {
+    r = height / 2;
+  }
+  return (r < 0) ? 0 : r;
+}
+
+void lcd_draw_round_rect(
+  int16_t x, int16_t y,
+  int16_t width, int16_t height,
+  int16_t r,
+  uint16_t color
+)
+{
+  int16_t stretch_x;
+  int16_t stretch_y;
+
+  if(width <= 0 || height <= 0)
+  {
+    return;
+  }
+  r = round_rect_radius(width, height, r);
+  stretch_x = width - 2 * r - 1;
+  stretch_y = height - 2 * r - 1;
+
+  // straight sides between the corners
+  if(stretch_x > 1)
+  {
+    lcd_hline(x + r + 1, x + r + stretch_x - 1, y, color);
+    lcd_hline(x + r + 1, x + r + stretch_x - 1, y + height - 1, color);
+  }
+  if(stretch_y > 1)
+  {
+    lcd_vline(x, y + r + 1, y + r + stretch_y - 1, color);
+    lcd_vline(x + width - 1, y + r + 1, y + r + stretch_y - 1, color);
+  }
+
+  circle_outline(x + r, y + r, r, stretch_x, stretch_y, color);
+}
+
+void lcd_fill_round_rect(
+  int16_t x, int16_t y,
+  int16_t width, int16_t height,
+  int16_t r,
+  uint16_t color
+)
+{
+  int16_t stretch_x;
+  int16_t stretch_y;
+
+  if(width <= 0 || height <= 0)
+  {
+    return;
+  }
+  r = round_rect_radius(width, height, r);
+  stretch_x = width - 2 * r - 1;
+  stretch_y = height - 2 * r - 1;
+
+  // the rows between the corners are full width
+  if(stretch_y > 1)
+  {
+    fill_clipped(x, y + r + 1, x + width - 1, y + r + stretch_y - 1, color);
+  }
+
+  circle_fill(x + r, y + r, r, stretch_x, stretch_y, color);
+}
@@ -0,0 +1,113 @@
+#include "present.h"
+#include "capture.h"
+
+// TE pulses every 16ms, none for this long means it is not wired
+#define PRESENT_TE_TIMEOUT_MS   100
+
+volatile uint32_t present_te_count = 0;
+
+static uint8_t present_interval = 1;
+static bool present_te = false;             // frames counted in TE pulses
+static uint32_t present_last_frame = 0;
+static uint32_t present_last_te = 0;
+static uint32_t present_te_time = 0;        // timebase at the last TE seen
+static uint32_t present_frame_time = 0;     // timebase at the last frame without TE
+
+//*****************************************************************************
+// TE interrupt.  Other sources on the port are left for their own drivers.
+//*****************************************************************************
+void GPIOD_Handler(void)
+{
+  if(LCD_TE_PORT->MIS & LCD_TE_PIN)
+  {
+    present_te_count++;
+    LCD_TE_PORT->ICR = LCD_TE_PIN;
+  }
+}
+
+//*****************************************************************************
+// Turns on the TE interrupt and sets the frame interval
+//*****************************************************************************
+void present_init(uint8_t interval, uint8_t priority)
+{
+  present_interval = (interval == 0) ? 1 : interval;
+  present_te = (interval != 0);
+  present_frame_time = timebase_now();
+
+  if(!present_te)
+  {
+    return;
+  }
+
+  lcd_te_enable(true);
+  NVIC_SetPriority(LCD_TE_IRQn, priority);
+  NVIC_EnableIRQ(LCD_TE_IRQn);
+  present_last_frame = present_te_count;
+  present_last_te = present_te_count;
+  present_te_time = timebase_now();
+}
+
+//*****************************************************************************
+// Changes the number of panel refreshes per frame
+//*****************************************************************************
+void present_set_interval(uint8_t interval)
+{
+  present_interval = (interval == 0) ? 1 : interval;
+  present_last_te = present_te_count;
+  present_te_time = timebase_now();
+}
+
+//*****************************************************************************
+// Returns true and starts a frame when interval refreshes have passed, by
+// the TE count or without it by the timebase
+//*****************************************************************************
+bool present_frame_due(void)
+{
+  uint32_t now = present_te_count;
+  uint32_t period;
+
+  if(present_te)
+  {
+    if(now != present_last_te)
+    {
+      present_last_te = now;
+      present_te_time = timebase_now();
+    }
+    else if(timebase_now() - present_te_time >= PRESENT_TE_TIMEOUT_MS * TIMEBASE_TICKS_PER_MS)
+    {
+      // No TE, pace frames with the timebase from here on
+      present_te = false;
+      present_frame_time = timebase_now();
+    }
+  }
+
+  if(present_te)
+  {
+    if(now - present_last_frame < present_interval)
+    {
+      return false;
+    }
+    present_last_frame = now;
+  }
+  else
+  {
+    period = present_interval * PRESENT_REFRESH_MS * TIMEBASE_TICKS_PER_MS;
+    if(timebase_now() - present_frame_time < period)
+    {
+      return false;
+    }
+
+    // keep the cadence, unless a long frame left it more than a period behind
+    present_frame_time += period;
+    if(timebase_now() - present_frame_time >= period)
+    {
+      present_frame_time = timebase_now();
+    }
+  }
+
+  // Everything drawn since the last call was one frame
+#if LCD_CAPTURE
+  capture_frame();
+#endif
+  return true;
+}
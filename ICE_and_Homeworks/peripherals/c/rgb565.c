@@ -0,0 +1,199 @@
+#include "rgb565.h"
+
+// channel fields of a spread pixel, see rgb565.h
+#define SPREAD_MASK     0x07E0F81F
+
+//*****************************************************************************
+// Moves green into the upper half so every channel has empty bits above it
+//*****************************************************************************
+static __inline uint32_t spread(uint32_t color)
+{
+  return (color | (color << 16)) & SPREAD_MASK;
+}
+
+static __inline uint16_t pack(uint32_t spread)
+{
+  return (uint16_t)(spread | (spread >> 16));
+}
+
+//*****************************************************************************
+// bg + (fg - bg) * alpha / 32 on all three channels.  A negative channel
+// difference borrows from the gap above it, and the multiply and shift
+// carry the borrow back out, so the fields come out exact.
+//*****************************************************************************
+static __inline uint32_t blend_spread(uint32_t fg, uint32_t bg, uint32_t alpha)
+{
+  return (bg + (((fg - bg) * alpha) >> 5)) & SPREAD_MASK;
+}
+
+static __inline bool word_aligned(const void *a, const void *b)
+{
+  return (((uintptr_t)a | (uintptr_t)b) & 0x3) == 0;
+}
+
+uint16_t rgb565_blend(uint16_t fg, uint16_t bg, uint8_t alpha)
+{
+  if (alpha > RGB565_ALPHA_MAX)
+  {
+    alpha = RGB565_ALPHA_MAX;
+  }
+
+  return pack(blend_spread(spread(fg), spread(bg), alpha));
+}
+
+uint16_t rgb565_scale(uint16_t color, uint8_t level)
+{
+  if (level > RGB565_ALPHA_MAX)
+  {
+    level = RGB565_ALPHA_MAX;
+  }
+
+  return pack(((spread(color) * level) >> 5) & SPREAD_MASK);
+}
+
+//*****************************************************************************
+// Buffer kernels.  Each has a word loop for two pixels at a time and falls
+// back to pixel at a time for unaligned buffers and an odd last pixel.
+//*****************************************************************************
+void rgb565_blend_buf(uint16_t *dst, const uint16_t *fg, uint32_t count, uint8_t alpha)
+{
+  uint32_t *dst_w;
+  const uint32_t *fg_w;
+  uint32_t d;
+  uint32_t f;
+
+  if (alpha > RGB565_ALPHA_MAX)
+  {
+    alpha = RGB565_ALPHA_MAX;
+  }
+
+  if (word_aligned(dst, fg))
+  {
+    dst_w = (uint32_t *)dst;
+    fg_w = (const uint32_t *)fg;
+    for (; count >= 2; count -= 2)
+    {
+      d = *dst_w;
+      f = *fg_w++;
+      *dst_w++ = pack(blend_spread(spread(f & 0xFFFF), spread(d & 0xFFFF), alpha)) |
+                 ((uint32_t)pack(blend_spread(spread(f >> 16), spread(d >> 16), alpha)) << 16);
+    }
+    dst = (uint16_t *)dst_w;
+    fg = (const uint16_t *)fg_w;
+  }
+
+  while (count--)
+  {
+    *dst = pack(blend_spread(spread(*fg++), spread(*dst), alpha));
+    dst++;
+  }
+}
+
+void rgb565_fade_buf(
+  uint16_t *dst,
+  const uint16_t *src,
+  uint32_t count,
+  uint16_t color,
+  uint8_t alpha
+)
+{
+  uint32_t *dst_w;
+  const uint32_t *src_w;
+  uint32_t c;
+  uint32_t s;
+
+  if (alpha > RGB565_ALPHA_MAX)
+  {
+    alpha = RGB565_ALPHA_MAX;
+  }
+
+  // Blending toward color is src + (color - src) * alpha / 32, the same
+  // as blend_spread with color as the foreground
+  c = spread(color);
+
+  if (word_aligned(dst, src))
+  {
+    dst_w = (uint32_t *)dst;
+    src_w = (const uint32_t *)src;
+    for (; count >= 2; count -= 2)
+    {
+      s = *src_w++;
+      *dst_w++ = pack(blend_spread(c, spread(s & 0xFFFF), alpha)) |
+                 ((uint32_t)pack(blend_spread(c, spread(s >> 16), alpha)) << 16);
+    }
+    dst = (uint16_t *)dst_w;
+    src = (const uint16_t *)src_w;
+  }
+
+  while (count--)
+  {
+    *dst++ = pack(blend_spread(c, spread(*src++), alpha));
+  }
+}
+
+void rgb565_scale_buf(uint16_t *dst, const uint16_t *src, uint32_t count, uint8_t level)
+{
+  uint32_t *dst_w;
+  const uint32_t *src_w;
+  uint32_t s;
+
+  if (level > RGB565_ALPHA_MAX)
+  {
+    level = RGB565_ALPHA_MAX;
+  }
+
+  if (word_aligned(dst, src))
+  {
+    dst_w = (uint32_t *)dst;
+    src_w = (const uint32_t *)src;
+    for (; count >= 2; count -= 2)
+    {
+      s = *src_w++;
+      *dst_w++ = pack(((spread(s & 0xFFFF) * level) >> 5) & SPREAD_MASK) |
+                 ((uint32_t)pack(((spread(s >> 16) * level) >> 5) & SPREAD_MASK) << 16);
+    }
+    dst = (uint16_t *)dst_w;
+    src = (const uint16_t *)src_w;
+  }
+
+  while (count--)
+  {
+    *dst++ = pack(((spread(*src++) * level) >> 5) & SPREAD_MASK);
+  }
+}
+
+//*****************************************************************************
+// Four pixels are three words of packed bytes.  The word loop takes them
+// apart with shifts instead of twelve byte loads.
+//*****************************************************************************
+void rgb888_to_565_buf(uint16_t *dst, const uint8_t *rgb, uint32_t count)
+{
+  const uint32_t *rgb_w;
+  uint32_t w0;
+  uint32_t w1;
+  uint32_t w2;
+
+  // dst only takes halfwords, only the bytes need word alignment
+  if (word_aligned(rgb, rgb))
+  {
+    rgb_w = (const uint32_t *)rgb;
+    for (; count >= 4; count -= 4)
+    {
+      // little endian, w0 holds R0 G0 B0 R1 from the low byte up
+      w0 = *rgb_w++;
+      w1 = *rgb_w++;
+      w2 = *rgb_w++;
+      *dst++ = RGB565(w0, w0 >> 8, w0 >> 16);
+      *dst++ = RGB565(w0 >> 24, w1, w1 >> 8);
+      *dst++ = RGB565(w1 >> 16, w1 >> 24, w2);
+      *dst++ = RGB565(w2 >> 8, w2 >> 16, w2 >> 24);
+    }
+    rgb = (const uint8_t *)rgb_w;
+  }
+
+  while (count--)
+  {
+    *dst++ = RGB565(rgb[0], rgb[1], rgb[2]);
+    rgb += 3;
+  }
+}
@@ -0,0 +1,13 @@
+#include "rng.h"
+
+void rng_seed(rng_t *rng, uint32_t seed)
+{
+  // Scramble the seed (the murmur3 finalizer) so nearby seeds do not
+  // start with nearby numbers
+  seed += 0x9E3779B9;
+  seed = (seed ^ (seed >> 16)) * 0x85EBCA6B;
+  seed = (seed ^ (seed >> 13)) * 0xC2B2AE35;
+  seed ^= seed >> 16;
+
+  rng->state = (seed != 0) ? seed : 0x9E3779B9;
+}
@@ -14,9 +14,22 @@
 // EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "serial_debug.h"
+#include "capture.h"
 
 static bool Rx_Interrupts_Enabled = false;
 static bool Tx_Interrupts_Enabled = false;
+static serial_debug_hook_t fputc_hook = NULL;
+
+// Text waits while a screen capture is streaming, see capture.h
+#if LCD_CAPTURE
+#define CAPTURE_STREAMING()     capture_enabled
+#define CAPTURE_MID_PACKET()    capture_mid_packet()
+
+static void serial_debug_capture_kick(void);
+#else
+#define CAPTURE_STREAMING()     false
+#define CAPTURE_MID_PACKET()    false
+#endif
 
 
 PC_Buffer UART0_Tx_Buffer;
@@ -103,8 +116,9 @@ void serial_debug_tx(uint32_t uart_base, PC_Buffer *tx_buffer, int data)
   tx_buffer_empty = pc_buffer_empty(tx_buffer);
   
   // If there is space in the hardware FIFO, and the circular
-  // buffer is empty, send the data to the FIFO.
-  if( (!fifo_full) && tx_buffer_empty )
+  // buffer is empty, send the data to the FIFO.  While the screen is
+  // captured the ISR decides, so text never lands inside a packet.
+  if( (!fifo_full) && tx_buffer_empty && !CAPTURE_STREAMING() && !CAPTURE_MID_PACKET())
   {
     // write data to HW FIFO
 		uart -> DR = data;
@@ -126,6 +140,14 @@ void serial_debug_tx(uint32_t uart_base, PC_Buffer *tx_buffer, int data)
 		DisableInterrupts();
 		pc_buffer_add(tx_buffer, (char)data);
 		EnableInterrupts();
+
+#if LCD_CAPTURE
+    // Nothing may have the UART going while the capture holds text back
+    if (CAPTURE_STREAMING() && uart_base == UART0_BASE)
+    {
+      serial_debug_capture_kick();
+    }
+#endif
   }
   
   // If you're in this function, you want to send data
@@ -136,6 +158,24 @@ void serial_debug_tx(uint32_t uart_base, PC_Buffer *tx_buffer, int data)
 }
 
 
+//****************************************************************************
+// Starts streaming the screen out UART0 alongside printf
+//****************************************************************************
+void serial_debug_capture_start(void)
+{
+#if LCD_CAPTURE
+  capture_start(serial_debug_capture_kick);
+#endif
+}
+
+//****************************************************************************
+// Installs a second place fputc sends characters to, see serial_debug.h
+//****************************************************************************
+void serial_debug_set_hook(serial_debug_hook_t hook)
+{
+  fputc_hook = hook;
+}
+
 //****************************************************************************
 //  This function is called from MicroLIB's stdio library.  By implementing
 //  this function, MicroLIB's getchar(), scanf(), etc will now work.
@@ -171,6 +211,12 @@ int fputc(int c, FILE* stream)
    uint32_t uart_base;
    PC_Buffer *tx_buffer;
 
+   // A stream of the hook's own never reaches the UART
+   if (fputc_hook != NULL && fputc_hook(c, stream))
+   {
+      return c;
+   }
+
    if ( Tx_Interrupts_Enabled)
    {
       serial_debug_tx(UART0_BASE, &UART0_Tx_Buffer, c);
@@ -233,11 +279,13 @@ __INLINE static void UART_Tx_Flow(uint32_t uart_base, PC_Buffer *tx_buffer)
     UART0_Type *uart = (UART0_Type *)(uart_base);    
     char c;
     bool tx_buffer_empty;
+    bool capture_empty = true;
   
    // Check to see if we have any data in the circular buffer
     tx_buffer_empty =  pc_buffer_empty(tx_buffer);
   
-    if( !tx_buffer_empty)
+    // Text has to wait for the end of a screen capture packet
+    if( !tx_buffer_empty && !CAPTURE_MID_PACKET())
     {
         // Move data from the circular queue to the hardware FIFO
         // until the hardware FIFO is full OR the circular buffer
@@ -248,7 +296,26 @@ __INLINE static void UART_Tx_Flow(uint32_t uart_base, PC_Buffer *tx_buffer)
 					uart -> DR = c; // add to the hw FIFO
 				}
     }
-    else
+    
+#if LCD_CAPTURE
+    // The screen capture stream gets the rest of the hw FIFO
+    if (uart_base == UART0_BASE)
+    {
+        uint8_t data;
+
+        capture_empty = false;
+        while (!capture_empty && !(uart->FR & UART_FR_TXFF))
+        {
+          capture_empty = !capture_read_byte(&data);
+          if (!capture_empty)
+          {
+            uart -> DR = data;
+          }
+        }
+    }
+#endif
+    
+    if( pc_buffer_empty(tx_buffer) && capture_empty)
     {
         // Disable the TX interrupts.
 				uart->IM &= ~(UART_IM_TXIM);
@@ -260,6 +327,21 @@ __INLINE static void UART_Tx_Flow(uint32_t uart_base, PC_Buffer *tx_buffer)
 
 }
 
+#if LCD_CAPTURE
+//*****************************************************************************
+// Called when screen capture packets are queued.  The TX interrupt only
+// comes when the hw FIFO drains down through its level, so an idle UART is
+// started by filling the FIFO here.
+//*****************************************************************************
+static void serial_debug_capture_kick(void)
+{
+  DisableInterrupts();
+  UART_Tx_Flow(UART0_BASE, &UART0_Tx_Buffer);
+  UART0->IM |= UART_IM_TXIM;
+  EnableInterrupts();
+}
+#endif
+
 //*****************************************************************************
 // UART0 Interrupt Service handler
 //*****************************************************************************
@@ -0,0 +1,173 @@
+#include "tilemap.h"
+
+static const uint8_t tilemap_bpp[] = {1, 1, 2, 4, 8};
+
+//*****************************************************************************
+// v modulo n, never negative, so the map repeats left of and above x0,y0
+//*****************************************************************************
+static uint16_t wrap(int32_t v, uint16_t n)
+{
+  v %= n;
+  return (v < 0) ? v + n : v;
+}
+
+//*****************************************************************************
+// Renders the span one tile at a time.  Within a tile the source row is
+// fixed, so each pixel is a shift, a mask and a palette lookup.
+//*****************************************************************************
+void tilemap_render_span(
+  const tilemap_t *map,
+  int16_t x0,
+  int16_t y,
+  uint16_t count,
+  uint16_t *span
+)
+{
+  const image_t *tiles = map->tileset->image;
+  uint8_t size = map->tileset->tile_size;
+  uint8_t bpp = tilemap_bpp[tiles->format];
+  uint8_t mask = (1 << bpp) - 1;
+  uint16_t bytes_per_row = ((uint32_t)size * bpp + 7) / 8;
+  uint16_t tile_count = tiles->height / size;
+  const uint8_t *cells;
+  const uint8_t *row;
+  uint16_t map_x;
+  uint16_t map_y;
+  uint16_t column;
+  uint16_t x;
+  uint16_t n;
+  uint8_t tile;
+
+  map_x = wrap((int32_t)x0 - map->x0, map->columns * size);
+  map_y = wrap((int32_t)y - map->y0, map->rows * size);
+  cells = map->cells + (uint32_t)(map_y / size) * map->columns;
+  column = map_x / size;
+  x = map_x % size;
+
+  while(count != 0)
+  {
+    // Unknown tile numbers draw tile 0
+    tile = cells[column];
+    if(tile >= tile_count)
+    {
+      tile = 0;
+    }
+    row = tiles->data + ((uint32_t)tile * size + map_y % size) * bytes_per_row;
+
+    n = size - x;
+    if(n > count)
+    {
+      n = count;
+    }
+    count -= n;
+
+    while(n--)
+    {
+      *span++ = tiles->palette[(row[(x * bpp) / 8] >> (8 - bpp - (x * bpp) % 8)) & mask];
+      x++;
+    }
+
+    x = 0;
+    if(++column == map->columns)
+    {
+      column = 0;
+    }
+  }
+}
+
+//*****************************************************************************
+// Streams the rectangle a row at a time through one LCD window.  Only the
+// sprites that reach into the rectangle are composed.
+//*****************************************************************************
+void tilemap_draw(
+  const tilemap_t *map,
+  int16_t x0,
+  int16_t y0,
+  int16_t x1,
+  int16_t y1,
+  const tilemap_sprite_t *sprites,
+  uint8_t count
+)
+{
+  uint16_t line[COLS];
+  const tilemap_sprite_t *layered[TILEMAP_MAX_SPRITES];
+  uint8_t layers = 0;
+  lcd_rect_t rect;
+  lcd_rect_t bounds;
+  uint16_t width;
+  int16_t y;
+  uint8_t i;
+
+  rect.x0 = x0;
+  rect.y0 = y0;
+  rect.x1 = x1;
+  rect.y1 = y1;
+  if(map == NULL || !lcd_clip(&rect))
+  {
+    return;
+  }
+
+  for(i = 0; i < count && layers < TILEMAP_MAX_SPRITES; i++)
+  {
+    bounds = tilemap_sprite_bounds(&sprites[i]);
+    if(bounds.x0 <= rect.x1 && bounds.x1 >= rect.x0 &&
+       bounds.y0 <= rect.y1 && bounds.y1 >= rect.y0)
+    {
+      layered[layers++] = &sprites[i];
+    }
+  }
+
+  width = rect.x1 - rect.x0 + 1;
+  lcd_set_pos(rect.x0, rect.x1, rect.y0, rect.y1);
+
+  for(y = rect.y0; y <= rect.y1; y++)
+  {
+    tilemap_render_span(map, rect.x0, y, width, line);
+    for(i = 0; i < layers; i++)
+    {
+      image_compose_row(layered[i]->image, layered[i]->x_center, layered[i]->y_center,
+                        layered[i]->flags, layered[i]->fColor, layered[i]->palette,
+                        y, rect.x0, width, line);
+    }
+    lcd_write_pixels(line, width);
+  }
+}
+
+//*****************************************************************************
+// dl_draw callback, draws the background inside the clip rect
+//*****************************************************************************
+static void tilemap_erase_draw(void *context)
+{
+  lcd_rect_t clip = lcd_get_clip();
+
+  tilemap_draw((const tilemap_t *)context, clip.x0, clip.y0, clip.x1, clip.y1, NULL, 0);
+}
+
+void tilemap_erase(
+  const tilemap_t *map,
+  int16_t x0,
+  int16_t y0,
+  uint16_t width,
+  uint16_t height
+)
+{
+  if(map == NULL || width == 0 || height == 0)
+  {
+    return;
+  }
+
+  dl_draw(x0, y0, x0 + width - 1, y0 + height - 1, true, tilemap_erase_draw, (void *)map);
+}
+
+lcd_rect_t tilemap_sprite_bounds(const tilemap_sprite_t *sprite)
+{
+  lcd_rect_t bounds;
+  uint16_t width = sprite->image->width * IMAGE_SCALE(sprite->flags);
+  uint16_t height = sprite->image->height * IMAGE_SCALE(sprite->flags);
+
+  bounds.x0 = sprite->x_center - width / 2;
+  bounds.y0 = sprite->y_center - height / 2;
+  bounds.x1 = ((int32_t)bounds.x0 + width - 1 > INT16_MAX) ? INT16_MAX : bounds.x0 + width - 1;
+  bounds.y1 = ((int32_t)bounds.y0 + height - 1 > INT16_MAX) ? INT16_MAX : bounds.y0 + height - 1;
+  return bounds;
+}
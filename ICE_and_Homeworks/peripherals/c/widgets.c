@@ -0,0 +1,326 @@
+#include "widgets.h"
+#include "display_list.h"
+#include <stdio.h>
+#include <string.h>
+
+//*****************************************************************************
+// Initializes a widget.  Nothing is drawn until widget_update is called.
+//*****************************************************************************
+void widget_init(
+  widget_t *w,
+  widget_type_t type,
+  uint16_t x,
+  uint16_t y,
+  uint16_t width,
+  uint16_t height,
+  uint16_t fColor,
+  uint16_t bColor,
+  uint16_t border_color,
+  uint8_t border_width
+)
+{
+  memset(w, 0, sizeof(widget_t));
+  w->type = type;
+  w->x = x;
+  w->y = y;
+  w->width = width;
+  w->height = height;
+  w->fColor = fColor;
+  w->bColor = bColor;
+  w->border_color = border_color;
+  w->border_width = border_width;
+  w->format = "%d";
+  w->max = 1;
+  w->visible = true;
+  w->erase_color = bColor;
+}
+
+//*****************************************************************************
+// Content setters
+//*****************************************************************************
+void widget_set_text(widget_t *w, const char *text)
+{
+  strncpy(w->text, text, WIDGET_TEXT_LEN - 1);
+  w->text[WIDGET_TEXT_LEN - 1] = '\0';
+}
+
+void widget_set_value(widget_t *w, int32_t value)
+{
+  w->value = value;
+}
+
+void widget_set_colors(widget_t *w, uint16_t fColor, uint16_t bColor)
+{
+  if(w->fColor != fColor || w->bColor != bColor)
+  {
+    w->fColor = fColor;
+    w->bColor = bColor;
+    w->drawn = false;
+  }
+}
+
+void widget_hide(widget_t *w, uint16_t erase_color)
+{
+  w->visible = false;
+  w->erase_color = erase_color;
+}
+
+void widget_show(widget_t *w)
+{
+  w->visible = true;
+}
+
+void widget_invalidate(widget_t *w)
+{
+  w->drawn = false;
+}
+
+//*****************************************************************************
+// Invalidates every widget in the list whose bounds intersect the rectangle.
+//*****************************************************************************
+void widget_damage(
+  widget_t *list,
+  uint8_t count,
+  uint16_t x0,
+  uint16_t y0,
+  uint16_t x1,
+  uint16_t y1
+)
+{
+  uint8_t i;
+
+  for(i = 0; i < count; i++)
+  {
+    if( x0 < list[i].x + list[i].width && x1 >= list[i].x &&
+        y0 < list[i].y + list[i].height && y1 >= list[i].y )
+    {
+      list[i].drawn = false;
+    }
+  }
+}
+
+//*****************************************************************************
+// Paints the border and the fill
+//*****************************************************************************
+static void widget_draw_frame(widget_t *w)
+{
+  uint8_t b = w->border_width;
+
+  if(b != 0)
+  {
+    dl_fill_rect(w->x, w->y, w->width, b, w->border_color);
+    dl_fill_rect(w->x, w->y + w->height - b, w->width, b, w->border_color);
+    dl_fill_rect(w->x, w->y + b, b, w->height - 2 * b, w->border_color);
+    dl_fill_rect(w->x + w->width - b, w->y + b, b, w->height - 2 * b, w->border_color);
+  }
+  dl_fill_rect(w->x + b, w->y + b, w->width - 2 * b, w->height - 2 * b, w->bColor);
+}
+
+// Fills columns x0 .. x1 - 1 of rows y .. y + height - 1, if there are any
+static void widget_fill_span(int16_t x0, int16_t x1, int16_t y, int16_t height, uint16_t color)
+{
+  if(x1 > x0 && height > 0)
+  {
+    lcd_fill_rect(x0, y, x1 - x0, height, color);
+  }
+}
+
+//*****************************************************************************
+// Display list callback, drawn_text and the fill around and between its
+// glyphs, so every pixel inside the border is painted.  It redraws the
+// whole inside and the clip rect keeps it to what was recorded.
+//*****************************************************************************
+static void widget_paint_text(void *context)
+{
+  widget_t *w = (widget_t *)context;
+  const font_t *font = font_get(w->font);
+  const font_glyph_t *glyph;
+  int16_t left = w->x + w->border_width;
+  int16_t right = w->x + w->width - w->border_width;
+  int16_t top = w->y + w->border_width;
+  int16_t bottom = w->y + w->height - w->border_width;
+  int16_t x = left + 2;
+  int16_t y = w->y + (w->height - font->height) / 2;
+  uint8_t i = 0;
+
+  widget_fill_span(left, right, top, y - top, w->bColor);
+  widget_fill_span(left, right, y + font->height, bottom - y - font->height, w->bColor);
+  widget_fill_span(left, x, y, font->height, w->bColor);
+
+  while(w->drawn_text[i] != '\0' && x + FONT_GLYPH(font, w->drawn_text[i])->width <= right)
+  {
+    glyph = FONT_GLYPH(font, w->drawn_text[i]);
+    font_draw_char(font, (uint8_t)w->drawn_text[i], x, y, w->fColor, w->bColor);
+    widget_fill_span(x + glyph->width, x + glyph->advance, y, font->height, w->bColor);
+    x += glyph->advance;
+    i++;
+  }
+  widget_fill_span(x, right, y, font->height, w->bColor);
+}
+
+//*****************************************************************************
+// Labels and counters.  Only the glyphs from the first changed character
+// onward are drawn, and whatever is left of the old string is erased.  The
+// text goes through the display list as one opaque draw: after a frame it
+// covers the whole inside, so inside a display list frame the fill under
+// it is culled, otherwise the changed part of the line.
+//*****************************************************************************
+static bool widget_draw_text(widget_t *w, const char *text)
+{
+  const font_t *font = font_get(w->font);
+  int16_t x = w->x + w->border_width + 2;
+  int16_t start;
+  int16_t end;
+  int16_t y;
+  int16_t right = w->x + w->width - w->border_width;
+  uint8_t i = 0;
+
+  if(font == NULL)
+  {
+    return false;
+  }
+  y = w->y + (w->height - font->height) / 2;
+
+  if(w->drawn)
+  {
+    // Skip the common prefix
+    while(text[i] != '\0' && text[i] == w->drawn_text[i])
+    {
+      x += FONT_GLYPH(font, text[i])->advance;
+      i++;
+    }
+    if(text[i] == '\0' && w->drawn_text[i] == '\0')
+    {
+      return false;
+    }
+  }
+
+  start = x;
+  while(text[i] != '\0' && x + FONT_GLYPH(font, text[i])->width <= right)
+  {
+    x += FONT_GLYPH(font, text[i])->advance;
+    i++;
+  }
+
+  // Take in what is left of a longer, older string
+  end = (w->drawn && w->drawn_end > x) ? w->drawn_end : x;
+  if(end > right)
+  {
+    end = right;
+  }
+
+  w->drawn_end = x;
+  strcpy(w->drawn_text, text);
+
+  if(!w->drawn)
+  {
+    dl_draw(w->x + w->border_width, w->y + w->border_width, right - 1,
+            w->y + w->height - w->border_width - 1, true, widget_paint_text, w);
+  }
+  else if(end > start)
+  {
+    dl_draw(start, y, end - 1, y + font->height - 1, true, widget_paint_text, w);
+  }
+  return true;
+}
+
+//*****************************************************************************
+// Bars.  Only the span between the old and the new fill level is drawn.
+//*****************************************************************************
+static uint16_t widget_bar_fill(widget_t *w, int32_t value)
+{
+  int32_t inner = w->width - 2 * w->border_width;
+
+  if(value <= 0 || w->max <= 0)   return 0;
+  if(value >= w->max)             return inner;
+  return (uint16_t)((value * inner) / w->max);
+}
+
+static bool widget_draw_bar(widget_t *w)
+{
+  uint16_t x = w->x + w->border_width;
+  uint16_t y = w->y + w->border_width;
+  uint16_t h = w->height - 2 * w->border_width;
+  uint16_t old_fill = widget_bar_fill(w, w->drawn_value);
+  uint16_t new_fill = widget_bar_fill(w, w->value);
+
+  if(!w->drawn)
+  {
+    old_fill = 0;
+  }
+  else if(old_fill == new_fill)
+  {
+    return false;
+  }
+
+  if(new_fill > old_fill)
+  {
+    dl_fill_rect(x + old_fill, y, new_fill - old_fill, h, w->fColor);
+  }
+  else
+  {
+    dl_fill_rect(x + new_fill, y, old_fill - new_fill, h, w->bColor);
+  }
+  return true;
+}
+
+//*****************************************************************************
+// Brings the screen up to date with the widget's state.
+//*****************************************************************************
+bool widget_update(widget_t *w)
+{
+  char buffer[WIDGET_TEXT_LEN];
+  bool changed = false;
+
+  if(!w->visible)
+  {
+    if(w->drawn_visible || !w->drawn)
+    {
+      dl_fill_rect(w->x, w->y, w->width, w->height, w->erase_color);
+      w->drawn_visible = false;
+      w->drawn = true;
+      return true;
+    }
+    return false;
+  }
+
+  if(!w->drawn || !w->drawn_visible)
+  {
+    widget_draw_frame(w);
+    w->drawn = false;
+    changed = true;
+  }
+
+  switch(w->type)
+  {
+    case WIDGET_LABEL:
+    {
+      changed |= widget_draw_text(w, w->text);
+      break;
+    }
+    case WIDGET_COUNTER:
+    {
+      // the string only has to be rebuilt when the value moved
+      if(!w->drawn || w->value != w->drawn_value)
+      {
+        snprintf(buffer, WIDGET_TEXT_LEN, w->format, (int)w->value);
+        changed |= widget_draw_text(w, buffer);
+      }
+      break;
+    }
+    case WIDGET_BAR:
+    {
+      changed |= widget_draw_bar(w);
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
+
+  w->drawn_value = w->value;
+  w->drawn_visible = true;
+  w->drawn = true;
+  return changed;
+}
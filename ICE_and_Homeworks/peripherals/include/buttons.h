@@ -4,17 +4,21 @@
 #include <stdint.h>
 #include "launchpad_io.h"
 
+//*****************************************************************************
+// Every push button on the board as one bit each, the way the debouncer in
+// debounce.h takes them: the four MCP23017 port B buttons in their pin
+// order (DIR_BTN_*_PIN) and the launchpad's SW1 and SW2 above them.
+//*****************************************************************************
+#define BUTTON_SW1            4
+#define BUTTON_SW2            5
 
-typedef enum 
-{
-  DEBOUNCE_ONE,
-  DEBOUNCE_1ST_ZERO,
-  DEBOUNCE_2ND_ZERO,
-  DEBOUNCE_PRESSED,
-	DEBOUNCE_DONE
-} DEBOUNCE_STATES;
+#define BUTTONS_EXPANDER_M    0x0F
+#define BUTTONS_LAUNCHPAD_M   ((1 << BUTTON_SW1) | (1 << BUTTON_SW2))
 
-
-bool button_pressed(uint8_t);
+//*****************************************************************************
+// The launchpad switches, a 1 bit is pressed.  Reads the GPIO pins
+// directly, no waiting.
+//*****************************************************************************
+uint8_t buttons_read_launchpad(void);
 
 #endif
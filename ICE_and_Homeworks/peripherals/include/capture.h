@@ -0,0 +1,133 @@
+#ifndef __CAPTURE_H__
+#define __CAPTURE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// The LCD driver, serial_debug and present only call in here when the
+// project defines LCD_CAPTURE as 1 (Final_Project), so projects that do not
+// build capture.c still link
+#ifndef LCD_CAPTURE
+#define LCD_CAPTURE             0
+#endif
+
+// Must be a power of 2
+#define CAPTURE_BUFFER_SIZE     4096
+
+// Most pixels in one literal packet
+#define CAPTURE_LITERAL_MAX     64
+
+// Shorter runs of one color go out as literals.  A run packet splitting a
+// literal packet costs 12 bytes, as much as 6 literal pixels.
+#define CAPTURE_MIN_RUN         6
+
+// Most damaged rows read back and resent per frame
+#define CAPTURE_REPAIR_ROWS     4
+
+//*****************************************************************************
+// Screen capture stream
+//
+// The LCD driver reports everything it writes to GRAM: each window, each
+// run and each pixel, plus mirror and scroll changes.  That traffic is
+// already the change between one frame and the next, so it is encoded as it
+// happens, runs of one color as a single packet and everything else as
+// literal pixels, into a ring that a transport drains in the background.
+// tools/capview rebuilds the screen from the stream and writes the frames
+// out as PNGs.
+//
+// Every packet is
+//    0xF5, type, payload length, payload (little endian)
+// and the transport only lets other traffic, ex printf on the same UART, in
+// between packets.  Any byte outside a packet is text.
+//
+//    'W' x0 x1 y0 y1 (u16)             window, pixels follow row by row
+//    'R' color (u16) count (u32)        run of one color
+//    'P' pixels (u16) ...               literal pixels
+//    'M' mirror_x mirror_y (u8)         lcd_set_mirror
+//    'S' top height offset (u16)        scroll area, see lcd_scroll_row
+//    'F' number (u32) time (u32) flags  end of frame, time in timebase ticks
+//
+// Nothing ever waits on the link.  A packet that does not fit in the ring
+// is dropped and the window it belonged to is marked damaged.  capture_frame
+// then reads a few damaged rows per frame back out of GRAM and resends them
+// while there is room, so the picture on the host heals once the link
+// catches up.  Starting a capture damages the whole screen, which makes the
+// first frames a key frame.
+//*****************************************************************************
+
+// Called after packets are added, ex to turn on a UART's TX interrupt
+typedef void (*capture_kick_t)(void);
+
+typedef struct
+{
+  uint32_t  frames;                   // frame packets sent
+  uint32_t  pixels;                   // pixels encoded, resent rows included
+  uint32_t  bytes;                    // bytes queued
+  uint32_t  dropped;                  // packets that did not fit
+  uint32_t  repaired;                 // rows resent from GRAM
+} capture_stats_t;
+
+// Encoder state, here so the per pixel hook can be inline.  Use the
+// functions below.
+extern bool capture_enabled;
+extern uint16_t capture_run_color;
+extern uint32_t capture_run_length;
+
+//*****************************************************************************
+// Starts a capture.  kick is called whenever packets are added.
+//*****************************************************************************
+void capture_start(capture_kick_t kick);
+
+//*****************************************************************************
+// Stops adding packets.  What is already queued still goes out.
+//*****************************************************************************
+void capture_stop(void);
+
+//*****************************************************************************
+// Ends a frame: flushes the encoder, resends some damaged rows and adds a
+// frame packet.  Does nothing if the frame drew nothing.  present_frame_due
+// calls it at the start of every frame.
+//*****************************************************************************
+void capture_frame(void);
+
+//*****************************************************************************
+// Transport side, safe to call from an interrupt.  Takes the next byte of
+// the stream, returns false if there is none.
+//*****************************************************************************
+bool capture_read_byte(uint8_t *data);
+
+//*****************************************************************************
+// True while part of a packet has been read, other traffic on the link has
+// to wait until it returns false.
+//*****************************************************************************
+bool capture_mid_packet(void);
+
+//*****************************************************************************
+// Statistics since capture_start.
+//*****************************************************************************
+capture_stats_t capture_get_stats(void);
+
+//*****************************************************************************
+// LCD driver hooks.  The driver calls capture_mirror and capture_scroll even
+// when no capture is running, so a capture starts from the LCD's state.
+//*****************************************************************************
+void capture_window(uint16_t x0, uint16_t x1, uint16_t y0, uint16_t y1);
+void capture_run(uint16_t color, uint32_t count);
+void capture_color_change(uint16_t color);
+void capture_mirror(bool mirror_x, bool mirror_y);
+void capture_scroll(uint16_t top, uint16_t height, uint16_t offset);
+
+// One pixel, the common case of extending the current run is inline
+static __inline void capture_pixel(uint16_t color)
+{
+  if(color == capture_run_color)
+  {
+    capture_run_length++;
+  }
+  else
+  {
+    capture_color_change(color);
+  }
+}
+
+#endif
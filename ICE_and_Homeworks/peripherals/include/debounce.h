@@ -0,0 +1,67 @@
+#ifndef __DEBOUNCE_H__
+#define __DEBOUNCE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Inputs one debouncer handles, one bit each
+#define DEBOUNCE_INPUTS     8
+
+//*****************************************************************************
+// Vertical counter debouncer
+//
+// Debounces up to 8 inputs at once.  Each input has a 2 bit counter, and
+// the counters are stored "vertically": bit n of ct0 and ct1 is input n's
+// counter.  One sample of every input then takes a handful of logic
+// operations for all of them together.  An input has to read the same for
+// 4 samples in a row before its debounced state changes.  At one sample per
+// 8ms TIMER4 tick that is a 32ms filter.
+//
+// There are no waits.  Call debounce_sample from a periodic interrupt or
+// loop with the raw inputs, 1 meaning pressed.
+//
+// While an input stays pressed it also counts ticks.  After long_ticks it
+// reports a long press once.  If repeat_ticks is not 0, it then reports a
+// repeat every repeat_ticks until it is released.
+//*****************************************************************************
+typedef struct
+{
+  uint8_t   state;                    // debounced, 1 is pressed
+  uint8_t   ct0;                      // vertical counter, low bits
+  uint8_t   ct1;                      // vertical counter, high bits
+  uint16_t  long_ticks;
+  uint16_t  repeat_ticks;
+  uint16_t  held[DEBOUNCE_INPUTS];    // samples pressed so far
+} debounce_t;
+
+// What one sample changed, a mask of inputs each
+typedef struct
+{
+  uint8_t   pressed;
+  uint8_t   released;
+  uint8_t   long_pressed;
+  uint8_t   repeated;
+} debounce_events_t;
+
+//*****************************************************************************
+// Starts every input released.  A long_ticks of 0 turns long presses and
+// repeats off.
+//*****************************************************************************
+void debounce_init(debounce_t *debounce, uint16_t long_ticks, uint16_t repeat_ticks);
+
+//*****************************************************************************
+// Feeds one sample of every input, a 1 bit is pressed.  Inputs that are not
+// sampled this time can be masked off with valid, their raw bit is then
+// taken to be the debounced state.
+//
+// Returns true if events has anything in it.
+//*****************************************************************************
+bool debounce_sample(debounce_t *debounce, uint8_t raw, uint8_t valid, debounce_events_t *events);
+
+//*****************************************************************************
+// True once every valid input has read its debounced state for a sample,
+// ex to stop sampling an input that can interrupt on a change.
+//*****************************************************************************
+bool debounce_settled(const debounce_t *debounce, uint8_t mask);
+
+#endif
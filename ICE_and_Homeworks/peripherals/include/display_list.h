@@ -0,0 +1,125 @@
+#ifndef __DISPLAY_LIST_H__
+#define __DISPLAY_LIST_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lcd.h"
+#include "image.h"
+
+#define DL_MAX_COMMANDS       48
+#define DL_PALETTE_SIZE       16
+
+// Draws a custom command.  context is whatever was passed to dl_draw.
+typedef void (*dl_draw_t)(void *context);
+
+//*****************************************************************************
+// Display list
+//
+// Between dl_begin and dl_end the dl_ draw calls are recorded instead of
+// sent to the LCD.  Outside of a frame they draw right away, so code can
+// call them unconditionally and the caller decides what gets batched.
+//
+// Every command records the rectangle it paints.  Fills and images paint
+// all of their rectangle, so a later one hides what is under it:
+//   - an earlier command entirely under a later opaque one is dropped
+//   - an earlier command with a full edge strip under a later opaque one is
+//     cut back to the part still showing (images through the clip rect)
+//   - a fill that lines up with an earlier fill of the same color is merged
+//     into it, when nothing recorded between them overlaps either
+// This happens as commands are recorded, which keeps the list short, ex a
+// sprite moved one pixel at a time leaves its last position plus one strip.
+// dl_end then sorts what is left into panel scan order, bottom row first, so
+// each part is written before the scan reaches it, never moving a command
+// past one it overlaps, and runs it.
+//
+// If the list fills up mid frame the commands so far are run and recording
+// carries on.
+//*****************************************************************************
+
+typedef struct
+{
+  uint16_t  recorded;                 // commands recorded
+  uint16_t  culled;                   // dropped, covered later or clipped away
+  uint16_t  merged;                   // fills merged into another
+  uint16_t  executed;                 // commands sent to the LCD
+  uint32_t  pixels_recorded;          // pixels the recorded commands cover
+  uint32_t  pixels_written;           // pixels actually sent
+  uint32_t  pixels_visible;           // pixels changed, if dl_count_visible
+} dl_stats_t;
+
+// Counting the pixels a frame changed (the union of what it drew) is O(n^3)
+// in the commands, so it is only done when this is set, ex by a host
+// simulation or for debug output.
+extern bool dl_count_visible;
+
+//*****************************************************************************
+// Starts recording a frame and clears the frame statistics.
+//*****************************************************************************
+void dl_begin(void);
+
+//*****************************************************************************
+// Optimizes and runs the recorded frame.
+//*****************************************************************************
+void dl_end(void);
+
+//*****************************************************************************
+// True between dl_begin and dl_end.
+//*****************************************************************************
+bool dl_recording(void);
+
+//*****************************************************************************
+// Same as lcd_fill_rect.
+//*****************************************************************************
+void dl_fill_rect(int16_t x0, int16_t y0, uint16_t width, uint16_t height, uint16_t color);
+
+//*****************************************************************************
+// Same geometry as lcd_draw_box, recorded as its five fills so the border
+// and the inside are culled and merged separately.
+//*****************************************************************************
+void dl_draw_box(
+  int16_t x_start,
+  uint16_t x_len,
+  int16_t y_start,
+  uint16_t y_len,
+  uint16_t border_color,
+  uint16_t fill_color,
+  uint16_t border_width
+);
+
+//*****************************************************************************
+// Same as image_blit.  A palette of up to DL_PALETTE_SIZE entries is copied,
+// so it may live on the caller's stack; a larger one must stay valid until
+// dl_end.
+//*****************************************************************************
+void dl_image(
+  const image_t *image,
+  int16_t x_center,
+  int16_t y_center,
+  uint8_t flags,
+  uint16_t fColor,
+  uint16_t bColor,
+  const uint16_t *palette
+);
+
+//*****************************************************************************
+// Records a custom draw that stays inside x0,y0 .. x1,y1, ex a line of text.
+// An opaque draw must write every pixel of that rectangle.  draw always runs
+// with the clip rect set to the part of the rectangle still showing, so it
+// can simply redraw whatever lcd_get_clip returns.
+//*****************************************************************************
+void dl_draw(
+  int16_t x0,
+  int16_t y0,
+  int16_t x1,
+  int16_t y1,
+  bool opaque,
+  dl_draw_t draw,
+  void *context
+);
+
+//*****************************************************************************
+// Statistics of the last frame.
+//*****************************************************************************
+void dl_get_stats(dl_stats_t *stats);
+
+#endif
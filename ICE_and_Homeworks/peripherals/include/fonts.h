@@ -0,0 +1,95 @@
+#ifndef __FONTS_H__
+#define __FONTS_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define FONT_MAX_FONTS    4
+#define FONT_INVALID      0xFF
+
+// One glyph cell.  The pixels of the width x font height cell are stored as
+// alternating background/foreground run lengths in row major order, starting
+// with background.  A run of 0 means the color switches without drawing.
+typedef struct
+{
+  uint8_t   width;            // width of the glyph cell in pixels
+  uint8_t   advance;          // distance to the next glyph's origin
+  uint16_t  run_offset;       // index of the first run in the font's run array
+  uint16_t  run_count;        // number of run bytes for this glyph
+} font_glyph_t;
+
+// Font tables are generated by tools/fontconv from BDF files.  glyph_map
+// holds an entry for every byte value so a lookup never leaves the table;
+// bytes the font does not contain map to glyph 0, the fallback glyph.
+typedef struct
+{
+  uint8_t               height;
+  uint8_t               glyph_count;
+  const uint8_t         *glyph_map;
+  const font_glyph_t    *glyphs;
+  const uint8_t         *runs;
+} font_t;
+
+//*****************************************************************************
+// Adds a font to the font table.  The first font registered becomes the
+// default font used by print_string_toLCD.
+//
+// Returns the font id, or FONT_INVALID if the table is full.
+//*****************************************************************************
+uint8_t font_register(const font_t *font);
+
+//*****************************************************************************
+// Returns the font registered under id, or NULL.
+//*****************************************************************************
+const font_t *font_get(uint8_t id);
+
+//*****************************************************************************
+// Returns the glyph used to draw byte c.  Always returns a valid glyph.
+//*****************************************************************************
+#define FONT_GLYPH(font, c)   (&(font)->glyphs[(font)->glyph_map[(uint8_t)(c)]])
+
+//*****************************************************************************
+// Draws one glyph with its upper left corner at x, y.
+//
+// Returns the glyph's advance in pixels.
+//*****************************************************************************
+uint16_t font_draw_char(
+  const font_t *font,
+  uint8_t c,
+  uint16_t x,
+  uint16_t y,
+  uint16_t fColor,
+  uint16_t bColor
+);
+
+//*****************************************************************************
+// Draws a string with its upper left corner at x, y using font id.
+//
+// Returns the x coordinate following the last glyph drawn.
+//*****************************************************************************
+uint16_t font_draw_string(
+  uint8_t id,
+  const char *string,
+  uint16_t x,
+  uint16_t y,
+  uint16_t fColor,
+  uint16_t bColor
+);
+
+//*****************************************************************************
+// Returns the width in pixels of string when drawn with font id.
+//*****************************************************************************
+uint16_t font_string_width(uint8_t id, const char *string);
+
+//*****************************************************************************
+// Legacy text output.  Each glyph is centered on (xPos, y_start) and xPos
+// advances by half the glyph width plus 4 pixels, matching the layout the
+// game screens were designed around.  Uses the default font.
+//*****************************************************************************
+void print_string_toLCD(char string[],
+  uint16_t x_start,
+  uint16_t y_start,
+  uint16_t fColor,
+  uint16_t bColor);
+
+#endif
@@ -62,6 +62,21 @@
 #define FT6X06_REALEASE_CODE_ID_R     0xAF
 #define FT6X06_STATE_R                0xBC
 
+// G_MODE, trigger mode pulses INT low once per new report
+#define FT6X06_G_MODE_POLLING         0x00
+#define FT6X06_G_MODE_TRIGGER         0x01
+
+// TD_STATUS through P2_MISC, read in one burst
+#define FT6X06_REPORT_BYTES           (FT6X06_P2_MISC_R - FT6X06_TD_STATUS_R + 1)
+
+// One touch report, points in LCD coordinates as ft6x06_read_x/y return them
+typedef struct
+{
+  uint8_t   count;                    // 0, 1 or 2
+  uint16_t  x[2];
+  uint16_t  y[2];
+} ft6x06_report_t;
+
 
 //*****************************************************************************
 // Read the X value of last touch event
@@ -78,6 +93,25 @@ uint16_t ft6x06_read_x(void);
 //*****************************************************************************
 uint16_t ft6x06_read_y(void);
 
+//*****************************************************************************
+// Reads TD_STATUS and both touch points in one sequential I2C read, instead
+// of the two transactions per register ft6x06_read_x/y take.
+//
+// Returns false if the read failed, report is then left alone.
+//*****************************************************************************
+bool ft6x06_read_report(ft6x06_report_t *report);
+
+//*****************************************************************************
+// Puts the controller in trigger mode and turns on a falling edge interrupt
+// on its INT pin, FT6X06_IRQ_PIN_NUM.  The panel then only has to be read
+// when INT fires, once per new report while touched and once on the
+// release, and not at all while idle.  The GPIOF handler has to call
+// ft6x06_read_report when the pin is pending, see gpiof_hook.
+//
+// Returns false if the pin or the controller could not be configured.
+//*****************************************************************************
+bool ft6x06_init_irq(uint8_t priority);
+
 //*****************************************************************************
 // Test the ft6x06
 //*****************************************************************************
@@ -0,0 +1,120 @@
+#ifndef __GESTURE_H__
+#define __GESTURE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//*****************************************************************************
+// Touch gestures
+//
+// A recognizer that runs on the stream of touch reports, one call per
+// report with the time it came in.  It keeps no history past the current
+// touch and the last tap, and never needs a timer: every gesture is decided
+// by a report, so it can run straight from the touch interrupt.
+//
+//    tap         down and up within tap_ms, moving less than slop
+//    double tap  a second tap within double_tap_ms of the first and slop of
+//                it.  The first tap is still reported as a tap.
+//    swipe       down, at least swipe_distance and up within swipe_ms
+//    drag        a touch that has moved more than slop and is still down
+//                after swipe_ms, reported on every move, then drag end
+//    pinch       two fingers, reported each time their distance changes by
+//                pinch_step.  The rest of the touch is ignored until all
+//                fingers are up.
+//
+// Distances are pixels, measured with gesture_distance.  The config times
+// are milliseconds and report times are timebase ticks.
+//*****************************************************************************
+
+typedef enum
+{
+  GESTURE_NONE,
+  GESTURE_TAP,
+  GESTURE_DOUBLE_TAP,
+  GESTURE_SWIPE,
+  GESTURE_DRAG,
+  GESTURE_DRAG_END,
+  GESTURE_PINCH
+} gesture_type_t;
+
+// gesture_t.dir of a swipe, in LCD coordinates, up is toward y 0
+typedef enum
+{
+  GESTURE_LEFT,
+  GESTURE_RIGHT,
+  GESTURE_UP,
+  GESTURE_DOWN
+} gesture_dir_t;
+
+typedef struct
+{
+  uint8_t   type;                     // gesture_type_t
+  uint8_t   dir;                      // gesture_dir_t, swipes only
+  int16_t   x;                        // where, the midpoint for a pinch
+  int16_t   y;
+  int16_t   dx;                       // swipe: start to end
+  int16_t   dy;                       // drag: since the last drag
+                                      // pinch: dx is the distance change
+                                      // since the pinch started
+} gesture_t;
+
+typedef struct
+{
+  uint32_t  tap_ms;
+  uint32_t  double_tap_ms;
+  uint32_t  swipe_ms;
+  uint16_t  slop;
+  uint16_t  swipe_distance;
+  uint16_t  pinch_step;
+} gesture_config_t;
+
+// The defaults, for a 240x320 panel
+#define GESTURE_TAP_MS            250
+#define GESTURE_DOUBLE_TAP_MS     300
+#define GESTURE_SWIPE_MS          300
+#define GESTURE_SLOP              10
+#define GESTURE_SWIPE_DISTANCE    40
+#define GESTURE_PINCH_STEP        8
+
+typedef struct
+{
+  const gesture_config_t *config;
+  uint8_t   state;
+  uint32_t  down_time;
+  int16_t   down_x;
+  int16_t   down_y;
+  int16_t   last_x;
+  int16_t   last_y;
+  uint16_t  pinch_start;
+  uint16_t  pinch_last;
+  bool      tapped;                   // a tap that a second one can double
+  uint32_t  tap_time;
+  int16_t   tap_x;
+  int16_t   tap_y;
+} gesture_state_t;
+
+extern const gesture_config_t gesture_default_config;
+
+//*****************************************************************************
+// Starts a recognizer with config, NULL for gesture_default_config.  The
+// config is used in place and must stay around.
+//*****************************************************************************
+void gesture_init(gesture_state_t *state, const gesture_config_t *config);
+
+//*****************************************************************************
+// Feeds one touch report: time in timebase ticks, count of 0, 1 or 2 points
+// and their coordinates.
+//
+// Returns true with the gesture in out if the report completed or continued
+// one.
+//*****************************************************************************
+bool gesture_feed(gesture_state_t *state, uint32_t time, uint8_t count,
+                  const uint16_t x[2], const uint16_t y[2], gesture_t *out);
+
+//*****************************************************************************
+// The larger of |dx| and |dy| plus half the smaller, within about 12% of the
+// true distance with no square root.
+//*****************************************************************************
+uint16_t gesture_distance(int16_t dx, int16_t dy);
+
+#endif
@@ -0,0 +1,132 @@
+#ifndef __IMAGE_H__
+#define __IMAGE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Pixel formats of an image_t's data
+#define IMAGE_1BPP          0     // rows of 1 bit pixels padded to a byte, MSB first
+#define IMAGE_1BPP_RLE      1     // alternating bColor/fColor runs, see below
+#define IMAGE_2BPP          2     // palette indexes, rows padded to a byte, MSB first
+#define IMAGE_4BPP          3
+#define IMAGE_8BPP          4
+
+#define IMAGE_IS_INDEXED(format)    ((format) >= IMAGE_2BPP && (format) <= IMAGE_8BPP)
+
+// image_blit flags
+#define IMAGE_FLIP_H        0x01  // mirror left to right
+#define IMAGE_FLIP_V        0x02  // mirror top to bottom
+#define IMAGE_SCALE_2X      0x04  // nearest neighbor, 2x2 pixels per source pixel
+#define IMAGE_SCALE_3X      0x08  // nearest neighbor, 3x3 pixels per source pixel
+
+#define IMAGE_SCALE(flags)  (((flags) & IMAGE_SCALE_3X) ? 3 : ((flags) & IMAGE_SCALE_2X) ? 2 : 1)
+
+// Image assets are generated by tools/imgconv from BMP or PBM files.
+//
+// IMAGE_1BPP_RLE data is the row major pixel stream stored as alternating
+// background/foreground run lengths, starting with background.  Each run is
+// an unsigned LEB128 varint (7 bits per byte, least significant group first,
+// bit 7 set when another byte follows), so a run may span several rows and a
+// run of 0 only switches the color.
+//
+// Indexed images carry their own RGB565 palette.  tools/imgconv puts the
+// color of the upper left pixel, normally the background, at index 0.
+typedef struct
+{
+  uint16_t        width;
+  uint16_t        height;
+  uint8_t         format;
+  uint32_t        size;             // bytes in data
+  const uint8_t   *data;
+  const uint16_t  *palette;         // indexed formats only, else NULL
+  uint16_t        palette_size;     // entries in palette
+} image_t;
+
+//*****************************************************************************
+// Draws an image centered on x_center, y_center, the same placement used by
+// lcd_draw_image, and clipped the same way (see lcd_set_clip), so an image
+// may hang off any edge.  For 1bpp formats set bits/foreground runs are
+// drawn in fColor and the rest in bColor; indexed formats use the image's
+// palette and ignore both colors.  Images are decoded straight into the
+// LCD's write window, no frame or line buffer is used.
+//
+// Returns false if the image format is not supported.
+//*****************************************************************************
+bool image_draw(
+  const image_t *image,
+  int16_t x_center,
+  int16_t y_center,
+  uint16_t fColor,
+  uint16_t bColor
+);
+
+//*****************************************************************************
+// Same as image_draw with the upper left corner of the image at x0, y0.
+//*****************************************************************************
+bool image_draw_at(
+  const image_t *image,
+  int16_t x0,
+  int16_t y0,
+  uint16_t fColor,
+  uint16_t bColor
+);
+
+//*****************************************************************************
+// Draws an indexed image centered on x_center, y_center through palette
+// instead of the image's own, ex a RAM copy with recolored entries.  palette
+// must hold at least image->palette_size entries.
+//
+// Returns false if the image is not an indexed format.
+//*****************************************************************************
+bool image_draw_palette(
+  const image_t *image,
+  int16_t x_center,
+  int16_t y_center,
+  const uint16_t *palette
+);
+
+//*****************************************************************************
+// Draws an image centered on x_center, y_center, flipped and/or scaled as
+// set by flags.  Flips are done by the LCD's address order (MADCTL) and
+// scaling by repeating pixels and rows as they are decoded, so no buffer
+// is used and the cost is proportional to the pixels drawn.  palette, if not
+// NULL, replaces the palette of an indexed image.
+//
+// Returns false if the image format is not supported.  An image that is
+// entirely clipped away is not an error.
+//*****************************************************************************
+bool image_blit(
+  const image_t *image,
+  int16_t x_center,
+  int16_t y_center,
+  uint8_t flags,
+  uint16_t fColor,
+  uint16_t bColor,
+  const uint16_t *palette
+);
+
+//*****************************************************************************
+// Paints screen row y of an image placed as image_blit would (same flags)
+// into span, a line buffer of count pixels starting at screen column x0.
+// Only opaque pixels are written: the set bits or foreground runs of 1bpp
+// formats in fColor, and palette indexes other than 0 of indexed formats.
+// The rest of span keeps what is already there, so sprites can be layered
+// over a background in RAM before the line goes to the LCD, see tilemap.h.
+//
+// Returns false if the image format is not supported.
+//*****************************************************************************
+bool image_compose_row(
+  const image_t *image,
+  int16_t x_center,
+  int16_t y_center,
+  uint8_t flags,
+  uint16_t fColor,
+  const uint16_t *palette,
+  int16_t y,
+  int16_t x0,
+  uint16_t count,
+  uint16_t *span
+);
+
+#endif
@@ -94,6 +94,51 @@
 bool io_expander_init(void);
 void io_expander_write_reg(uint8_t reg, uint8_t data);
 uint8_t io_expander_read_reg(uint8_t);
-uint8_t debounce_expander_fsm(uint8_t buttons_pressed);
+
+//*****************************************************************************
+// Coalesced access
+//
+// The driver keeps a shadow of the LED latch (OLATA), the buttons (GPIOB)
+// and the last interrupt flags and capture (INTFB, INTCAPB).  Setting the
+// LEDs only changes the shadow.  io_expander_tick, called from one periodic
+// interrupt, makes at most one transfer a tick.  It writes OLATA once no
+// matter how many times the LEDs changed since the last tick.  Otherwise it
+// reads GPIOB when asked to.  On the expander's INT, io_expander_irq reads
+// INTFB, INTCAPA and INTCAPB in one sequential transfer.
+//
+// io_expander_tick and io_expander_irq share I2C1 and must run at the same
+// interrupt priority.  None of the other calls touch the bus.
+//*****************************************************************************
+
+// Sets the LEDs on port A, written on the next tick.  Ends a flash.
+void io_expander_set_leds(uint8_t leds);
+
+// Sets the LEDs and turns them off again after ticks ticks
+void io_expander_flash_leds(uint8_t leds, uint16_t ticks);
+
+// The LEDs as last set
+uint8_t io_expander_leds(void);
+
+// Port B as last read, low is pressed
+uint8_t io_expander_buttons(void);
+
+//*****************************************************************************
+// The one transfer of this tick.  A pending LED change goes first.  If there
+// is none and sample_buttons is true, port B is read.
+//
+// Returns true if port B was read, see io_expander_buttons.
+//*****************************************************************************
+bool io_expander_tick(bool sample_buttons);
+
+//*****************************************************************************
+// Call on the INT, reads which port B pins interrupted and their capture.
+// Clears the INT.
+//
+// Returns false if the read failed.
+//*****************************************************************************
+bool io_expander_irq(uint8_t *intf, uint8_t *intcap);
+
+void enableLeds(void);
+void disableLeds(void);
 
 #endif
@@ -26,7 +26,8 @@
 #include <stdint.h>
 #include "driver_defines.h"
 #include "gpio_port.h"
-#include "I:\ECE353\ICE_and_Homeworks\Project\alphabet.h"
+#include "timers.h"
+#include "rgb565.h"
 
 typedef enum {
   LEFT = 0,
@@ -40,6 +41,14 @@ typedef enum {
 #define DELAY 100
 #define ROWS  320
 #define COLS  240
+
+// Memory Access Control (MADCTL) bits.  MX/MY reverse the column/page
+// address order, which lcd_set_mirror uses to flip images while they are
+// written.
+#define LCD_MADCTL_MY       0x80
+#define LCD_MADCTL_MX       0x40
+#define LCD_MADCTL_BGR      0x08
+#define LCD_MADCTL_DEFAULT  (LCD_MADCTL_MY | LCD_MADCTL_MX | LCD_MADCTL_BGR)
 #define ROW_COUNT  1
 
 #define ROUND_NONE    0
@@ -167,6 +176,12 @@ typedef enum {
 #define LCD_DATA_GPIO_BASE           GPIOB_BASE
 #define LCD_DATA_PORT                GPIOB
 
+// Tearing effect output of the ILI9341, pulses high during vertical blanking
+#define LCD_TE_PIN                   PD2
+#define LCD_TE_GPIO_BASE             GPIOD_BASE
+#define LCD_TE_PORT                  GPIOD
+#define LCD_TE_IRQn                  GPIOD_IRQn
+
 // ADD CODE
 #define LCD_CSX                     (*((volatile unsigned long *)0x40006040))
 #define LCD_DCX                     (*((volatile unsigned long *)0x40006080))
@@ -174,6 +189,9 @@ typedef enum {
 #define LCD_RDX                     (*((volatile unsigned long *)0x40006200))
 #define LCD_DATA                    (*((volatile unsigned long *)0x400053FC))
 
+// Extra GPIO accesses that hold RDX low during a read, see lcd_read_u8
+#define LCD_READ_STRETCH            16
+
 /*******************************************************************************
 * Function Name: lcd_write_data_u16
 ********************************************************************************
@@ -233,14 +251,15 @@ void lcd_draw_box(
 /*******************************************************************************
 * Function Name: lcd_draw_image
 ********************************************************************************
-* Summary: Prints an image centered at the coordinates set by x_start, y_start
+* Summary: Prints an image centered at the coordinates set by x_start, y_start.
+*          The image is clipped, see lcd_set_clip.
 * Returns:
 *  Nothing
 *******************************************************************************/
 void lcd_draw_image(
-  uint16_t x_start,                 // X coordinate starting address
+  int16_t x_start,                  // X coordinate of the image center
   uint16_t image_width_bits,        // image width
-  uint16_t y_start,                 // Y coordinate starting address
+  int16_t y_start,                  // Y coordinate of the image center
   uint16_t image_height_pixels,     // image height
   const uint8_t *image,             // bitmap of the image
   uint16_t fColor,                  // foreground color
@@ -289,11 +308,337 @@ void lcd_draw_box(
 
 
 void lcd_config_screen(void);
-void print_string_toLCD(char string[], 
-	uint16_t x_start, 
-	uint16_t y_start, 
-	uint16_t fColor, 
-	uint16_t bColor);
+
+/*******************************************************************************
+* Function Name: lcd_init_start
+********************************************************************************
+* Summary: Starts the controller initialization table.  The short reset wait
+*          is taken here, then the function returns as soon as the sequence
+*          reaches a long wait (the sleep out) so the caller can bring up
+*          other hardware in the meantime.  No other LCD function may be
+*          used until lcd_init_service returns true or lcd_init_finish
+*          returns.  lcd_config_gpio must be called first.
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_init_start(void);
+
+/*******************************************************************************
+* Function Name: lcd_init_service
+********************************************************************************
+* Summary: Sends every table entry whose wait has expired without blocking.
+* Returns:
+*  true once the whole table has been sent and its last wait has passed
+*******************************************************************************/
+bool lcd_init_service(void);
+
+/*******************************************************************************
+* Function Name: lcd_init_finish
+********************************************************************************
+* Summary: Blocks until the initialization table is complete.
+* Returns:
+*  The number of microseconds from lcd_init_start to completion
+*******************************************************************************/
+uint32_t lcd_init_finish(void);
+
+/*******************************************************************************
+* Function Name: lcd_write_run
+********************************************************************************
+* Summary: Writes count pixels of a single color to the active window in one
+*          chip select transaction.  lcd_set_pos must be called first.
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_write_run(uint16_t color, uint32_t count);
+
+/*******************************************************************************
+* Function Name: lcd_write_pixels
+********************************************************************************
+* Summary: Writes count RGB565 pixels to the active window in one chip select
+*          transaction, ex a line buffer composed in RAM.  lcd_set_pos must be
+*          called first.
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_write_pixels(const uint16_t *pixels, uint32_t count);
+
+/*******************************************************************************
+* Clipping
+*
+* lcd_fill_rect, lcd_draw_runs, lcd_draw_image, lcd_write_rect, lcd_draw_box
+* and everything built on them (fonts, images, shapes, widgets) only touch
+* pixels inside the clip rectangle, which starts out as the whole screen.
+* Draws that miss it return before any command is sent; draws that cross
+* its edge set a window on the visible part only and skip the hidden source
+* rows and columns.  Coordinates are signed so a sprite can hang off the
+* left or top of the screen.
+*******************************************************************************/
+typedef struct
+{
+  int16_t x0;                       // left column
+  int16_t y0;                       // top row
+  int16_t x1;                       // right column, inclusive
+  int16_t y1;                       // bottom row, inclusive
+} lcd_rect_t;
+
+/*******************************************************************************
+* Function Name: lcd_set_clip
+********************************************************************************
+* Summary: Limits drawing to x0,y0 .. x1,y1 inclusive, intersected with the
+*          screen.  lcd_clear_screen ignores the clip rectangle.
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_set_clip(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+/*******************************************************************************
+* Function Name: lcd_reset_clip
+********************************************************************************
+* Summary: Sets the clip rectangle back to the whole screen
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_reset_clip(void);
+
+/*******************************************************************************
+* Function Name: lcd_get_clip
+********************************************************************************
+* Summary: Returns the current clip rectangle, ex to restore it after a
+*          temporary lcd_set_clip
+* Returns:
+*  The clip rectangle
+*******************************************************************************/
+lcd_rect_t lcd_get_clip(void);
+
+/*******************************************************************************
+* Function Name: lcd_clip
+********************************************************************************
+* Summary: Shrinks rect to the part of it inside the clip rectangle
+* Returns:
+*  false if nothing of rect is visible, rect is then left unchanged
+*******************************************************************************/
+bool lcd_clip(lcd_rect_t *rect);
+
+/*******************************************************************************
+* Clipped pixel streams
+*
+* Decoders that produce a window's pixels in row major order, ex RLE images,
+* can feed them through lcd_clip_stream_run instead of lcd_write_run.  Only
+* the pixels in the visible columns and rows are sent, so the LCD window is
+* set to the visible part and the decoder does not need to know about
+* clipping.
+*******************************************************************************/
+typedef struct
+{
+  uint16_t width;                   // width of the whole, unclipped window
+  uint16_t col0;                    // first visible column of the window
+  uint16_t col1;                    // last visible column
+  uint16_t row0;                    // first visible row
+  uint16_t row1;                    // last visible row
+  uint16_t col;                     // stream position
+  uint16_t row;
+} lcd_clip_stream_t;
+
+/*******************************************************************************
+* Function Name: lcd_clip_stream_run
+********************************************************************************
+* Summary: Advances the stream by count pixels of color, writing the visible
+*          ones to the active window.
+* Returns:
+*  false once the stream is past its last visible row, the caller can stop
+*******************************************************************************/
+bool lcd_clip_stream_run(lcd_clip_stream_t *stream, uint16_t color, uint32_t count);
+
+/*******************************************************************************
+* Function Name: lcd_fill_rect
+********************************************************************************
+* Summary: Fills a width x height rectangle whose upper left corner is x0,y0
+*          with a single color
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_fill_rect(
+  int16_t x0,                       // X coordinate of the upper left corner
+  int16_t y0,                       // Y coordinate of the upper left corner
+  uint16_t width,                   // width in pixels
+  uint16_t height,                  // height in pixels
+  uint16_t color                    // fill color
+);
+
+/*******************************************************************************
+* Function Name: lcd_draw_runs
+********************************************************************************
+* Summary: Fills a width x height window whose upper left corner is x0,y0 from
+*          a list of run lengths.  Runs alternate between bColor and fColor,
+*          starting with bColor, and cover the window in row major order.
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_draw_runs(
+  int16_t x0,                       // X coordinate of the upper left corner
+  int16_t y0,                       // Y coordinate of the upper left corner
+  uint16_t width,                   // window width in pixels
+  uint16_t height,                  // window height in pixels
+  const uint8_t *runs,              // run lengths
+  uint16_t run_count,               // number of entries in runs
+  uint16_t fColor,                  // foreground color
+  uint16_t bColor                   // background color
+);
+
+/*******************************************************************************
+* Function Name: lcd_write_indexed
+********************************************************************************
+* Summary: Writes count pixels to the active window from packed 2, 4 or 8 bit
+*          palette indexes (MSB first), looking each one up in palette.  The
+*          first skip pixels of indexes are passed over, so a clipped row can
+*          start mid byte.  Each pixel is repeated scale times for horizontal
+*          scaling.  All pixels go out in one chip select transaction.
+*          lcd_set_pos must be called first.
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_write_indexed(
+  const uint8_t *indexes,           // packed indexes, first pixel in the MSBs
+  uint8_t bpp,                      // 2, 4 or 8
+  uint32_t skip,                    // pixels to pass over before the first one
+  uint32_t count,                   // number of pixels
+  const uint16_t *palette,          // RGB565 colors
+  uint8_t scale                     // times each pixel is written, 1 to 3
+);
+
+/*******************************************************************************
+* Function Name: lcd_set_mirror
+********************************************************************************
+* Summary: Reverses the column (mirror_x) and/or page (mirror_y) address order.
+*          While mirrored, a window must be given in mirrored coordinates,
+*          x' = COLS - 1 - x and y' = ROWS - 1 - y.  Pixels are then written
+*          right to left and/or bottom to top on the panel.  Call with both
+*          false to go back to normal addressing.
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_set_mirror(bool mirror_x, bool mirror_y);
+
+/*******************************************************************************
+* Hardware vertical scrolling
+*
+* The screen is split into a top fixed area, a scrolling area and a bottom
+* fixed area.  Scrolling moves what the panel shows without touching GRAM,
+* so only the band of rows that scrolls into view has to be drawn.
+*
+* All coordinates are the usual logical ones.  With the default MADCTL (MY
+* set) GRAM lines run bottom to top, so the controller's top fixed area is
+* the logical bottom one; lcd.c does that translation.
+*
+* While the scroll offset is not 0, GRAM row y is not shown at screen row y.
+* lcd_scroll_row gives the GRAM row currently shown at a screen row, which
+* is where anything meant to appear on that screen row must be drawn.
+*******************************************************************************/
+typedef void (*lcd_scroll_repaint_t)(
+  uint16_t screen_y,                // first screen row of the band
+  uint16_t y,                       // GRAM row to draw the band at
+  uint16_t height                   // rows in the band
+);
+
+/*******************************************************************************
+* Function Name: lcd_scroll_define
+********************************************************************************
+* Summary: Sets the fixed areas (VSCRDEF) and resets the scroll offset.  The
+*          scrolling area is the rows in between.
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_scroll_define(uint16_t top_fixed, uint16_t bottom_fixed);
+
+/*******************************************************************************
+* Function Name: lcd_scroll
+********************************************************************************
+* Summary: Scrolls the scrolling area's content up by lines (down if
+*          negative) with VSCRSADD.  repaint, if not NULL, is called for the
+*          band that scrolled into view, once or twice if the band wraps
+*          around the end of the scrolling area in GRAM.
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_scroll(int16_t lines, lcd_scroll_repaint_t repaint);
+
+/*******************************************************************************
+* Function Name: lcd_scroll_row
+********************************************************************************
+* Summary: Returns the GRAM row currently shown at screen row screen_y.  Rows
+*          in the fixed areas are returned unchanged.
+* Returns:
+*  GRAM row
+*******************************************************************************/
+uint16_t lcd_scroll_row(uint16_t screen_y);
+
+/*******************************************************************************
+* GRAM read back
+*
+* Pixels are read with Memory Read, with the data bus switched to input for
+* the transfer.  Reading is several times slower than writing, so it suits
+* saving a sprite's background or taking a screenshot, not every frame.
+*******************************************************************************/
+typedef void (*lcd_row_sink_t)(
+  uint16_t y,                       // screen row
+  const uint16_t *pixels,           // RGB565, left to right
+  uint16_t count                    // pixels in the row
+);
+
+/*******************************************************************************
+* Function Name: lcd_read_rect
+********************************************************************************
+* Summary: Reads a width x height rectangle whose upper left corner is x0,y0
+*          into pixels (RGB565, row major).  pixels must hold width * height
+*          entries.
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_read_rect(
+  uint16_t x0,                      // X coordinate of the upper left corner
+  uint16_t y0,                      // Y coordinate of the upper left corner
+  uint16_t width,                   // width in pixels
+  uint16_t height,                  // height in pixels
+  uint16_t *pixels                  // destination
+);
+
+/*******************************************************************************
+* Function Name: lcd_write_rect
+********************************************************************************
+* Summary: Writes a width x height rectangle of RGB565 pixels, ex to restore a
+*          region saved with lcd_read_rect.
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_write_rect(
+  int16_t x0,                       // X coordinate of the upper left corner
+  int16_t y0,                       // Y coordinate of the upper left corner
+  uint16_t width,                   // width in pixels
+  uint16_t height,                  // height in pixels
+  const uint16_t *pixels            // source, row major
+);
+
+/*******************************************************************************
+* Function Name: lcd_screenshot
+********************************************************************************
+* Summary: Reads the whole screen as shown, one row at a time, and passes each
+*          row to sink.  Only one row is buffered, so it runs without a frame
+*          buffer; sink can send rows out over the UART.
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_screenshot(lcd_row_sink_t sink);
+
+/*******************************************************************************
+* Function Name: lcd_te_enable
+********************************************************************************
+* Summary: Turns the tearing effect output on (V-blank pulses only) and sets
+*          LCD_TE_PIN up as a rising edge interrupt, or turns the output off.
+*          The NVIC is left to the caller.
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_te_enable(bool enable);
 
 #endif
 
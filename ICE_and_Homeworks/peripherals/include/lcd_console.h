@@ -0,0 +1,64 @@
+#ifndef __LCD_CONSOLE_H__
+#define __LCD_CONSOLE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "lcd.h"
+#include "fonts.h"
+
+#define LCD_CONSOLE_MAX_COLS      40
+#define LCD_CONSOLE_MAX_ROWS      32
+#define LCD_CONSOLE_BUFFER_SIZE   512
+
+// Once lcd_console_init has run, fprintf(LCD_CONSOLE, ...) writes to the
+// console only, through serial_debug's fputc.  Setting
+// lcd_console_stdout also copies everything printf sends to the UART.
+extern FILE *LCD_CONSOLE;
+extern bool lcd_console_stdout;
+
+//*****************************************************************************
+// Turns a band of the screen into a text console.  The band starts at screen
+// row top and holds rows lines of text in font; it becomes the hardware
+// scrolling area, so a new line costs one scroll command plus one line of
+// glyphs.  Every glyph gets a cell as wide as the font's widest advance.
+//
+// The console takes over lcd_scroll_define, anything drawn in the band by
+// other code scrolls with it.
+//
+// Returns false if the font is not registered or the band does not fit.
+//*****************************************************************************
+bool lcd_console_init(
+  uint8_t font,
+  uint16_t top,
+  uint8_t rows,
+  uint16_t fColor,
+  uint16_t bColor
+);
+
+//*****************************************************************************
+// Queues one character.  Nothing is drawn until lcd_console_service or
+// lcd_console_flush runs, unless the queue is full.  Understands '\n',
+// '\r', '\b', '\t' and '\f' (clear).
+//*****************************************************************************
+void lcd_console_putc(char c);
+
+//*****************************************************************************
+// Draws at most budget queued characters so logging never holds up the main
+// loop for long.  Call once per pass of the main loop.
+//
+// Returns the number of characters still queued.
+//*****************************************************************************
+uint16_t lcd_console_service(uint16_t budget);
+
+//*****************************************************************************
+// Draws everything that is queued.
+//*****************************************************************************
+void lcd_console_flush(void);
+
+//*****************************************************************************
+// Changes the colors of text written from now on.
+//*****************************************************************************
+void lcd_console_set_colors(uint16_t fColor, uint16_t bColor);
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef __LCD_EFFECTS_H__
+#define __LCD_EFFECTS_H__
+
+#include <stdint.h>
+#include "lcd.h"
+#include "rgb565.h"
+
+//*****************************************************************************
+// Effects that work on what is already on the screen through the GRAM read
+// back, with the rgb565.c kernels.  Kept out of lcd.c so projects that only
+// draw do not need rgb565.c.
+//*****************************************************************************
+
+/*******************************************************************************
+* Function Name: lcd_tint_rect
+********************************************************************************
+* Summary: Blends color over what is already on the screen inside the
+*          rectangle, alpha 0..RGB565_ALPHA_MAX, ex a translucent HUD panel or
+*          one step of a fade.  Runs a row at a time through a read back, so
+*          it costs about as much as a lcd_read_rect of the same area.  The
+*          rectangle is clipped, see lcd_set_clip.
+* Returns:
+*  Nothing
+*******************************************************************************/
+void lcd_tint_rect(
+  int16_t x0,                       // X coordinate of the upper left corner
+  int16_t y0,                       // Y coordinate of the upper left corner
+  uint16_t width,                   // width in pixels
+  uint16_t height,                  // height in pixels
+  uint16_t color,                   // color blended in
+  uint8_t alpha                     // how much of color shows
+);
+
+#endif
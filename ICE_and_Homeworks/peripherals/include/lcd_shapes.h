@@ -0,0 +1,81 @@
+#ifndef __LCD_SHAPES_H__
+#define __LCD_SHAPES_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lcd.h"
+
+// most corners lcd_fill_polygon accepts
+#define LCD_POLYGON_MAX_POINTS    16
+
+typedef struct
+{
+  int16_t x;
+  int16_t y;
+} lcd_point_t;
+
+//*****************************************************************************
+// Every shape below is rasterized into horizontal or vertical spans, and each
+// span is sent as one windowed burst fill.  The cost of a shape follows the
+// number of spans it covers, not the number of pixels.  Coordinates are
+// signed so shapes may hang off the screen; spans are clipped to the clip
+// rectangle, see lcd_set_clip.
+//*****************************************************************************
+
+//*****************************************************************************
+// Fills x0..x1 on row y, or rows y0..y1 on column x.  The end points may be
+// given in either order.
+//*****************************************************************************
+void lcd_hline(int16_t x0, int16_t x1, int16_t y, uint16_t color);
+void lcd_vline(int16_t x, int16_t y0, int16_t y1, uint16_t color);
+
+//*****************************************************************************
+// Bresenham line from x0,y0 to x1,y1 inclusive.  Pixels that land on the same
+// row (or column for steep lines) are merged into one span.
+//*****************************************************************************
+void lcd_draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+//*****************************************************************************
+// Midpoint circle of radius r centered on xc,yc.  The outline is drawn as
+// runs along the flat parts of each octant.
+//*****************************************************************************
+void lcd_draw_circle(int16_t xc, int16_t yc, int16_t r, uint16_t color);
+void lcd_fill_circle(int16_t xc, int16_t yc, int16_t r, uint16_t color);
+
+//*****************************************************************************
+// Filled triangle, one span per row.
+//*****************************************************************************
+void lcd_fill_triangle(
+  int16_t x0, int16_t y0,
+  int16_t x1, int16_t y1,
+  int16_t x2, int16_t y2,
+  uint16_t color
+);
+
+//*****************************************************************************
+// Polygon through count points, closed back to the first point.  The fill
+// uses the even-odd rule so concave and self-crossing polygons work.
+//
+// lcd_fill_polygon returns false if count is outside 3..LCD_POLYGON_MAX_POINTS.
+//*****************************************************************************
+void lcd_draw_polygon(const lcd_point_t *points, uint8_t count, uint16_t color);
+bool lcd_fill_polygon(const lcd_point_t *points, uint8_t count, uint16_t color);
+
+//*****************************************************************************
+// Rectangle of width x height whose upper left corner is x,y, with corners
+// rounded to radius r.  r is reduced to fit if the rectangle is too small.
+//*****************************************************************************
+void lcd_draw_round_rect(
+  int16_t x, int16_t y,
+  int16_t width, int16_t height,
+  int16_t r,
+  uint16_t color
+);
+void lcd_fill_round_rect(
+  int16_t x, int16_t y,
+  int16_t width, int16_t height,
+  int16_t r,
+  uint16_t color
+);
+
+#endif
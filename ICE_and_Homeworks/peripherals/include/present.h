@@ -0,0 +1,38 @@
+#ifndef __PRESENT_H__
+#define __PRESENT_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lcd.h"
+
+// frame period without TE, about the panel's 61Hz refresh
+#define PRESENT_REFRESH_MS      16
+
+extern volatile uint32_t present_te_count;
+
+//*****************************************************************************
+// Turns on the LCD's tearing effect output and its interrupt.  A frame is
+// presented every interval panel refreshes, ex 1 for the full 61Hz, 2 for
+// 30Hz.  An interval of 0 leaves the output off, for boards where TE is not
+// wired, and paces frames with the timebase instead, one every
+// PRESENT_REFRESH_MS.  If no TE pulse comes for PRESENT_TE_TIMEOUT_MS,
+// present_frame_due falls back to the timebase as well, at interval times
+// PRESENT_REFRESH_MS.
+//*****************************************************************************
+void present_init(uint8_t interval, uint8_t priority);
+
+//*****************************************************************************
+// Changes how many panel refreshes there are per presented frame.
+//*****************************************************************************
+void present_set_interval(uint8_t interval);
+
+//*****************************************************************************
+// Returns true once interval refreshes have passed since the last frame,
+// and starts the next frame.  A render loop that only draws when this
+// returns true is locked to the panel and starts every frame right at the
+// beginning of vertical blanking.  Without TE the frame rate is the same,
+// but not in step with the panel.
+//*****************************************************************************
+bool present_frame_due(void);
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef __RGB565_H__
+#define __RGB565_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// alpha and brightness levels run 0..RGB565_ALPHA_MAX, RGB565_ALPHA_MAX is
+// all foreground (or full brightness)
+#define RGB565_ALPHA_MAX      32
+
+// Packs 8 bit channels into RGB565, dropping the low bits
+#define RGB565(r, g, b)       ((uint16_t)((((r) & 0xF8) << 8) | (((g) & 0xFC) << 3) | (((b) & 0xFF) >> 3)))
+
+// Same for a 0xRRGGBB constant
+#define RGB565_FROM_RGB888(rgb)   RGB565(((rgb) >> 16) & 0xFF, ((rgb) >> 8) & 0xFF, (rgb) & 0xFF)
+
+//*****************************************************************************
+// RGB565 pixel math
+//
+// The kernels work on the three channels of a pixel at once.  A pixel is
+// spread into a 32 bit word as 0b00000GGGGGG00000RRRRR000000BBBBB, leaving at
+// least five empty bits above every channel.  A channel times an alpha of at
+// most 32 fits in its field plus the gap, so one multiply blends all three
+// channels, and the shift and mask that follow cut the fields back out.
+//
+// The buffer kernels run two pixels per loop, loading and storing both as
+// one 32 bit word when the buffers are word aligned.  Every kernel matches
+// the per channel result (fg * alpha + bg * (32 - alpha)) / 32 rounded down.
+//
+// src and dst may be the same buffer.
+//*****************************************************************************
+
+//*****************************************************************************
+// fg over bg.  alpha 0 gives bg, RGB565_ALPHA_MAX gives fg.
+//*****************************************************************************
+uint16_t rgb565_blend(uint16_t fg, uint16_t bg, uint8_t alpha);
+
+//*****************************************************************************
+// Each channel times level / 32.  level 0 is black, RGB565_ALPHA_MAX leaves
+// the pixel as it was.
+//*****************************************************************************
+uint16_t rgb565_scale(uint16_t color, uint8_t level);
+
+//*****************************************************************************
+// dst[i] = blend of fg[i] over dst[i]
+//*****************************************************************************
+void rgb565_blend_buf(uint16_t *dst, const uint16_t *fg, uint32_t count, uint8_t alpha);
+
+//*****************************************************************************
+// dst[i] = blend of color over src[i], ex a fade to black or a tinted
+// overlay.  alpha is how much of color shows.
+//*****************************************************************************
+void rgb565_fade_buf(
+  uint16_t *dst,
+  const uint16_t *src,
+  uint32_t count,
+  uint16_t color,
+  uint8_t alpha
+);
+
+//*****************************************************************************
+// dst[i] = src[i] scaled by level / 32
+//*****************************************************************************
+void rgb565_scale_buf(uint16_t *dst, const uint16_t *src, uint32_t count, uint8_t level);
+
+//*****************************************************************************
+// Converts count pixels of packed R, G, B bytes to RGB565
+//*****************************************************************************
+void rgb888_to_565_buf(uint16_t *dst, const uint8_t *rgb, uint32_t count);
+
+#endif
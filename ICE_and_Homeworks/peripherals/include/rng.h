@@ -0,0 +1,47 @@
+#ifndef __RNG_H__
+#define __RNG_H__
+
+#include <stdint.h>
+
+//*****************************************************************************
+// Seedable pseudo random numbers, xorshift32
+//
+// Three shifts and three XORs a number, no divide, and the whole state is
+// one word, so each user keeps its own generator and a seed always gives
+// the same sequence on the board and on a host.  Not for anything that has
+// to be hard to guess.
+//*****************************************************************************
+typedef struct
+{
+  uint32_t  state;                    // never 0
+} rng_t;
+
+//*****************************************************************************
+// Starts the sequence for seed.  Any seed is fine, 0 included.
+//*****************************************************************************
+void rng_seed(rng_t *rng, uint32_t seed);
+
+//*****************************************************************************
+// Next 32 bit number
+//*****************************************************************************
+static __inline uint32_t rng_next(rng_t *rng)
+{
+  uint32_t x = rng->state;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  rng->state = x;
+  return x;
+}
+
+//*****************************************************************************
+// Next number in 0 .. n - 1.  The top 32 bits of next * n, one multiply
+// instead of a modulo.
+//*****************************************************************************
+static __inline uint32_t rng_below(rng_t *rng, uint32_t n)
+{
+  return (uint32_t)(((uint64_t)rng_next(rng) * n) >> 32);
+}
+
+#endif
@@ -34,7 +34,8 @@ enum
     STDOUT_HANDLE,
     STDERR_HANDLE,
     DEBUG_HANDLE,
-    BLUETOOTH_HANDLE
+    BLUETOOTH_HANDLE,
+    LCD_CONSOLE_HANDLE
 } ;
 
 extern FILE *SERIAL_DEBUG;
@@ -78,4 +79,21 @@ int serial_debug_rx(PC_Buffer *rx_buffer, bool block);
  ****************************************************************************/
 void serial_debug_tx(uint32_t uart_base, PC_Buffer *tx_buffer, int data);
 
+//****************************************************************************
+// A second place fputc sends characters to, such as the LCD console, which
+// installs itself.  The hook sees each character with its stream first and
+// returns true if it took the character for itself, keeping it off the UART.
+//****************************************************************************
+typedef bool (*serial_debug_hook_t)(int c, FILE *stream);
+
+void serial_debug_set_hook(serial_debug_hook_t hook);
+
+//****************************************************************************
+// Starts streaming the screen out the serial debug UART, see capture.h.
+// Text still goes out between packets.  Needs the TX interrupt enabled
+// through init_serial_debug, and LCD_CAPTURE defined as 1 for the project,
+// without it this does nothing.
+//****************************************************************************
+void serial_debug_capture_start(void);
+
 #endif
@@ -0,0 +1,103 @@
+#ifndef __TILEMAP_H__
+#define __TILEMAP_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lcd.h"
+#include "image.h"
+#include "display_list.h"
+
+// most sprites one tilemap_draw composes
+#define TILEMAP_MAX_SPRITES   8
+
+//*****************************************************************************
+// Tile map backgrounds
+//
+// A tileset is an indexed image_t holding square tiles stacked top to
+// bottom, so tools/imgconv builds it from a strip of art, ex
+//    imgconv -f i4 -n ocean_tiles bmp/ocean_tiles.bmp > ocean_tiles.c
+// A map is a row major array of tile numbers.  The map repeats in both
+// directions, so a small map can cover the whole screen.
+//
+// Nothing is kept in RAM but one line buffer.  The background under any
+// rectangle is regenerated from the map a row at a time, sprites are
+// layered over the row (see image_compose_row), and the row is streamed to
+// a single LCD window.  Redrawing a rectangle over a tile map sends the same
+// number of pixels as filling it with a solid color.
+//*****************************************************************************
+
+typedef struct
+{
+  const image_t   *image;           // 2, 4 or 8 bpp, tile_size pixels wide
+  uint8_t         tile_size;        // 8 or 16
+} tileset_t;
+
+typedef struct
+{
+  const tileset_t *tileset;
+  uint16_t        columns;          // map size in tiles
+  uint16_t        rows;
+  const uint8_t   *cells;           // columns * rows tile numbers, row major
+  int16_t         x0;               // screen position of the upper left tile
+  int16_t         y0;
+} tilemap_t;
+
+// A sprite layered over the background, placed as image_blit would
+typedef struct
+{
+  const image_t   *image;
+  int16_t         x_center;
+  int16_t         y_center;
+  uint8_t         flags;            // image_blit flags
+  uint16_t        fColor;           // 1bpp formats
+  const uint16_t  *palette;         // indexed formats, NULL for the image's own
+} tilemap_sprite_t;
+
+//*****************************************************************************
+// Fills span with count background pixels of screen row y, starting at
+// screen column x0.
+//*****************************************************************************
+void tilemap_render_span(
+  const tilemap_t *map,
+  int16_t x0,
+  int16_t y,
+  uint16_t count,
+  uint16_t *span
+);
+
+//*****************************************************************************
+// Redraws the rectangle x0,y0 .. x1,y1 (inclusive) as the background with
+// count sprites on top, later sprites over earlier ones.  Sprites may reach
+// outside the rectangle, only the part inside is drawn.  The rectangle is
+// clipped, see lcd_set_clip.
+//*****************************************************************************
+void tilemap_draw(
+  const tilemap_t *map,
+  int16_t x0,
+  int16_t y0,
+  int16_t x1,
+  int16_t y1,
+  const tilemap_sprite_t *sprites,
+  uint8_t count
+);
+
+//*****************************************************************************
+// Repaints the background over a rectangle, the tile map version of
+// lcd_fill_rect.  It goes through the display list, see dl_draw, so inside a
+// frame it is culled and ordered with the other dl_ commands.  map must
+// stay valid until dl_end.
+//*****************************************************************************
+void tilemap_erase(
+  const tilemap_t *map,
+  int16_t x0,
+  int16_t y0,
+  uint16_t width,
+  uint16_t height
+);
+
+//*****************************************************************************
+// Screen rectangle a sprite covers
+//*****************************************************************************
+lcd_rect_t tilemap_sprite_bounds(const tilemap_sprite_t *sprite);
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef __WIDGETS_H__
+#define __WIDGETS_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lcd.h"
+#include "fonts.h"
+
+#define WIDGET_TEXT_LEN   24
+
+typedef enum
+{
+  WIDGET_BOX,           // border and fill only
+  WIDGET_LABEL,         // text set with widget_set_text
+  WIDGET_COUNTER,       // value printed through a printf style format
+  WIDGET_BAR            // horizontal bar filled in proportion to value/max
+} widget_type_t;
+
+// A retained mode HUD element.  The widget remembers what it last put on
+// the screen so widget_update only touches the pixels that changed.  Every
+// widget owns its bounds: the border is drawn inside them and the content
+// inside the border.
+typedef struct
+{
+  widget_type_t   type;
+  uint16_t        x;
+  uint16_t        y;
+  uint16_t        width;
+  uint16_t        height;
+  uint16_t        fColor;           // text or bar color
+  uint16_t        bColor;           // fill color
+  uint16_t        border_color;
+  uint8_t         border_width;
+  uint8_t         font;             // font id for labels and counters
+  const char      *format;          // counter format, ex "%d bullets"
+  int32_t         value;
+  int32_t         max;              // bar full scale
+  bool            visible;
+  uint16_t        erase_color;      // painted over the bounds when hidden
+  char            text[WIDGET_TEXT_LEN];
+
+  // What is currently on the screen
+  bool            drawn;
+  bool            drawn_visible;
+  int32_t         drawn_value;
+  uint16_t        drawn_end;        // x following the last glyph drawn
+  char            drawn_text[WIDGET_TEXT_LEN];
+} widget_t;
+
+//*****************************************************************************
+// Initializes a widget.  Nothing is drawn until widget_update is called.
+//*****************************************************************************
+void widget_init(
+  widget_t *w,
+  widget_type_t type,
+  uint16_t x,
+  uint16_t y,
+  uint16_t width,
+  uint16_t height,
+  uint16_t fColor,
+  uint16_t bColor,
+  uint16_t border_color,
+  uint8_t border_width
+);
+
+//*****************************************************************************
+// Content setters.  They only record the new state; widget_update draws it.
+//*****************************************************************************
+void widget_set_text(widget_t *w, const char *text);
+void widget_set_value(widget_t *w, int32_t value);
+void widget_set_colors(widget_t *w, uint16_t fColor, uint16_t bColor);
+
+//*****************************************************************************
+// widget_hide paints the widget's bounds with erase_color on the next update
+// and stops drawing it until widget_show is called.
+//*****************************************************************************
+void widget_hide(widget_t *w, uint16_t erase_color);
+void widget_show(widget_t *w);
+
+//*****************************************************************************
+// Forces a full redraw on the next update.  Call after something else drew
+// over the widget, ex lcd_clear_screen.
+//*****************************************************************************
+void widget_invalidate(widget_t *w);
+
+//*****************************************************************************
+// Invalidates every widget in the list whose bounds intersect the rectangle.
+//*****************************************************************************
+void widget_damage(
+  widget_t *list,
+  uint8_t count,
+  uint16_t x0,
+  uint16_t y0,
+  uint16_t x1,
+  uint16_t y1
+);
+
+//*****************************************************************************
+// Brings the screen up to date with the widget's state.  Returns true if
+// anything was drawn.  It draws through the display list, so between
+// dl_begin and dl_end a full redraw costs no more than its frame and text.
+//*****************************************************************************
+bool widget_update(widget_t *w);
+
+#endif
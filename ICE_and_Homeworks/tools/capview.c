@@ -0,0 +1,412 @@
+//*****************************************************************************
+// capview -- host tool that rebuilds the screen from the capture stream of
+// peripherals/c/capture.c and writes it out as PNG frames
+//
+// Build (any host C compiler):
+//    gcc -O2 -o capview capview.c
+//
+// Usage:
+//    capview [-o prefix] [-r fps] [capture.bin]
+//
+//    -o prefix    frames are written to prefix%05d.png (default "frame_")
+//    -r fps       write frames at a fixed rate from the frame time stamps,
+//                 repeating frames where nothing was drawn, so a video made
+//                 from them plays in real time.  By default every frame
+//                 packet writes one PNG.
+//
+// The stream is read from the file, or stdin if none is given, ex on Linux
+//    stty -F /dev/ttyACM0 115200 raw
+//    capview -r 30 < /dev/ttyACM0
+// Text the board prints between packets goes to stderr.  The frames make a
+// video with
+//    ffmpeg -framerate 30 -i frame_%05d.png capture.mp4
+//
+// The tool keeps its own copy of GRAM, in the LCD's unmirrored logical
+// coordinates, and applies each window, run and pixel packet to it the way
+// the controller would, honoring lcd_set_mirror.  The image written out is
+// what the panel shows, with the vertical scroll applied.
+//*****************************************************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define COLS            240
+#define ROWS            320
+#define SYNC            0xF5
+#define TICKS_PER_SEC   50000000.0
+
+static uint16_t gram[ROWS][COLS];
+
+// write window and cursor, logical coordinates
+static int win_x0;
+static int win_x1 = COLS - 1;
+static int win_y0;
+static int win_y1 = ROWS - 1;
+static int cur_x;
+static int cur_y;
+
+static int mirror_x;
+static int mirror_y;
+static int scroll_top;
+static int scroll_height = ROWS;
+static int scroll_offset;
+
+static const char *prefix = "frame_";
+static unsigned frames_written;
+static unsigned frames_damaged;
+
+//*****************************************************************************
+// Memory write, one pixel at the cursor, then the cursor moves on through
+// the window and wraps to its start like the controller's
+//*****************************************************************************
+static void put_pixel(uint16_t color)
+{
+  int x = mirror_x ? COLS - 1 - cur_x : cur_x;
+  int y = mirror_y ? ROWS - 1 - cur_y : cur_y;
+
+  if (x >= 0 && x < COLS && y >= 0 && y < ROWS)
+  {
+    gram[y][x] = color;
+  }
+
+  if (++cur_x > win_x1)
+  {
+    cur_x = win_x0;
+    if (++cur_y > win_y1)
+    {
+      cur_y = win_y0;
+    }
+  }
+}
+
+// GRAM row shown on screen row y, as lcd_scroll_row
+static int scroll_row(int y)
+{
+  if (y < scroll_top || y >= scroll_top + scroll_height)
+  {
+    return y;
+  }
+  return scroll_top + (y - scroll_top + scroll_offset) % scroll_height;
+}
+
+//*****************************************************************************
+// PNG output, 8 bit RGB.  The image data goes in stored (uncompressed)
+// deflate blocks, so no zlib is needed.
+//*****************************************************************************
+static uint32_t crc_table[256];
+
+static void crc_init(void)
+{
+  uint32_t c;
+  int n;
+  int k;
+
+  for (n = 0; n < 256; n++)
+  {
+    c = n;
+    for (k = 0; k < 8; k++)
+    {
+      c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+    }
+    crc_table[n] = c;
+  }
+}
+
+static uint32_t crc_update(uint32_t crc, const uint8_t *data, size_t length)
+{
+  while (length--)
+  {
+    crc = crc_table[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+  }
+  return crc;
+}
+
+static void put_be32(uint8_t *p, uint32_t v)
+{
+  p[0] = v >> 24;
+  p[1] = v >> 16;
+  p[2] = v >> 8;
+  p[3] = v;
+}
+
+static void write_chunk(FILE *f, const char *type, const uint8_t *data, uint32_t length)
+{
+  uint8_t word[4];
+  uint32_t crc;
+
+  put_be32(word, length);
+  fwrite(word, 1, 4, f);
+  fwrite(type, 1, 4, f);
+  fwrite(data, 1, length, f);
+  crc = crc_update(0xFFFFFFFF, (const uint8_t *)type, 4);
+  crc = crc_update(crc, data, length);
+  put_be32(word, crc ^ 0xFFFFFFFF);
+  fwrite(word, 1, 4, f);
+}
+
+static int write_png(const char *name)
+{
+  static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  static uint8_t raw[ROWS * (1 + 3 * COLS)];
+  static uint8_t zdata[sizeof(raw) + sizeof(raw) / 65535 * 5 + 5 + 6];
+  uint8_t header[13];
+  uint8_t *p = raw;
+  uint8_t *z = zdata;
+  uint32_t a = 1;
+  uint32_t b = 0;
+  size_t left;
+  size_t n;
+  size_t i;
+  uint16_t c;
+  int x;
+  int y;
+  FILE *f;
+
+  for (y = 0; y < ROWS; y++)
+  {
+    *p++ = 0;                           // filter: none
+    for (x = 0; x < COLS; x++)
+    {
+      c = gram[scroll_row(y)][x];
+      *p++ = ((c >> 11) << 3) | (c >> 13);
+      *p++ = (((c >> 5) & 0x3F) << 2) | ((c >> 9) & 0x3);
+      *p++ = ((c & 0x1F) << 3) | ((c >> 2) & 0x7);
+    }
+  }
+
+  // zlib header, stored blocks, adler32
+  *z++ = 0x78;
+  *z++ = 0x01;
+  for (i = 0, left = sizeof(raw); left != 0; i += n, left -= n)
+  {
+    n = left > 65535 ? 65535 : left;
+    *z++ = (left == n);
+    *z++ = n;
+    *z++ = n >> 8;
+    *z++ = ~n;
+    *z++ = ~n >> 8;
+    memcpy(z, raw + i, n);
+    z += n;
+  }
+  for (i = 0; i < sizeof(raw); i++)
+  {
+    a = (a + raw[i]) % 65521;
+    b = (b + a) % 65521;
+  }
+  put_be32(z, (b << 16) | a);
+  z += 4;
+
+  put_be32(header, COLS);
+  put_be32(header + 4, ROWS);
+  header[8] = 8;                        // bits per channel
+  header[9] = 2;                        // RGB
+  header[10] = 0;
+  header[11] = 0;
+  header[12] = 0;
+
+  f = fopen(name, "wb");
+  if (f == NULL)
+  {
+    perror(name);
+    return 0;
+  }
+  fwrite(signature, 1, sizeof(signature), f);
+  write_chunk(f, "IHDR", header, sizeof(header));
+  write_chunk(f, "IDAT", zdata, z - zdata);
+  write_chunk(f, "IEND", NULL, 0);
+  fclose(f);
+  return 1;
+}
+
+static void write_frame(void)
+{
+  char name[512];
+
+  snprintf(name, sizeof(name), "%s%05u.png", prefix, frames_written);
+  if (write_png(name))
+  {
+    frames_written++;
+  }
+}
+
+//*****************************************************************************
+// Packets
+//*****************************************************************************
+static uint16_t get_u16(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8);
+}
+
+static uint32_t get_u32(const uint8_t *p)
+{
+  return get_u16(p) | ((uint32_t)get_u16(p + 2) << 16);
+}
+
+// Applies one packet, returns 0 if it does not parse
+static int packet(uint8_t type, const uint8_t *data, int length, double fps)
+{
+  static int have_time;
+  static uint32_t last_ticks;
+  static double seconds;
+  uint32_t count;
+  uint32_t ticks;
+  int i;
+
+  switch (type)
+  {
+    case 'W':
+      if (length != 8)
+      {
+        return 0;
+      }
+      win_x0 = get_u16(data);
+      win_x1 = get_u16(data + 2);
+      win_y0 = get_u16(data + 4);
+      win_y1 = get_u16(data + 6);
+      cur_x = win_x0;
+      cur_y = win_y0;
+      return 1;
+
+    case 'R':
+      if (length != 6)
+      {
+        return 0;
+      }
+      for (count = get_u32(data + 2); count != 0; count--)
+      {
+        put_pixel(get_u16(data));
+      }
+      return 1;
+
+    case 'P':
+      if (length % 2 != 0)
+      {
+        return 0;
+      }
+      for (i = 0; i < length; i += 2)
+      {
+        put_pixel(get_u16(data + i));
+      }
+      return 1;
+
+    case 'M':
+      if (length != 2)
+      {
+        return 0;
+      }
+      mirror_x = data[0];
+      mirror_y = data[1];
+      return 1;
+
+    case 'S':
+      if (length != 6 || get_u16(data + 2) == 0)
+      {
+        return 0;
+      }
+      scroll_top = get_u16(data);
+      scroll_height = get_u16(data + 2);
+      scroll_offset = get_u16(data + 4);
+      return 1;
+
+    case 'F':
+      if (length != 9)
+      {
+        return 0;
+      }
+      frames_damaged += data[8] & 1;
+      if (fps <= 0)
+      {
+        write_frame();
+        return 1;
+      }
+
+      // The time stamp wraps every 85 seconds, frames are far closer
+      ticks = get_u32(data + 4);
+      if (have_time)
+      {
+        seconds += (uint32_t)(ticks - last_ticks) / TICKS_PER_SEC;
+      }
+      have_time = 1;
+      last_ticks = ticks;
+      while (frames_written <= seconds * fps)
+      {
+        write_frame();
+      }
+      return 1;
+
+    default:
+      return 0;
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  static uint8_t data[256];
+  FILE *in = stdin;
+  double fps = 0;
+  unsigned packets = 0;
+  unsigned text = 0;
+  int c;
+  int type;
+  int length;
+  int i;
+
+  for (i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+    {
+      prefix = argv[++i];
+    }
+    else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+    {
+      fps = atof(argv[++i]);
+    }
+    else if (argv[i][0] == '-')
+    {
+      fprintf(stderr, "usage: capview [-o prefix] [-r fps] [capture.bin]\n");
+      return 1;
+    }
+    else
+    {
+      in = fopen(argv[i], "rb");
+      if (in == NULL)
+      {
+        perror(argv[i]);
+        return 1;
+      }
+    }
+  }
+
+  crc_init();
+
+  while ((c = fgetc(in)) != EOF)
+  {
+    if (c != SYNC)
+    {
+      fputc(c, stderr);
+      text++;
+      continue;
+    }
+
+    type = fgetc(in);
+    length = fgetc(in);
+    if (type == EOF || length == EOF || fread(data, 1, length, in) != (size_t)length)
+    {
+      break;
+    }
+    if (packet(type, data, length, fps))
+    {
+      packets++;
+    }
+    else
+    {
+      // Corrupt, its bytes are skipped and the next packet starts clean
+      fprintf(stderr, "\ncapview: bad packet '%c' length %d\n", type, length);
+    }
+  }
+
+  fprintf(stderr, "\ncapview: %u packets, %u text bytes, %u frames written, %u damaged\n",
+          packets, text, frames_written, frames_damaged);
+  return 0;
+}
@@ -0,0 +1,681 @@
+//*****************************************************************************
+// cliptest -- host check of the clipped draw primitives in lcd.c and image.c
+// and of the tile map renderer in tilemap.c
+//
+// Build (Linux, gcc), from the tools directory, all one command:
+//    gcc -O2 -DLCD_CAPTURE=1 -Ihost -I../peripherals/include -I../drivers/include
+//        -o cliptest cliptest.c host/registers.c
+//        ../peripherals/c/lcd.c ../peripherals/c/image.c ../peripherals/c/rgb565.c
+//        ../peripherals/c/tilemap.c ../peripherals/c/display_list.c
+//        ../drivers/c/gpio_port.c ../drivers/c/timers.c
+//
+// Usage:
+//    cliptest [-s seed]
+//
+// Random images, placements and clip rectangles are drawn through
+//
+//    image_blit      every format, flip and scale, 300 of each
+//    lcd_draw_image  lcd_draw_runs  lcd_write_rect  lcd_fill_rect
+//                    900 of each
+//
+// 21600 draws in all, about a third of them hanging off the screen or the
+// clip rectangle, a few entirely outside it.  Each image is made from a
+// random index bitmap, and every pixel that lands in the clip rectangle is
+// checked against that bitmap decoded directly, flipped and scaled.
+//
+// Then 600 tilemap_draw rectangles over random tilesets (2, 4 and 8 bpp,
+// 8 and 16 pixel tiles) and maps, each with up to TILEMAP_MAX_SPRITES
+// random sprites of any format, flip and scale.  The reference is the map
+// looked up tile by tile for every pixel, with the opaque pixels of each
+// sprite over it in order.
+//
+// The panel is modeled as in gamesim, through the driver's capture hooks,
+// and every draw must send exactly the visible pixels and nothing outside
+// them.
+//
+// Prints the failures and exits 1 if there were any.
+//*****************************************************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "lcd.h"
+#include "image.h"
+#include "tilemap.h"
+#include "capture.h"
+
+#define DRAWS           300         // image_blit draws per format, flip and scale
+#define PRIMITIVE_DRAWS 900         // draws of each lcd.c primitive
+#define TILEMAP_DRAWS   600
+#define SIZE_MAX_PIXELS 40          // largest random source width and height
+#define SOURCE_MAX      64          // largest source, ex a tileset
+#define MAP_MAX         6           // largest map width and height in tiles
+#define SENTINEL        0x0821      // color no draw uses
+
+//*****************************************************************************
+// Panel model, fed by the LCD driver's capture hooks
+//*****************************************************************************
+bool capture_enabled = true;
+uint16_t capture_run_color;
+uint32_t capture_run_length = 0;
+
+static uint16_t gram[ROWS][COLS];
+
+static int win_x0;
+static int win_x1 = COLS - 1;
+static int win_y0;
+static int win_y1 = ROWS - 1;
+static int cur_x;
+static int cur_y;
+static bool mirror_x;
+static bool mirror_y;
+
+static lcd_rect_t visible;          // where the draw may write
+static bool visible_empty;
+static uint32_t pixels_sent;
+static uint32_t pixels_outside;
+
+static void put_pixels(uint16_t color, uint32_t count)
+{
+  int x;
+  int y;
+
+  pixels_sent += count;
+  while(count--)
+  {
+    x = mirror_x ? COLS - 1 - cur_x : cur_x;
+    y = mirror_y ? ROWS - 1 - cur_y : cur_y;
+    if(visible_empty || x < visible.x0 || x > visible.x1 || y < visible.y0 || y > visible.y1)
+    {
+      pixels_outside++;
+    }
+    else
+    {
+      gram[y][x] = color;
+    }
+    if(++cur_x > win_x1)
+    {
+      cur_x = win_x0;
+      if(++cur_y > win_y1)
+      {
+        cur_y = win_y0;
+      }
+    }
+  }
+}
+
+static void end_run(void)
+{
+  put_pixels(capture_run_color, capture_run_length);
+  capture_run_length = 0;
+}
+
+void capture_window(uint16_t x0, uint16_t x1, uint16_t y0, uint16_t y1)
+{
+  end_run();
+  win_x0 = x0;
+  win_x1 = x1;
+  win_y0 = y0;
+  win_y1 = y1;
+  cur_x = x0;
+  cur_y = y0;
+}
+
+void capture_run(uint16_t color, uint32_t count)
+{
+  if(color != capture_run_color)
+  {
+    end_run();
+    capture_run_color = color;
+  }
+  capture_run_length += count;
+}
+
+void capture_color_change(uint16_t color)
+{
+  end_run();
+  capture_run_color = color;
+  capture_run_length = 1;
+}
+
+void capture_mirror(bool x, bool y)
+{
+  end_run();
+  mirror_x = x;
+  mirror_y = y;
+}
+
+void capture_scroll(uint16_t top, uint16_t height, uint16_t offset)
+{
+  (void)top;
+  (void)height;
+  (void)offset;
+}
+
+//*****************************************************************************
+// Test images.  Every format is encoded from the same kind of index bitmap,
+// which is also what the drawn pixels are checked against.
+//*****************************************************************************
+typedef struct
+{
+  uint16_t  width;
+  uint16_t  height;
+  uint8_t   bpp;
+  uint8_t   index[SOURCE_MAX][SOURCE_MAX];
+  uint16_t  palette[256];
+  uint16_t  fColor;
+  uint16_t  bColor;
+  uint8_t   data[SOURCE_MAX * SOURCE_MAX * 2];
+  uint8_t   runs[SOURCE_MAX * SOURCE_MAX * 2];
+  uint16_t  run_count;
+  uint16_t  pixels[SOURCE_MAX * SOURCE_MAX];
+  image_t   image;
+} source_t;
+
+static source_t source;
+static uint32_t failures = 0;
+static uint32_t draws = 0;
+
+// The draw being checked, for the reference pixels
+static const source_t *drawn;
+static int16_t drawn_x0;
+static int16_t drawn_y0;
+static uint8_t drawn_flags;
+
+static uint16_t random_color(void)
+{
+  uint16_t color = rand() & 0xFFFF;
+
+  return (color == SENTINEL) ? color ^ 1 : color;
+}
+
+static int random_between(int low, int high)
+{
+  return low + rand() % (high - low + 1);
+}
+
+// Same LEB128 varint as tools/imgconv
+static uint32_t put_varint(uint8_t *p, uint32_t value)
+{
+  uint32_t n = 0;
+
+  do
+  {
+    p[n] = value & 0x7F;
+    value >>= 7;
+    if(value != 0)
+    {
+      p[n] |= 0x80;
+    }
+    n++;
+  } while(value != 0);
+  return n;
+}
+
+static void make_source(source_t *s, uint8_t format, uint16_t width, uint16_t height)
+{
+  static const uint8_t bpp[] = {1, 1, 2, 4, 8};
+  uint16_t bytes_per_row;
+  uint32_t size = 0;
+  uint32_t run = 0;
+  uint8_t color = 0;
+  int x;
+  int y;
+  int i;
+
+  s->width = width;
+  s->height = height;
+  s->bpp = bpp[format];
+  s->fColor = random_color();
+  s->bColor = random_color();
+  for(i = 0; i < 256; i++)
+  {
+    s->palette[i] = random_color();
+  }
+
+  // Runs of the same index, so the run encodings get long runs as well
+  for(y = 0; y < s->height; y++)
+  {
+    for(x = 0; x < s->width; x++)
+    {
+      if(rand() % 4 == 0)
+      {
+        color = rand() & ((1 << s->bpp) - 1);
+      }
+      s->index[y][x] = color;
+      s->pixels[y * s->width + x] = s->palette[color];
+    }
+  }
+
+  // Packed rows padded to a byte, MSB first
+  bytes_per_row = (s->width * s->bpp + 7) / 8;
+  memset(s->data, 0, sizeof(s->data));
+  for(y = 0; y < s->height; y++)
+  {
+    for(x = 0; x < s->width; x++)
+    {
+      i = x * s->bpp;
+      s->data[y * bytes_per_row + i / 8] |= s->index[y][x] << (8 - s->bpp - i % 8);
+    }
+  }
+  size = bytes_per_row * s->height;
+
+  // Alternating background and foreground runs over the whole stream, as
+  // varints for IMAGE_1BPP_RLE and as bytes for lcd_draw_runs
+  s->run_count = 0;
+  color = 0;
+  if(s->bpp == 1)
+  {
+    if(format == IMAGE_1BPP_RLE)
+    {
+      size = 0;
+    }
+    for(i = 0; i <= s->width * s->height; i++)
+    {
+      if(i < s->width * s->height &&
+         s->index[i / s->width][i % s->width] == color)
+      {
+        run++;
+        continue;
+      }
+      if(format == IMAGE_1BPP_RLE)
+      {
+        size += put_varint(s->data + size, run);
+      }
+      while(run > 255)
+      {
+        s->runs[s->run_count++] = 255;
+        s->runs[s->run_count++] = 0;
+        run -= 255;
+      }
+      s->runs[s->run_count++] = run;
+      run = 1;
+      color = !color;
+    }
+  }
+
+  s->image.width = s->width;
+  s->image.height = s->height;
+  s->image.format = format;
+  s->image.size = size;
+  s->image.data = s->data;
+  s->image.palette = IMAGE_IS_INDEXED(format) ? s->palette : NULL;
+  s->image.palette_size = 1 << s->bpp;
+}
+
+static void random_source(source_t *s, uint8_t format)
+{
+  make_source(s, format, random_between(1, SIZE_MAX_PIXELS), random_between(1, SIZE_MAX_PIXELS));
+}
+
+//*****************************************************************************
+// The index of the source pixel at column x, row y of the drawn (flipped and
+// scaled) rectangle, and its color.  1 bpp sources are in fColor and bColor.
+//*****************************************************************************
+static uint8_t source_index(const source_t *s, int x, int y, uint8_t flags)
+{
+  int scale = IMAGE_SCALE(flags);
+  int sx = x / scale;
+  int sy = y / scale;
+
+  if(flags & IMAGE_FLIP_H)
+  {
+    sx = s->width - 1 - sx;
+  }
+  if(flags & IMAGE_FLIP_V)
+  {
+    sy = s->height - 1 - sy;
+  }
+  return s->index[sy][sx];
+}
+
+static uint16_t source_color(const source_t *s, uint8_t index)
+{
+  if(s->bpp == 1)
+  {
+    return index ? s->fColor : s->bColor;
+  }
+  return s->palette[index];
+}
+
+// Screen pixel x, y of the source drawn at drawn_x0, drawn_y0
+static uint16_t drawn_pixel(int x, int y)
+{
+  return source_color(drawn, source_index(drawn, x - drawn_x0, y - drawn_y0, drawn_flags));
+}
+
+//*****************************************************************************
+// A random clip rectangle, the whole screen half of the time, and a placement
+// of a width x height rectangle anywhere from just off the screen on one
+// side to just off it on the other
+//*****************************************************************************
+static void random_placement(uint16_t width, uint16_t height, int16_t *x0, int16_t *y0)
+{
+  int16_t cx0, cy0, cx1, cy1;
+
+  if(rand() % 2)
+  {
+    lcd_reset_clip();
+  }
+  else
+  {
+    cx0 = random_between(0, COLS - 1);
+    cx1 = random_between(cx0, COLS - 1);
+    cy0 = random_between(0, ROWS - 1);
+    cy1 = random_between(cy0, ROWS - 1);
+    lcd_set_clip(cx0, cy0, cx1, cy1);
+  }
+
+  *x0 = random_between(-width - 2, COLS + 1);
+  *y0 = random_between(-height - 2, ROWS + 1);
+}
+
+static void begin_draw(const source_t *s, uint8_t flags, int16_t x0, int16_t y0,
+                       uint16_t width, uint16_t height)
+{
+  lcd_rect_t rect;
+
+  drawn = s;
+  drawn_flags = flags;
+  drawn_x0 = x0;
+  drawn_y0 = y0;
+
+  rect.x0 = x0;
+  rect.y0 = y0;
+  rect.x1 = x0 + width - 1;
+  rect.y1 = y0 + height - 1;
+  visible_empty = !lcd_clip(&rect);
+  visible = rect;
+  pixels_sent = 0;
+  pixels_outside = 0;
+  draws++;
+}
+
+static void fail(const char *test, const char *what, int a, int b)
+{
+  if(failures++ < 20)
+  {
+    printf("%s draw %lu: %s (%d, %d)\n", test, (unsigned long)draws, what, a, b);
+  }
+}
+
+//*****************************************************************************
+// Checks the visible part of a draw against the reference, and puts the
+// sentinel back under it
+//*****************************************************************************
+static void end_draw(const char *test, uint16_t (*reference)(int x, int y))
+{
+  uint32_t expected = 0;
+  int x;
+  int y;
+
+  end_run();
+  if(!visible_empty)
+  {
+    expected = (uint32_t)(visible.x1 - visible.x0 + 1) * (visible.y1 - visible.y0 + 1);
+    for(y = visible.y0; y <= visible.y1; y++)
+    {
+      for(x = visible.x0; x <= visible.x1; x++)
+      {
+        if(gram[y][x] != reference(x, y))
+        {
+          fail(test, "wrong pixel at", x, y);
+        }
+        gram[y][x] = SENTINEL;
+      }
+    }
+  }
+
+  if(pixels_outside != 0)
+  {
+    fail(test, "pixels outside the clip, of", pixels_outside, pixels_sent);
+  }
+  if(pixels_sent != expected)
+  {
+    fail(test, "pixels sent, visible", pixels_sent, expected);
+  }
+}
+
+static void test_blit(uint8_t format, uint8_t flags)
+{
+  static const char *names[] = {"1bpp", "1bpp rle", "2bpp", "4bpp", "8bpp"};
+  uint16_t width;
+  uint16_t height;
+  int16_t x0;
+  int16_t y0;
+  int i;
+
+  for(i = 0; i < DRAWS; i++)
+  {
+    random_source(&source, format);
+    width = source.width * IMAGE_SCALE(flags);
+    height = source.height * IMAGE_SCALE(flags);
+    random_placement(width, height, &x0, &y0);
+    begin_draw(&source, flags, x0, y0, width, height);
+    if(!image_blit(&source.image, x0 + width / 2, y0 + height / 2, flags,
+                   source.fColor, source.bColor, NULL))
+    {
+      fail(names[format], "not drawn", x0, y0);
+    }
+    end_draw(names[format], drawn_pixel);
+  }
+}
+
+static void test_primitives(void)
+{
+  int16_t x0;
+  int16_t y0;
+  uint16_t color;
+  int i;
+
+  for(i = 0; i < PRIMITIVE_DRAWS; i++)
+  {
+    random_source(&source, IMAGE_1BPP);
+    random_placement(source.width, source.height, &x0, &y0);
+    begin_draw(&source, 0, x0, y0, source.width, source.height);
+    lcd_draw_image(x0 + source.width / 2, source.width, y0 + source.height / 2, source.height,
+                   source.data, source.fColor, source.bColor);
+    end_draw("lcd_draw_image", drawn_pixel);
+  }
+
+  for(i = 0; i < PRIMITIVE_DRAWS; i++)
+  {
+    random_source(&source, IMAGE_1BPP);
+    random_placement(source.width, source.height, &x0, &y0);
+    begin_draw(&source, 0, x0, y0, source.width, source.height);
+    lcd_draw_runs(x0, y0, source.width, source.height, source.runs, source.run_count,
+                  source.fColor, source.bColor);
+    end_draw("lcd_draw_runs", drawn_pixel);
+  }
+
+  for(i = 0; i < PRIMITIVE_DRAWS; i++)
+  {
+    random_source(&source, IMAGE_8BPP);
+    random_placement(source.width, source.height, &x0, &y0);
+    begin_draw(&source, 0, x0, y0, source.width, source.height);
+    lcd_write_rect(x0, y0, source.width, source.height, source.pixels);
+    end_draw("lcd_write_rect", drawn_pixel);
+  }
+
+  // A source of one index for the fill
+  for(i = 0; i < PRIMITIVE_DRAWS; i++)
+  {
+    random_source(&source, IMAGE_8BPP);
+    memset(source.index, 0, sizeof(source.index));
+    color = source.palette[0];
+    random_placement(source.width, source.height, &x0, &y0);
+    begin_draw(&source, 0, x0, y0, source.width, source.height);
+    lcd_fill_rect(x0, y0, source.width, source.height, color);
+    end_draw("lcd_fill_rect", drawn_pixel);
+  }
+}
+
+//*****************************************************************************
+// tilemap_draw.  The tileset is an indexed source one tile wide with the
+// tiles stacked top to bottom, as imgconv makes them.
+//*****************************************************************************
+static source_t tileset_source;
+static tileset_t tileset;
+static uint8_t cells[MAP_MAX * MAP_MAX];
+static tilemap_t map = {&tileset, 1, 1, cells, 0, 0};
+static source_t sprite_sources[TILEMAP_MAX_SPRITES];
+static tilemap_sprite_t sprites[TILEMAP_MAX_SPRITES];
+static uint8_t sprite_count;
+
+static uint16_t wrap(int v, int n)
+{
+  v %= n;
+  return (v < 0) ? v + n : v;
+}
+
+// The map's tile at x, y, then each sprite's opaque pixel there in order
+static uint16_t tilemap_pixel(int x, int y)
+{
+  uint8_t size = tileset.tile_size;
+  uint16_t map_x = wrap(x - map.x0, map.columns * size);
+  uint16_t map_y = wrap(y - map.y0, map.rows * size);
+  uint8_t tile = cells[(map_y / size) * map.columns + map_x / size];
+  const source_t *sprite;
+  uint16_t color;
+  uint8_t scale;
+  uint8_t index;
+  int left;
+  int top;
+  int i;
+
+  // unknown tile numbers draw tile 0
+  if(tile >= tileset_source.height / size)
+  {
+    tile = 0;
+  }
+  color = tileset_source.palette[tileset_source.index[tile * size + map_y % size][map_x % size]];
+
+  for(i = 0; i < sprite_count; i++)
+  {
+    sprite = &sprite_sources[i];
+    scale = IMAGE_SCALE(sprites[i].flags);
+    left = sprites[i].x_center - sprite->width * scale / 2;
+    top = sprites[i].y_center - sprite->height * scale / 2;
+    if(x < left || x >= left + sprite->width * scale ||
+       y < top || y >= top + sprite->height * scale)
+    {
+      continue;
+    }
+    index = source_index(sprite, x - left, y - top, sprites[i].flags);
+    if(index != 0)
+    {
+      color = source_color(sprite, index);
+    }
+  }
+  return color;
+}
+
+static void test_tilemap(void)
+{
+  static const uint8_t tile_formats[] = {IMAGE_2BPP, IMAGE_4BPP, IMAGE_8BPP};
+  uint8_t flips;
+  uint16_t width;
+  uint16_t height;
+  int16_t x0;
+  int16_t y0;
+  int tiles;
+  int i;
+  int n;
+
+  for(n = 0; n < TILEMAP_DRAWS; n++)
+  {
+    tileset.tile_size = (rand() % 2) ? 16 : 8;
+    tiles = random_between(1, SOURCE_MAX / tileset.tile_size);
+    make_source(&tileset_source, tile_formats[rand() % 3], tileset.tile_size,
+                tileset.tile_size * tiles);
+    tileset.image = &tileset_source.image;
+
+    // one more than the tile count, for the unknown tile numbers
+    map.columns = random_between(1, MAP_MAX);
+    map.rows = random_between(1, MAP_MAX);
+    map.x0 = random_between(-40, 40);
+    map.y0 = random_between(-40, 40);
+    for(i = 0; i < map.columns * map.rows; i++)
+    {
+      cells[i] = random_between(0, tiles);
+    }
+
+    width = random_between(1, 120);
+    height = random_between(1, 120);
+    random_placement(width, height, &x0, &y0);
+
+    sprite_count = random_between(0, TILEMAP_MAX_SPRITES);
+    for(i = 0; i < sprite_count; i++)
+    {
+      random_source(&sprite_sources[i], rand() % (IMAGE_8BPP + 1));
+      flips = rand() & (IMAGE_FLIP_H | IMAGE_FLIP_V);
+      sprites[i].image = &sprite_sources[i].image;
+      sprites[i].x_center = random_between(x0 - 20, x0 + width + 20);
+      sprites[i].y_center = random_between(y0 - 20, y0 + height + 20);
+      sprites[i].flags = flips | ((rand() % 3 == 0) ? IMAGE_SCALE_2X : 0);
+      sprites[i].fColor = sprite_sources[i].fColor;
+      sprites[i].palette = NULL;
+    }
+
+    begin_draw(NULL, 0, x0, y0, width, height);
+    tilemap_draw(&map, x0, y0, x0 + width - 1, y0 + height - 1, sprites, sprite_count);
+    end_draw("tilemap", tilemap_pixel);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  static const uint8_t flips[] = {0, IMAGE_FLIP_H, IMAGE_FLIP_V, IMAGE_FLIP_H | IMAGE_FLIP_V};
+  static const uint8_t scales[] = {0, IMAGE_SCALE_2X, IMAGE_SCALE_3X};
+  unsigned seed = 1;
+  uint8_t format;
+  int f;
+  int s;
+  int x;
+  int y;
+
+  if(argc == 3 && strcmp(argv[1], "-s") == 0)
+  {
+    seed = strtoul(argv[2], NULL, 0);
+  }
+  else if(argc != 1)
+  {
+    fprintf(stderr, "usage: cliptest [-s seed]\n");
+    return 1;
+  }
+  if(!host_map_registers())
+  {
+    fprintf(stderr, "cliptest: can not map the register addresses\n");
+    return 1;
+  }
+  srand(seed);
+
+  for(y = 0; y < ROWS; y++)
+  {
+    for(x = 0; x < COLS; x++)
+    {
+      gram[y][x] = SENTINEL;
+    }
+  }
+
+  for(format = IMAGE_1BPP; format <= IMAGE_8BPP; format++)
+  {
+    for(f = 0; f < 4; f++)
+    {
+      for(s = 0; s < 3; s++)
+      {
+        test_blit(format, flips[f] | scales[s]);
+      }
+    }
+  }
+  test_primitives();
+  test_tilemap();
+
+  if(failures != 0)
+  {
+    printf("cliptest: %lu failures in %lu draws\n", (unsigned long)failures, (unsigned long)draws);
+    return 1;
+  }
+  printf("cliptest: %lu draws, all matched\n", (unsigned long)draws);
+  return 0;
+}
@@ -0,0 +1,238 @@
+//*****************************************************************************
+// consoletest -- test of peripherals/c/lcd_console.c on the virtual TM4C123,
+// against the ILI9341 model in host/sim_lcd.c
+//
+// Usage:
+//    consoletest
+//
+// Text goes to a four line console the ways a program sends it: fputc to
+// LCD_CONSOLE, and printf with lcd_console_stdout set, through
+// serial_debug.c's fputc.  After each case the text the console should
+// show is worked out from the characters sent, and every cell of the panel
+// is compared with its character drawn alone below the console:
+//
+//    wrap        a full line then '\n' starts the next line, no blank line
+//    scroll      more lines than the console holds, '\t' and '\r' as well
+//
+// Prints the failures and exits 1 if there were any.
+//*****************************************************************************
+#include <stdio.h>
+#include <string.h>
+#include "lcd.h"
+#include "lcd_console.h"
+#include "serial_debug.h"
+#include "font_data.h"
+#include "sim.h"
+
+#define CONSOLE_TOP     40
+#define CONSOLE_ROWS    4
+#define F_COLOR         LCD_COLOR_WHITE
+#define B_COLOR         LCD_COLOR_BLUE2
+
+static const font_t *font;
+static uint8_t cell_width;
+static uint8_t cols;
+static uint16_t reference_y;          // where a reference cell is drawn
+
+// What the console should show
+static char text[CONSOLE_ROWS][LCD_CONSOLE_MAX_COLS];
+static uint8_t row;
+static uint8_t col;
+
+static uint32_t failures = 0;
+
+void DisableInterrupts(void)
+{
+  __disable_irq();
+}
+
+void EnableInterrupts(void)
+{
+  __enable_irq();
+}
+
+//*****************************************************************************
+// The console's behaviour, one character at a time
+//*****************************************************************************
+static void model_newline(void)
+{
+  col = 0;
+  if(row + 1 < CONSOLE_ROWS)
+  {
+    row++;
+    return;
+  }
+  memmove(text[0], text[1], sizeof(text[0]) * (CONSOLE_ROWS - 1));
+  memset(text[CONSOLE_ROWS - 1], ' ', sizeof(text[0]));
+}
+
+static void model_draw(char c)
+{
+  if(col >= cols)
+  {
+    model_newline();
+  }
+  text[row][col++] = c;
+}
+
+static void model_putc(char c)
+{
+  switch(c)
+  {
+    case '\n':  model_newline();                    break;
+    case '\r':  col = 0;                            break;
+    case '\t':
+      do
+      {
+        model_draw(' ');
+      } while(col % 4 != 0 && col < cols);
+      break;
+    default:    model_draw(c);                      break;
+  }
+}
+
+static void model_puts(const char *s)
+{
+  while(*s != '\0')
+  {
+    model_putc(*s++);
+  }
+}
+
+//*****************************************************************************
+// Compares every cell of the console with its character drawn on its own
+// at reference_y.  Each character is drawn once and checked everywhere.
+//*****************************************************************************
+static void check(const char *test)
+{
+  bool checked[256] = {false};
+  uint16_t x, y;
+  uint8_t r, c, r2, c2;
+  uint8_t ch;
+
+  lcd_console_flush();
+  for(r = 0; r < CONSOLE_ROWS; r++)
+  {
+    for(c = 0; c < cols; c++)
+    {
+      ch = (uint8_t)text[r][c];
+      if(checked[ch])
+      {
+        continue;
+      }
+      checked[ch] = true;
+
+      lcd_fill_rect(0, reference_y, cell_width, font->height, B_COLOR);
+      font_draw_char(font, ch, 0, reference_y, F_COLOR, B_COLOR);
+
+      for(r2 = 0; r2 < CONSOLE_ROWS; r2++)
+      {
+        for(c2 = 0; c2 < cols; c2++)
+        {
+          if((uint8_t)text[r2][c2] != ch)
+          {
+            continue;
+          }
+          for(y = 0; y < font->height; y++)
+          {
+            for(x = 0; x < cell_width; x++)
+            {
+              if(sim_board_lcd_pixel(c2 * cell_width + x, CONSOLE_TOP + r2 * font->height + y) !=
+                 sim_board_lcd_pixel(x, reference_y + y))
+              {
+                if(failures++ < 20)
+                {
+                  printf("%s: line %u column %u is not '%c'\n", test, r2, c2, ch);
+                }
+                x = cell_width;
+                y = font->height;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+// The text goes out through the UART, so let it drain before main returns
+static void finish(void)
+{
+  while(UART0->FR & UART_FR_BUSY) {};
+}
+
+// Through fputc on the console's own stream, which keeps it off the UART
+static void console_puts(const char *s)
+{
+  model_puts(s);
+  while(*s != '\0')
+  {
+    fputc(*s++, LCD_CONSOLE);
+  }
+}
+
+int main(void)
+{
+  char line[LCD_CONSOLE_MAX_COLS + 1];
+  uint16_t i;
+
+  init_serial_debug(false, false);
+  font_register(&font_sans8);
+  font = font_get(FONT_SANS8);
+  for(i = 0; i < font->glyph_count; i++)
+  {
+    if(font->glyphs[i].advance > cell_width)
+    {
+      cell_width = font->glyphs[i].advance;
+    }
+  }
+  cols = COLS / cell_width;
+  if(cols > LCD_CONSOLE_MAX_COLS)
+  {
+    cols = LCD_CONSOLE_MAX_COLS;
+  }
+  reference_y = ROWS - font->height;
+
+  lcd_config_screen();
+  lcd_clear_screen(LCD_COLOR_BLACK);
+  if(!lcd_console_init(FONT_SANS8, CONSOLE_TOP, CONSOLE_ROWS, F_COLOR, B_COLOR))
+  {
+    printf("consoletest: lcd_console_init failed\n");
+    finish();
+    return 1;
+  }
+  memset(text, ' ', sizeof(text));
+
+  // a full line, then '\n'
+  for(i = 0; i < cols; i++)
+  {
+    line[i] = 'A' + i % 26;
+  }
+  line[cols] = '\0';
+  console_puts(line);
+  console_puts("\nNEXT");
+  check("wrap");
+
+  // through printf, scrolling the first lines away
+  lcd_console_stdout = true;
+  for(i = 0; i < 6; i++)
+  {
+    printf("LINE %u\t%u\n", i, i * 7);
+    sprintf(line, "LINE %u\t%u\n", i, i * 7);
+    model_puts(line);
+  }
+  printf("OLD TEXT\rNEW");
+  model_puts("OLD TEXT\rNEW");
+  lcd_console_stdout = false;
+  check("scroll");
+
+  if(failures != 0)
+  {
+    printf("\nconsoletest: %lu mismatches\n", (unsigned long)failures);
+    finish();
+    return 1;
+  }
+  printf("\nconsoletest: passed\n");
+  finish();
+  return 0;
+}
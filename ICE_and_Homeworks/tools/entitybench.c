@@ -0,0 +1,272 @@
+//*****************************************************************************
+// entitybench -- host benchmark of the entity store in Project/entity.c
+// against the per character records it replaced
+//
+// Build (any host C compiler), from the tools directory:
+//    gcc -O2 -DENTITY_MAX=1024 -I../Project -I../peripherals/include -o entitybench entitybench.c ../Project/entity.c
+//
+// Usage:
+//    entitybench
+//
+// Both sides run the game's fish update, a random 1 to 10 pixel move that
+// bounces off the sides, and then test a bullet against every fish.  The
+// record side is moveFish, move_Left/move_Right and shootBullet's hit test
+// as they were, with the drawing left out: every pixel of a move goes
+// through the strcmp on the type string to pick the draw function.  The
+// store side is entity_update and entity_collide.  Before timing, the two
+// are run side by side and must end with every fish in the same place.
+//*****************************************************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "entity.h"
+
+#define UPDATES     4000000             // entity updates timed per size
+#define FISH_W      39
+#define FISH_H      31
+#define X_MIN       0
+#define X_MAX       (240 - FISH_W)
+
+//*****************************************************************************
+// The record layout, as it was in game.h
+//*****************************************************************************
+typedef struct _GameCharacter
+{
+  uint16_t width;
+  uint16_t height;
+  int16_t xPos;
+  int16_t yPos;
+  const image_t* image;
+  uint8_t flags;
+  uint16_t fColor;
+  uint16_t bColor;
+  const char* type;
+  int16_t max_X;
+  int16_t min_X;
+  bool moveRight;
+  bool hit;
+} _GameCharacter;
+
+static _GameCharacter *records;
+static uint8_t speeds[256];
+
+// drawCharacter without the drawing
+static void drawCharacter(_GameCharacter* character, int16_t x, int16_t y)
+{
+  character->xPos = x;
+  character->yPos = y;
+}
+
+static void drawObject(void* obj, int16_t x, int16_t y)
+{
+  (void)obj;
+  (void)x;
+  (void)y;
+}
+
+static void move_Left(int16_t xPos, int16_t yPos, uint32_t num_pixels, int16_t minX, const char type[], void* ptr)
+{
+  int16_t i;
+  int16_t final_x = (xPos - (int)num_pixels < minX) ? minX : xPos - (int)num_pixels;
+
+  for (i = xPos; i >= final_x; i--)
+  {
+    if (!strcmp(type, "character")) drawCharacter((_GameCharacter*)ptr, i, yPos);
+    else if (!strcmp(type, "object")) drawObject(ptr, i, yPos);
+  }
+}
+
+static void move_Right(int16_t xPos, int16_t yPos, uint32_t num_pixels, int16_t maxX, const char type[], void* ptr)
+{
+  int16_t i;
+  int16_t final_x = (xPos + (int)num_pixels > maxX) ? maxX : xPos + (int)num_pixels;
+
+  for (i = xPos; i <= final_x; i++)
+  {
+    if (!strcmp(type, "character")) drawCharacter((_GameCharacter*)ptr, i, yPos);
+    else if (!strcmp(type, "object")) drawObject(ptr, i, yPos);
+  }
+}
+
+static void records_update(int n, int frame)
+{
+  int numPixels;
+  int i;
+
+  for (i = 0; i < n; i++)
+  {
+    numPixels = speeds[(frame + i) & 0xFF];
+    if (records[i].moveRight)
+    {
+      if (records[i].xPos + numPixels >= records[i].max_X)
+      {
+        records[i].moveRight = false;
+        records[i].flags = IMAGE_FLIP_H;
+      }
+      move_Right(records[i].xPos, records[i].yPos, numPixels, records[i].max_X, records[i].type, &records[i]);
+    }
+    else
+    {
+      if (records[i].xPos - numPixels <= records[i].min_X)
+      {
+        records[i].moveRight = true;
+        records[i].flags = 0;
+      }
+      move_Left(records[i].xPos, records[i].yPos, numPixels, records[i].min_X, records[i].type, &records[i]);
+    }
+  }
+}
+
+static int records_collide(int n, int16_t bx, int16_t by)
+{
+  int i;
+
+  for (i = 0; i < n; i++)
+  {
+    if (by < records[i].yPos + records[i].height && records[i].yPos < by + 10 &&
+        bx < records[i].xPos + records[i].width && records[i].xPos < bx + 10)
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+//*****************************************************************************
+// The entity store
+//*****************************************************************************
+static void store_update(int frame)
+{
+  uint16_t i;
+  int8_t speed;
+
+  for (i = 0; i < entities.count; i++)
+  {
+    if (entities.type[i] == ENTITY_FISH)
+    {
+      speed = speeds[(frame + i) & 0xFF];
+      entities.vx[i] = (entities.vx[i] < 0) ? -speed : speed;
+    }
+  }
+  entity_update(ENTITY_MASK(ENTITY_FISH));
+  for (i = 0; i < entities.count; i++)
+  {
+    if (entities.type[i] == ENTITY_FISH)
+    {
+      entities.image_flags[i] = (entities.vx[i] < 0) ? IMAGE_FLIP_H : 0;
+    }
+  }
+}
+
+//*****************************************************************************
+// Same fish on both sides.  The bullet is created last so the fish handles
+// match the record indexes.
+//*****************************************************************************
+static entity_t setup(int n)
+{
+  entity_t bullet;
+  int i;
+
+  entity_reset();
+  for (i = 0; i < n; i++)
+  {
+    records[i].width = FISH_W;
+    records[i].height = FISH_H;
+    records[i].xPos = rand() % X_MAX;
+    records[i].yPos = rand() % 290;
+    records[i].type = "character";
+    records[i].max_X = X_MAX;
+    records[i].min_X = X_MIN;
+    records[i].moveRight = rand() & 1;
+    records[i].flags = records[i].moveRight ? 0 : IMAGE_FLIP_H;
+
+    entity_create(ENTITY_FISH, records[i].xPos, records[i].yPos, FISH_W, FISH_H);
+    entities.min_x[i] = X_MIN;
+    entities.max_x[i] = X_MAX;
+    entities.vx[i] = records[i].moveRight ? 1 : -1;
+  }
+  bullet = entity_create(ENTITY_BULLET, 100, 150, 10, 10);
+  return bullet;
+}
+
+static double seconds(clock_t start)
+{
+  return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main(void)
+{
+  static const int sizes[] = {8, 64, 256, 1000};
+  entity_t bullet;
+  clock_t start;
+  double t_records;
+  double t_store;
+  long hits;
+  int frames;
+  int frame;
+  int bad = 0;
+  int n;
+  int s;
+  int i;
+
+  for (i = 0; i < 256; i++)
+  {
+    speeds[i] = (rand() % 10) + 1;
+  }
+  records = calloc(ENTITY_MAX, sizeof(_GameCharacter));
+  if (records == NULL)
+  {
+    return 1;
+  }
+
+  // side by side check
+  for (s = 0; s < (int)(sizeof(sizes) / sizeof(sizes[0])); s++)
+  {
+    n = sizes[s];
+    setup(n);
+    for (frame = 0; frame < 1000; frame++)
+    {
+      records_update(n, frame);
+      store_update(frame);
+    }
+    for (i = 0; i < n; i++)
+    {
+      bad += records[i].xPos != entities.x[i] || records[i].flags != entities.image_flags[i];
+    }
+  }
+  printf("check: %d fish out of place\n", bad);
+
+  for (s = 0; s < (int)(sizeof(sizes) / sizeof(sizes[0])); s++)
+  {
+    n = sizes[s];
+    frames = UPDATES / n;
+
+    bullet = setup(n);
+    hits = 0;
+    start = clock();
+    for (frame = 0; frame < frames; frame++)
+    {
+      records_update(n, frame);
+      hits += records_collide(n, entities.x[bullet], entities.y[bullet]) >= 0;
+    }
+    t_records = seconds(start);
+
+    setup(n);
+    start = clock();
+    for (frame = 0; frame < frames; frame++)
+    {
+      store_update(frame);
+      hits += entity_collide(bullet, ENTITY_MASK(ENTITY_FISH)) != ENTITY_NONE;
+    }
+    t_store = seconds(start);
+
+    printf("%5d fish   records %6.1f ns/fish   store %6.1f ns/fish   %.1fx   (%ld)\n", n,
+           t_records * 1e9 / ((double)frames * n), t_store * 1e9 / ((double)frames * n),
+           t_records / t_store, hits);
+  }
+
+  free(records);
+  return bad != 0;
+}
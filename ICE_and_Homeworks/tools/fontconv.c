@@ -0,0 +1,350 @@
+//*****************************************************************************
+// fontconv -- host tool that converts a BDF bitmap font into the run encoded
+// font_t tables used by peripherals/c/fonts.c
+//
+// Build (any host C compiler):
+//    gcc -O2 -o fontconv fontconv.c
+//
+// Usage:
+//    fontconv [-n name] [-b] [-s scale] [-f fallback_char] font.bdf > font.c
+//
+//    -n name      C symbol for the generated font_t (default "font")
+//    -b           generate a bold style by smearing every glyph 1 pixel right
+//    -s scale     integer scale factor (1-4) for large styles
+//    -f char      glyph drawn for bytes the font does not contain
+//                 (default '?' when present, otherwise ' ')
+//
+// Every glyph is rendered into a cell as wide as its advance and as tall as
+// the font (ascent + descent), so glyphs drawn side by side tile without
+// gaps.  The cell is stored as alternating background/foreground run
+// lengths over the row major pixel stream, starting with background.  A run
+// longer than 255 pixels is split as 255, 0, remainder.
+//*****************************************************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define MAX_GLYPHS    256
+#define MAX_CELL_W    64
+#define MAX_CELL_H    64
+#define MAX_RUNS      (MAX_CELL_W * MAX_CELL_H * 2)
+
+typedef struct
+{
+  int       encoding;
+  int       width;                            // cell width in pixels
+  int       advance;                          // DWIDTH
+  uint8_t   pixels[MAX_CELL_H][MAX_CELL_W];
+} glyph_t;
+
+static glyph_t  glyphs[MAX_GLYPHS];
+static int      glyph_count = 0;
+static int      font_ascent = 0;
+static int      font_descent = 0;
+
+//*****************************************************************************
+// Parse the subset of BDF 2.1 needed for fixed height bitmap fonts.
+//*****************************************************************************
+static int parse_bdf(FILE *fp)
+{
+  char      line[256];
+  glyph_t   *g = NULL;
+  int       bbx_w = 0, bbx_h = 0, bbx_x = 0, bbx_y = 0;
+  int       row = 0;
+  int       in_bitmap = 0;
+
+  while(fgets(line, sizeof(line), fp))
+  {
+    if(strncmp(line, "FONT_ASCENT", 11) == 0)
+    {
+      font_ascent = atoi(line + 11);
+    }
+    else if(strncmp(line, "FONT_DESCENT", 12) == 0)
+    {
+      font_descent = atoi(line + 12);
+    }
+    else if(strncmp(line, "STARTCHAR", 9) == 0)
+    {
+      if(glyph_count >= MAX_GLYPHS)
+      {
+        fprintf(stderr, "fontconv: too many glyphs\n");
+        return -1;
+      }
+      g = &glyphs[glyph_count];
+      memset(g, 0, sizeof(*g));
+      g->encoding = -1;
+    }
+    else if(g && strncmp(line, "ENCODING", 8) == 0)
+    {
+      g->encoding = atoi(line + 8);
+    }
+    else if(g && strncmp(line, "DWIDTH", 6) == 0)
+    {
+      g->advance = atoi(line + 6);
+    }
+    else if(g && strncmp(line, "BBX", 3) == 0)
+    {
+      sscanf(line + 3, "%d %d %d %d", &bbx_w, &bbx_h, &bbx_x, &bbx_y);
+      g->width = bbx_w + (bbx_x > 0 ? bbx_x : 0);
+      if(g->width > MAX_CELL_W || bbx_h > MAX_CELL_H)
+      {
+        fprintf(stderr, "fontconv: glyph %d is too large\n", g->encoding);
+        return -1;
+      }
+    }
+    else if(g && strncmp(line, "BITMAP", 6) == 0)
+    {
+      // First bitmap row lands at (ascent - top of bbx)
+      row = font_ascent - (bbx_h + bbx_y);
+      in_bitmap = 1;
+    }
+    else if(g && strncmp(line, "ENDCHAR", 7) == 0)
+    {
+      // Only 8-bit encodings can be reached through the byte map
+      if(g->encoding >= 0 && g->encoding < 256)
+      {
+        glyph_count++;
+      }
+      g = NULL;
+      in_bitmap = 0;
+    }
+    else if(g && in_bitmap)
+    {
+      int   x;
+      int   len = (int)strcspn(line, "\r\n");
+
+      for(x = 0; x < bbx_w && (x / 4) < len; x++)
+      {
+        char    hex[2] = { line[x / 4], 0 };
+        int     nibble = (int)strtol(hex, NULL, 16);
+        int     px = x + (bbx_x > 0 ? bbx_x : 0);
+
+        if( (nibble & (0x8 >> (x % 4))) && row >= 0 && row < MAX_CELL_H )
+        {
+          g->pixels[row][px] = 1;
+        }
+      }
+      row++;
+    }
+  }
+
+  if(font_ascent + font_descent <= 0)
+  {
+    fprintf(stderr, "fontconv: missing FONT_ASCENT/FONT_DESCENT\n");
+    return -1;
+  }
+  return 0;
+}
+
+//*****************************************************************************
+// Style transforms
+//*****************************************************************************
+static void embolden(glyph_t *g)
+{
+  int x, y;
+
+  if(g->width + 1 > MAX_CELL_W)
+    return;
+
+  for(y = 0; y < MAX_CELL_H; y++)
+  {
+    for(x = g->width; x > 0; x--)
+    {
+      g->pixels[y][x] |= g->pixels[y][x - 1];
+    }
+  }
+  g->width++;
+  g->advance++;
+}
+
+static void scale_glyph(glyph_t *g, int scale, int height)
+{
+  static uint8_t  tmp[MAX_CELL_H][MAX_CELL_W];
+  int             x, y;
+
+  memset(tmp, 0, sizeof(tmp));
+  for(y = 0; y < height * scale && y < MAX_CELL_H; y++)
+  {
+    for(x = 0; x < g->width * scale && x < MAX_CELL_W; x++)
+    {
+      tmp[y][x] = g->pixels[y / scale][x / scale];
+    }
+  }
+  memcpy(g->pixels, tmp, sizeof(tmp));
+  g->width *= scale;
+  g->advance *= scale;
+}
+
+//*****************************************************************************
+// Convert one glyph cell to runs.  Returns the number of run bytes written.
+//*****************************************************************************
+static int encode_runs(const glyph_t *g, int height, uint8_t *runs)
+{
+  int       count = 0;
+  int       color = 0;
+  uint32_t  run = 0;
+  int       x, y;
+
+  for(y = 0; y < height; y++)
+  {
+    for(x = 0; x < g->width; x++)
+    {
+      if(g->pixels[y][x] != color)
+      {
+        while(run > 255) { runs[count++] = 255; runs[count++] = 0; run -= 255; }
+        runs[count++] = (uint8_t)run;
+        run = 0;
+        color = !color;
+      }
+      run++;
+    }
+  }
+
+  while(run > 255) { runs[count++] = 255; runs[count++] = 0; run -= 255; }
+  runs[count++] = (uint8_t)run;
+  return count;
+}
+
+static void print_char_comment(int c)
+{
+  if(c >= 0x20 && c < 0x7F && c != '\\' && c != '*' && c != '/')
+    printf("/* '%c' */", c);
+  else
+    printf("/* 0x%02X */", c);
+}
+
+int main(int argc, char **argv)
+{
+  const char  *name = "font";
+  const char  *path = NULL;
+  int         bold = 0;
+  int         scale = 1;
+  int         fallback = -1;
+  int         height;
+  int         i, j, fb_index = -1;
+  int         map[256];
+  static uint8_t  runs[MAX_GLYPHS][MAX_RUNS];
+  int         run_len[MAX_GLYPHS];
+  FILE        *fp;
+
+  for(i = 1; i < argc; i++)
+  {
+    if(strcmp(argv[i], "-n") == 0 && i + 1 < argc)       name = argv[++i];
+    else if(strcmp(argv[i], "-b") == 0)                   bold = 1;
+    else if(strcmp(argv[i], "-s") == 0 && i + 1 < argc)  scale = atoi(argv[++i]);
+    else if(strcmp(argv[i], "-f") == 0 && i + 1 < argc)  fallback = (unsigned char)argv[++i][0];
+    else                                                  path = argv[i];
+  }
+
+  if(path == NULL || scale < 1 || scale > 4)
+  {
+    fprintf(stderr, "usage: fontconv [-n name] [-b] [-s scale] [-f char] font.bdf\n");
+    return 1;
+  }
+
+  fp = fopen(path, "r");
+  if(fp == NULL)
+  {
+    perror(path);
+    return 1;
+  }
+  if(parse_bdf(fp) != 0)
+  {
+    fclose(fp);
+    return 1;
+  }
+  fclose(fp);
+
+  height = font_ascent + font_descent;
+  for(i = 0; i < glyph_count; i++)
+  {
+    if(bold)        embolden(&glyphs[i]);
+    if(scale > 1)   scale_glyph(&glyphs[i], scale, height);
+
+    // Pad the cell out to the advance so the inter-glyph gap gets painted
+    if(glyphs[i].advance > glyphs[i].width && glyphs[i].advance <= MAX_CELL_W)
+      glyphs[i].width = glyphs[i].advance;
+  }
+  height *= scale;
+  if(height > 255)
+  {
+    fprintf(stderr, "fontconv: scaled font is too tall\n");
+    return 1;
+  }
+
+  // Pick the fallback glyph
+  for(i = 0; i < glyph_count; i++)
+  {
+    if(glyphs[i].encoding == (fallback >= 0 ? fallback : '?'))
+      fb_index = i;
+  }
+  for(i = 0; fb_index < 0 && i < glyph_count; i++)
+  {
+    if(glyphs[i].encoding == ' ')
+      fb_index = i;
+  }
+  if(fb_index < 0)
+    fb_index = 0;
+
+  // Glyph table index 0 is always the fallback, real glyphs follow in
+  // file order.  Every byte value maps to some glyph.
+  for(i = 0; i < 256; i++)
+    map[i] = 0;
+  for(i = 0; i < glyph_count; i++)
+    map[glyphs[i].encoding] = i + 1;
+
+  for(i = 0; i < glyph_count; i++)
+    run_len[i] = encode_runs(&glyphs[i], height, runs[i]);
+
+  printf("// Generated by tools/fontconv from %s", path);
+  if(bold)        printf(" (bold)");
+  if(scale > 1)   printf(" (x%d)", scale);
+  printf("\n// Do not edit by hand, regenerate the file instead.\n\n");
+  printf("#include \"fonts.h\"\n\n");
+
+  printf("static const uint8_t %s_runs[] =\n{\n", name);
+  for(i = 0; i < glyph_count; i++)
+  {
+    printf("  ");
+    print_char_comment(glyphs[i].encoding);
+    printf("\n  ");
+    for(j = 0; j < run_len[i]; j++)
+    {
+      printf("%d,%s", runs[i][j], ((j % 16) == 15 && j + 1 < run_len[i]) ? "\n  " : " ");
+    }
+    printf("\n");
+  }
+  printf("};\n\n");
+
+  printf("static const font_glyph_t %s_glyphs[] =\n{\n", name);
+  for(i = -1; i < glyph_count; i++)
+  {
+    int         g = (i < 0) ? fb_index : i;
+    int         off = 0;
+
+    for(j = 0; j < g; j++)
+      off += run_len[j];
+    printf("  {%2d, %2d, %5d, %3d},   ", glyphs[g].width, glyphs[g].advance, off, run_len[g]);
+    if(i < 0)   printf("/* fallback */\n");
+    else        { print_char_comment(glyphs[g].encoding); printf("\n"); }
+  }
+  printf("};\n\n");
+
+  printf("static const uint8_t %s_map[256] =\n{\n", name);
+  for(i = 0; i < 256; i++)
+  {
+    printf("%s%3d,%s", (i % 16) == 0 ? "  " : "", map[i], (i % 16) == 15 ? "\n" : " ");
+  }
+  printf("};\n\n");
+
+  printf("const font_t %s =\n{\n", name);
+  printf("  %d,                    // height\n", height);
+  printf("  %d,                    // glyph count, including the fallback\n", glyph_count + 1);
+  printf("  %s_map,\n", name);
+  printf("  %s_glyphs,\n", name);
+  printf("  %s_runs\n", name);
+  printf("};\n");
+
+  return 0;
+}
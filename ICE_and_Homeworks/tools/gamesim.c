@@ -0,0 +1,642 @@
+//*****************************************************************************
+// gamesim -- headless host simulation of the final project game
+//
+// Build (Linux, gcc), from the tools directory, all one command:
+//    gcc -O2 -Ihost -I../Project -I../peripherals/include -I../drivers/include
+//        -Wl,--wrap=dl_end,--wrap=entity_create,--wrap=entity_collide
+//        -o gamesim gamesim.c host/registers.c
+//        ../Project/game.c ../Project/entity.c ../Project/input_log.c ../Project/background.c
+//        ../Project/images.c ../Project/octopus_image.c ../Project/ocean_tiles_image.c
+//        ../Project/font_sans8.c ../Project/font_sans8_bold.c ../Project/font_sans8_x2.c
+//        ../peripherals/c/lcd.c ../peripherals/c/display_list.c ../peripherals/c/tilemap.c
+//        ../peripherals/c/image.c ../peripherals/c/widgets.c ../peripherals/c/fonts.c
+//        ../peripherals/c/rgb565.c ../peripherals/c/rng.c
+//        ../drivers/c/gpio_port.c ../drivers/c/timers.c
+//
+// Usage:
+//    gamesim [-n frames] [-s seed] [-v] [-o screen.ppm] [-w log] [-r log] [script]
+//
+//    -n frames    panel refreshes to run (default 100000)
+//    -s seed      seeds the random input and the games, so a seed always
+//                 plays the same games
+//    -v           one line per game
+//    -o file      writes the final screen out as a PPM
+//    -w log       records every input to log, see input_log.h
+//    -r log       replays a recording made with -w or on the board with
+//                 INPUT_RECORD (other text in the file is skipped), up to
+//                 the frame its last input came before.  It takes the place
+//                 of the random input or a script, -s makes no difference.
+//
+// The game code, display list and LCD driver are the board's, built for the
+// host against tools/host/TM4C123GH6PM.h.  The LCD bus writes go to memory
+// mapped over the GPIO registers and the panel is modeled through the
+// driver's capture hooks (capture.h), which see every window and pixel the
+// driver sends.  The accelerometer, touch controller and buttons are
+// replaced by the input below, fed through input_log the way the main loop
+// does: two samples (TIMER4) and at most one button per frame.
+//
+// Without a script the input is random: the board tilts left, right or
+// level for a while at a time, the screen is touched about a quarter of the
+// time and a color or HUD button is pressed now and then.  A script is a
+// text file of
+//    <frame> tilt <accelerometer x>
+//    <frame> touch <touch count>
+//    <frame> button U|D|L|R
+// lines in frame order, # starts a comment.  Tilt and touch hold until
+// changed.  The game starts paused, as on the board, and the simulation
+// presses BTN_D before the first frame.  A game that runs out of bullets is
+// restarted at once instead of showing the end screen.
+//
+// The draw call counts come from the LCD windows, the display list numbers
+// from dl_get_stats after every dl_end, and the shots and collision tests
+// from wrapping entity_create and entity_collide (see the -Wl,--wrap in the
+// build line).
+//*****************************************************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "game.h"
+#include "input_log.h"
+#include "rng.h"
+#include "capture.h"
+#include "font_data.h"
+
+#define SAMPLES_PER_FRAME   2       // TIMER4 runs at about 124Hz, the panel 60Hz
+
+//*****************************************************************************
+// Panel model, fed by the LCD driver's capture hooks
+//*****************************************************************************
+bool capture_enabled = true;
+uint16_t capture_run_color;
+uint32_t capture_run_length = 0;
+
+static uint16_t gram[ROWS][COLS];
+
+static int win_x0;
+static int win_x1 = COLS - 1;
+static int win_y0;
+static int win_y1 = ROWS - 1;
+static int cur_x;
+static int cur_y;
+static bool mirror_x;
+static bool mirror_y;
+
+static uint32_t frame_windows;
+static uint32_t frame_pixels;
+
+static void put_pixels(uint16_t color, uint32_t count)
+{
+  int x;
+  int y;
+
+  frame_pixels += count;
+  while(count--)
+  {
+    x = mirror_x ? COLS - 1 - cur_x : cur_x;
+    y = mirror_y ? ROWS - 1 - cur_y : cur_y;
+    if(x >= 0 && x < COLS && y >= 0 && y < ROWS)
+    {
+      gram[y][x] = color;
+    }
+    if(++cur_x > win_x1)
+    {
+      cur_x = win_x0;
+      if(++cur_y > win_y1)
+      {
+        cur_y = win_y0;
+      }
+    }
+  }
+}
+
+static void end_run(void)
+{
+  put_pixels(capture_run_color, capture_run_length);
+  capture_run_length = 0;
+}
+
+void capture_window(uint16_t x0, uint16_t x1, uint16_t y0, uint16_t y1)
+{
+  end_run();
+  win_x0 = x0;
+  win_x1 = x1;
+  win_y0 = y0;
+  win_y1 = y1;
+  cur_x = x0;
+  cur_y = y0;
+  frame_windows++;
+}
+
+void capture_run(uint16_t color, uint32_t count)
+{
+  if(color != capture_run_color)
+  {
+    end_run();
+    capture_run_color = color;
+  }
+  capture_run_length += count;
+}
+
+void capture_color_change(uint16_t color)
+{
+  end_run();
+  capture_run_color = color;
+  capture_run_length = 1;
+}
+
+void capture_mirror(bool x, bool y)
+{
+  end_run();
+  mirror_x = x;
+  mirror_y = y;
+}
+
+void capture_scroll(uint16_t top, uint16_t height, uint16_t offset)
+{
+  // the game never scrolls
+  (void)top;
+  (void)height;
+  (void)offset;
+}
+
+static int write_ppm(const char *name)
+{
+  uint16_t c;
+  int x;
+  int y;
+  FILE *f = fopen(name, "wb");
+
+  if(f == NULL)
+  {
+    perror(name);
+    return 0;
+  }
+  fprintf(f, "P6\n%d %d\n255\n", COLS, ROWS);
+  for(y = 0; y < ROWS; y++)
+  {
+    for(x = 0; x < COLS; x++)
+    {
+      c = gram[y][x];
+      fputc(((c >> 11) << 3) | (c >> 13), f);
+      fputc((((c >> 5) & 0x3F) << 2) | ((c >> 9) & 0x3), f);
+      fputc(((c & 0x1F) << 3) | ((c >> 2) & 0x7), f);
+    }
+  }
+  fclose(f);
+  return 1;
+}
+
+//*****************************************************************************
+// Counters on the game's calls into the display list and entity store
+//*****************************************************************************
+typedef struct
+{
+  uint64_t recorded;
+  uint64_t culled;
+  uint64_t merged;
+  uint64_t executed;
+  uint64_t pixels_recorded;
+  uint64_t pixels_written;
+  uint64_t pixels_visible;
+} dl_total_t;
+
+static dl_total_t dl_total;
+static uint32_t dl_frames;
+static uint32_t shots;
+static uint32_t collision_tests;
+static uint32_t shield_hits;
+
+void __real_dl_end(void);
+entity_t __real_entity_create(entity_type_t type, int16_t x, int16_t y, uint8_t width, uint8_t height);
+entity_t __real_entity_collide(entity_t e, uint8_t types);
+
+void __wrap_dl_end(void)
+{
+  dl_stats_t stats;
+
+  __real_dl_end();
+  dl_get_stats(&stats);
+  dl_total.recorded += stats.recorded;
+  dl_total.culled += stats.culled;
+  dl_total.merged += stats.merged;
+  dl_total.executed += stats.executed;
+  dl_total.pixels_recorded += stats.pixels_recorded;
+  dl_total.pixels_written += stats.pixels_written;
+  dl_total.pixels_visible += stats.pixels_visible;
+  dl_frames++;
+}
+
+entity_t __wrap_entity_create(entity_type_t type, int16_t x, int16_t y, uint8_t width, uint8_t height)
+{
+  shots += (type == ENTITY_BULLET);
+  return __real_entity_create(type, x, y, width, height);
+}
+
+entity_t __wrap_entity_collide(entity_t e, uint8_t types)
+{
+  entity_t hit = __real_entity_collide(e, types);
+
+  collision_tests++;
+  if(hit != ENTITY_NONE && entities.type[hit] == ENTITY_SHIELD)
+  {
+    shield_hits++;
+  }
+  return hit;
+}
+
+//*****************************************************************************
+// Input
+//*****************************************************************************
+typedef struct
+{
+  uint32_t frame;
+  char kind;                    // 't' tilt, 'c' touch count, 'b' button
+  int value;
+} event_t;
+
+static event_t *script;
+static size_t script_length;
+static size_t script_next;
+
+static int16_t tilt;
+static uint8_t touch;
+static uint8_t button;
+static rng_t input_rng;
+
+static input_event_t *replay;
+static uint32_t replay_length;
+static FILE *record_file;
+
+static void record_input(const input_event_t *event)
+{
+  fprintf(record_file, INPUT_LOG_FORMAT, (unsigned long)event->frame, event->type,
+          (long)event->value, event->touches);
+}
+
+// Every line of a log that parses as an event
+static int load_replay(const char *name)
+{
+  char line[256];
+  unsigned long frame;
+  long value;
+  unsigned touches;
+  char type;
+  size_t size = 0;
+  FILE *f = fopen(name, "r");
+
+  if(f == NULL)
+  {
+    perror(name);
+    return 0;
+  }
+  while(fgets(line, sizeof(line), f) != NULL)
+  {
+    if(sscanf(line, " {%lu, '%c', %ld, %u}", &frame, &type, &value, &touches) != 4)
+    {
+      continue;
+    }
+    if(replay_length == size)
+    {
+      size = size ? 2 * size : 1024;
+      replay = realloc(replay, size * sizeof(input_event_t));
+      if(replay == NULL)
+      {
+        fclose(f);
+        return 0;
+      }
+    }
+    replay[replay_length].frame = frame;
+    replay[replay_length].type = type;
+    replay[replay_length].value = value;
+    replay[replay_length].touches = touches;
+    replay_length++;
+  }
+  fclose(f);
+  if(replay_length == 0)
+  {
+    fprintf(stderr, "%s: no inputs\n", name);
+    return 0;
+  }
+  return 1;
+}
+
+static int load_script(const char *name)
+{
+  char line[256];
+  char kind[16];
+  char arg[16];
+  unsigned long frame;
+  size_t size = 0;
+  int number = 0;
+  event_t e;
+  FILE *f = fopen(name, "r");
+
+  if(f == NULL)
+  {
+    perror(name);
+    return 0;
+  }
+  while(fgets(line, sizeof(line), f) != NULL)
+  {
+    number++;
+    if(strchr(line, '#') != NULL)
+    {
+      *strchr(line, '#') = '\0';
+    }
+    if(sscanf(line, "%lu %15s %15s", &frame, kind, arg) != 3)
+    {
+      if(strspn(line, " \t\r\n") != strlen(line))
+      {
+        fprintf(stderr, "%s:%d: expected <frame> tilt|touch|button <value>\n", name, number);
+        fclose(f);
+        return 0;
+      }
+      continue;
+    }
+
+    e.frame = frame;
+    if(strcmp(kind, "tilt") == 0)
+    {
+      e.kind = 't';
+      e.value = atoi(arg);
+    }
+    else if(strcmp(kind, "touch") == 0)
+    {
+      e.kind = 'c';
+      e.value = atoi(arg);
+    }
+    else if(strcmp(kind, "button") == 0 && strchr("UDLR", arg[0]) != NULL)
+    {
+      e.kind = 'b';
+      e.value = (arg[0] == 'U') ? BTN_U : (arg[0] == 'D') ? BTN_D : (arg[0] == 'L') ? BTN_L : BTN_R;
+    }
+    else
+    {
+      fprintf(stderr, "%s:%d: unknown input '%s %s'\n", name, number, kind, arg);
+      fclose(f);
+      return 0;
+    }
+    if(script_length > 0 && frame < script[script_length - 1].frame)
+    {
+      fprintf(stderr, "%s:%d: frames must not go backwards\n", name, number);
+      fclose(f);
+      return 0;
+    }
+
+    if(script_length == size)
+    {
+      size = size ? 2 * size : 64;
+      script = realloc(script, size * sizeof(event_t));
+      if(script == NULL)
+      {
+        fclose(f);
+        return 0;
+      }
+    }
+    script[script_length++] = e;
+  }
+  fclose(f);
+  return 1;
+}
+
+static void script_input(uint32_t frame)
+{
+  event_t *e;
+
+  button = BTN_NONE;
+  while(script_next < script_length && script[script_next].frame <= frame)
+  {
+    e = &script[script_next++];
+    switch(e->kind)
+    {
+      case 't': tilt = e->value;  break;
+      case 'c': touch = e->value; break;
+      case 'b': button = e->value; break;
+    }
+  }
+}
+
+static void random_input(void)
+{
+  static const int16_t tilts[3] = {MOVE_LEFT + 1000, 0, MOVE_RIGHT - 1000};
+  static const uint8_t buttons[3] = {BTN_L, BTN_R, BTN_U};
+
+  if(rng_below(&input_rng, 30) == 0)
+  {
+    tilt = tilts[rng_below(&input_rng, 3)];
+  }
+  touch = (rng_below(&input_rng, 4) == 0);
+  button = (rng_below(&input_rng, 300) == 0) ? buttons[rng_below(&input_rng, 3)] : BTN_NONE;
+}
+
+//*****************************************************************************
+// Main loop
+//*****************************************************************************
+static double seconds_now(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[])
+{
+  const char *script_name = NULL;
+  const char *screen_name = NULL;
+  const char *record_name = NULL;
+  const char *replay_name = NULL;
+  unsigned long frames = 100000;
+  unsigned seed = 1;
+  int verbose = 0;
+  uint32_t frame;
+  uint32_t played = 0;
+  uint32_t replay_end = 0;
+  uint32_t games = 0;
+  uint32_t fish_hits = 0;
+  uint32_t max_windows = 0;
+  uint32_t max_pixels = 0;
+  uint64_t windows = 0;
+  uint64_t pixels = 0;
+  int best = 0;
+  int before;
+  double start;
+  double elapsed;
+  int i;
+
+  for(i = 1; i < argc; i++)
+  {
+    if(strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+    {
+      frames = strtoul(argv[++i], NULL, 0);
+    }
+    else if(strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+    {
+      seed = strtoul(argv[++i], NULL, 0);
+    }
+    else if(strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+    {
+      screen_name = argv[++i];
+    }
+    else if(strcmp(argv[i], "-w") == 0 && i + 1 < argc)
+    {
+      record_name = argv[++i];
+    }
+    else if(strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+    {
+      replay_name = argv[++i];
+    }
+    else if(strcmp(argv[i], "-v") == 0)
+    {
+      verbose = 1;
+    }
+    else if(argv[i][0] == '-' || script_name != NULL)
+    {
+      fprintf(stderr, "usage: gamesim [-n frames] [-s seed] [-v] [-o screen.ppm] [-w log] [-r log] [script]\n");
+      return 1;
+    }
+    else
+    {
+      script_name = argv[i];
+    }
+  }
+
+  if(!host_map_registers())
+  {
+    fprintf(stderr, "gamesim: can not map the register addresses\n");
+    return 1;
+  }
+  if(script_name != NULL && !load_script(script_name))
+  {
+    return 1;
+  }
+  if(replay_name != NULL)
+  {
+    if(!load_replay(replay_name))
+    {
+      return 1;
+    }
+    replay_end = replay[replay_length - 1].frame + 1;
+    input_replay(replay, replay_length);
+  }
+  if(record_name != NULL)
+  {
+    record_file = fopen(record_name, "w");
+    if(record_file == NULL)
+    {
+      perror(record_name);
+      return 1;
+    }
+    input_record(record_input);
+  }
+  rng_seed(&input_rng, seed);
+
+  // what init_hardware does for the game
+  font_register(&font_sans8);
+  font_register(&font_sans8_bold);
+  font_register(&font_sans8_x2);
+  dl_count_visible = true;
+  lcd_clear_screen(BG_COLOR);
+  input_button(BTN_D);
+
+  start = seconds_now();
+  for(frame = 0; (replay_name != NULL) ? played < replay_end : frame < frames; frame++)
+  {
+    input_poll();
+
+    // A replay is the only input, even in the frame its last event is used
+    // up, so the seed never shows in what it plays
+    if(replay_name == NULL)
+    {
+      if(script_name != NULL)
+      {
+        script_input(frame);
+      }
+      else
+      {
+        random_input();
+      }
+      for(i = 0; i < SAMPLES_PER_FRAME; i++)
+      {
+        input_sample(tilt, touch);
+      }
+      if(button != BTN_NONE)
+      {
+        input_button(button);
+      }
+    }
+
+    if(pause)
+    {
+      if(replay_name != NULL && !input_replaying())
+      {
+        break;
+      }
+      continue;
+    }
+
+    frame_windows = 0;
+    frame_pixels = 0;
+    if(played == 0)
+    {
+      input_game_start(rng_next(&input_rng));
+    }
+    before = score;
+    if(!input_game_frame())
+    {
+      games++;
+      if(verbose)
+      {
+        printf("game %u: score %d, frame %u\n", games, score, frame);
+      }
+      best = (score > best) ? score : best;
+      input_game_start(rng_next(&input_rng));
+    }
+    else
+    {
+      fish_hits += score - before;
+    }
+    fishHit = false;
+    played++;
+
+    end_run();
+    windows += frame_windows;
+    pixels += frame_pixels;
+    max_windows = (frame_windows > max_windows) ? frame_windows : max_windows;
+    max_pixels = (frame_pixels > max_pixels) ? frame_pixels : max_pixels;
+  }
+  elapsed = seconds_now() - start;
+  best = (score > best) ? score : best;
+
+  if(played == 0)
+  {
+    printf("no frames played, the game stayed paused\n");
+    return 0;
+  }
+  printf("frames        %u played, %lu paused, %.0f frames/s\n", played, (unsigned long)(frame - played), frame / elapsed);
+  printf("games         %u over, best score %d\n", games, best);
+  printf("lcd           %.1f windows, %.0f pixels per frame (max %u, %u)\n",
+         (double)windows / played, (double)pixels / played, max_windows, max_pixels);
+  printf("display list  %u lists, per list %.1f recorded, %.1f culled, %.1f merged, %.1f executed\n",
+         dl_frames, (double)dl_total.recorded / dl_frames, (double)dl_total.culled / dl_frames,
+         (double)dl_total.merged / dl_frames, (double)dl_total.executed / dl_frames);
+  printf("              pixels per list %.0f recorded, %.0f written, %.0f visible\n",
+         (double)dl_total.pixels_recorded / dl_frames, (double)dl_total.pixels_written / dl_frames,
+         (double)dl_total.pixels_visible / dl_frames);
+  printf("bullets       %u shots, %u fish hit, %u shield hits, %u collision tests\n",
+         shots, fish_hits, shield_hits, collision_tests);
+
+  if(screen_name != NULL && !write_ppm(screen_name))
+  {
+    return 1;
+  }
+  if(record_file != NULL)
+  {
+    fclose(record_file);
+  }
+  free(script);
+  free(replay);
+  return 0;
+}
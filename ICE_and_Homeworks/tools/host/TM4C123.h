@@ -0,0 +1,6 @@
+#ifndef __TM4C123_H__
+#define __TM4C123_H__
+
+#include "TM4C123GH6PM.h"
+
+#endif
@@ -0,0 +1,597 @@
+//*****************************************************************************
+// TM4C123GH6PM.h -- host stand-in for the Keil device header
+//
+// The register blocks have the part's layout and sit at the part's
+// addresses, so the drivers build for a Linux host without changes.  The
+// addresses are only usable once memory is mapped over them, by one of:
+//
+//    registers.c   host_map_registers maps plain memory, stores land there
+//                  and loads read back whatever was last stored
+//    sim_core.c    the virtual TM4C123 of sim.h, every access goes through
+//                  a model of its peripheral
+//
+// Only the peripherals and core functions the course code uses are here.
+//*****************************************************************************
+#ifndef __TM4C123GH6PM_H__
+#define __TM4C123GH6PM_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define __I     volatile const
+#define __O     volatile
+#define __IO    volatile
+
+// ARMCC keywords.  Functions the Keil build inlines are plain functions here.
+#define __INLINE
+#ifndef __packed
+#define __packed              __attribute__((packed))
+#endif
+
+#define __NVIC_PRIO_BITS      3
+
+typedef enum
+{
+  Reset_IRQn            = -15,
+  NonMaskableInt_IRQn   = -14,
+  HardFault_IRQn        = -13,
+  MemoryManagement_IRQn = -12,
+  BusFault_IRQn         = -11,
+  UsageFault_IRQn       = -10,
+  SVCall_IRQn           =  -5,
+  DebugMonitor_IRQn     =  -4,
+  PendSV_IRQn           =  -2,
+  SysTick_IRQn          =  -1,
+  GPIOA_IRQn            =   0,
+  GPIOB_IRQn            =   1,
+  GPIOC_IRQn            =   2,
+  GPIOD_IRQn            =   3,
+  GPIOE_IRQn            =   4,
+  UART0_IRQn            =   5,
+  UART1_IRQn            =   6,
+  SSI0_IRQn             =   7,
+  I2C0_IRQn             =   8,
+  ADC0SS0_IRQn          =  14,
+  ADC0SS1_IRQn          =  15,
+  ADC0SS2_IRQn          =  16,
+  ADC0SS3_IRQn          =  17,
+  WATCHDOG0_IRQn        =  18,
+  TIMER0A_IRQn          =  19,
+  TIMER0B_IRQn          =  20,
+  TIMER1A_IRQn          =  21,
+  TIMER1B_IRQn          =  22,
+  TIMER2A_IRQn          =  23,
+  TIMER2B_IRQn          =  24,
+  SYSCTL_IRQn           =  28,
+  FLASH_CTRL_IRQn       =  29,
+  GPIOF_IRQn            =  30,
+  UART2_IRQn            =  33,
+  SSI1_IRQn             =  34,
+  TIMER3A_IRQn          =  35,
+  TIMER3B_IRQn          =  36,
+  I2C1_IRQn             =  37,
+  HIB_IRQn              =  43,
+  USB0_IRQn             =  44,
+  UDMA_IRQn             =  46,
+  UDMAERR_IRQn          =  47,
+  ADC1SS0_IRQn          =  48,
+  ADC1SS1_IRQn          =  49,
+  ADC1SS2_IRQn          =  50,
+  ADC1SS3_IRQn          =  51,
+  SSI2_IRQn             =  57,
+  SSI3_IRQn             =  58,
+  UART3_IRQn            =  59,
+  UART4_IRQn            =  60,
+  UART5_IRQn            =  61,
+  UART6_IRQn            =  62,
+  UART7_IRQn            =  63,
+  I2C2_IRQn             =  68,
+  I2C3_IRQn             =  69,
+  TIMER4A_IRQn          =  70,
+  TIMER4B_IRQn          =  71,
+  TIMER5A_IRQn          =  92,
+  TIMER5B_IRQn          =  93,
+  WTIMER0A_IRQn         =  94,
+  WTIMER0B_IRQn         =  95,
+  SYSEXC_IRQn           = 106
+} IRQn_Type;
+
+//*****************************************************************************
+// Peripheral register blocks
+//*****************************************************************************
+typedef struct
+{
+  __I  uint32_t RESERVED0[255];
+  __IO uint32_t DATA;                   // 0x3FC, DATA + 4 * mask in RESERVED0
+  __IO uint32_t DIR;
+  __IO uint32_t IS;
+  __IO uint32_t IBE;
+  __IO uint32_t IEV;
+  __IO uint32_t IM;
+  __IO uint32_t RIS;
+  __IO uint32_t MIS;
+  __O  uint32_t ICR;
+  __IO uint32_t AFSEL;
+  __I  uint32_t RESERVED1[55];
+  __IO uint32_t DR2R;                   // 0x500
+  __IO uint32_t DR4R;
+  __IO uint32_t DR8R;
+  __IO uint32_t ODR;
+  __IO uint32_t PUR;
+  __IO uint32_t PDR;
+  __IO uint32_t SLR;
+  __IO uint32_t DEN;
+  __IO uint32_t LOCK;
+  __IO uint32_t CR;
+  __IO uint32_t AMSEL;
+  __IO uint32_t PCTL;
+  __IO uint32_t ADCCTL;
+  __IO uint32_t DMACTL;
+} GPIOA_Type;
+
+typedef struct
+{
+  __IO uint32_t CR0;
+  __IO uint32_t CR1;
+  __IO uint32_t DR;
+  __IO uint32_t SR;
+  __IO uint32_t CPSR;
+  __IO uint32_t IM;
+  __IO uint32_t RIS;
+  __IO uint32_t MIS;
+  __O  uint32_t ICR;
+  __IO uint32_t DMACTL;
+  __I  uint32_t RESERVED[1000];
+  __IO uint32_t CC;                     // 0xFC8
+} SSI0_Type;
+
+typedef struct
+{
+  __IO uint32_t DR;
+  union
+  {
+    __IO uint32_t ECR;
+    __IO uint32_t RSR;
+  };
+  __I  uint32_t RESERVED0[4];
+  __IO uint32_t FR;                     // 0x018
+  __I  uint32_t RESERVED1;
+  __IO uint32_t ILPR;
+  __IO uint32_t IBRD;
+  __IO uint32_t FBRD;
+  __IO uint32_t LCRH;
+  __IO uint32_t CTL;
+  __IO uint32_t IFLS;
+  __IO uint32_t IM;
+  __IO uint32_t RIS;
+  __IO uint32_t MIS;
+  __O  uint32_t ICR;
+  __IO uint32_t DMACTL;
+  __I  uint32_t RESERVED2[22];
+  __IO uint32_t _9BITADDR;              // 0x0A4
+  __IO uint32_t _9BITAMASK;
+  __I  uint32_t RESERVED3[965];
+  __IO uint32_t PP;                     // 0xFC0
+  __I  uint32_t RESERVED4;
+  __IO uint32_t CC;
+} UART0_Type;
+
+typedef struct
+{
+  __IO uint32_t MSA;
+  __IO uint32_t MCS;
+  __IO uint32_t MDR;
+  __IO uint32_t MTPR;
+  __IO uint32_t MIMR;
+  __IO uint32_t MRIS;
+  __IO uint32_t MMIS;
+  __O  uint32_t MICR;
+  __IO uint32_t MCR;
+  __IO uint32_t MCLKOCNT;
+  __I  uint32_t RESERVED0;
+  __IO uint32_t MBMON;
+  __I  uint32_t RESERVED1[2];
+  __IO uint32_t MCR2;                   // 0x038
+  __I  uint32_t RESERVED2[497];
+  __IO uint32_t SOAR;                   // 0x800
+  __IO uint32_t SCSR;
+  __IO uint32_t SDR;
+  __IO uint32_t SIMR;
+  __IO uint32_t SRIS;
+  __IO uint32_t SMIS;
+  __O  uint32_t SICR;
+  __IO uint32_t SOAR2;
+  __IO uint32_t SACKCTL;
+  __I  uint32_t RESERVED3[487];
+  __IO uint32_t PP;                     // 0xFC0
+  __IO uint32_t PC;
+} I2C0_Type;
+
+typedef struct
+{
+  __IO uint32_t CFG;
+  __IO uint32_t TAMR;
+  __IO uint32_t TBMR;
+  __IO uint32_t CTL;
+  __IO uint32_t SYNC;
+  __I  uint32_t RESERVED0;
+  __IO uint32_t IMR;
+  __IO uint32_t RIS;
+  __IO uint32_t MIS;
+  __O  uint32_t ICR;
+  __IO uint32_t TAILR;
+  __IO uint32_t TBILR;
+  __IO uint32_t TAMATCHR;
+  __IO uint32_t TBMATCHR;
+  __IO uint32_t TAPR;
+  __IO uint32_t TBPR;
+  __IO uint32_t TAPMR;
+  __IO uint32_t TBPMR;
+  __IO uint32_t TAR;
+  __IO uint32_t TBR;
+  __IO uint32_t TAV;                    // 0x050
+  __IO uint32_t TBV;
+  __IO uint32_t RTCPD;
+  __IO uint32_t TAPS;
+  __IO uint32_t TBPS;
+  __IO uint32_t TAPV;
+  __IO uint32_t TBPV;
+  __I  uint32_t RESERVED1[981];
+  __IO uint32_t PP;                     // 0xFC0
+} TIMER0_Type;
+
+typedef struct
+{
+  __IO uint32_t ACTSS;
+  __IO uint32_t RIS;
+  __IO uint32_t IM;
+  __IO uint32_t ISC;
+  __IO uint32_t OSTAT;
+  __IO uint32_t EMUX;
+  __IO uint32_t USTAT;
+  __IO uint32_t TSSEL;
+  __IO uint32_t SSPRI;
+  __IO uint32_t SPC;
+  __IO uint32_t PSSI;
+  __I  uint32_t RESERVED0;
+  __IO uint32_t SAC;
+  __IO uint32_t DCISC;
+  __IO uint32_t CTL;
+  __I  uint32_t RESERVED1;
+  __IO uint32_t SSMUX0;                 // 0x040
+  __IO uint32_t SSCTL0;
+  __IO uint32_t SSFIFO0;
+  __IO uint32_t SSFSTAT0;
+  __IO uint32_t SSOP0;
+  __IO uint32_t SSDC0;
+  __I  uint32_t RESERVED2[2];
+  __IO uint32_t SSMUX1;                 // 0x060
+  __IO uint32_t SSCTL1;
+  __IO uint32_t SSFIFO1;
+  __IO uint32_t SSFSTAT1;
+  __IO uint32_t SSOP1;
+  __IO uint32_t SSDC1;
+  __I  uint32_t RESERVED3[2];
+  __IO uint32_t SSMUX2;                 // 0x080
+  __IO uint32_t SSCTL2;
+  __IO uint32_t SSFIFO2;
+  __IO uint32_t SSFSTAT2;
+  __IO uint32_t SSOP2;
+  __IO uint32_t SSDC2;
+  __I  uint32_t RESERVED4[2];
+  __IO uint32_t SSMUX3;                 // 0x0A0
+  __IO uint32_t SSCTL3;
+  __IO uint32_t SSFIFO3;
+  __IO uint32_t SSFSTAT3;
+  __IO uint32_t SSOP3;
+  __IO uint32_t SSDC3;
+  __I  uint32_t RESERVED5[786];
+  __O  uint32_t DCRIC;                  // 0xD00
+  __I  uint32_t RESERVED6[63];
+  __IO uint32_t DCCTL[8];               // 0xE00
+  __I  uint32_t RESERVED7[8];
+  __IO uint32_t DCCMP[8];               // 0xE40
+  __I  uint32_t RESERVED8[88];
+  __IO uint32_t PP;                     // 0xFC0
+  __IO uint32_t PC;
+  __IO uint32_t CC;
+} ADC0_Type;
+
+// The run mode, sleep, deep sleep clock gating and present registers all
+// have this layout, one register per kind of peripheral
+#define SYSCTL_PERIPH_BLOCK(p)                  \
+  __IO uint32_t p##WD;                          \
+  __IO uint32_t p##TIMER;                       \
+  __IO uint32_t p##GPIO;                        \
+  __IO uint32_t p##DMA;                         \
+  __I  uint32_t p##_RESERVED0;                  \
+  __IO uint32_t p##HIB;                         \
+  __IO uint32_t p##UART;                        \
+  __IO uint32_t p##SSI;                         \
+  __IO uint32_t p##I2C;                         \
+  __I  uint32_t p##_RESERVED1;                  \
+  __IO uint32_t p##USB;                         \
+  __I  uint32_t p##_RESERVED2[2];               \
+  __IO uint32_t p##CAN;                         \
+  __IO uint32_t p##ADC;                         \
+  __IO uint32_t p##ACMP;                        \
+  __IO uint32_t p##PWM;                         \
+  __IO uint32_t p##QEI;                         \
+  __I  uint32_t p##_RESERVED3[4];               \
+  __IO uint32_t p##EEPROM;                      \
+  __IO uint32_t p##WTIMER;
+
+typedef struct
+{
+  __IO uint32_t DID0;
+  __IO uint32_t DID1;
+  __IO uint32_t DC0;
+  __I  uint32_t RESERVED0;
+  __IO uint32_t DC1;
+  __IO uint32_t DC2;
+  __IO uint32_t DC3;
+  __IO uint32_t DC4;
+  __IO uint32_t DC5;
+  __IO uint32_t DC6;
+  __IO uint32_t DC7;
+  __IO uint32_t DC8;
+  __IO uint32_t PBORCTL;
+  __I  uint32_t RESERVED1[3];
+  __IO uint32_t SRCR0;                  // 0x040
+  __IO uint32_t SRCR1;
+  __IO uint32_t SRCR2;
+  __I  uint32_t RESERVED2;
+  __IO uint32_t RIS;                    // 0x050
+  __IO uint32_t IMC;
+  __IO uint32_t MISC;
+  __IO uint32_t RESC;
+  __IO uint32_t RCC;                    // 0x060
+  __I  uint32_t RESERVED3[2];
+  __IO uint32_t GPIOHBCTL;
+  __IO uint32_t RCC2;                   // 0x070
+  __I  uint32_t RESERVED4[2];
+  __IO uint32_t MOSCCTL;
+  __I  uint32_t RESERVED5[49];
+  __IO uint32_t DSLPCLKCFG;             // 0x144
+  __I  uint32_t RESERVED6;
+  __IO uint32_t SYSPROP;
+  __IO uint32_t PIOSCCAL;
+  __IO uint32_t PIOSCSTAT;
+  __I  uint32_t RESERVED7[2];
+  __IO uint32_t PLLFREQ0;               // 0x160
+  __IO uint32_t PLLFREQ1;
+  __IO uint32_t PLLSTAT;
+  __I  uint32_t RESERVED8[7];
+  __IO uint32_t SLPPWRCFG;              // 0x188
+  __IO uint32_t DSLPPWRCFG;
+  __IO uint32_t DC9;
+  __I  uint32_t RESERVED9[3];
+  __IO uint32_t NVMSTAT;                // 0x1A0
+  __I  uint32_t RESERVED10[4];
+  __IO uint32_t LDOSPCTL;               // 0x1B4
+  __I  uint32_t RESERVED11;
+  __IO uint32_t LDODPCTL;
+  __I  uint32_t RESERVED12[80];
+  SYSCTL_PERIPH_BLOCK(PP)               // 0x300
+  __I  uint32_t RESERVED13[104];
+  SYSCTL_PERIPH_BLOCK(SR)               // 0x500
+  __I  uint32_t RESERVED14[40];
+  SYSCTL_PERIPH_BLOCK(RCGC)             // 0x600
+  __I  uint32_t RESERVED15[40];
+  SYSCTL_PERIPH_BLOCK(SCGC)             // 0x700
+  __I  uint32_t RESERVED16[40];
+  SYSCTL_PERIPH_BLOCK(DCGC)             // 0x800
+  __I  uint32_t RESERVED17[104];
+  SYSCTL_PERIPH_BLOCK(PR)               // 0xA00
+} SYSCTL_Type;
+
+#undef SYSCTL_PERIPH_BLOCK
+
+//*****************************************************************************
+// Cortex-M4 core, the parts of CMSIS core_cm4.h in use
+//*****************************************************************************
+typedef struct
+{
+  __IO uint32_t CTRL;
+  __IO uint32_t LOAD;
+  __IO uint32_t VAL;
+  __I  uint32_t CALIB;
+} SysTick_Type;
+
+typedef struct
+{
+  __IO uint32_t ISER[8];
+  uint32_t      RESERVED0[24];
+  __IO uint32_t ICER[8];                // 0x080
+  uint32_t      RESERVED1[24];
+  __IO uint32_t ISPR[8];                // 0x100
+  uint32_t      RESERVED2[24];
+  __IO uint32_t ICPR[8];                // 0x180
+  uint32_t      RESERVED3[24];
+  __IO uint32_t IABR[8];                // 0x200
+  uint32_t      RESERVED4[56];
+  __IO uint8_t  IP[240];                // 0x300
+  uint32_t      RESERVED5[644];
+  __O  uint32_t STIR;                   // 0xE00
+} NVIC_Type;
+
+typedef struct
+{
+  __I  uint32_t CPUID;
+  __IO uint32_t ICSR;
+  __IO uint32_t VTOR;
+  __IO uint32_t AIRCR;
+  __IO uint32_t SCR;
+  __IO uint32_t CCR;
+  __IO uint8_t  SHP[12];
+  __IO uint32_t SHCSR;
+  __IO uint32_t CFSR;
+  __IO uint32_t HFSR;
+  __IO uint32_t DFSR;
+  __IO uint32_t MMFAR;
+  __IO uint32_t BFAR;
+  __IO uint32_t AFSR;
+  __I  uint32_t PFR[2];
+  __I  uint32_t DFR;
+  __I  uint32_t ADR;
+  __I  uint32_t MMFR[4];
+  __I  uint32_t ISAR[5];
+  uint32_t      RESERVED0[5];
+  __IO uint32_t CPACR;                  // 0x088
+} SCB_Type;
+
+//*****************************************************************************
+// Memory map
+//*****************************************************************************
+#define WATCHDOG0_BASE        0x40000000UL
+#define GPIOA_BASE            0x40004000UL
+#define GPIOB_BASE            0x40005000UL
+#define GPIOC_BASE            0x40006000UL
+#define GPIOD_BASE            0x40007000UL
+#define SSI0_BASE             0x40008000UL
+#define SSI1_BASE             0x40009000UL
+#define SSI2_BASE             0x4000A000UL
+#define SSI3_BASE             0x4000B000UL
+#define UART0_BASE            0x4000C000UL
+#define UART1_BASE            0x4000D000UL
+#define UART2_BASE            0x4000E000UL
+#define UART3_BASE            0x4000F000UL
+#define UART4_BASE            0x40010000UL
+#define UART5_BASE            0x40011000UL
+#define UART6_BASE            0x40012000UL
+#define UART7_BASE            0x40013000UL
+#define I2C0_BASE             0x40020000UL
+#define I2C1_BASE             0x40021000UL
+#define I2C2_BASE             0x40022000UL
+#define I2C3_BASE             0x40023000UL
+#define GPIOE_BASE            0x40024000UL
+#define GPIOF_BASE            0x40025000UL
+#define TIMER0_BASE           0x40030000UL
+#define TIMER1_BASE           0x40031000UL
+#define TIMER2_BASE           0x40032000UL
+#define TIMER3_BASE           0x40033000UL
+#define TIMER4_BASE           0x40034000UL
+#define TIMER5_BASE           0x40035000UL
+#define WTIMER0_BASE          0x40036000UL
+#define WTIMER1_BASE          0x40037000UL
+#define ADC0_BASE             0x40038000UL
+#define ADC1_BASE             0x40039000UL
+#define SYSCTL_BASE           0x400FE000UL
+
+#define SysTick_BASE          0xE000E010UL
+#define NVIC_BASE             0xE000E100UL
+#define SCB_BASE              0xE000ED00UL
+
+#define GPIOA                 ((GPIOA_Type *) GPIOA_BASE)
+#define GPIOB                 ((GPIOA_Type *) GPIOB_BASE)
+#define GPIOC                 ((GPIOA_Type *) GPIOC_BASE)
+#define GPIOD                 ((GPIOA_Type *) GPIOD_BASE)
+#define GPIOE                 ((GPIOA_Type *) GPIOE_BASE)
+#define GPIOF                 ((GPIOA_Type *) GPIOF_BASE)
+#define SSI0                  ((SSI0_Type *) SSI0_BASE)
+#define SSI1                  ((SSI0_Type *) SSI1_BASE)
+#define SSI2                  ((SSI0_Type *) SSI2_BASE)
+#define SSI3                  ((SSI0_Type *) SSI3_BASE)
+#define UART0                 ((UART0_Type *) UART0_BASE)
+#define UART1                 ((UART0_Type *) UART1_BASE)
+#define UART2                 ((UART0_Type *) UART2_BASE)
+#define UART3                 ((UART0_Type *) UART3_BASE)
+#define UART4                 ((UART0_Type *) UART4_BASE)
+#define UART5                 ((UART0_Type *) UART5_BASE)
+#define UART6                 ((UART0_Type *) UART6_BASE)
+#define UART7                 ((UART0_Type *) UART7_BASE)
+#define I2C0                  ((I2C0_Type *) I2C0_BASE)
+#define I2C1                  ((I2C0_Type *) I2C1_BASE)
+#define I2C2                  ((I2C0_Type *) I2C2_BASE)
+#define I2C3                  ((I2C0_Type *) I2C3_BASE)
+#define TIMER0                ((TIMER0_Type *) TIMER0_BASE)
+#define TIMER1                ((TIMER0_Type *) TIMER1_BASE)
+#define TIMER2                ((TIMER0_Type *) TIMER2_BASE)
+#define TIMER3                ((TIMER0_Type *) TIMER3_BASE)
+#define TIMER4                ((TIMER0_Type *) TIMER4_BASE)
+#define TIMER5                ((TIMER0_Type *) TIMER5_BASE)
+#define WTIMER0               ((TIMER0_Type *) WTIMER0_BASE)
+#define WTIMER1               ((TIMER0_Type *) WTIMER1_BASE)
+#define ADC0                  ((ADC0_Type *) ADC0_BASE)
+#define ADC1                  ((ADC0_Type *) ADC1_BASE)
+#define SYSCTL                ((SYSCTL_Type *) SYSCTL_BASE)
+
+#define SysTick               ((SysTick_Type *) SysTick_BASE)
+#define NVIC                  ((NVIC_Type *) NVIC_BASE)
+#define SCB                   ((SCB_Type *) SCB_BASE)
+
+#define SysTick_CTRL_ENABLE_Msk     (1UL << 0)
+#define SysTick_CTRL_TICKINT_Msk    (1UL << 1)
+#define SysTick_CTRL_CLKSOURCE_Msk  (1UL << 2)
+#define SysTick_LOAD_RELOAD_Msk     0xFFFFFFUL
+
+//*****************************************************************************
+// CMSIS core functions.  The NVIC ones write the same registers as on the
+// part.  PRIMASK is a variable in registers.c.
+//*****************************************************************************
+extern uint32_t host_primask;
+
+static inline void __enable_irq(void)                 { host_primask = 0; }
+static inline void __disable_irq(void)                { host_primask = 1; }
+static inline uint32_t __get_PRIMASK(void)            { return host_primask; }
+static inline void __set_PRIMASK(uint32_t primask)    { host_primask = primask & 1; }
+static inline void __NOP(void)                        { }
+static inline void __WFI(void)                        { }
+static inline void __DSB(void)                        { }
+static inline void __ISB(void)                        { }
+
+static inline void NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+  NVIC->ISER[(uint32_t)IRQn >> 5] = 1UL << ((uint32_t)IRQn & 0x1F);
+}
+
+static inline void NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+  NVIC->ICER[(uint32_t)IRQn >> 5] = 1UL << ((uint32_t)IRQn & 0x1F);
+}
+
+static inline void NVIC_SetPendingIRQ(IRQn_Type IRQn)
+{
+  NVIC->ISPR[(uint32_t)IRQn >> 5] = 1UL << ((uint32_t)IRQn & 0x1F);
+}
+
+static inline void NVIC_ClearPendingIRQ(IRQn_Type IRQn)
+{
+  NVIC->ICPR[(uint32_t)IRQn >> 5] = 1UL << ((uint32_t)IRQn & 0x1F);
+}
+
+static inline void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority)
+{
+  if((int32_t)IRQn < 0)
+  {
+    SCB->SHP[((uint32_t)IRQn & 0xF) - 4] = (priority << (8 - __NVIC_PRIO_BITS)) & 0xFF;
+  }
+  else
+  {
+    NVIC->IP[(uint32_t)IRQn] = (priority << (8 - __NVIC_PRIO_BITS)) & 0xFF;
+  }
+}
+
+static inline uint32_t SysTick_Config(uint32_t ticks)
+{
+  if((ticks - 1) > SysTick_LOAD_RELOAD_Msk)
+  {
+    return 1;
+  }
+  SysTick->LOAD = ticks - 1;
+  NVIC_SetPriority(SysTick_IRQn, (1UL << __NVIC_PRIO_BITS) - 1);
+  SysTick->VAL = 0;
+  SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+  return 0;
+}
+
+//*****************************************************************************
+// Maps memory over the peripheral and core register windows.  Must be
+// called before any register is touched.  With the sim linked instead of
+// registers.c the windows are mapped before main and this only returns true.
+//
+// Returns false if the addresses are already in use in this process.
+//*****************************************************************************
+bool host_map_registers(void);
+
+#endif
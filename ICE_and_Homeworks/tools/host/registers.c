@@ -0,0 +1,31 @@
+//*****************************************************************************
+// registers.c -- backing memory for the register addresses in the host
+// TM4C123GH6PM.h
+//*****************************************************************************
+#define _GNU_SOURCE
+#include <sys/mman.h>
+#include "TM4C123GH6PM.h"
+
+// Every peripheral in the header, through SYSCTL
+#define PERIPH_WINDOW_BASE    0x40000000UL
+#define PERIPH_WINDOW_SIZE    0x00100000UL
+
+// SysTick, NVIC and SCB
+#define CORE_WINDOW_BASE      0xE000E000UL
+#define CORE_WINDOW_SIZE      0x00001000UL
+
+uint32_t host_primask = 1;
+
+static bool map_window(unsigned long base, unsigned long size)
+{
+  void *p = mmap((void *)base, size, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+  return p == (void *)base;
+}
+
+bool host_map_registers(void)
+{
+  return map_window(PERIPH_WINDOW_BASE, PERIPH_WINDOW_SIZE) &&
+         map_window(CORE_WINDOW_BASE, CORE_WINDOW_SIZE);
+}
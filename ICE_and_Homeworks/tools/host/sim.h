@@ -0,0 +1,198 @@
+//*****************************************************************************
+// sim.h -- virtual TM4C123 for host builds of the board code
+//
+// Linked into a host program (see tools/CMakeLists.txt), the register
+// windows of the host TM4C123GH6PM.h are mapped with no access at all.
+// Every load and store a driver makes to a register faults.  The fault
+// handler hands it to the model of that peripheral and single steps the
+// instruction, so the drivers, the game and the labs run unmodified while
+// the models see every bus operation:
+//
+//    GPIO      DATA address masking, direction, pull ups, edge and level
+//              interrupts, inputs set with sim_gpio_input
+//    UART      16 byte FIFOs drained at the baud rate, UART0 is stdin and
+//              stdout
+//    SSI       8 frame FIFOs shifted at the bit rate through a device
+//    I2C       master, byte timing from MTPR, devices by address
+//    GPTM      one shot and periodic, up and down, 16 bit with prescaler
+//              and 32 bit, timeouts and interrupts
+//    ADC       processor triggered sample sequencers
+//    SysTick   and the NVIC, SCB and SYSCTL clock gating
+//
+// Anything else in the windows is plain memory.
+//
+// Time is simulated: every access costs SIM_ACCESS_CYCLES of the 50MHz
+// clock.  A loop that polls one register is sped up toward the next event,
+// and if no register is touched for SIM_IDLE_MS of host time, as in a main
+// loop waiting on a flag, time skips to the next event.  Interrupts are
+// taken after the access that raised them, in priority order, and never
+// while PRIMASK is set.
+//
+// At exit the number of reads and writes of every peripheral that was used
+// goes to stderr.  SIM_MS=n in the environment ends the program after n
+// simulated milliseconds.
+//
+// x86-64 Linux only: the stepping uses the trap flag.
+//*****************************************************************************
+#ifndef __SIM_H__
+#define __SIM_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#define SIM_CLOCK_HZ          50000000UL
+
+// Cycles one register access costs
+#define SIM_ACCESS_CYCLES     4
+
+// Most cycles one poll of a register is stretched to
+#define SIM_POLL_MAX_CYCLES   1000
+
+// Host time with no register access before time skips ahead
+#define SIM_IDLE_MS           1
+
+typedef struct
+{
+  uint64_t  reads;
+  uint64_t  writes;
+} sim_counts_t;
+
+//*****************************************************************************
+// Time
+//*****************************************************************************
+
+// Cycles since the program started
+uint64_t sim_cycles(void);
+
+// Lets time pass, ex for instructions a host stand-in does not execute
+void sim_delay(uint32_t cycles);
+
+//*****************************************************************************
+// Bus operation counts
+//*****************************************************************************
+
+// Counts of the peripheral at base.  Returns false for an unknown base.
+bool sim_counts(uint32_t base, sim_counts_t *counts);
+
+// Counts of every peripheral together
+void sim_total_counts(sim_counts_t *counts);
+
+// Starts every count over
+void sim_clear_counts(void);
+
+// Writes the counts of every peripheral used, as at exit
+void sim_report(FILE *out);
+
+//*****************************************************************************
+// Device side
+//*****************************************************************************
+
+// Drives input pins of a GPIO port from outside, high or low
+void sim_gpio_input(uint32_t base, uint8_t pins, bool high);
+
+// Stops driving pins, they read their pull up or pull down again
+void sim_gpio_release(uint32_t base, uint8_t pins);
+
+// Levels of a port's pins, as a device on them sees them
+uint8_t sim_gpio_level(uint32_t base);
+
+// Called after the output level of any pin of a port changes
+typedef void (*sim_gpio_watch_t)(void *context, uint8_t before, uint8_t after);
+bool sim_gpio_watch(uint32_t base, sim_gpio_watch_t watch, void *context);
+
+// Queues a byte for a UART to receive at its baud rate
+void sim_uart_receive(uint32_t base, uint8_t byte);
+
+// Sets the level an ADC input converts to, 0 to 4095
+void sim_adc_input(uint8_t channel, uint16_t value);
+
+// An SSI slave.  exchange gets each frame sent and returns the frame
+// received, first is set for a frame that did not follow straight on from
+// the last one.
+typedef uint16_t (*sim_ssi_exchange_t)(void *context, uint16_t frame, bool first);
+bool sim_ssi_attach(uint32_t base, sim_ssi_exchange_t exchange, void *context);
+
+// An I2C slave
+typedef struct
+{
+  bool      (*start)(void *context, bool read);         // true to ACK
+  bool      (*write)(void *context, uint8_t data);      // true to ACK
+  uint8_t   (*read)(void *context, bool ack);
+  void      (*stop)(void *context);
+  void      *context;
+} sim_i2c_device_t;
+
+bool sim_i2c_attach(uint32_t base, uint8_t address, const sim_i2c_device_t *device);
+
+//*****************************************************************************
+// The ECE353 board, sim_board.c
+//*****************************************************************************
+
+// Holds down the MCP23017 direction buttons set in pressed, bit n for port
+// B pin n as DIR_BTN_UP_PIN and the rest number them, and lets go of the
+// others
+void sim_board_buttons(uint8_t pressed);
+
+// Touches the panel at screen x, y, or lifts off, and pulses the FT6x06's
+// INT for the new report
+void sim_board_touch(bool touched, uint16_t x, uint16_t y);
+
+// RGB565 pixel the ILI9341 shows at screen x, y, in lcd.c's orientation
+// with its default MADCTL, after vertical scrolling
+uint16_t sim_board_lcd_pixel(uint16_t x, uint16_t y);
+
+//*****************************************************************************
+// A register file device, for I2C or SPI slaves that are an address
+// pointer into registers.  A write sets the pointer from the first
+// address_bytes bytes, the rest are stored from there on.  A read returns
+// from the pointer.  The pointer moves on after each byte and wraps at
+// size.  On I2C, a write_cycles long write cycle after a write NACKs the
+// address, as an EEPROM does.
+//*****************************************************************************
+typedef struct sim_regs sim_regs_t;
+
+struct sim_regs
+{
+  uint8_t   *regs;
+  uint32_t  size;
+  uint8_t   address_bytes;
+  uint8_t   address_read_bit;         // SPI: set in the address for a read
+  uint32_t  pointer;
+  uint8_t   address_seen;
+  bool      read;
+  bool      wrote;
+  uint32_t  write_cycles;
+  uint64_t  busy_until;
+
+  // optional, after a register is written and before one is read
+  void      (*written)(sim_regs_t *regs, uint32_t reg);
+  void      (*reading)(sim_regs_t *regs, uint32_t reg);
+  void      *context;
+};
+
+void sim_regs_init(sim_regs_t *regs, uint8_t *data, uint32_t size, uint8_t address_bytes);
+
+// Puts regs on an I2C bus or an SSI
+bool sim_regs_attach_i2c(sim_regs_t *regs, uint32_t base, uint8_t address);
+bool sim_regs_attach_ssi(sim_regs_t *regs, uint32_t base, uint8_t address_read_bit);
+
+//*****************************************************************************
+// Events, for device models that change on their own
+//*****************************************************************************
+typedef struct sim_event sim_event_t;
+
+struct sim_event
+{
+  void        (*fire)(sim_event_t *event);
+  void        *context;
+  uint64_t    when;
+  bool        armed;
+  sim_event_t *next;
+};
+
+// Fires event at cycle when, replacing any earlier time it was set for
+void sim_event_at(sim_event_t *event, uint64_t when);
+void sim_event_cancel(sim_event_t *event);
+
+#endif
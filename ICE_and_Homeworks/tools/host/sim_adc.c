@@ -0,0 +1,268 @@
+//*****************************************************************************
+// sim_adc.c -- ADC0 and ADC1 of the virtual TM4C123, see sim.h
+//
+// Processor triggered sample sequencers only.  Writing PSSI starts each
+// enabled sequencer it names.  Its steps come from SSMUXn and SSCTLn up to
+// the one marked END, take SAMPLE_CYCLES each at 1Msps and then land in
+// the sequencer's FIFO together.  A channel converts the level
+// sim_adc_input last set, mid scale until then.
+//*****************************************************************************
+#include "sim_internal.h"
+
+#define ADCS                  2
+#define SEQUENCERS            4
+#define CHANNELS              12
+
+#define REG(m)                SIM_REG(ADC0_Type, m)
+
+// SSMUXn, SSCTLn, SSFIFOn and SSFSTATn are 0x20 apart
+#define SS_BASE               REG(SSMUX0)
+#define SS_STRIDE             0x20
+#define SS_MUX                0x0
+#define SS_CTL                0x4
+#define SS_FIFO               0x8
+#define SS_FSTAT              0xC
+
+#define ACTSS_BUSY            0x10000
+
+#define SSCTL_END             0x2
+#define SSCTL_IE              0x4
+#define SSCTL_TS              0x8
+
+#define SSFSTAT_EMPTY         0x100
+#define SSFSTAT_FULL          0x1000
+
+#define SAMPLE_CYCLES         50
+#define MID_SCALE             2048
+
+// about 25C on the internal temperature sensor
+#define TEMPERATURE           1750
+
+typedef struct adc adc_t;
+
+typedef struct
+{
+  adc_t         *adc;
+  int           number;
+  int           irq;
+  uint16_t      fifo[8];
+  int           head;
+  int           count;
+  sim_event_t   done;
+} sequencer_t;
+
+struct adc
+{
+  sim_block_t   block;
+  sequencer_t   sequencers[SEQUENCERS];
+};
+
+static adc_t adcs[ADCS];
+static uint16_t inputs[CHANNELS];
+
+static const int steps[SEQUENCERS] = { 8, 4, 4, 1 };
+
+static const struct
+{
+  const char  *name;
+  uint32_t    base;
+  int         irq[SEQUENCERS];
+} adc_info[ADCS] =
+{
+  { "ADC0", ADC0_BASE, { ADC0SS0_IRQn, ADC0SS1_IRQn, ADC0SS2_IRQn, ADC0SS3_IRQn } },
+  { "ADC1", ADC1_BASE, { ADC1SS0_IRQn, ADC1SS1_IRQn, ADC1SS2_IRQn, ADC1SS3_IRQn } },
+};
+
+static uint32_t reg(adc_t *adc, uint32_t offset)
+{
+  return *sim_reg(&adc->block, offset);
+}
+
+static uint32_t ss_reg(sequencer_t *ss, uint32_t which)
+{
+  return reg(ss->adc, SS_BASE + ss->number * SS_STRIDE + which);
+}
+
+static void update_irq(adc_t *adc)
+{
+  uint32_t mis = reg(adc, REG(RIS)) & reg(adc, REG(IM));
+  int i;
+
+  for(i = 0; i < SEQUENCERS; i++)
+  {
+    sim_irq_level(adc->sequencers[i].irq, (mis & (1u << i)) != 0);
+  }
+}
+
+// The steps to the END, whether any raises the interrupt
+static int sequence(sequencer_t *ss, uint16_t *samples, bool *interrupt)
+{
+  uint32_t mux = ss_reg(ss, SS_MUX);
+  uint32_t ctl = ss_reg(ss, SS_CTL);
+  uint32_t step_ctl;
+  uint32_t channel;
+  int i;
+
+  *interrupt = false;
+  for(i = 0; i < steps[ss->number]; i++)
+  {
+    step_ctl = (ctl >> (4 * i)) & 0xF;
+    channel = (mux >> (4 * i)) & 0xF;
+    samples[i] = (step_ctl & SSCTL_TS) ? TEMPERATURE :
+                 (channel < CHANNELS) ? inputs[channel] : 0;
+    *interrupt |= (step_ctl & SSCTL_IE) != 0;
+    if(step_ctl & SSCTL_END)
+    {
+      return i + 1;
+    }
+  }
+  return steps[ss->number];
+}
+
+static void done(sim_event_t *event)
+{
+  sequencer_t *ss = event->context;
+  uint16_t samples[8];
+  bool interrupt;
+  int count = sequence(ss, samples, &interrupt);
+  int i;
+
+  for(i = 0; i < count && ss->count < steps[ss->number]; i++)
+  {
+    ss->fifo[(ss->head + ss->count) % steps[ss->number]] = samples[i];
+    ss->count++;
+  }
+  if(interrupt)
+  {
+    *sim_reg(&ss->adc->block, REG(RIS)) |= 1u << ss->number;
+    update_irq(ss->adc);
+  }
+}
+
+static void start(sequencer_t *ss)
+{
+  uint16_t samples[8];
+  bool interrupt;
+
+  if(!(reg(ss->adc, REG(ACTSS)) & (1u << ss->number)) || ss->done.armed)
+  {
+    return;
+  }
+  sim_event_at(&ss->done, sim_now + sequence(ss, samples, &interrupt) * SAMPLE_CYCLES);
+}
+
+static uint32_t adc_read(sim_block_t *block, uint32_t offset, bool peek)
+{
+  adc_t *adc = (adc_t *)block;
+  sequencer_t *ss;
+  uint32_t which;
+  uint32_t value;
+  int i;
+
+  if(offset >= SS_BASE && offset < SS_BASE + SEQUENCERS * SS_STRIDE)
+  {
+    ss = &adc->sequencers[(offset - SS_BASE) / SS_STRIDE];
+    which = (offset - SS_BASE) % SS_STRIDE;
+    if(which == SS_FIFO)
+    {
+      if(ss->count == 0)
+      {
+        return 0;
+      }
+      value = ss->fifo[ss->head];
+      if(!peek)
+      {
+        ss->head = (ss->head + 1) % steps[ss->number];
+        ss->count--;
+      }
+      return value;
+    }
+    if(which == SS_FSTAT)
+    {
+      return ((ss->count == 0) ? SSFSTAT_EMPTY : 0) |
+             ((ss->count == steps[ss->number]) ? SSFSTAT_FULL : 0);
+    }
+  }
+  if(offset == REG(ACTSS))
+  {
+    value = reg(adc, REG(ACTSS)) & 0xF;
+    for(i = 0; i < SEQUENCERS; i++)
+    {
+      value |= adc->sequencers[i].done.armed ? ACTSS_BUSY : 0;
+    }
+    return value;
+  }
+  if(offset == REG(ISC))
+  {
+    return reg(adc, REG(RIS)) & reg(adc, REG(IM));
+  }
+  if(offset == REG(PSSI))
+  {
+    return 0;
+  }
+  return sim_plain_read(block, offset, peek);
+}
+
+static void adc_write(sim_block_t *block, uint32_t offset, uint32_t value)
+{
+  adc_t *adc = (adc_t *)block;
+  int i;
+
+  if(offset == REG(PSSI))
+  {
+    for(i = 0; i < SEQUENCERS; i++)
+    {
+      if(value & (1u << i))
+      {
+        start(&adc->sequencers[i]);
+      }
+    }
+    return;
+  }
+  if(offset == REG(ISC))
+  {
+    *sim_reg(block, REG(RIS)) &= ~(value & 0xF);
+  }
+  else if(offset != REG(RIS))
+  {
+    sim_plain_write(block, offset, value);
+  }
+  update_irq(adc);
+}
+
+void sim_adc_input(uint8_t channel, uint16_t value)
+{
+  if(channel < CHANNELS)
+  {
+    inputs[channel] = value & 0xFFF;
+  }
+}
+
+void sim_adc_init(void)
+{
+  int i;
+  int j;
+
+  for(i = 0; i < CHANNELS; i++)
+  {
+    inputs[i] = MID_SCALE;
+  }
+
+  for(i = 0; i < ADCS; i++)
+  {
+    adcs[i].block.name = adc_info[i].name;
+    adcs[i].block.base = adc_info[i].base;
+    adcs[i].block.size = 0x1000;
+    adcs[i].block.read = adc_read;
+    adcs[i].block.write = adc_write;
+    for(j = 0; j < SEQUENCERS; j++)
+    {
+      adcs[i].sequencers[j].adc = &adcs[i];
+      adcs[i].sequencers[j].number = j;
+      adcs[i].sequencers[j].irq = adc_info[i].irq[j];
+      adcs[i].sequencers[j].done.fire = done;
+      adcs[i].sequencers[j].done.context = &adcs[i].sequencers[j];
+    }
+    sim_block_add(&adcs[i].block);
+  }
+}
@@ -0,0 +1,212 @@
+//*****************************************************************************
+// sim_board.c -- the ECE353 board around the virtual TM4C123, see sim.h
+//
+//    I2C1 0x50   24LC32 EEPROM, 4KB erased to 0xFF, 5ms write cycle
+//    I2C1 0x27   MCP23017, LEDs on port A, direction buttons on port B,
+//                INT on PF0
+//    I2C1 0x38   FT6x06 touch controller, INT on PF4
+//    SSI0        LSM6DS3 accelerometer lying flat, 1g on Z
+//    PD2         ILI9341 TE, a pulse each 60Hz frame
+//    PB, PC4-7   ILI9341 8080 bus and its GRAM, see sim_lcd.c
+//
+// With no one holding a button or touching the panel, the pins read as the
+// idle board's do.
+//*****************************************************************************
+#include <string.h>
+#include "sim_internal.h"
+
+#define EEPROM_ADDRESS        0x50
+#define EEPROM_SIZE           4096
+#define EEPROM_WRITE_CYCLES   (SIM_CLOCK_HZ / 200)
+
+#define MCP23017_ADDRESS      0x27
+#define MCP23017_REGS         0x16
+#define MCP23017_IODIRA       0x00
+#define MCP23017_IODIRB       0x01
+#define MCP23017_IPOLB        0x03
+#define MCP23017_GPINTENB     0x05
+#define MCP23017_DEFVALB      0x07
+#define MCP23017_INTCONB      0x09
+#define MCP23017_INTFB        0x0F
+#define MCP23017_INTCAPB      0x11
+#define MCP23017_GPIOA        0x12
+#define MCP23017_GPIOB        0x13
+#define MCP23017_OLATA        0x14
+#define MCP23017_OLATB        0x15
+#define MCP23017_BUTTONS_M    0x0F
+#define MCP23017_INT_PIN      0x01      // PF0
+
+#define FT6X06_ADDRESS        0x38
+#define FT6X06_REGS           0x100
+#define FT6X06_TD_STATUS      0x02
+#define FT6X06_P1_XH          0x03
+#define FT6X06_G_MODE         0xA4
+#define FT6X06_FOCALTECH_ID   0xA8
+#define FT6X06_INT_PIN        0x10      // PF4
+#define FT6X06_INT_CYCLES     (SIM_CLOCK_HZ / 10000)
+
+#define ACCEL_REGS            0x80
+#define ACCEL_READ_BIT        0x80
+#define ACCEL_WHO_AM_I        0x0F
+#define ACCEL_OUTZ_H_XL       0x2D
+
+#define TE_PIN                0x04      // PD2
+#define TE_PERIOD_CYCLES      (SIM_CLOCK_HZ / 60)
+#define TE_HIGH_CYCLES        (SIM_CLOCK_HZ / 1250)
+
+static uint8_t eeprom_data[EEPROM_SIZE];
+static sim_regs_t eeprom;
+
+static uint8_t mcp23017_data[MCP23017_REGS];
+static sim_regs_t mcp23017;
+static uint8_t buttons = MCP23017_BUTTONS_M;      // pin levels, pressed is low
+
+static uint8_t ft6x06_data[FT6X06_REGS];
+static sim_regs_t ft6x06;
+static sim_event_t ft6x06_int;
+
+static uint8_t accel_data[ACCEL_REGS];
+static sim_regs_t accel;
+
+static sim_event_t te;
+
+//*****************************************************************************
+// MCP23017.  Port B interrupts on change, or against DEFVALB, and INT stays
+// low until INTCAPB or GPIOB is read.
+//*****************************************************************************
+static void mcp23017_int(void)
+{
+  sim_gpio_input(GPIOF_BASE, MCP23017_INT_PIN, mcp23017_data[MCP23017_INTFB] == 0);
+}
+
+static void mcp23017_compare(uint8_t before)
+{
+  uint8_t enabled = mcp23017_data[MCP23017_GPINTENB];
+  uint8_t against = mcp23017_data[MCP23017_INTCONB];
+  uint8_t changed;
+
+  changed = ((buttons ^ before) & ~against) | ((buttons ^ mcp23017_data[MCP23017_DEFVALB]) & against);
+  changed &= enabled;
+  if(changed != 0 && mcp23017_data[MCP23017_INTFB] == 0)
+  {
+    mcp23017_data[MCP23017_INTFB] = changed;
+    mcp23017_data[MCP23017_INTCAPB] = buttons ^ mcp23017_data[MCP23017_IPOLB];
+    mcp23017_int();
+  }
+}
+
+static void mcp23017_reading(sim_regs_t *regs, uint32_t reg)
+{
+  (void)regs;
+
+  if(reg == MCP23017_GPIOA)
+  {
+    mcp23017_data[MCP23017_GPIOA] = mcp23017_data[MCP23017_OLATA];
+  }
+  else if(reg == MCP23017_GPIOB)
+  {
+    mcp23017_data[MCP23017_GPIOB] = (buttons & mcp23017_data[MCP23017_IODIRB]) |
+                                    (mcp23017_data[MCP23017_OLATB] & ~mcp23017_data[MCP23017_IODIRB]);
+    mcp23017_data[MCP23017_GPIOB] ^= mcp23017_data[MCP23017_IPOLB];
+  }
+
+  if((reg == MCP23017_GPIOB || reg == MCP23017_INTCAPB) && mcp23017_data[MCP23017_INTFB] != 0)
+  {
+    mcp23017_data[MCP23017_INTFB] = 0;
+    mcp23017_int();
+  }
+}
+
+static void mcp23017_written(sim_regs_t *regs, uint32_t reg)
+{
+  (void)regs;
+
+  if(reg == MCP23017_GPIOA || reg == MCP23017_GPIOB)
+  {
+    mcp23017_data[reg + 2] = mcp23017_data[reg];
+  }
+  mcp23017_compare(buttons);
+}
+
+void sim_board_buttons(uint8_t pressed)
+{
+  uint8_t before;
+
+  sim_lock();
+  before = buttons;
+  buttons = ~pressed & MCP23017_BUTTONS_M;
+  mcp23017_compare(before);
+  sim_unlock();
+}
+
+//*****************************************************************************
+// FT6x06.  In trigger mode INT pulses low for each new report.
+//*****************************************************************************
+static void ft6x06_int_done(sim_event_t *event)
+{
+  (void)event;
+  sim_gpio_release(GPIOF_BASE, FT6X06_INT_PIN);
+}
+
+void sim_board_touch(bool touched, uint16_t x, uint16_t y)
+{
+  uint16_t raw_x = 239 - (x % 240);
+  uint16_t raw_y = 320 - (y % 321);
+  uint8_t *point = &ft6x06_data[FT6X06_P1_XH];
+
+  sim_lock();
+  // event flag in XH bits 7:6, 2 for contact and 1 for lift up
+  point[0] = (touched ? 0x80 : 0x40) | ((raw_x >> 8) & 0x0F);
+  point[1] = raw_x & 0xFF;
+  point[2] = (raw_y >> 8) & 0x0F;
+  point[3] = raw_y & 0xFF;
+  ft6x06_data[FT6X06_TD_STATUS] = touched ? 1 : 0;
+
+  sim_gpio_input(GPIOF_BASE, FT6X06_INT_PIN, false);
+  sim_event_at(&ft6x06_int, sim_now + FT6X06_INT_CYCLES);
+  sim_unlock();
+}
+
+//*****************************************************************************
+// TE goes high for the LCD's vertical blanking
+//*****************************************************************************
+static void te_edge(sim_event_t *event)
+{
+  static bool high;
+
+  high = !high;
+  sim_gpio_input(GPIOD_BASE, TE_PIN, high);
+  sim_event_at(event, sim_now + (high ? TE_HIGH_CYCLES : TE_PERIOD_CYCLES - TE_HIGH_CYCLES));
+}
+
+void sim_board_init(void)
+{
+  memset(eeprom_data, 0xFF, sizeof(eeprom_data));
+  sim_regs_init(&eeprom, eeprom_data, EEPROM_SIZE, 2);
+  eeprom.write_cycles = EEPROM_WRITE_CYCLES;
+  sim_regs_attach_i2c(&eeprom, I2C1_BASE, EEPROM_ADDRESS);
+
+  sim_regs_init(&mcp23017, mcp23017_data, MCP23017_REGS, 1);
+  mcp23017_data[MCP23017_IODIRA] = 0xFF;
+  mcp23017_data[MCP23017_IODIRB] = 0xFF;
+  mcp23017.reading = mcp23017_reading;
+  mcp23017.written = mcp23017_written;
+  sim_regs_attach_i2c(&mcp23017, I2C1_BASE, MCP23017_ADDRESS);
+  mcp23017_int();
+
+  sim_regs_init(&ft6x06, ft6x06_data, FT6X06_REGS, 1);
+  ft6x06_data[FT6X06_G_MODE] = 0x00;
+  ft6x06_data[FT6X06_FOCALTECH_ID] = 0x11;
+  ft6x06_int.fire = ft6x06_int_done;
+  sim_regs_attach_i2c(&ft6x06, I2C1_BASE, FT6X06_ADDRESS);
+
+  sim_regs_init(&accel, accel_data, ACCEL_REGS, 1);
+  accel_data[ACCEL_WHO_AM_I] = 0x69;
+  accel_data[ACCEL_OUTZ_H_XL] = 0x40;
+  sim_regs_attach_ssi(&accel, SSI0_BASE, ACCEL_READ_BIT);
+
+  te.fire = te_edge;
+  sim_event_at(&te, TE_PERIOD_CYCLES - TE_HIGH_CYCLES);
+
+  sim_lcd_init();
+}
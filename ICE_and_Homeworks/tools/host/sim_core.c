@@ -0,0 +1,574 @@
+//*****************************************************************************
+// sim_core.c -- register traps, time and events for the virtual TM4C123,
+// see sim.h
+//
+// Both register windows are mapped with no access.  An access faults into
+// on_fault, which opens the page, puts the model's value of the register in
+// it and sets the trap flag.  The instruction runs once and on_step takes
+// what it stored, closes the page and hands the store to the model.
+//*****************************************************************************
+#define _GNU_SOURCE
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <ucontext.h>
+#include "sim_internal.h"
+
+#if !defined(__x86_64__) || !defined(__linux__)
+#error "the sim steps register accesses with the x86-64 trap flag"
+#endif
+
+// Every peripheral in the header, through SYSCTL
+#define PERIPH_WINDOW_BASE    0x40000000UL
+#define PERIPH_WINDOW_SIZE    0x00100000UL
+
+// SysTick, NVIC and SCB
+#define CORE_WINDOW_BASE      0xE000E000UL
+#define CORE_WINDOW_SIZE      0x00001000UL
+
+#define PAGE_SIZE             0x1000UL
+#define PAGES                 (PERIPH_WINDOW_SIZE / PAGE_SIZE)
+#define CORE_BLOCKS_MAX       4
+#define BLOCKS_MAX            64
+
+// x86 page fault error code, the access was a store
+#define FAULT_WRITE           0x2
+
+// EFLAGS trap flag, a debug trap after the next instruction
+#define EFLAGS_TF             0x100
+
+// PRIMASK is clear out of reset
+uint32_t host_primask = 0;
+
+uint64_t sim_now = 0;
+
+static sim_block_t *pages[PAGES];
+static sim_block_t *core_blocks[CORE_BLOCKS_MAX];
+static int core_block_count = 0;
+static sim_block_t *blocks[BLOCKS_MAX];
+static int block_count = 0;
+
+// accesses to the parts of the windows no model covers, plain memory
+static sim_counts_t other_counts;
+
+// the access being stepped
+static struct
+{
+  bool          active;
+  sim_block_t   *block;
+  uintptr_t     address;              // word aligned
+  uintptr_t     rip;
+  uint32_t      before;
+  bool          write;
+} step;
+
+// polling, the last read and what it costs now
+static uintptr_t poll_rip = 0;
+static uintptr_t poll_address = 0;
+static uint64_t poll_cycles = SIM_ACCESS_CYCLES;
+
+static uint64_t accesses = 0;
+static uint64_t idle_mark = 0;
+static uint64_t stop_at = 0;
+
+static sim_event_t *events = NULL;
+static int lock_depth = 0;
+static sigset_t lock_saved;
+static sim_block_t sysctl;
+
+//*****************************************************************************
+// Blocks
+//*****************************************************************************
+void sim_block_add(sim_block_t *block)
+{
+  uint32_t page;
+
+  if(block_count < BLOCKS_MAX)
+  {
+    blocks[block_count++] = block;
+  }
+
+  if(block->base >= CORE_WINDOW_BASE)
+  {
+    if(core_block_count < CORE_BLOCKS_MAX)
+    {
+      core_blocks[core_block_count++] = block;
+    }
+    return;
+  }
+
+  for(page = (block->base - PERIPH_WINDOW_BASE) / PAGE_SIZE;
+      page <= (block->base + block->size - 1 - PERIPH_WINDOW_BASE) / PAGE_SIZE && page < PAGES;
+      page++)
+  {
+    pages[page] = block;
+  }
+}
+
+sim_block_t *sim_block_find(uint32_t address)
+{
+  int i;
+
+  if(address - PERIPH_WINDOW_BASE < PERIPH_WINDOW_SIZE)
+  {
+    return pages[(address - PERIPH_WINDOW_BASE) / PAGE_SIZE];
+  }
+
+  for(i = 0; i < core_block_count; i++)
+  {
+    if(address - core_blocks[i]->base < core_blocks[i]->size)
+    {
+      return core_blocks[i];
+    }
+  }
+  return NULL;
+}
+
+uint32_t sim_plain_read(sim_block_t *block, uint32_t offset, bool peek)
+{
+  (void)peek;
+  return *sim_reg(block, offset);
+}
+
+void sim_plain_write(sim_block_t *block, uint32_t offset, uint32_t value)
+{
+  *sim_reg(block, offset) = value;
+}
+
+//*****************************************************************************
+// SYSCTL.  A peripheral is ready as soon as its clock is on: the present
+// registers read back the run mode clock gating registers.
+//*****************************************************************************
+static uint32_t sysctl_read(sim_block_t *block, uint32_t offset, bool peek)
+{
+  uint32_t pr = SIM_REG(SYSCTL_Type, PRWD);
+  uint32_t rcgc = SIM_REG(SYSCTL_Type, RCGCWD);
+
+  if(offset >= pr && offset <= SIM_REG(SYSCTL_Type, PRWTIMER))
+  {
+    return *sim_reg(block, offset - pr + rcgc);
+  }
+  return sim_plain_read(block, offset, peek);
+}
+
+//*****************************************************************************
+// Time and events
+//*****************************************************************************
+void sim_event_at(sim_event_t *event, uint64_t when)
+{
+  sim_event_t **link;
+
+  sim_event_cancel(event);
+  event->when = when;
+  event->armed = true;
+
+  // in time order, after any already set for the same time
+  for(link = &events; *link != NULL && (*link)->when <= when; link = &(*link)->next)
+  {
+  }
+  event->next = *link;
+  *link = event;
+}
+
+void sim_event_cancel(sim_event_t *event)
+{
+  sim_event_t **link;
+
+  if(!event->armed)
+  {
+    return;
+  }
+  for(link = &events; *link != NULL; link = &(*link)->next)
+  {
+    if(*link == event)
+    {
+      *link = event->next;
+      break;
+    }
+  }
+  event->armed = false;
+}
+
+uint64_t sim_next_event(void)
+{
+  return (events != NULL) ? events->when : 0;
+}
+
+void sim_advance(uint64_t cycles)
+{
+  uint64_t target = sim_now + cycles;
+  sim_event_t *event;
+
+  while(events != NULL && events->when <= target)
+  {
+    event = events;
+    events = event->next;
+    event->armed = false;
+    if(event->when > sim_now)
+    {
+      sim_now = event->when;
+    }
+    event->fire(event);
+  }
+  if(target > sim_now)
+  {
+    sim_now = target;
+  }
+
+  if(stop_at != 0 && sim_now >= stop_at)
+  {
+    exit(0);
+  }
+}
+
+uint64_t sim_cycles(void)
+{
+  return sim_now;
+}
+
+void sim_delay(uint32_t cycles)
+{
+  sim_lock();
+  sim_advance(cycles);
+  sim_nvic_dispatch();
+  sim_unlock();
+}
+
+// Calls nest, and the handlers already have the idle timer blocked, so
+// unlocking puts back the mask from before the outermost lock
+void sim_lock(void)
+{
+  sigset_t set;
+  sigset_t old;
+
+  sigemptyset(&set);
+  sigaddset(&set, SIGALRM);
+  sigprocmask(SIG_BLOCK, &set, &old);
+  if(lock_depth++ == 0)
+  {
+    lock_saved = old;
+  }
+}
+
+void sim_unlock(void)
+{
+  if(--lock_depth == 0)
+  {
+    sigprocmask(SIG_SETMASK, &lock_saved, NULL);
+  }
+}
+
+//*****************************************************************************
+// Charges an access and takes any interrupt it raised.  A read from the
+// same instruction and register as the last access is a poll, and each one
+// in a row costs twice the last, up to SIM_POLL_MAX_CYCLES and never past
+// the next event.
+//*****************************************************************************
+static void access_done(uintptr_t rip, uintptr_t address, bool write)
+{
+  uint64_t cycles = SIM_ACCESS_CYCLES;
+  uint64_t next;
+
+  accesses++;
+
+  if(!write && rip == poll_rip && address == poll_address)
+  {
+    poll_cycles *= 2;
+    if(poll_cycles > SIM_POLL_MAX_CYCLES)
+    {
+      poll_cycles = SIM_POLL_MAX_CYCLES;
+    }
+    cycles = poll_cycles;
+    next = sim_next_event();
+    if(next != 0 && next > sim_now && cycles > next - sim_now)
+    {
+      cycles = (next - sim_now > SIM_ACCESS_CYCLES) ? next - sim_now : SIM_ACCESS_CYCLES;
+    }
+  }
+  else
+  {
+    poll_cycles = SIM_ACCESS_CYCLES;
+  }
+  poll_rip = write ? 0 : rip;
+  poll_address = address;
+
+  sim_advance(cycles);
+  sim_nvic_dispatch();
+}
+
+//*****************************************************************************
+// Faults and steps
+//*****************************************************************************
+static bool in_window(uintptr_t address)
+{
+  return (address - PERIPH_WINDOW_BASE < PERIPH_WINDOW_SIZE) ||
+         (address - CORE_WINDOW_BASE < CORE_WINDOW_SIZE);
+}
+
+static void *page_of(uintptr_t address)
+{
+  return (void *)(address & ~(PAGE_SIZE - 1));
+}
+
+static void on_fault(int sig, siginfo_t *info, void *context)
+{
+  ucontext_t *uc = context;
+  uintptr_t address = (uintptr_t)info->si_addr;
+  sim_block_t *block;
+
+  if(!in_window(address) || step.active)
+  {
+    // a real crash, let it happen again without the handler
+    signal(sig, SIG_DFL);
+    return;
+  }
+
+  step.active = true;
+  step.address = address & ~(uintptr_t)3;
+  step.rip = uc->uc_mcontext.gregs[REG_RIP];
+  step.write = (uc->uc_mcontext.gregs[REG_ERR] & FAULT_WRITE) != 0;
+  step.block = block = sim_block_find(address);
+
+  mprotect(page_of(address), PAGE_SIZE, PROT_READ | PROT_WRITE);
+  if(block != NULL)
+  {
+    *(volatile uint32_t *)step.address = block->read(block, step.address - block->base, step.write);
+  }
+  step.before = *(volatile uint32_t *)step.address;
+
+  uc->uc_mcontext.gregs[REG_EFL] |= EFLAGS_TF;
+}
+
+static void on_step(int sig, siginfo_t *info, void *context)
+{
+  ucontext_t *uc = context;
+  sim_block_t *block = step.block;
+  uint32_t value;
+  bool write;
+
+  (void)sig;
+  (void)info;
+
+  if(!step.active)
+  {
+    return;
+  }
+  uc->uc_mcontext.gregs[REG_EFL] &= ~EFLAGS_TF;
+
+  // a read-modify-write can fault as a read
+  value = *(volatile uint32_t *)step.address;
+  write = step.write || value != step.before;
+
+  mprotect(page_of(step.address), PAGE_SIZE, PROT_NONE);
+  step.active = false;
+
+  if(block == NULL)
+  {
+    write ? other_counts.writes++ : other_counts.reads++;
+  }
+  else if(write)
+  {
+    block->counts.writes++;
+    block->write(block, step.address - block->base, value);
+  }
+  else
+  {
+    block->counts.reads++;
+  }
+
+  access_done(step.rip, step.address, write);
+}
+
+//*****************************************************************************
+// Nothing touched a register for SIM_IDLE_MS, the program is waiting on an
+// interrupt.  Skips to the next event.
+//*****************************************************************************
+static void on_idle(int sig)
+{
+  uint64_t next;
+
+  (void)sig;
+
+  // in the middle of a step, try again next time
+  if(step.active)
+  {
+    return;
+  }
+
+  sim_uart_poll_host();
+
+  if(accesses == idle_mark)
+  {
+    next = sim_next_event();
+    if(next > sim_now)
+    {
+      sim_advance(next - sim_now);
+    }
+  }
+  idle_mark = accesses;
+  sim_nvic_dispatch();
+}
+
+static void on_interrupt(int sig)
+{
+  (void)sig;
+  exit(130);
+}
+
+//*****************************************************************************
+// Counts
+//*****************************************************************************
+bool sim_counts(uint32_t base, sim_counts_t *counts)
+{
+  int i;
+
+  for(i = 0; i < block_count; i++)
+  {
+    if(blocks[i]->base == base)
+    {
+      *counts = blocks[i]->counts;
+      return true;
+    }
+  }
+  return false;
+}
+
+void sim_total_counts(sim_counts_t *counts)
+{
+  int i;
+
+  *counts = other_counts;
+  for(i = 0; i < block_count; i++)
+  {
+    counts->reads += blocks[i]->counts.reads;
+    counts->writes += blocks[i]->counts.writes;
+  }
+}
+
+void sim_clear_counts(void)
+{
+  int i;
+
+  for(i = 0; i < block_count; i++)
+  {
+    memset(&blocks[i]->counts, 0, sizeof(blocks[i]->counts));
+  }
+  memset(&other_counts, 0, sizeof(other_counts));
+}
+
+void sim_report(FILE *out)
+{
+  sim_counts_t total;
+  int i;
+
+  sim_total_counts(&total);
+  fprintf(out, "sim: %.3f ms, %llu cycles, %llu reads, %llu writes\n",
+          (double)sim_now * 1000 / SIM_CLOCK_HZ, (unsigned long long)sim_now,
+          (unsigned long long)total.reads, (unsigned long long)total.writes);
+
+  for(i = 0; i < block_count; i++)
+  {
+    if(blocks[i]->counts.reads != 0 || blocks[i]->counts.writes != 0)
+    {
+      fprintf(out, "  %-8s %12llu reads %12llu writes\n", blocks[i]->name,
+              (unsigned long long)blocks[i]->counts.reads,
+              (unsigned long long)blocks[i]->counts.writes);
+    }
+  }
+  if(other_counts.reads != 0 || other_counts.writes != 0)
+  {
+    fprintf(out, "  %-8s %12llu reads %12llu writes\n", "other",
+            (unsigned long long)other_counts.reads,
+            (unsigned long long)other_counts.writes);
+  }
+}
+
+static void report_at_exit(void)
+{
+  sim_report(stderr);
+}
+
+//*****************************************************************************
+// Start up, before main
+//*****************************************************************************
+static bool map_window(unsigned long base, unsigned long size)
+{
+  void *p = mmap((void *)base, size, PROT_NONE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+  return p == (void *)base;
+}
+
+// The windows are mapped before main, for code built against registers.c
+bool host_map_registers(void)
+{
+  return true;
+}
+
+__attribute__((constructor))
+static void sim_start(void)
+{
+  struct sigaction action;
+  struct itimerval idle;
+  const char *ms;
+
+  if(!map_window(PERIPH_WINDOW_BASE, PERIPH_WINDOW_SIZE) ||
+     !map_window(CORE_WINDOW_BASE, CORE_WINDOW_SIZE))
+  {
+    fprintf(stderr, "sim: can't map the register windows\n");
+    exit(1);
+  }
+
+  sysctl.name = "SYSCTL";
+  sysctl.base = SYSCTL_BASE;
+  sysctl.size = PAGE_SIZE;
+  sysctl.read = sysctl_read;
+  sysctl.write = sim_plain_write;
+  sim_block_add(&sysctl);
+
+  sim_nvic_init();
+  sim_gpio_init();
+  sim_uart_init();
+  sim_ssi_init();
+  sim_i2c_init();
+  sim_gptm_init();
+  sim_adc_init();
+  sim_board_init();
+
+  // UART0 output and printf in the order they happen
+  setvbuf(stdout, NULL, _IONBF, 0);
+  sim_libs_init();
+
+  ms = getenv("SIM_MS");
+  if(ms != NULL)
+  {
+    stop_at = strtoull(ms, NULL, 0) * (SIM_CLOCK_HZ / 1000);
+  }
+  atexit(report_at_exit);
+
+  // stepping starts from inside interrupts taken on a step, so neither
+  // handler blocks itself, and the idle timer waits until both are done
+  memset(&action, 0, sizeof(action));
+  action.sa_flags = SA_SIGINFO | SA_NODEFER;
+  sigemptyset(&action.sa_mask);
+  sigaddset(&action.sa_mask, SIGALRM);
+  action.sa_sigaction = on_fault;
+  sigaction(SIGSEGV, &action, NULL);
+  action.sa_sigaction = on_step;
+  sigaction(SIGTRAP, &action, NULL);
+
+  memset(&action, 0, sizeof(action));
+  action.sa_flags = SA_RESTART;
+  sigemptyset(&action.sa_mask);
+  action.sa_handler = on_idle;
+  sigaction(SIGALRM, &action, NULL);
+  action.sa_handler = on_interrupt;
+  sigaction(SIGINT, &action, NULL);
+
+  idle.it_interval.tv_sec = 0;
+  idle.it_interval.tv_usec = SIM_IDLE_MS * 1000;
+  idle.it_value = idle.it_interval;
+  setitimer(ITIMER_REAL, &idle, NULL);
+}
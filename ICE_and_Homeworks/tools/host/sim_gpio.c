@@ -0,0 +1,216 @@
+//*****************************************************************************
+// sim_gpio.c -- GPIO ports A to F of the virtual TM4C123, see sim.h
+//
+// A pin's level is its output if it is one, else what drives it from
+// outside, else its pull up or pull down, else low.  Any change of a level,
+// from either side, runs the port's interrupt sense.
+//*****************************************************************************
+#include "sim_internal.h"
+
+#define PORTS                 6
+
+#define REG(m)                SIM_REG(GPIOA_Type, m)
+
+// DATA is at the top of 256 words, address bits 9:2 mask the access
+#define DATA_WINDOW           0x400
+
+typedef struct
+{
+  sim_block_t       block;
+  int               irq;
+  uint8_t           driven;           // pins driven from outside
+  uint8_t           inputs;           // and their level
+  uint8_t           level;            // every pin as of the last change
+  sim_gpio_watch_t  watch;
+  void              *context;
+} port_t;
+
+static port_t ports[PORTS];
+
+static const struct
+{
+  const char  *name;
+  uint32_t    base;
+  int         irq;
+} port_info[PORTS] =
+{
+  { "GPIOA", GPIOA_BASE, GPIOA_IRQn },
+  { "GPIOB", GPIOB_BASE, GPIOB_IRQn },
+  { "GPIOC", GPIOC_BASE, GPIOC_IRQn },
+  { "GPIOD", GPIOD_BASE, GPIOD_IRQn },
+  { "GPIOE", GPIOE_BASE, GPIOE_IRQn },
+  { "GPIOF", GPIOF_BASE, GPIOF_IRQn },
+};
+
+static uint8_t reg8(port_t *port, uint32_t offset)
+{
+  return *sim_reg(&port->block, offset) & 0xFF;
+}
+
+static port_t *find_port(uint32_t base)
+{
+  int i;
+
+  for(i = 0; i < PORTS; i++)
+  {
+    if(ports[i].block.base == base)
+    {
+      return &ports[i];
+    }
+  }
+  return NULL;
+}
+
+static uint8_t pin_levels(port_t *port)
+{
+  uint8_t dir = reg8(port, REG(DIR));
+  uint8_t odr = reg8(port, REG(ODR));
+  uint8_t data = reg8(port, REG(DATA));
+  uint8_t level;
+
+  level = reg8(port, REG(PUR)) & ~reg8(port, REG(PDR));
+  level = (level & ~port->driven) | (port->inputs & port->driven);
+
+  // outputs win, open drain outputs only pull low
+  level = (level & ~(dir & ~odr)) | (data & dir & ~odr);
+  level &= ~(dir & odr & ~data);
+  return level;
+}
+
+//*****************************************************************************
+// Edge sense latches RIS, level sense follows the pin.  The port's line is
+// RIS masked by IM.
+//*****************************************************************************
+static void update(port_t *port)
+{
+  uint8_t before = port->level;
+  uint8_t after = pin_levels(port);
+  uint8_t is = reg8(port, REG(IS));
+  uint8_t ibe = reg8(port, REG(IBE));
+  uint8_t iev = reg8(port, REG(IEV));
+  uint8_t rising = ~before & after;
+  uint8_t falling = before & ~after;
+  uint8_t edges = ((rising & (ibe | iev)) | (falling & (ibe | ~iev))) & ~is;
+  uint8_t levels = ((after & iev) | (~after & ~iev)) & is;
+  uint32_t *ris = sim_reg(&port->block, REG(RIS));
+
+  *ris = (((*ris | edges) & ~is) | levels) & 0xFF;
+  port->level = after;
+  sim_irq_level(port->irq, (*ris & reg8(port, REG(IM))) != 0);
+
+  if(before != after && port->watch != NULL)
+  {
+    port->watch(port->context, before, after);
+  }
+}
+
+static uint32_t gpio_read(sim_block_t *block, uint32_t offset, bool peek)
+{
+  port_t *port = (port_t *)block;
+
+  if(offset < DATA_WINDOW)
+  {
+    // outputs read what they drive, pins without DEN read low
+    return pin_levels(port) & reg8(port, REG(DEN)) & ((offset >> 2) & 0xFF);
+  }
+  if(offset == REG(MIS))
+  {
+    return reg8(port, REG(RIS)) & reg8(port, REG(IM));
+  }
+  if(offset == REG(ICR))
+  {
+    return 0;
+  }
+  return sim_plain_read(block, offset, peek);
+}
+
+static void gpio_write(sim_block_t *block, uint32_t offset, uint32_t value)
+{
+  port_t *port = (port_t *)block;
+  uint32_t *data = sim_reg(block, REG(DATA));
+  uint32_t mask;
+
+  if(offset < DATA_WINDOW)
+  {
+    mask = (offset >> 2) & 0xFF;
+    *data = (*data & ~mask) | (value & mask);
+  }
+  else if(offset == REG(ICR))
+  {
+    *sim_reg(block, REG(RIS)) &= ~value;
+  }
+  else if(offset == REG(MIS) || offset == REG(RIS))
+  {
+    return;
+  }
+  else
+  {
+    sim_plain_write(block, offset, value);
+  }
+  update(port);
+}
+
+void sim_gpio_input(uint32_t base, uint8_t pins, bool high)
+{
+  port_t *port = find_port(base);
+
+  if(port == NULL)
+  {
+    return;
+  }
+  sim_lock();
+  port->driven |= pins;
+  port->inputs = high ? (port->inputs | pins) : (port->inputs & ~pins);
+  update(port);
+  sim_unlock();
+}
+
+void sim_gpio_release(uint32_t base, uint8_t pins)
+{
+  port_t *port = find_port(base);
+
+  if(port == NULL)
+  {
+    return;
+  }
+  sim_lock();
+  port->driven &= ~pins;
+  update(port);
+  sim_unlock();
+}
+
+uint8_t sim_gpio_level(uint32_t base)
+{
+  port_t *port = find_port(base);
+
+  return port != NULL ? port->level : 0;
+}
+
+bool sim_gpio_watch(uint32_t base, sim_gpio_watch_t watch, void *context)
+{
+  port_t *port = find_port(base);
+
+  if(port == NULL)
+  {
+    return false;
+  }
+  port->watch = watch;
+  port->context = context;
+  return true;
+}
+
+void sim_gpio_init(void)
+{
+  int i;
+
+  for(i = 0; i < PORTS; i++)
+  {
+    ports[i].block.name = port_info[i].name;
+    ports[i].block.base = port_info[i].base;
+    ports[i].block.size = 0x1000;
+    ports[i].block.read = gpio_read;
+    ports[i].block.write = gpio_write;
+    ports[i].irq = port_info[i].irq;
+    sim_block_add(&ports[i].block);
+  }
+}
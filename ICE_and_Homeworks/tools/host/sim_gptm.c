@@ -0,0 +1,273 @@
+//*****************************************************************************
+// sim_gptm.c -- TIMER0 to TIMER5 and WTIMER0 and 1 of the virtual TM4C123,
+// see sim.h
+//
+// One shot and periodic modes, counting up or down.  CFG 0 runs timer A
+// alone as 32 bits, any other CFG splits A and B, 16 bits each with TnPR + 1
+// cycles a tick (32 bits each on the wide timers).  Counts are worked out
+// from the time they started, an event fires each timeout.  Writing TnILR
+// reloads a down counter at once, as with TnILD clear.
+//*****************************************************************************
+#include "sim_internal.h"
+
+#define TIMERS                8
+
+#define REG(m)                SIM_REG(TIMER0_Type, m)
+
+#define CFG_32_BIT            0x0
+
+#define TMR_M                 0x03
+#define TMR_1_SHOT            0x01
+#define TMR_CDIR              0x10
+
+#define CTL_TAEN              0x001
+#define CTL_TBEN              0x100
+
+#define INT_A_M               0x01F
+#define INT_B_M               0xF00
+#define INT_TATO              0x001
+#define INT_TBTO              0x100
+
+typedef struct gptm gptm_t;
+
+typedef struct
+{
+  gptm_t        *timer;
+  int           half;                 // 0 for A, 1 for B
+  bool          running;
+  int64_t       origin;               // when the count started, running
+  uint32_t      position;             // ticks since it started, stopped
+  sim_event_t   timeout;
+} half_t;
+
+struct gptm
+{
+  sim_block_t   block;
+  bool          wide;
+  int           irq[2];
+  half_t        halves[2];
+};
+
+static gptm_t timers[TIMERS];
+
+static const struct
+{
+  const char  *name;
+  uint32_t    base;
+  bool        wide;
+  int         irq_a;
+  int         irq_b;
+} timer_info[TIMERS] =
+{
+  { "TIMER0",  TIMER0_BASE,  false, TIMER0A_IRQn,  TIMER0B_IRQn },
+  { "TIMER1",  TIMER1_BASE,  false, TIMER1A_IRQn,  TIMER1B_IRQn },
+  { "TIMER2",  TIMER2_BASE,  false, TIMER2A_IRQn,  TIMER2B_IRQn },
+  { "TIMER3",  TIMER3_BASE,  false, TIMER3A_IRQn,  TIMER3B_IRQn },
+  { "TIMER4",  TIMER4_BASE,  false, TIMER4A_IRQn,  TIMER4B_IRQn },
+  { "TIMER5",  TIMER5_BASE,  false, TIMER5A_IRQn,  TIMER5B_IRQn },
+  { "WTIMER0", WTIMER0_BASE, true,  WTIMER0A_IRQn, WTIMER0B_IRQn },
+  { "WTIMER1", WTIMER1_BASE, true,  SIM_NO_IRQ,    SIM_NO_IRQ },
+};
+
+// TnMR, TnILR and TnPR of a half
+static const uint32_t mode_reg[2] = { REG(TAMR), REG(TBMR) };
+static const uint32_t load_reg[2] = { REG(TAILR), REG(TBILR) };
+static const uint32_t prescale_reg[2] = { REG(TAPR), REG(TBPR) };
+static const uint32_t enable_bit[2] = { CTL_TAEN, CTL_TBEN };
+static const uint32_t timeout_bit[2] = { INT_TATO, INT_TBTO };
+
+static uint32_t reg(gptm_t *timer, uint32_t offset)
+{
+  return *sim_reg(&timer->block, offset);
+}
+
+static bool split(gptm_t *timer)
+{
+  return (reg(timer, REG(CFG)) & 0x7) != CFG_32_BIT;
+}
+
+static uint64_t tick(half_t *half)
+{
+  gptm_t *timer = half->timer;
+
+  if(!split(timer))
+  {
+    return 1;
+  }
+  return 1 + (reg(timer, prescale_reg[half->half]) & (timer->wide ? 0xFFFF : 0xFF));
+}
+
+static uint32_t load(half_t *half)
+{
+  gptm_t *timer = half->timer;
+  uint32_t value = reg(timer, load_reg[half->half]);
+
+  return (split(timer) && !timer->wide) ? (value & 0xFFFF) : value;
+}
+
+static bool counts_up(half_t *half)
+{
+  return (reg(half->timer, mode_reg[half->half]) & TMR_CDIR) != 0;
+}
+
+static uint32_t position(half_t *half)
+{
+  uint64_t ticks;
+
+  if(!half->running)
+  {
+    return half->position;
+  }
+  ticks = (uint64_t)((int64_t)sim_now - half->origin) / tick(half);
+  return ticks % ((uint64_t)load(half) + 1);
+}
+
+static void set_position(half_t *half, uint32_t ticks)
+{
+  half->position = ticks;
+  if(half->running)
+  {
+    half->origin = (int64_t)sim_now - (int64_t)ticks * (int64_t)tick(half);
+    sim_event_at(&half->timeout, half->origin + ((uint64_t)load(half) + 1) * tick(half));
+  }
+}
+
+static void update_irq(gptm_t *timer)
+{
+  uint32_t mis = reg(timer, REG(RIS)) & reg(timer, REG(IMR));
+
+  sim_irq_level(timer->irq[0], (mis & INT_A_M) != 0);
+  sim_irq_level(timer->irq[1], (mis & INT_B_M) != 0);
+}
+
+static void timeout(sim_event_t *event)
+{
+  half_t *half = event->context;
+  gptm_t *timer = half->timer;
+
+  *sim_reg(&timer->block, REG(RIS)) |= timeout_bit[half->half];
+
+  if((reg(timer, mode_reg[half->half]) & TMR_M) == TMR_1_SHOT)
+  {
+    half->running = false;
+    half->position = 0;
+    *sim_reg(&timer->block, REG(CTL)) &= ~enable_bit[half->half];
+  }
+  else
+  {
+    half->origin += ((uint64_t)load(half) + 1) * tick(half);
+    sim_event_at(&half->timeout, half->origin + ((uint64_t)load(half) + 1) * tick(half));
+  }
+  update_irq(timer);
+}
+
+static void enable(half_t *half, bool enabled)
+{
+  if(enabled && !half->running)
+  {
+    half->running = true;
+    set_position(half, half->position);
+  }
+  else if(!enabled && half->running)
+  {
+    half->position = position(half);
+    half->running = false;
+    sim_event_cancel(&half->timeout);
+  }
+}
+
+static uint32_t timer_read(sim_block_t *block, uint32_t offset, bool peek)
+{
+  gptm_t *timer = (gptm_t *)block;
+  half_t *half;
+
+  if(offset == REG(TAR) || offset == REG(TAV) || offset == REG(TBR) || offset == REG(TBV))
+  {
+    half = &timer->halves[(offset == REG(TBR) || offset == REG(TBV)) ? 1 : 0];
+    return counts_up(half) ? position(half) : load(half) - position(half);
+  }
+  if(offset == REG(MIS))
+  {
+    return reg(timer, REG(RIS)) & reg(timer, REG(IMR));
+  }
+  if(offset == REG(ICR))
+  {
+    return 0;
+  }
+  return sim_plain_read(block, offset, peek);
+}
+
+static void timer_write(sim_block_t *block, uint32_t offset, uint32_t value)
+{
+  gptm_t *timer = (gptm_t *)block;
+  half_t *half;
+  uint32_t ticks;
+  int i;
+
+  if(offset == REG(TAV) || offset == REG(TBV))
+  {
+    half = &timer->halves[(offset == REG(TBV)) ? 1 : 0];
+    ticks = counts_up(half) ? value : load(half) - value;
+    set_position(half, (ticks <= load(half)) ? ticks : 0);
+    return;
+  }
+  if(offset == REG(ICR))
+  {
+    *sim_reg(block, REG(RIS)) &= ~value;
+    update_irq(timer);
+    return;
+  }
+  if(offset == REG(TAR) || offset == REG(TBR) || offset == REG(RIS) || offset == REG(MIS))
+  {
+    return;
+  }
+
+  sim_plain_write(block, offset, value);
+
+  for(i = 0; i < 2; i++)
+  {
+    half = &timer->halves[i];
+    if(offset == REG(CTL))
+    {
+      enable(half, (value & enable_bit[i]) != 0 && (i == 0 || split(timer)));
+    }
+    else if(offset == load_reg[i])
+    {
+      set_position(half, counts_up(half) && position(half) <= load(half) ? position(half) : 0);
+    }
+    else if(offset == REG(CFG) || offset == mode_reg[i] || offset == prescale_reg[i])
+    {
+      set_position(half, (position(half) <= load(half)) ? position(half) : 0);
+    }
+  }
+  update_irq(timer);
+}
+
+void sim_gptm_init(void)
+{
+  int i;
+  int j;
+
+  for(i = 0; i < TIMERS; i++)
+  {
+    timers[i].block.name = timer_info[i].name;
+    timers[i].block.base = timer_info[i].base;
+    timers[i].block.size = 0x1000;
+    timers[i].block.read = timer_read;
+    timers[i].block.write = timer_write;
+    timers[i].wide = timer_info[i].wide;
+    timers[i].irq[0] = timer_info[i].irq_a;
+    timers[i].irq[1] = timer_info[i].irq_b;
+    for(j = 0; j < 2; j++)
+    {
+      timers[i].halves[j].timer = &timers[i];
+      timers[i].halves[j].half = j;
+      timers[i].halves[j].timeout.fire = timeout;
+      timers[i].halves[j].timeout.context = &timers[i].halves[j];
+    }
+    // reset values, TnILR all ones
+    *sim_reg(&timers[i].block, REG(TAILR)) = 0xFFFFFFFF;
+    *sim_reg(&timers[i].block, REG(TBILR)) = timers[i].wide ? 0xFFFFFFFF : 0xFFFF;
+    sim_block_add(&timers[i].block);
+  }
+}
@@ -0,0 +1,283 @@
+//*****************************************************************************
+// sim_i2c.c -- the I2C0 to I2C3 masters of the virtual TM4C123, see sim.h
+//
+// A command written to MCS runs against the addressed device right away,
+// and MCS reads BUSY until the bytes it moved would have gone out at the
+// SCL rate MTPR sets, (1 + TPR) * 20 cycles a bit, nine bits a byte.
+//*****************************************************************************
+#include "sim_internal.h"
+
+#define BUSES                 4
+#define DEVICES               8
+
+#define REG(m)                SIM_REG(I2C0_Type, m)
+
+// written
+#define MCS_RUN               0x01
+#define MCS_START             0x02
+#define MCS_STOP              0x04
+#define MCS_ACK               0x08
+
+// read
+#define MCS_BUSY              0x01
+#define MCS_ERROR             0x02
+#define MCS_ADRACK            0x04
+#define MCS_DATACK            0x08
+#define MCS_IDLE              0x20
+#define MCS_BUSBSY            0x40
+
+#define BYTE_BITS             9
+
+typedef struct
+{
+  uint8_t           address;
+  sim_i2c_device_t  device;
+} slave_t;
+
+typedef struct
+{
+  sim_block_t   block;
+  int           irq;
+  slave_t       slaves[DEVICES];
+  int           slave_count;
+  slave_t       *active;              // addressed and ACKed
+  bool          read;
+  bool          held;                 // no STOP since the START
+  uint32_t      status;               // MCS once the command is done
+  sim_event_t   done;
+} bus_t;
+
+static bus_t buses[BUSES];
+
+static const struct
+{
+  const char  *name;
+  uint32_t    base;
+  int         irq;
+} bus_info[BUSES] =
+{
+  { "I2C0", I2C0_BASE, I2C0_IRQn },
+  { "I2C1", I2C1_BASE, I2C1_IRQn },
+  { "I2C2", I2C2_BASE, I2C2_IRQn },
+  { "I2C3", I2C3_BASE, I2C3_IRQn },
+};
+
+static uint32_t reg(bus_t *bus, uint32_t offset)
+{
+  return *sim_reg(&bus->block, offset);
+}
+
+static slave_t *find_slave(bus_t *bus, uint8_t address)
+{
+  int i;
+
+  for(i = 0; i < bus->slave_count; i++)
+  {
+    if(bus->slaves[i].address == address)
+    {
+      return &bus->slaves[i];
+    }
+  }
+  return NULL;
+}
+
+static void update_irq(bus_t *bus)
+{
+  sim_irq_level(bus->irq, (reg(bus, REG(MRIS)) & reg(bus, REG(MIMR)) & 0x1) != 0);
+}
+
+static void stop(bus_t *bus)
+{
+  if(bus->active != NULL && bus->active->device.stop != NULL)
+  {
+    bus->active->device.stop(bus->active->device.context);
+  }
+  bus->active = NULL;
+  bus->held = false;
+}
+
+//*****************************************************************************
+// Runs a command.  Returns the bits it put on the bus.
+//*****************************************************************************
+static uint32_t command(bus_t *bus, uint32_t mcs)
+{
+  uint32_t msa = reg(bus, REG(MSA));
+  uint32_t *mdr = sim_reg(&bus->block, REG(MDR));
+  slave_t *slave;
+  uint32_t bits = 0;
+
+  bus->status = 0;
+
+  if((mcs & (MCS_RUN | MCS_START)) == 0)
+  {
+    // STOP alone ends a transaction left held after an error
+    if((mcs & MCS_STOP) && bus->held)
+    {
+      stop(bus);
+      return 1;
+    }
+    return 0;
+  }
+
+  if(mcs & MCS_START)
+  {
+    // a repeated START leaves the device addressed before
+    if(bus->active != NULL && bus->active->address != (msa >> 1))
+    {
+      stop(bus);
+    }
+
+    bus->held = true;
+    bus->read = (msa & 0x1) != 0;
+    bits += BYTE_BITS;
+    slave = find_slave(bus, (msa >> 1) & 0x7F);
+    if(slave == NULL || slave->device.start == NULL ||
+       !slave->device.start(slave->device.context, bus->read))
+    {
+      bus->active = NULL;
+      bus->status = MCS_ERROR | MCS_ADRACK;
+      if(mcs & MCS_STOP)
+      {
+        bus->held = false;
+      }
+      return bits + 1;
+    }
+    bus->active = slave;
+  }
+
+  if(bus->active == NULL)
+  {
+    bus->status = MCS_ERROR;
+    return bits;
+  }
+
+  if(mcs & MCS_RUN)
+  {
+    bits += BYTE_BITS;
+    if(bus->read)
+    {
+      *mdr = (bus->active->device.read == NULL) ? 0xFF :
+             bus->active->device.read(bus->active->device.context, (mcs & MCS_ACK) != 0);
+    }
+    else if(bus->active->device.write == NULL ||
+            !bus->active->device.write(bus->active->device.context, *mdr & 0xFF))
+    {
+      bus->status = MCS_ERROR | MCS_DATACK;
+    }
+  }
+
+  if(mcs & MCS_STOP)
+  {
+    stop(bus);
+    bits++;
+  }
+  return bits;
+}
+
+static void done(sim_event_t *event)
+{
+  bus_t *bus = event->context;
+
+  *sim_reg(&bus->block, REG(MRIS)) |= 0x1;
+  update_irq(bus);
+}
+
+static uint32_t i2c_read(sim_block_t *block, uint32_t offset, bool peek)
+{
+  bus_t *bus = (bus_t *)block;
+  uint32_t mcs;
+
+  if(offset == REG(MCS))
+  {
+    mcs = bus->held ? MCS_BUSBSY : 0;
+    if(bus->done.armed)
+    {
+      return mcs | MCS_BUSY;
+    }
+    return mcs | bus->status | (bus->held ? 0 : MCS_IDLE);
+  }
+  if(offset == REG(MMIS))
+  {
+    return reg(bus, REG(MRIS)) & reg(bus, REG(MIMR));
+  }
+  if(offset == REG(MICR))
+  {
+    return 0;
+  }
+  return sim_plain_read(block, offset, peek);
+}
+
+static void i2c_write(sim_block_t *block, uint32_t offset, uint32_t value)
+{
+  bus_t *bus = (bus_t *)block;
+  uint64_t bit = 20 * (1 + (uint64_t)(reg(bus, REG(MTPR)) & 0x7F));
+  uint32_t bits;
+
+  if(offset == REG(MCS))
+  {
+    if(bus->done.armed)
+    {
+      return;
+    }
+    bits = command(bus, value & 0xF);
+    if(bits != 0)
+    {
+      sim_event_at(&bus->done, sim_now + bits * bit);
+    }
+    return;
+  }
+  if(offset == REG(MICR))
+  {
+    *sim_reg(block, REG(MRIS)) &= ~value;
+  }
+  else if(offset != REG(MRIS) && offset != REG(MMIS))
+  {
+    sim_plain_write(block, offset, value);
+  }
+  update_irq(bus);
+}
+
+bool sim_i2c_attach(uint32_t base, uint8_t address, const sim_i2c_device_t *device)
+{
+  slave_t *slave;
+  int i;
+
+  for(i = 0; i < BUSES; i++)
+  {
+    if(buses[i].block.base != base)
+    {
+      continue;
+    }
+    slave = find_slave(&buses[i], address);
+    if(slave == NULL)
+    {
+      if(buses[i].slave_count == DEVICES)
+      {
+        return false;
+      }
+      slave = &buses[i].slaves[buses[i].slave_count++];
+    }
+    slave->address = address;
+    slave->device = *device;
+    return true;
+  }
+  return false;
+}
+
+void sim_i2c_init(void)
+{
+  int i;
+
+  for(i = 0; i < BUSES; i++)
+  {
+    buses[i].block.name = bus_info[i].name;
+    buses[i].block.base = bus_info[i].base;
+    buses[i].block.size = 0x1000;
+    buses[i].block.read = i2c_read;
+    buses[i].block.write = i2c_write;
+    buses[i].irq = bus_info[i].irq;
+    buses[i].done.fire = done;
+    buses[i].done.context = &buses[i];
+    sim_block_add(&buses[i].block);
+  }
+}
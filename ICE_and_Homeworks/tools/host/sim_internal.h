@@ -0,0 +1,89 @@
+//*****************************************************************************
+// sim_internal.h -- what the sim's device models share, see sim.h
+//*****************************************************************************
+#ifndef __SIM_INTERNAL_H__
+#define __SIM_INTERNAL_H__
+
+#include <stddef.h>
+#include "TM4C123GH6PM.h"
+#include "sim.h"
+
+// Register blocks are at most one 4KB page
+#define SIM_BLOCK_WORDS       1024
+
+// No interrupt line, SysTick is -1
+#define SIM_NO_IRQ            (-100)
+
+// Register offset of member m of register block type t
+#define SIM_REG(t, m)         ((uint32_t)offsetof(t, m))
+
+typedef struct sim_block sim_block_t;
+
+//*****************************************************************************
+// One peripheral's registers.  read returns the word at a byte offset from
+// base.  It is also called with peek set for the word a store is about to
+// change, so a byte store or a read-modify-write sees the register, and
+// must then have no side effects.  write gets the whole word after the
+// store.  regs holds the registers a model does not handle itself.
+//*****************************************************************************
+struct sim_block
+{
+  const char    *name;
+  uint32_t      base;
+  uint32_t      size;
+  uint32_t      (*read)(sim_block_t *block, uint32_t offset, bool peek);
+  void          (*write)(sim_block_t *block, uint32_t offset, uint32_t value);
+  sim_counts_t  counts;
+  uint32_t      regs[SIM_BLOCK_WORDS];
+};
+
+// Models, in sim_core.c unless noted
+extern uint64_t sim_now;
+
+void sim_block_add(sim_block_t *block);
+sim_block_t *sim_block_find(uint32_t address);
+
+// Plain register, stored in regs
+uint32_t sim_plain_read(sim_block_t *block, uint32_t offset, bool peek);
+void sim_plain_write(sim_block_t *block, uint32_t offset, uint32_t value);
+
+static inline uint32_t *sim_reg(sim_block_t *block, uint32_t offset)
+{
+  return &block->regs[(offset & (SIM_BLOCK_WORDS * 4 - 1)) >> 2];
+}
+
+// Runs time forward, firing the events on the way
+void sim_advance(uint64_t cycles);
+
+// When the next event fires, or 0 if none is armed
+uint64_t sim_next_event(void);
+
+// Keeps the idle timer out of the models while the host program calls in
+void sim_lock(void);
+void sim_unlock(void);
+
+// sim_nvic.c.  An interrupt line follows the level a model drives it to,
+// pending one is taken once.
+void sim_nvic_init(void);
+void sim_irq_level(int irq, bool asserted);
+void sim_irq_pend(int irq);
+void sim_nvic_dispatch(void);
+
+void sim_gpio_init(void);
+void sim_uart_init(void);
+void sim_uart_poll_host(void);
+void sim_ssi_init(void);
+void sim_i2c_init(void);
+void sim_gptm_init(void);
+void sim_adc_init(void);
+
+// sim_board.c, the devices on the ECE353 board
+void sim_board_init(void);
+
+// sim_lcd.c, the ILI9341 on the board's 8080 bus
+void sim_lcd_init(void);
+
+// sim_libs.c, stdio through the program's fputc and fgetc if it has them
+void sim_libs_init(void);
+
+#endif
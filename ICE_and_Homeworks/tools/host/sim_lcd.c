@@ -0,0 +1,343 @@
+//*****************************************************************************
+// sim_lcd.c -- the ILI9341 on the ECE353 board's 8080 bus, see sim.h
+//
+//    PB0-7   D0-7, read from the port's pins on each rising WRX, and driven
+//            onto them while RDX is low
+//    PC4     CSX, the other strobes are ignored while it is high
+//    PC5     DCX, low for a command byte
+//    PC6     WRX
+//    PC7     RDX
+//
+// GRAM is 240 x 320 18 bit pixels.  Column and page addresses (CASET,
+// PASET) go through MADCTL's MX and MY to GRAM, Memory Write and Write
+// Memory Continue store 16 bit or 18 bit pixels as COLMOD says, and Memory
+// Read and Read Memory Continue return a dummy byte and then one byte per
+// color, the 6 bits at the top.  VSCRDEF and VSCRSADD scroll what the panel
+// shows, not GRAM.  MV, BGR, which only swaps the panel's color order, and
+// the rest of the command set are not modelled.
+//*****************************************************************************
+#include <string.h>
+#include "sim_internal.h"
+
+#define LCD_COLS              240
+#define LCD_ROWS              320
+
+#define CSX_PIN               0x10
+#define DCX_PIN               0x20
+#define WRX_PIN               0x40
+#define RDX_PIN               0x80
+#define DATA_PINS             0xFF
+
+#define CMD_SOFTWARE_RESET    0x01
+#define CMD_COLUMN_ADDR       0x2A
+#define CMD_PAGE_ADDR         0x2B
+#define CMD_MEMORY_WRITE      0x2C
+#define CMD_MEMORY_READ       0x2E
+#define CMD_SCROLL_DEFINITION 0x33
+#define CMD_MADCTL            0x36
+#define CMD_SCROLL_START      0x37
+#define CMD_PIXEL_FORMAT      0x3A
+#define CMD_WRITE_CONTINUE    0x3C
+#define CMD_READ_CONTINUE     0x3E
+
+#define MADCTL_MY             0x80
+#define MADCTL_MX             0x40
+
+#define COLMOD_18_BIT         0x06
+
+typedef struct
+{
+  uint8_t   gram[LCD_ROWS][LCD_COLS][3];    // GRAM row, column, then R, G, B
+  uint8_t   command;
+  uint8_t   params[6];
+  uint8_t   param_count;
+  uint16_t  sc, ec, sp, ep;                 // CASET and PASET
+  uint16_t  column, page;                   // memory pointer
+  uint8_t   pixel[3];                       // bytes of the pixel being written
+  uint8_t   pixel_count;
+  int8_t    read_color;                     // -1 for the dummy read
+  uint8_t   madctl;
+  uint8_t   colmod;
+  uint16_t  tfa, vsa, bfa, vsp;
+} lcd_t;
+
+static lcd_t lcd;
+
+static void lcd_reset(void)
+{
+  lcd.command = 0;
+  lcd.param_count = 0;
+  lcd.sc = 0;
+  lcd.ec = LCD_COLS - 1;
+  lcd.sp = 0;
+  lcd.ep = LCD_ROWS - 1;
+  lcd.column = 0;
+  lcd.page = 0;
+  lcd.pixel_count = 0;
+  lcd.read_color = -1;
+  lcd.madctl = 0;
+  lcd.colmod = COLMOD_18_BIT;
+  lcd.tfa = 0;
+  lcd.vsa = LCD_ROWS;
+  lcd.bfa = 0;
+  lcd.vsp = 0;
+}
+
+//*****************************************************************************
+// The GRAM pixel at the memory pointer, NULL outside the panel
+//*****************************************************************************
+static uint8_t *pointer_pixel(void)
+{
+  uint16_t column = lcd.column;
+  uint16_t page = lcd.page;
+
+  if(column >= LCD_COLS || page >= LCD_ROWS)
+  {
+    return NULL;
+  }
+  if(lcd.madctl & MADCTL_MX)
+  {
+    column = LCD_COLS - 1 - column;
+  }
+  if(lcd.madctl & MADCTL_MY)
+  {
+    page = LCD_ROWS - 1 - page;
+  }
+  return lcd.gram[page][column];
+}
+
+// Across the window a row at a time, back to its start after the last pixel
+static void pointer_next(void)
+{
+  if(lcd.column++ >= lcd.ec)
+  {
+    lcd.column = lcd.sc;
+    if(lcd.page++ >= lcd.ep)
+    {
+      lcd.page = lcd.sp;
+    }
+  }
+}
+
+static void pointer_start(void)
+{
+  lcd.column = lcd.sc;
+  lcd.page = lcd.sp;
+}
+
+static uint16_t param_u16(uint8_t i)
+{
+  return (lcd.params[i] << 8) | lcd.params[i + 1];
+}
+
+static void write_pixel_byte(uint8_t byte)
+{
+  uint8_t *pixel;
+  bool wide = (lcd.colmod & 0x07) == COLMOD_18_BIT;
+
+  lcd.pixel[lcd.pixel_count++] = byte;
+  if(lcd.pixel_count < (wide ? 3 : 2))
+  {
+    return;
+  }
+  lcd.pixel_count = 0;
+
+  pixel = pointer_pixel();
+  if(pixel != NULL && wide)
+  {
+    pixel[0] = lcd.pixel[0] >> 2;
+    pixel[1] = lcd.pixel[1] >> 2;
+    pixel[2] = lcd.pixel[2] >> 2;
+  }
+  else if(pixel != NULL)
+  {
+    // red and blue get their MSB as the 6th bit, as the panel's 65K color
+    // mapping does
+    pixel[0] = ((lcd.pixel[0] >> 3) << 1) | (lcd.pixel[0] >> 7);
+    pixel[1] = ((lcd.pixel[0] & 0x07) << 3) | (lcd.pixel[1] >> 5);
+    pixel[2] = ((lcd.pixel[1] & 0x1F) << 1) | ((lcd.pixel[1] >> 4) & 0x01);
+  }
+  pointer_next();
+}
+
+static void write_command(uint8_t command)
+{
+  lcd.command = command;
+  lcd.param_count = 0;
+
+  switch(command)
+  {
+    case CMD_SOFTWARE_RESET:
+      lcd_reset();
+      break;
+    case CMD_MEMORY_WRITE:
+    case CMD_MEMORY_READ:
+      pointer_start();
+      // fall through
+    case CMD_WRITE_CONTINUE:
+    case CMD_READ_CONTINUE:
+      lcd.pixel_count = 0;
+      lcd.read_color = -1;
+      break;
+    default:
+      break;
+  }
+}
+
+static void write_data(uint8_t data)
+{
+  if(lcd.command == CMD_MEMORY_WRITE || lcd.command == CMD_WRITE_CONTINUE)
+  {
+    write_pixel_byte(data);
+    return;
+  }
+
+  if(lcd.param_count < sizeof(lcd.params))
+  {
+    lcd.params[lcd.param_count++] = data;
+  }
+
+  switch(lcd.command)
+  {
+    case CMD_COLUMN_ADDR:
+      if(lcd.param_count == 4)
+      {
+        lcd.sc = param_u16(0);
+        lcd.ec = param_u16(2);
+      }
+      break;
+    case CMD_PAGE_ADDR:
+      if(lcd.param_count == 4)
+      {
+        lcd.sp = param_u16(0);
+        lcd.ep = param_u16(2);
+      }
+      break;
+    case CMD_MADCTL:
+      lcd.madctl = data;
+      break;
+    case CMD_PIXEL_FORMAT:
+      lcd.colmod = data;
+      break;
+    case CMD_SCROLL_DEFINITION:
+      if(lcd.param_count == 6)
+      {
+        lcd.tfa = param_u16(0);
+        lcd.vsa = param_u16(2);
+        lcd.bfa = param_u16(4);
+      }
+      break;
+    case CMD_SCROLL_START:
+      if(lcd.param_count == 2)
+      {
+        lcd.vsp = param_u16(0);
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+// The byte a read strobe puts on the bus
+static uint8_t read_data(void)
+{
+  uint8_t *pixel;
+  uint8_t data = 0;
+
+  if(lcd.command != CMD_MEMORY_READ && lcd.command != CMD_READ_CONTINUE)
+  {
+    return 0;
+  }
+  if(lcd.read_color < 0)
+  {
+    lcd.read_color = 0;
+    return 0;
+  }
+
+  pixel = pointer_pixel();
+  if(pixel != NULL)
+  {
+    data = pixel[lcd.read_color] << 2;
+  }
+  if(++lcd.read_color == 3)
+  {
+    lcd.read_color = 0;
+    pointer_next();
+  }
+  return data;
+}
+
+//*****************************************************************************
+// The strobes.  A write latches the data pins as WRX rises, a read drives
+// them from RDX falling to RDX rising.
+//*****************************************************************************
+static void lcd_watch(void *context, uint8_t before, uint8_t after)
+{
+  uint8_t data;
+
+  (void)context;
+
+  if(after & CSX_PIN)
+  {
+    if(!(before & CSX_PIN))
+    {
+      sim_gpio_release(GPIOB_BASE, DATA_PINS);
+    }
+    return;
+  }
+
+  if(!(before & WRX_PIN) && (after & WRX_PIN))
+  {
+    data = sim_gpio_level(GPIOB_BASE);
+    if(after & DCX_PIN)
+    {
+      write_data(data);
+    }
+    else
+    {
+      write_command(data);
+    }
+  }
+
+  if((before & RDX_PIN) && !(after & RDX_PIN) && (after & DCX_PIN))
+  {
+    data = read_data();
+    sim_gpio_input(GPIOB_BASE, data, true);
+    sim_gpio_input(GPIOB_BASE, ~data & DATA_PINS, false);
+  }
+  else if(!(before & RDX_PIN) && (after & RDX_PIN))
+  {
+    sim_gpio_release(GPIOB_BASE, DATA_PINS);
+  }
+}
+
+//*****************************************************************************
+// Screen row y is counted from the panel's bottom line, the one it scans
+// last, and x from its right edge, which is where lcd.c's default MADCTL
+// puts logical 0,0.  Lines of the scrolling area show GRAM from the VSCRSADD
+// line on, wrapping inside the area.
+//*****************************************************************************
+uint16_t sim_board_lcd_pixel(uint16_t x, uint16_t y)
+{
+  uint16_t line = LCD_ROWS - 1 - (y % LCD_ROWS);
+  uint16_t column = LCD_COLS - 1 - (x % LCD_COLS);
+  uint8_t *pixel;
+
+  sim_lock();
+  if(lcd.tfa + lcd.vsa + lcd.bfa == LCD_ROWS && lcd.vsa != 0 &&
+     line >= lcd.tfa && line < lcd.tfa + lcd.vsa && lcd.vsp >= lcd.tfa)
+  {
+    line = lcd.tfa + (lcd.vsp - lcd.tfa + line - lcd.tfa) % lcd.vsa;
+  }
+  pixel = lcd.gram[line][column];
+  sim_unlock();
+
+  return ((pixel[0] >> 1) << 11) | (pixel[1] << 5) | (pixel[2] >> 1);
+}
+
+void sim_lcd_init(void)
+{
+  memset(lcd.gram, 0, sizeof(lcd.gram));
+  lcd_reset();
+  sim_gpio_watch(GPIOC_BASE, lcd_watch, NULL);
+}
@@ -0,0 +1,166 @@
+//*****************************************************************************
+// sim_libs.c -- host stand-ins for what the Keil projects take from lib/
+// and from assembly, see sim.h
+//
+//    ECE353-Validate.lib   the serial debug calls, on UART0 at 115200 through
+//                          the UART model as any driver would.  validate_ice
+//                          passes, what it checks is the Keil build.
+//    ws2812b.s             WS2812B_write, the same three stores a bit at the
+//                          same 60 cycles a bit
+//    MicroLIB              printf and scanf end in the program's fputc and
+//                          fgetc, when it has them
+//*****************************************************************************
+#define _GNU_SOURCE
+#include "sim_internal.h"
+#include "driver_defines.h"
+#include "validate.h"
+
+// 50MHz / (16 * 115200) = 27.127, FBRD = 0.127 * 64
+#define DEBUG_IBRD            27
+#define DEBUG_FBRD            8
+
+#define WS2812B_BIT_CYCLES    60
+
+//*****************************************************************************
+// ECE353-Validate.lib
+//*****************************************************************************
+void initialize_serial_debug(void)
+{
+  SYSCTL->RCGCGPIO |= SYSCTL_RCGCGPIO_R0;
+  while((SYSCTL->PRGPIO & SYSCTL_PRGPIO_R0) == 0) {};
+  SYSCTL->RCGCUART |= SYSCTL_RCGCUART_R0;
+  while((SYSCTL->PRUART & SYSCTL_PRUART_R0) == 0) {};
+
+  // PA0 is U0RX, PA1 U0TX
+  GPIOA->DEN |= 0x03;
+  GPIOA->AFSEL |= 0x03;
+  GPIOA->PCTL = (GPIOA->PCTL & ~0xFF) | GPIO_PCTL_PA0_U0RX | GPIO_PCTL_PA1_U0TX;
+
+  UART0->CTL = 0;
+  UART0->IBRD = DEBUG_IBRD;
+  UART0->FBRD = DEBUG_FBRD;
+  UART0->LCRH = UART_LCRH_WLEN_8 | UART_LCRH_FEN;
+  UART0->CTL = UART_CTL_UARTEN | UART_CTL_TXE | UART_CTL_RXE;
+}
+
+void put_char(char c)
+{
+  while(UART0->FR & UART_FR_TXFF) {};
+  UART0->DR = c;
+}
+
+void put_string(char *data)
+{
+  while(*data != '\0')
+  {
+    put_char(*data++);
+  }
+}
+
+char get_char(bool block)
+{
+  if(!block && (UART0->FR & UART_FR_RXFE))
+  {
+    return 0;
+  }
+  while(UART0->FR & UART_FR_RXFE) {};
+  return UART0->DR & 0xFF;
+}
+
+// Up to the end of the line, which is left out
+void get_string(char *string)
+{
+  char c;
+
+  while((c = get_char(true)) != '\n' && c != '\r')
+  {
+    *string++ = c;
+  }
+  *string = '\0';
+}
+
+// The labs print right after, with the debug UART set up here
+bool validate_ice(ice_validate_t ice)
+{
+  (void)ice;
+
+  if(!(UART0->CTL & UART_CTL_UARTEN))
+  {
+    initialize_serial_debug();
+  }
+  return true;
+}
+
+//*****************************************************************************
+// MicroLIB retargeting.  The board programs are built with fputc and fgetc
+// renamed to these (tools/CMakeLists.txt), so one the program defines does
+// not take the place of the C library's.  stdout and stdin then become
+// streams that go through them a character at a time.
+//*****************************************************************************
+int sim_retarget_fputc(int c, FILE *stream) __attribute__((weak));
+int sim_retarget_fgetc(FILE *stream) __attribute__((weak));
+
+static ssize_t retarget_write(void *cookie, const char *buffer, size_t size)
+{
+  size_t i;
+
+  (void)cookie;
+  for(i = 0; i < size; i++)
+  {
+    sim_retarget_fputc((unsigned char)buffer[i], stdout);
+  }
+  return size;
+}
+
+static ssize_t retarget_read(void *cookie, char *buffer, size_t size)
+{
+  int c = sim_retarget_fgetc(stdin);
+
+  (void)cookie;
+  if(c == EOF || size == 0)
+  {
+    return 0;
+  }
+  buffer[0] = c;
+  return 1;
+}
+
+void sim_libs_init(void)
+{
+  cookie_io_functions_t output = { NULL, retarget_write, NULL, NULL };
+  cookie_io_functions_t input = { retarget_read, NULL, NULL, NULL };
+  FILE *stream;
+
+  if(sim_retarget_fputc != NULL && (stream = fopencookie(NULL, "w", output)) != NULL)
+  {
+    setvbuf(stream, NULL, _IONBF, 0);
+    stdout = stream;
+  }
+  if(sim_retarget_fgetc != NULL && (stream = fopencookie(NULL, "r", input)) != NULL)
+  {
+    setvbuf(stream, NULL, _IONBF, 0);
+    stdin = stream;
+  }
+}
+
+//*****************************************************************************
+// ws2812b.s.  Each bit of each LED's green, red and blue bytes, most
+// significant first, raises the pin, drops it early for a 0 and drops it.
+//*****************************************************************************
+void WS2812B_write(uint32_t port_base_addr, uint8_t *led_array, uint16_t num_leds)
+{
+  volatile uint32_t *data = (volatile uint32_t *)(uintptr_t)port_base_addr;
+  uint32_t i;
+  uint8_t bit;
+
+  for(i = 0; i < num_leds * 3u; i++)
+  {
+    for(bit = 0x80; bit != 0; bit >>= 1)
+    {
+      *data = 0x80;
+      *data = (led_array[i] & bit) ? 0x80 : 0x00;
+      *data = 0x00;
+      sim_delay(WS2812B_BIT_CYCLES - 3 * SIM_ACCESS_CYCLES);
+    }
+  }
+}
@@ -0,0 +1,529 @@
+//*****************************************************************************
+// sim_nvic.c -- NVIC, SCB and SysTick of the virtual TM4C123, and the
+// vector table, see sim.h
+//
+// An interrupt is taken when it is enabled, pending or its line is
+// asserted, not already active and of higher priority than whatever runs.
+// Its handler is called straight from the access or idle tick that found
+// it, so a handler interrupts the program where it stands and returns to
+// it, as on the part.  A line that is still asserted once the handler
+// returns is taken again.
+//*****************************************************************************
+#include <stdlib.h>
+#include "sim_internal.h"
+
+// Interrupts 0 to SIM_IRQS - 1
+#define SIM_IRQS              139
+#define IRQ_WORDS             ((SIM_IRQS + 31) / 32)
+
+// Priority of the program outside any handler, below every interrupt
+#define THREAD_PRIORITY       256
+
+// SCB->ICSR
+#define ICSR_PENDSTSET        (1UL << 26)
+#define ICSR_PENDSTCLR        (1UL << 25)
+
+// SysTick->CTRL
+#define SYSTICK_COUNTFLAG     (1UL << 16)
+
+// The precision internal oscillator over 4, SysTick without CLKSOURCE
+#define PIOSC_DIV4_HZ         4000000UL
+
+#define CPUID_CORTEX_M4F      0x410FC241UL
+
+typedef void (*handler_t)(void);
+
+static sim_block_t nvic;
+static sim_block_t scb;
+static sim_block_t systick;
+
+static uint32_t enabled[IRQ_WORDS];
+static uint32_t pending[IRQ_WORDS];
+static uint32_t lines[IRQ_WORDS];
+static uint32_t active[IRQ_WORDS];
+static bool systick_pending = false;
+static bool systick_active = false;
+static int running = THREAD_PRIORITY;
+
+static sim_event_t systick_wrap;
+static uint64_t systick_reload = 0;   // when VAL was last reloaded
+static bool systick_countflag = false;
+
+//*****************************************************************************
+// Vectors.  Each defaults to a handler that stops the program, as the
+// Keil start up's default handler hangs.
+//*****************************************************************************
+static void unhandled(const char *name)
+{
+  fprintf(stderr, "sim: %s taken with no handler\n", name);
+  exit(1);
+}
+
+#define HANDLER(name)                                                       \
+  void name(void) __attribute__((weak));                                    \
+  void name(void) { unhandled(#name); }
+
+HANDLER(SysTick_Handler)
+HANDLER(GPIOA_Handler)
+HANDLER(GPIOB_Handler)
+HANDLER(GPIOC_Handler)
+HANDLER(GPIOD_Handler)
+HANDLER(GPIOE_Handler)
+HANDLER(UART0_Handler)
+HANDLER(UART1_Handler)
+HANDLER(SSI0_Handler)
+HANDLER(I2C0_Handler)
+HANDLER(ADC0SS0_Handler)
+HANDLER(ADC0SS1_Handler)
+HANDLER(ADC0SS2_Handler)
+HANDLER(ADC0SS3_Handler)
+HANDLER(WDT0_Handler)
+HANDLER(TIMER0A_Handler)
+HANDLER(TIMER0B_Handler)
+HANDLER(TIMER1A_Handler)
+HANDLER(TIMER1B_Handler)
+HANDLER(TIMER2A_Handler)
+HANDLER(TIMER2B_Handler)
+HANDLER(SYSCTL_Handler)
+HANDLER(FLASH_Handler)
+HANDLER(GPIOF_Handler)
+HANDLER(UART2_Handler)
+HANDLER(SSI1_Handler)
+HANDLER(TIMER3A_Handler)
+HANDLER(TIMER3B_Handler)
+HANDLER(I2C1_Handler)
+HANDLER(HIB_Handler)
+HANDLER(USB0_Handler)
+HANDLER(UDMA_Handler)
+HANDLER(UDMAERR_Handler)
+HANDLER(ADC1SS0_Handler)
+HANDLER(ADC1SS1_Handler)
+HANDLER(ADC1SS2_Handler)
+HANDLER(ADC1SS3_Handler)
+HANDLER(SSI2_Handler)
+HANDLER(SSI3_Handler)
+HANDLER(UART3_Handler)
+HANDLER(UART4_Handler)
+HANDLER(UART5_Handler)
+HANDLER(UART6_Handler)
+HANDLER(UART7_Handler)
+HANDLER(I2C2_Handler)
+HANDLER(I2C3_Handler)
+HANDLER(TIMER4A_Handler)
+HANDLER(TIMER4B_Handler)
+HANDLER(TIMER5A_Handler)
+HANDLER(TIMER5B_Handler)
+HANDLER(WTIMER0A_Handler)
+HANDLER(WTIMER0B_Handler)
+
+static const handler_t vectors[SIM_IRQS] =
+{
+  [GPIOA_IRQn]      = GPIOA_Handler,
+  [GPIOB_IRQn]      = GPIOB_Handler,
+  [GPIOC_IRQn]      = GPIOC_Handler,
+  [GPIOD_IRQn]      = GPIOD_Handler,
+  [GPIOE_IRQn]      = GPIOE_Handler,
+  [UART0_IRQn]      = UART0_Handler,
+  [UART1_IRQn]      = UART1_Handler,
+  [SSI0_IRQn]       = SSI0_Handler,
+  [I2C0_IRQn]       = I2C0_Handler,
+  [ADC0SS0_IRQn]    = ADC0SS0_Handler,
+  [ADC0SS1_IRQn]    = ADC0SS1_Handler,
+  [ADC0SS2_IRQn]    = ADC0SS2_Handler,
+  [ADC0SS3_IRQn]    = ADC0SS3_Handler,
+  [WATCHDOG0_IRQn]  = WDT0_Handler,
+  [TIMER0A_IRQn]    = TIMER0A_Handler,
+  [TIMER0B_IRQn]    = TIMER0B_Handler,
+  [TIMER1A_IRQn]    = TIMER1A_Handler,
+  [TIMER1B_IRQn]    = TIMER1B_Handler,
+  [TIMER2A_IRQn]    = TIMER2A_Handler,
+  [TIMER2B_IRQn]    = TIMER2B_Handler,
+  [SYSCTL_IRQn]     = SYSCTL_Handler,
+  [FLASH_CTRL_IRQn] = FLASH_Handler,
+  [GPIOF_IRQn]      = GPIOF_Handler,
+  [UART2_IRQn]      = UART2_Handler,
+  [SSI1_IRQn]       = SSI1_Handler,
+  [TIMER3A_IRQn]    = TIMER3A_Handler,
+  [TIMER3B_IRQn]    = TIMER3B_Handler,
+  [I2C1_IRQn]       = I2C1_Handler,
+  [HIB_IRQn]        = HIB_Handler,
+  [USB0_IRQn]       = USB0_Handler,
+  [UDMA_IRQn]       = UDMA_Handler,
+  [UDMAERR_IRQn]    = UDMAERR_Handler,
+  [ADC1SS0_IRQn]    = ADC1SS0_Handler,
+  [ADC1SS1_IRQn]    = ADC1SS1_Handler,
+  [ADC1SS2_IRQn]    = ADC1SS2_Handler,
+  [ADC1SS3_IRQn]    = ADC1SS3_Handler,
+  [SSI2_IRQn]       = SSI2_Handler,
+  [SSI3_IRQn]       = SSI3_Handler,
+  [UART3_IRQn]      = UART3_Handler,
+  [UART4_IRQn]      = UART4_Handler,
+  [UART5_IRQn]      = UART5_Handler,
+  [UART6_IRQn]      = UART6_Handler,
+  [UART7_IRQn]      = UART7_Handler,
+  [I2C2_IRQn]       = I2C2_Handler,
+  [I2C3_IRQn]       = I2C3_Handler,
+  [TIMER4A_IRQn]    = TIMER4A_Handler,
+  [TIMER4B_IRQn]    = TIMER4B_Handler,
+  [TIMER5A_IRQn]    = TIMER5A_Handler,
+  [TIMER5B_IRQn]    = TIMER5B_Handler,
+  [WTIMER0A_IRQn]   = WTIMER0A_Handler,
+  [WTIMER0B_IRQn]   = WTIMER0B_Handler,
+};
+
+//*****************************************************************************
+// Lines and dispatch
+//*****************************************************************************
+static bool bit(const uint32_t *words, int irq)
+{
+  return (words[irq >> 5] >> (irq & 0x1F)) & 1;
+}
+
+void sim_irq_level(int irq, bool asserted)
+{
+  if(irq < 0 || irq >= SIM_IRQS)
+  {
+    return;
+  }
+  if(asserted)
+  {
+    lines[irq >> 5] |= 1UL << (irq & 0x1F);
+  }
+  else
+  {
+    lines[irq >> 5] &= ~(1UL << (irq & 0x1F));
+  }
+}
+
+void sim_irq_pend(int irq)
+{
+  if(irq == SysTick_IRQn)
+  {
+    systick_pending = true;
+  }
+  else if(irq >= 0 && irq < SIM_IRQS)
+  {
+    pending[irq >> 5] |= 1UL << (irq & 0x1F);
+  }
+}
+
+// NVIC->IP and SCB->SHP keep the top __NVIC_PRIO_BITS bits
+static int irq_priority(int irq)
+{
+  const uint8_t *ip = (const uint8_t *)nvic.regs + (SIM_REG(NVIC_Type, IP) - SIM_REG(NVIC_Type, ISER));
+
+  return ip[irq] >> (8 - __NVIC_PRIO_BITS);
+}
+
+static int systick_priority(void)
+{
+  const uint8_t *shp = (const uint8_t *)scb.regs + SIM_REG(SCB_Type, SHP);
+
+  return shp[11] >> (8 - __NVIC_PRIO_BITS);
+}
+
+void sim_nvic_dispatch(void)
+{
+  int best;
+  int best_priority;
+  int saved;
+  int irq;
+
+  while(host_primask == 0)
+  {
+    best = SIM_NO_IRQ;
+    best_priority = running;
+
+    // ties go to the lower exception number, SysTick first
+    if(systick_pending && !systick_active && systick_priority() < best_priority)
+    {
+      best = SysTick_IRQn;
+      best_priority = systick_priority();
+    }
+    for(irq = 0; irq < SIM_IRQS; irq++)
+    {
+      if(bit(enabled, irq) && (bit(pending, irq) || bit(lines, irq)) && !bit(active, irq) &&
+         irq_priority(irq) < best_priority)
+      {
+        best = irq;
+        best_priority = irq_priority(irq);
+      }
+    }
+    if(best == SIM_NO_IRQ)
+    {
+      return;
+    }
+
+    saved = running;
+    running = best_priority;
+    if(best == SysTick_IRQn)
+    {
+      systick_pending = false;
+      systick_active = true;
+      SysTick_Handler();
+      systick_active = false;
+    }
+    else
+    {
+      pending[best >> 5] &= ~(1UL << (best & 0x1F));
+      active[best >> 5] |= 1UL << (best & 0x1F);
+      if(vectors[best] != NULL)
+      {
+        vectors[best]();
+      }
+      active[best >> 5] &= ~(1UL << (best & 0x1F));
+    }
+    running = saved;
+  }
+}
+
+//*****************************************************************************
+// NVIC registers
+//*****************************************************************************
+static uint32_t nvic_read(sim_block_t *block, uint32_t offset, bool peek)
+{
+  uint32_t n = (offset & 0x7F) >> 2;
+
+  (void)peek;
+
+  if(offset < SIM_REG(NVIC_Type, IP) && n >= IRQ_WORDS)
+  {
+    return 0;
+  }
+  if(offset < SIM_REG(NVIC_Type, ICER))
+  {
+    return enabled[n];
+  }
+  if(offset < SIM_REG(NVIC_Type, ISPR))
+  {
+    return enabled[n];
+  }
+  if(offset < SIM_REG(NVIC_Type, IABR))
+  {
+    return pending[n] | lines[n];
+  }
+  if(offset < SIM_REG(NVIC_Type, IP))
+  {
+    return active[n];
+  }
+  return sim_plain_read(block, offset, peek);
+}
+
+static void nvic_write(sim_block_t *block, uint32_t offset, uint32_t value)
+{
+  uint32_t n = (offset & 0x7F) >> 2;
+
+  if(offset == SIM_REG(NVIC_Type, STIR))
+  {
+    sim_irq_pend(value & 0x1FF);
+    return;
+  }
+  if(offset < SIM_REG(NVIC_Type, IP) && n >= IRQ_WORDS)
+  {
+    return;
+  }
+  if(offset < SIM_REG(NVIC_Type, ICER))
+  {
+    enabled[n] |= value;
+  }
+  else if(offset < SIM_REG(NVIC_Type, ISPR))
+  {
+    enabled[n] &= ~value;
+  }
+  else if(offset < SIM_REG(NVIC_Type, ICPR))
+  {
+    pending[n] |= value;
+  }
+  else if(offset < SIM_REG(NVIC_Type, IABR))
+  {
+    pending[n] &= ~value;
+  }
+  else if(offset >= SIM_REG(NVIC_Type, IP))
+  {
+    sim_plain_write(block, offset, value);
+  }
+}
+
+//*****************************************************************************
+// SCB, only SysTick's pending bit does anything
+//*****************************************************************************
+static uint32_t scb_read(sim_block_t *block, uint32_t offset, bool peek)
+{
+  if(offset == SIM_REG(SCB_Type, CPUID))
+  {
+    return CPUID_CORTEX_M4F;
+  }
+  if(offset == SIM_REG(SCB_Type, ICSR))
+  {
+    return systick_pending ? ICSR_PENDSTSET : 0;
+  }
+  return sim_plain_read(block, offset, peek);
+}
+
+static void scb_write(sim_block_t *block, uint32_t offset, uint32_t value)
+{
+  if(offset == SIM_REG(SCB_Type, ICSR))
+  {
+    if(value & ICSR_PENDSTSET)
+    {
+      systick_pending = true;
+    }
+    if(value & ICSR_PENDSTCLR)
+    {
+      systick_pending = false;
+    }
+    return;
+  }
+  sim_plain_write(block, offset, value);
+}
+
+//*****************************************************************************
+// SysTick.  VAL counts down from LOAD and reloads, setting COUNTFLAG and
+// pending the exception if TICKINT is set.
+//*****************************************************************************
+static uint32_t *systick_reg(uint32_t offset)
+{
+  return sim_reg(&systick, offset);
+}
+
+static bool systick_running(void)
+{
+  return (*systick_reg(SIM_REG(SysTick_Type, CTRL)) & SysTick_CTRL_ENABLE_Msk) != 0;
+}
+
+// System clock cycles per count
+static uint64_t systick_cycles(uint64_t counts)
+{
+  if(*systick_reg(SIM_REG(SysTick_Type, CTRL)) & SysTick_CTRL_CLKSOURCE_Msk)
+  {
+    return counts;
+  }
+  return counts * SIM_CLOCK_HZ / PIOSC_DIV4_HZ;
+}
+
+static uint32_t systick_load(void)
+{
+  return *systick_reg(SIM_REG(SysTick_Type, LOAD)) & SysTick_LOAD_RELOAD_Msk;
+}
+
+static void systick_arm(void)
+{
+  if(systick_running() && systick_load() != 0)
+  {
+    sim_event_at(&systick_wrap, systick_reload + systick_cycles(systick_load() + 1));
+  }
+  else
+  {
+    sim_event_cancel(&systick_wrap);
+  }
+}
+
+static void systick_fire(sim_event_t *event)
+{
+  (void)event;
+
+  systick_reload = sim_now;
+  systick_countflag = true;
+  if(*systick_reg(SIM_REG(SysTick_Type, CTRL)) & SysTick_CTRL_TICKINT_Msk)
+  {
+    systick_pending = true;
+  }
+  systick_arm();
+}
+
+static uint32_t systick_value(void)
+{
+  uint64_t counts;
+
+  if(!systick_running())
+  {
+    return *systick_reg(SIM_REG(SysTick_Type, VAL));
+  }
+  if(*systick_reg(SIM_REG(SysTick_Type, CTRL)) & SysTick_CTRL_CLKSOURCE_Msk)
+  {
+    counts = sim_now - systick_reload;
+  }
+  else
+  {
+    counts = (sim_now - systick_reload) * PIOSC_DIV4_HZ / SIM_CLOCK_HZ;
+  }
+  return (counts >= systick_load()) ? 0 : systick_load() - (uint32_t)counts;
+}
+
+static uint32_t systick_read(sim_block_t *block, uint32_t offset, bool peek)
+{
+  uint32_t value;
+
+  if(offset == SIM_REG(SysTick_Type, CTRL))
+  {
+    value = *systick_reg(offset) | (systick_countflag ? SYSTICK_COUNTFLAG : 0);
+    if(!peek)
+    {
+      systick_countflag = false;
+    }
+    return value;
+  }
+  if(offset == SIM_REG(SysTick_Type, VAL))
+  {
+    return systick_value();
+  }
+  return sim_plain_read(block, offset, peek);
+}
+
+static void systick_write(sim_block_t *block, uint32_t offset, uint32_t value)
+{
+  bool was_running = systick_running();
+
+  if(offset == SIM_REG(SysTick_Type, CTRL))
+  {
+    *systick_reg(offset) = value & (SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk |
+                                    SysTick_CTRL_CLKSOURCE_Msk);
+    if(!was_running && systick_running())
+    {
+      systick_reload = sim_now;
+    }
+    else if(was_running && !systick_running())
+    {
+      *systick_reg(SIM_REG(SysTick_Type, VAL)) = systick_value();
+    }
+    systick_arm();
+  }
+  else if(offset == SIM_REG(SysTick_Type, VAL))
+  {
+    // any write clears the count and COUNTFLAG, the next count reloads
+    *systick_reg(offset) = 0;
+    systick_countflag = false;
+    systick_reload = sim_now;
+    systick_arm();
+  }
+  else
+  {
+    sim_plain_write(block, offset, value);
+  }
+}
+
+void sim_nvic_init(void)
+{
+  nvic.name = "NVIC";
+  nvic.base = NVIC_BASE;
+  nvic.size = SIM_REG(NVIC_Type, STIR) + 4;
+  nvic.read = nvic_read;
+  nvic.write = nvic_write;
+  sim_block_add(&nvic);
+
+  scb.name = "SCB";
+  scb.base = SCB_BASE;
+  scb.size = SIM_REG(SCB_Type, CPACR) + 4;
+  scb.read = scb_read;
+  scb.write = scb_write;
+  sim_block_add(&scb);
+
+  systick.name = "SysTick";
+  systick.base = SysTick_BASE;
+  systick.size = sizeof(SysTick_Type);
+  systick.read = systick_read;
+  systick.write = systick_write;
+  sim_block_add(&systick);
+
+  systick_wrap.fire = systick_fire;
+}
@@ -0,0 +1,146 @@
+//*****************************************************************************
+// sim_regs.c -- register file devices on I2C or SSI, see sim.h
+//*****************************************************************************
+#include <string.h>
+#include "sim_internal.h"
+
+void sim_regs_init(sim_regs_t *regs, uint8_t *data, uint32_t size, uint8_t address_bytes)
+{
+  memset(regs, 0, sizeof(*regs));
+  regs->regs = data;
+  regs->size = size;
+  regs->address_bytes = address_bytes;
+}
+
+// The address bytes come most significant first
+static void address_byte(sim_regs_t *regs, uint8_t data)
+{
+  if(regs->address_seen == 0)
+  {
+    regs->pointer = 0;
+  }
+  regs->pointer = (regs->pointer << 8) | data;
+  regs->address_seen++;
+  if(regs->address_seen == regs->address_bytes)
+  {
+    regs->pointer %= regs->size;
+  }
+}
+
+static void store(sim_regs_t *regs, uint8_t data)
+{
+  uint32_t reg = regs->pointer;
+
+  regs->regs[reg] = data;
+  regs->wrote = true;
+  regs->pointer = (reg + 1) % regs->size;
+  if(regs->written != NULL)
+  {
+    regs->written(regs, reg);
+  }
+}
+
+static uint8_t load(sim_regs_t *regs)
+{
+  uint32_t reg = regs->pointer;
+
+  if(regs->reading != NULL)
+  {
+    regs->reading(regs, reg);
+  }
+  regs->pointer = (reg + 1) % regs->size;
+  return regs->regs[reg];
+}
+
+//*****************************************************************************
+// I2C: a write transaction starts with the address, a read one goes on from
+// where the pointer is.
+//*****************************************************************************
+static bool i2c_start(void *context, bool read)
+{
+  sim_regs_t *regs = context;
+
+  if(sim_now < regs->busy_until)
+  {
+    return false;
+  }
+  regs->read = read;
+  if(!read)
+  {
+    regs->address_seen = 0;
+  }
+  return true;
+}
+
+static bool i2c_write(void *context, uint8_t data)
+{
+  sim_regs_t *regs = context;
+
+  if(regs->address_seen < regs->address_bytes)
+  {
+    address_byte(regs, data);
+  }
+  else
+  {
+    store(regs, data);
+  }
+  return true;
+}
+
+static uint8_t i2c_read(void *context, bool ack)
+{
+  (void)ack;
+  return load(context);
+}
+
+static void i2c_stop(void *context)
+{
+  sim_regs_t *regs = context;
+
+  if(regs->wrote)
+  {
+    regs->busy_until = sim_now + regs->write_cycles;
+    regs->wrote = false;
+  }
+}
+
+bool sim_regs_attach_i2c(sim_regs_t *regs, uint32_t base, uint8_t address)
+{
+  sim_i2c_device_t device = { i2c_start, i2c_write, i2c_read, i2c_stop, regs };
+
+  return sim_i2c_attach(base, address, &device);
+}
+
+//*****************************************************************************
+// SSI: every transfer starts with the address, address_read_bit set in its
+// first byte for a read.
+//*****************************************************************************
+static uint16_t ssi_exchange(void *context, uint16_t frame, bool first)
+{
+  sim_regs_t *regs = context;
+  uint8_t data = frame & 0xFF;
+
+  if(first)
+  {
+    regs->address_seen = 0;
+    regs->read = (data & regs->address_read_bit) != 0;
+    data &= ~regs->address_read_bit;
+  }
+  if(regs->address_seen < regs->address_bytes)
+  {
+    address_byte(regs, data);
+    return 0x00;
+  }
+  if(regs->read)
+  {
+    return load(regs);
+  }
+  store(regs, data);
+  return 0x00;
+}
+
+bool sim_regs_attach_ssi(sim_regs_t *regs, uint32_t base, uint8_t address_read_bit)
+{
+  regs->address_read_bit = address_read_bit;
+  return sim_ssi_attach(base, ssi_exchange, regs);
+}
@@ -0,0 +1,246 @@
+//*****************************************************************************
+// sim_ssi.c -- SSI0 to SSI3 of the virtual TM4C123, see sim.h
+//
+// Frames shift out of the TX FIFO one at a time while SSE is set, each
+// taking (DSS + 1) bits at SysClk / (CPSDVSR * (1 + SCR)).  The attached
+// device answers each one into the RX FIFO as it completes.  Chip selects
+// are GPIOs the model does not see, so a frame starting with the SSI idle
+// is a device's first.
+//*****************************************************************************
+#include "sim_internal.h"
+
+#define SSIS                  4
+#define FIFO_DEPTH            8
+
+#define REG(m)                SIM_REG(SSI0_Type, m)
+
+#define CR0_DSS_M             0x000F
+#define CR0_SCR_S             8
+#define CR1_SSE               0x02
+
+#define SR_TFE                0x01
+#define SR_TNF                0x02
+#define SR_RNE                0x04
+#define SR_RFF                0x08
+#define SR_BSY                0x10
+
+#define INT_ROR               0x01
+#define INT_RX                0x04
+#define INT_TX                0x08
+
+typedef struct
+{
+  sim_block_t         block;
+  int                 irq;
+  uint16_t            tx[FIFO_DEPTH];
+  int                 tx_head;
+  int                 tx_count;
+  uint16_t            rx[FIFO_DEPTH];
+  int                 rx_head;
+  int                 rx_count;
+  uint16_t            frame;          // shifting out
+  bool                first;
+  bool                shifting;
+  bool                idle;
+  sim_event_t         done;
+  sim_ssi_exchange_t  exchange;
+  void                *context;
+} ssi_t;
+
+static ssi_t ssis[SSIS];
+
+static const struct
+{
+  const char  *name;
+  uint32_t    base;
+  int         irq;
+} ssi_info[SSIS] =
+{
+  { "SSI0", SSI0_BASE, SSI0_IRQn },
+  { "SSI1", SSI1_BASE, SSI1_IRQn },
+  { "SSI2", SSI2_BASE, SSI2_IRQn },
+  { "SSI3", SSI3_BASE, SSI3_IRQn },
+};
+
+static uint32_t reg(ssi_t *ssi, uint32_t offset)
+{
+  return *sim_reg(&ssi->block, offset);
+}
+
+static uint64_t frame_cycles(ssi_t *ssi)
+{
+  uint32_t cr0 = reg(ssi, REG(CR0));
+  uint64_t bits = (cr0 & CR0_DSS_M) + 1;
+  uint64_t cpsdvsr = reg(ssi, REG(CPSR)) & 0xFE;
+  uint64_t scr = (cr0 >> CR0_SCR_S) & 0xFF;
+
+  return bits * (cpsdvsr ? cpsdvsr : 2) * (1 + scr);
+}
+
+// TX at half empty or less, RX at half full or more, overrun latched
+static uint32_t ris(ssi_t *ssi)
+{
+  uint32_t value = reg(ssi, REG(RIS)) & INT_ROR;
+
+  value |= (ssi->tx_count <= FIFO_DEPTH / 2) ? INT_TX : 0;
+  value |= (ssi->rx_count >= FIFO_DEPTH / 2) ? INT_RX : 0;
+  return value;
+}
+
+static void update_irq(ssi_t *ssi)
+{
+  sim_irq_level(ssi->irq, (ris(ssi) & reg(ssi, REG(IM))) != 0);
+}
+
+static void start(ssi_t *ssi)
+{
+  if(ssi->shifting || ssi->tx_count == 0 || !(reg(ssi, REG(CR1)) & CR1_SSE))
+  {
+    return;
+  }
+
+  ssi->frame = ssi->tx[ssi->tx_head];
+  ssi->tx_head = (ssi->tx_head + 1) % FIFO_DEPTH;
+  ssi->tx_count--;
+  ssi->first = ssi->idle;
+  ssi->idle = false;
+  ssi->shifting = true;
+  sim_event_at(&ssi->done, sim_now + frame_cycles(ssi));
+  update_irq(ssi);
+}
+
+static void done(sim_event_t *event)
+{
+  ssi_t *ssi = event->context;
+  uint16_t mask = (2u << (reg(ssi, REG(CR0)) & CR0_DSS_M)) - 1;
+  uint16_t received = 0xFFFF;
+
+  if(ssi->exchange != NULL)
+  {
+    received = ssi->exchange(ssi->context, ssi->frame & mask, ssi->first);
+  }
+
+  if(ssi->rx_count == FIFO_DEPTH)
+  {
+    *sim_reg(&ssi->block, REG(RIS)) |= INT_ROR;
+  }
+  else
+  {
+    ssi->rx[(ssi->rx_head + ssi->rx_count) % FIFO_DEPTH] = received & mask;
+    ssi->rx_count++;
+  }
+
+  ssi->shifting = false;
+  ssi->idle = (ssi->tx_count == 0);
+  start(ssi);
+  update_irq(ssi);
+}
+
+static uint32_t ssi_read(sim_block_t *block, uint32_t offset, bool peek)
+{
+  ssi_t *ssi = (ssi_t *)block;
+  uint16_t frame;
+  uint32_t sr;
+
+  if(offset == REG(DR))
+  {
+    if(ssi->rx_count == 0)
+    {
+      return 0;
+    }
+    frame = ssi->rx[ssi->rx_head];
+    if(!peek)
+    {
+      ssi->rx_head = (ssi->rx_head + 1) % FIFO_DEPTH;
+      ssi->rx_count--;
+      update_irq(ssi);
+    }
+    return frame;
+  }
+  if(offset == REG(SR))
+  {
+    sr = 0;
+    sr |= (ssi->tx_count == 0) ? SR_TFE : 0;
+    sr |= (ssi->tx_count < FIFO_DEPTH) ? SR_TNF : 0;
+    sr |= (ssi->rx_count > 0) ? SR_RNE : 0;
+    sr |= (ssi->rx_count == FIFO_DEPTH) ? SR_RFF : 0;
+    sr |= (ssi->shifting || ssi->tx_count > 0) ? SR_BSY : 0;
+    return sr;
+  }
+  if(offset == REG(RIS))
+  {
+    return ris(ssi);
+  }
+  if(offset == REG(MIS))
+  {
+    return ris(ssi) & reg(ssi, REG(IM));
+  }
+  if(offset == REG(ICR))
+  {
+    return 0;
+  }
+  return sim_plain_read(block, offset, peek);
+}
+
+static void ssi_write(sim_block_t *block, uint32_t offset, uint32_t value)
+{
+  ssi_t *ssi = (ssi_t *)block;
+
+  if(offset == REG(DR))
+  {
+    if(ssi->tx_count < FIFO_DEPTH)
+    {
+      ssi->tx[(ssi->tx_head + ssi->tx_count) % FIFO_DEPTH] = value & 0xFFFF;
+      ssi->tx_count++;
+      start(ssi);
+    }
+  }
+  else if(offset == REG(ICR))
+  {
+    *sim_reg(block, REG(RIS)) &= ~(value & INT_ROR);
+  }
+  else if(offset != REG(SR) && offset != REG(RIS) && offset != REG(MIS))
+  {
+    sim_plain_write(block, offset, value);
+    if(offset == REG(CR1))
+    {
+      start(ssi);
+    }
+  }
+  update_irq(ssi);
+}
+
+bool sim_ssi_attach(uint32_t base, sim_ssi_exchange_t exchange, void *context)
+{
+  int i;
+
+  for(i = 0; i < SSIS; i++)
+  {
+    if(ssis[i].block.base == base)
+    {
+      ssis[i].exchange = exchange;
+      ssis[i].context = context;
+      return true;
+    }
+  }
+  return false;
+}
+
+void sim_ssi_init(void)
+{
+  int i;
+
+  for(i = 0; i < SSIS; i++)
+  {
+    ssis[i].block.name = ssi_info[i].name;
+    ssis[i].block.base = ssi_info[i].base;
+    ssis[i].block.size = 0x1000;
+    ssis[i].block.read = ssi_read;
+    ssis[i].block.write = ssi_write;
+    ssis[i].irq = ssi_info[i].irq;
+    ssis[i].idle = true;
+    ssis[i].done.fire = done;
+    ssis[i].done.context = &ssis[i];
+    sim_block_add(&ssis[i].block);
+  }
+}
@@ -0,0 +1,397 @@
+//*****************************************************************************
+// sim_uart.c -- UART0 to UART7 of the virtual TM4C123, see sim.h
+//
+// Frames go out and come in at the rate IBRD, FBRD and LCRH set.  A byte
+// leaves when the shifter takes it from the TX FIFO, and UART0's go to
+// stdout, as the launchpad's debug port would show them.  UART0 receives
+// what comes in on stdin.
+//*****************************************************************************
+#include <poll.h>
+#include <unistd.h>
+#include "sim_internal.h"
+
+#define UARTS                 8
+#define FIFO_DEPTH            16
+#define HOST_QUEUE            1024
+
+#define REG(m)                SIM_REG(UART0_Type, m)
+
+#define FR_BUSY               0x008
+#define FR_RXFE               0x010
+#define FR_TXFF               0x020
+#define FR_RXFF               0x040
+#define FR_TXFE               0x080
+
+#define LCRH_PEN              0x02
+#define LCRH_STP2             0x08
+#define LCRH_FEN              0x10
+#define LCRH_WLEN_S           5
+
+#define CTL_UARTEN            0x001
+#define CTL_EOT               0x010
+#define CTL_HSE               0x020
+
+#define INT_RX                0x010
+#define INT_TX                0x020
+#define INT_RT                0x040
+#define INT_OE                0x400
+
+// the receive timeout is 32 bit periods
+#define RT_BITS               32
+
+typedef struct
+{
+  sim_block_t   block;
+  int           irq;
+  uint8_t       tx[FIFO_DEPTH];
+  int           tx_head;
+  int           tx_count;
+  bool          shifting;
+  uint8_t       rx[FIFO_DEPTH];
+  int           rx_head;
+  int           rx_count;
+  uint8_t       host[HOST_QUEUE];     // received from outside, not yet in
+  int           host_head;
+  int           host_count;
+  sim_event_t   tx_done;
+  sim_event_t   rx_next;
+  sim_event_t   rx_timeout;
+} uart_t;
+
+static uart_t uarts[UARTS];
+static bool stdin_open = true;
+
+static const struct
+{
+  const char  *name;
+  uint32_t    base;
+  int         irq;
+} uart_info[UARTS] =
+{
+  { "UART0", UART0_BASE, UART0_IRQn },
+  { "UART1", UART1_BASE, UART1_IRQn },
+  { "UART2", UART2_BASE, UART2_IRQn },
+  { "UART3", UART3_BASE, UART3_IRQn },
+  { "UART4", UART4_BASE, UART4_IRQn },
+  { "UART5", UART5_BASE, UART5_IRQn },
+  { "UART6", UART6_BASE, UART6_IRQn },
+  { "UART7", UART7_BASE, UART7_IRQn },
+};
+
+static uint32_t reg(uart_t *uart, uint32_t offset)
+{
+  return *sim_reg(&uart->block, offset);
+}
+
+static int depth(uart_t *uart)
+{
+  return (reg(uart, REG(LCRH)) & LCRH_FEN) ? FIFO_DEPTH : 1;
+}
+
+// IFLS levels 1/8 to 7/8 of the FIFO, one entry without FIFOs
+static int trigger(uart_t *uart, int select)
+{
+  static const int levels[] = { 2, 4, 8, 12, 14 };
+
+  if(depth(uart) == 1)
+  {
+    return 1;
+  }
+  return (select < 5) ? levels[select] : 8;
+}
+
+// TX raises its interrupt on falling to this many entries, empty without
+// FIFOs
+static int tx_trigger(uart_t *uart)
+{
+  return (depth(uart) == 1) ? 0 : trigger(uart, reg(uart, REG(IFLS)) & 0x7);
+}
+
+static int rx_trigger(uart_t *uart)
+{
+  return trigger(uart, (reg(uart, REG(IFLS)) >> 3) & 0x7);
+}
+
+static uint64_t bit_cycles(uart_t *uart)
+{
+  uint64_t divisor = (uint64_t)reg(uart, REG(IBRD)) * 64 + (reg(uart, REG(FBRD)) & 0x3F);
+  uint64_t clocks = (reg(uart, REG(CTL)) & CTL_HSE) ? 8 : 16;
+  uint64_t cycles = clocks * divisor / 64;
+
+  return (cycles != 0) ? cycles : 1;
+}
+
+static uint64_t frame_cycles(uart_t *uart)
+{
+  uint32_t lcrh = reg(uart, REG(LCRH));
+  uint64_t bits = 1 + 5 + ((lcrh >> LCRH_WLEN_S) & 0x3) + ((lcrh & LCRH_PEN) ? 1 : 0) +
+                  ((lcrh & LCRH_STP2) ? 2 : 1);
+
+  return bits * bit_cycles(uart);
+}
+
+static void set_ris(uart_t *uart, uint32_t set, uint32_t clear)
+{
+  uint32_t *ris = sim_reg(&uart->block, REG(RIS));
+
+  *ris = (*ris & ~clear) | set;
+  sim_irq_level(uart->irq, (*ris & reg(uart, REG(IM))) != 0);
+}
+
+//*****************************************************************************
+// Transmit
+//*****************************************************************************
+static void tx_start(uart_t *uart)
+{
+  uint8_t byte;
+
+  if(uart->shifting || uart->tx_count == 0 || !(reg(uart, REG(CTL)) & CTL_UARTEN))
+  {
+    return;
+  }
+
+  byte = uart->tx[uart->tx_head];
+  uart->tx_head = (uart->tx_head + 1) % FIFO_DEPTH;
+  if(uart == &uarts[0])
+  {
+    if(write(STDOUT_FILENO, &byte, 1) < 0)
+    {
+      // nowhere to show it, the frame still takes its time
+    }
+  }
+
+  uart->tx_count--;
+  uart->shifting = true;
+  sim_event_at(&uart->tx_done, sim_now + frame_cycles(uart));
+
+  if(uart->tx_count == tx_trigger(uart) && !(reg(uart, REG(CTL)) & CTL_EOT))
+  {
+    set_ris(uart, INT_TX, 0);
+  }
+}
+
+static void tx_done(sim_event_t *event)
+{
+  uart_t *uart = event->context;
+
+  uart->shifting = false;
+  if(uart->tx_count == 0 && (reg(uart, REG(CTL)) & CTL_EOT))
+  {
+    set_ris(uart, INT_TX, 0);
+  }
+  tx_start(uart);
+}
+
+//*****************************************************************************
+// Receive.  Bytes from outside wait in host until a frame's time has passed
+// for each.
+//*****************************************************************************
+static void rx_arm(uart_t *uart)
+{
+  if(uart->host_count > 0 && !uart->rx_next.armed)
+  {
+    sim_event_at(&uart->rx_next, sim_now + frame_cycles(uart));
+  }
+}
+
+static void rx_next(sim_event_t *event)
+{
+  uart_t *uart = event->context;
+  uint8_t byte = uart->host[uart->host_head];
+
+  uart->host_head = (uart->host_head + 1) % HOST_QUEUE;
+  uart->host_count--;
+
+  if(uart->rx_count == depth(uart))
+  {
+    set_ris(uart, INT_OE, 0);
+  }
+  else
+  {
+    uart->rx[(uart->rx_head + uart->rx_count) % FIFO_DEPTH] = byte;
+    uart->rx_count++;
+    if(uart->rx_count >= rx_trigger(uart))
+    {
+      set_ris(uart, INT_RX, 0);
+    }
+  }
+  sim_event_at(&uart->rx_timeout, sim_now + RT_BITS * bit_cycles(uart));
+  rx_arm(uart);
+}
+
+static void rx_timeout(sim_event_t *event)
+{
+  uart_t *uart = event->context;
+
+  if(uart->rx_count > 0)
+  {
+    set_ris(uart, INT_RT, 0);
+  }
+}
+
+static uint8_t rx_pop(uart_t *uart, bool peek)
+{
+  uint8_t byte;
+
+  if(uart->rx_count == 0)
+  {
+    return 0;
+  }
+  byte = uart->rx[uart->rx_head];
+  if(!peek)
+  {
+    uart->rx_head = (uart->rx_head + 1) % FIFO_DEPTH;
+    uart->rx_count--;
+    if(uart->rx_count < rx_trigger(uart))
+    {
+      set_ris(uart, 0, INT_RX);
+    }
+    if(uart->rx_count == 0)
+    {
+      set_ris(uart, 0, INT_RT);
+    }
+  }
+  return byte;
+}
+
+//*****************************************************************************
+// Registers
+//*****************************************************************************
+static uint32_t uart_read(sim_block_t *block, uint32_t offset, bool peek)
+{
+  uart_t *uart = (uart_t *)block;
+  uint32_t fr;
+
+  if(offset == REG(DR))
+  {
+    return rx_pop(uart, peek);
+  }
+  if(offset == REG(FR))
+  {
+    fr = 0;
+    fr |= (uart->shifting || uart->tx_count > 0) ? FR_BUSY : 0;
+    fr |= (uart->rx_count == 0) ? FR_RXFE : 0;
+    fr |= (uart->tx_count >= depth(uart)) ? FR_TXFF : 0;
+    fr |= (uart->rx_count >= depth(uart)) ? FR_RXFF : 0;
+    fr |= (uart->tx_count == 0) ? FR_TXFE : 0;
+    return fr;
+  }
+  if(offset == REG(MIS))
+  {
+    return reg(uart, REG(RIS)) & reg(uart, REG(IM));
+  }
+  if(offset == REG(ICR))
+  {
+    return 0;
+  }
+  return sim_plain_read(block, offset, peek);
+}
+
+static void uart_write(sim_block_t *block, uint32_t offset, uint32_t value)
+{
+  uart_t *uart = (uart_t *)block;
+
+  if(offset == REG(DR))
+  {
+    if(uart->tx_count < depth(uart))
+    {
+      uart->tx[(uart->tx_head + uart->tx_count) % FIFO_DEPTH] = value & 0xFF;
+      uart->tx_count++;
+      if(uart->tx_count > tx_trigger(uart))
+      {
+        set_ris(uart, 0, INT_TX);
+      }
+      tx_start(uart);
+    }
+    return;
+  }
+  if(offset == REG(ICR))
+  {
+    set_ris(uart, 0, value);
+    return;
+  }
+  if(offset == REG(FR) || offset == REG(RIS) || offset == REG(MIS))
+  {
+    return;
+  }
+
+  sim_plain_write(block, offset, value);
+  if(offset == REG(IM))
+  {
+    set_ris(uart, 0, 0);
+  }
+  else if(offset == REG(CTL))
+  {
+    tx_start(uart);
+  }
+}
+
+void sim_uart_receive(uint32_t base, uint8_t byte)
+{
+  int i;
+
+  for(i = 0; i < UARTS; i++)
+  {
+    if(uarts[i].block.base == base && uarts[i].host_count < HOST_QUEUE)
+    {
+      sim_lock();
+      uarts[i].host[(uarts[i].host_head + uarts[i].host_count) % HOST_QUEUE] = byte;
+      uarts[i].host_count++;
+      rx_arm(&uarts[i]);
+      sim_unlock();
+    }
+  }
+}
+
+//*****************************************************************************
+// stdin into UART0, whatever is there without waiting
+//*****************************************************************************
+void sim_uart_poll_host(void)
+{
+  struct pollfd fd = { STDIN_FILENO, POLLIN, 0 };
+  uint8_t buffer[64];
+  ssize_t count;
+  ssize_t i;
+
+  if(!stdin_open || uarts[0].host_count > HOST_QUEUE - (int)sizeof(buffer))
+  {
+    return;
+  }
+  if(poll(&fd, 1, 0) != 1)
+  {
+    return;
+  }
+
+  count = read(STDIN_FILENO, buffer, sizeof(buffer));
+  if(count <= 0)
+  {
+    stdin_open = false;
+    return;
+  }
+  for(i = 0; i < count; i++)
+  {
+    sim_uart_receive(UART0_BASE, buffer[i]);
+  }
+}
+
+void sim_uart_init(void)
+{
+  int i;
+
+  for(i = 0; i < UARTS; i++)
+  {
+    uarts[i].block.name = uart_info[i].name;
+    uarts[i].block.base = uart_info[i].base;
+    uarts[i].block.size = 0x1000;
+    uarts[i].block.read = uart_read;
+    uarts[i].block.write = uart_write;
+    uarts[i].irq = uart_info[i].irq;
+    uarts[i].tx_done.fire = tx_done;
+    uarts[i].tx_done.context = &uarts[i];
+    uarts[i].rx_next.fire = rx_next;
+    uarts[i].rx_next.context = &uarts[i];
+    uarts[i].rx_timeout.fire = rx_timeout;
+    uarts[i].rx_timeout.context = &uarts[i];
+    sim_block_add(&uarts[i].block);
+  }
+}
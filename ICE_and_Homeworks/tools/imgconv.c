@@ -0,0 +1,406 @@
+//*****************************************************************************
+// imgconv -- host tool that converts BMP or PBM art into the image_t assets
+// drawn by peripherals/c/image.c
+//
+// Build (any host C compiler):
+//    gcc -O2 -o imgconv imgconv.c
+//
+// Usage:
+//    imgconv [-n name] [-f raw|rle|i2|i4|i8] [-i] image.bmp > image.c
+//
+//    -n name      C symbol for the generated image_t (default "image")
+//    -f format    raw  1 bit per pixel, rows padded to a byte (lcd_draw_image)
+//                 rle  run length encoded 1 bit per pixel (default)
+//                 i2   2 bit palette indexes, up to 4 colors
+//                 i4   4 bit palette indexes, up to 16 colors
+//                 i8   8 bit palette indexes, up to 256 colors
+//    -i           invert: light pixels become foreground (1bpp formats)
+//
+// Inputs are uncompressed BMP files (1, 4, 8, 24 or 32 bits per pixel) or
+// binary PBM (P4) files.  PNG art can be converted to either with any image
+// editor or with netpbm (pngtopnm | pgmtopbm).  For the 1bpp formats, pixels
+// darker than 50% gray are foreground unless -i is given.
+//
+// The indexed formats pack pixels MSB first with every row padded to a byte.
+// The RGB565 palette lists the colors in the order they first appear in the
+// image, row major, so index 0 is always the color of the upper left pixel;
+// for sprites that is the background, which makes it easy to recolor.
+//
+// The rle format stores alternating background/foreground run lengths over
+// the row major pixel stream, starting with background.  Each run is an
+// unsigned LEB128 varint: 7 bits per byte, least significant group first,
+// bit 7 set when another byte follows.
+//*****************************************************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+static int      img_width;
+static int      img_height;
+static uint32_t *img_rgb;                 // 0xRRGGBB, row major
+static uint8_t  *img_pixels;              // 1 = foreground, row major
+
+static uint32_t rd16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+static uint32_t rd32(const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+static uint8_t *read_file(const char *path, long *size)
+{
+  FILE      *fp = fopen(path, "rb");
+  uint8_t   *buf;
+
+  if(fp == NULL)
+  {
+    perror(path);
+    return NULL;
+  }
+  fseek(fp, 0, SEEK_END);
+  *size = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  buf = malloc(*size);
+  if(buf == NULL || fread(buf, 1, *size, fp) != (size_t)*size)
+  {
+    fprintf(stderr, "imgconv: cannot read %s\n", path);
+    fclose(fp);
+    free(buf);
+    return NULL;
+  }
+  fclose(fp);
+  return buf;
+}
+
+//*****************************************************************************
+// Loaders.  Both fill img_rgb.
+//*****************************************************************************
+static int load_bmp(const uint8_t *buf, long size)
+{
+  uint32_t  offset = rd32(buf + 10);
+  uint32_t  dib = rd32(buf + 14);
+  int32_t   h = (int32_t)rd32(buf + 22);
+  int       bpp = rd16(buf + 28);
+  uint32_t  comp = rd32(buf + 30);
+  uint32_t  colors = (dib >= 40) ? rd32(buf + 46) : 0;
+  const uint8_t *pal = buf + 14 + dib;
+  int       top_down = h < 0;
+  int       stride, x, y;
+
+  img_width = (int)rd32(buf + 18);
+  img_height = top_down ? -h : h;
+
+  if(comp != 0 && comp != 3)
+  {
+    fprintf(stderr, "imgconv: compressed BMP files are not supported\n");
+    return -1;
+  }
+  if(bpp != 1 && bpp != 4 && bpp != 8 && bpp != 24 && bpp != 32)
+  {
+    fprintf(stderr, "imgconv: %d bit BMP files are not supported\n", bpp);
+    return -1;
+  }
+  if(colors == 0 && bpp <= 8)
+    colors = 1u << bpp;
+
+  stride = ((img_width * bpp + 31) / 32) * 4;
+  if(offset + (long)stride * img_height > size)
+  {
+    fprintf(stderr, "imgconv: truncated BMP file\n");
+    return -1;
+  }
+
+  img_rgb = calloc(img_width * img_height, sizeof(uint32_t));
+  for(y = 0; y < img_height; y++)
+  {
+    const uint8_t *row = buf + offset + (long)stride * (top_down ? y : img_height - 1 - y);
+
+    for(x = 0; x < img_width; x++)
+    {
+      int   r, g, b, idx;
+
+      if(bpp <= 8)
+      {
+        if(bpp == 1)        idx = (row[x / 8] >> (7 - (x % 8))) & 0x1;
+        else if(bpp == 4)   idx = (row[x / 2] >> ((x & 1) ? 0 : 4)) & 0xF;
+        else                idx = row[x];
+        if((uint32_t)idx >= colors)
+          idx = 0;
+        b = pal[idx * 4 + 0];
+        g = pal[idx * 4 + 1];
+        r = pal[idx * 4 + 2];
+      }
+      else
+      {
+        const uint8_t *p = row + x * (bpp / 8);
+        b = p[0];
+        g = p[1];
+        r = p[2];
+      }
+      img_rgb[y * img_width + x] = (r << 16) | (g << 8) | b;
+    }
+  }
+  return 0;
+}
+
+static int load_pbm(const uint8_t *buf, long size)
+{
+  const char  *p = (const char *)buf + 2;
+  int         bytes_per_row, x, y;
+  long        offset;
+
+  // header is "P4", whitespace/comments, width, height, one whitespace
+  while(1)
+  {
+    while(*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+    if(*p != '#') break;
+    while(*p != '\n') p++;
+  }
+  img_width = (int)strtol(p, (char **)&p, 10);
+  while(1)
+  {
+    while(*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+    if(*p != '#') break;
+    while(*p != '\n') p++;
+  }
+  img_height = (int)strtol(p, (char **)&p, 10);
+  p++;
+
+  offset = (const uint8_t *)p - buf;
+  bytes_per_row = (img_width + 7) / 8;
+  if(img_width <= 0 || img_height <= 0 || offset + (long)bytes_per_row * img_height > size)
+  {
+    fprintf(stderr, "imgconv: bad PBM file\n");
+    return -1;
+  }
+
+  img_rgb = calloc(img_width * img_height, sizeof(uint32_t));
+  for(y = 0; y < img_height; y++)
+    for(x = 0; x < img_width; x++)
+      img_rgb[y * img_width + x] = ((buf[offset + y * bytes_per_row + x / 8] >> (7 - (x % 8))) & 1) ? 0x000000 : 0xFFFFFF;
+  return 0;
+}
+
+//*****************************************************************************
+// Output
+//*****************************************************************************
+static long out_count = 0;
+
+static void emit_byte(uint8_t b)
+{
+  printf("%s0x%02X,", (out_count % 16) == 0 ? "\n  " : " ", b);
+  out_count++;
+}
+
+static void emit_varint(uint32_t v)
+{
+  do
+  {
+    uint8_t b = v & 0x7F;
+    v >>= 7;
+    emit_byte(v ? (b | 0x80) : b);
+  } while(v);
+}
+
+static void emit_raw(void)
+{
+  int x, y;
+
+  for(y = 0; y < img_height; y++)
+  {
+    for(x = 0; x < img_width; x += 8)
+    {
+      uint8_t b = 0;
+      int     i;
+
+      for(i = 0; i < 8 && x + i < img_width; i++)
+        b |= img_pixels[y * img_width + x + i] << (7 - i);
+      emit_byte(b);
+    }
+  }
+}
+
+static void emit_rle(void)
+{
+  long      i, n = (long)img_width * img_height;
+  uint8_t   color = 0;
+  uint32_t  run = 0;
+
+  for(i = 0; i < n; i++)
+  {
+    if(img_pixels[i] != color)
+    {
+      emit_varint(run);
+      run = 0;
+      color = !color;
+    }
+    run++;
+  }
+  emit_varint(run);
+}
+
+//*****************************************************************************
+// Indexed formats.  Builds the RGB565 palette in order of first appearance,
+// then packs the indexes MSB first, each row padded to a byte.
+//*****************************************************************************
+static uint16_t palette[256];
+static int      palette_size = 0;
+
+static uint16_t rgb565(uint32_t rgb)
+{
+  return (uint16_t)(((rgb >> 8) & 0xF800) | ((rgb >> 5) & 0x07E0) | ((rgb >> 3) & 0x001F));
+}
+
+static int palette_index(uint16_t color, int max_colors)
+{
+  int i;
+
+  for(i = 0; i < palette_size; i++)
+    if(palette[i] == color)
+      return i;
+
+  if(palette_size >= max_colors)
+    return -1;
+  palette[palette_size] = color;
+  return palette_size++;
+}
+
+static int emit_indexed(int bpp)
+{
+  int       x, y, i, idx;
+  int       per_byte = 8 / bpp;
+  uint8_t   *indexes = calloc(img_width * img_height, 1);
+
+  for(i = 0; i < img_width * img_height; i++)
+  {
+    idx = palette_index(rgb565(img_rgb[i]), 1 << bpp);
+    if(idx < 0)
+    {
+      fprintf(stderr, "imgconv: more than %d colors, use a deeper format\n", 1 << bpp);
+      free(indexes);
+      return -1;
+    }
+    indexes[i] = (uint8_t)idx;
+  }
+
+  for(y = 0; y < img_height; y++)
+  {
+    for(x = 0; x < img_width; x += per_byte)
+    {
+      uint8_t b = 0;
+
+      for(i = 0; i < per_byte && x + i < img_width; i++)
+        b |= indexes[y * img_width + x + i] << (8 - bpp * (i + 1));
+      emit_byte(b);
+    }
+  }
+  free(indexes);
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  const char  *name = "image";
+  const char  *format = "rle";
+  const char  *path = NULL;
+  int         invert = 0;
+  long        size, i;
+  uint8_t     *buf;
+  int         rc;
+  int         bpp = 0;
+  char        field[16];
+
+  for(i = 1; i < argc; i++)
+  {
+    if(strcmp(argv[i], "-n") == 0 && i + 1 < argc)       name = argv[++i];
+    else if(strcmp(argv[i], "-f") == 0 && i + 1 < argc)  format = argv[++i];
+    else if(strcmp(argv[i], "-i") == 0)                   invert = 1;
+    else                                                  path = argv[i];
+  }
+
+  if(strcmp(format, "i2") == 0)          bpp = 2;
+  else if(strcmp(format, "i4") == 0)     bpp = 4;
+  else if(strcmp(format, "i8") == 0)     bpp = 8;
+
+  if(path == NULL || (bpp == 0 && strcmp(format, "raw") != 0 && strcmp(format, "rle") != 0))
+  {
+    fprintf(stderr, "usage: imgconv [-n name] [-f raw|rle|i2|i4|i8] [-i] image.bmp\n");
+    return 1;
+  }
+
+  buf = read_file(path, &size);
+  if(buf == NULL)
+    return 1;
+
+  if(size > 54 && buf[0] == 'B' && buf[1] == 'M')         rc = load_bmp(buf, size);
+  else if(size > 3 && buf[0] == 'P' && buf[1] == '4')     rc = load_pbm(buf, size);
+  else
+  {
+    fprintf(stderr, "imgconv: %s is not a BMP or binary PBM file\n", path);
+    rc = -1;
+  }
+  free(buf);
+  if(rc != 0)
+    return 1;
+
+  // 1bpp formats threshold on luma
+  img_pixels = calloc(img_width * img_height, 1);
+  for(i = 0; i < (long)img_width * img_height; i++)
+  {
+    uint32_t rgb = img_rgb[i];
+    int luma = (((rgb >> 16) & 0xFF) * 299 + ((rgb >> 8) & 0xFF) * 587 + (rgb & 0xFF) * 114) / 1000;
+    img_pixels[i] = (luma < 128) ^ invert;
+  }
+
+  printf("// Generated by tools/imgconv from %s (%dx%d)\n", path, img_width, img_height);
+  printf("// Do not edit by hand, regenerate the file instead.\n\n");
+  printf("#include \"image.h\"\n\n");
+  printf("static const uint8_t %s_data[] =\n{", name);
+  if(bpp != 0)
+  {
+    if(emit_indexed(bpp) != 0)
+      return 1;
+  }
+  else if(strcmp(format, "raw") == 0)
+  {
+    emit_raw();
+  }
+  else
+  {
+    emit_rle();
+  }
+  printf("\n};\n\n");
+
+  if(bpp != 0)
+  {
+    printf("static const uint16_t %s_palette[] =\n{", name);
+    for(i = 0; i < palette_size; i++)
+      printf("%s0x%04X,", (i % 8) == 0 ? "\n  " : " ", palette[i]);
+    printf("\n};\n\n");
+  }
+
+  printf("const image_t %s =\n{\n", name);
+  sprintf(field, "%d,", img_width);
+  printf("  %-24s// width\n", field);
+  sprintf(field, "%d,", img_height);
+  printf("  %-24s// height\n", field);
+  if(bpp != 0)                          printf("  IMAGE_%dBPP,\n", bpp);
+  else if(strcmp(format, "raw") == 0)   printf("  IMAGE_1BPP,\n");
+  else                                  printf("  IMAGE_1BPP_RLE,\n");
+  sprintf(field, "%ld,", out_count);
+  printf("  %-24s// bytes of data\n", field);
+  if(bpp != 0)
+  {
+    printf("  %s_data,\n", name);
+    printf("  %s_palette,\n", name);
+    printf("  %d                       // palette entries\n", palette_size);
+  }
+  else
+  {
+    printf("  %s_data,\n", name);
+    printf("  NULL,                   // no palette\n");
+    printf("  0\n");
+  }
+  printf("};\n");
+
+  free(img_pixels);
+  free(img_rgb);
+  return 0;
+}
@@ -0,0 +1,160 @@
+//*****************************************************************************
+// lcdtest -- GRAM round trip test of peripherals/c/lcd.c on the virtual
+// TM4C123, against the ILI9341 model in host/sim_lcd.c
+//
+// Usage:
+//    lcdtest
+//
+// Rectangles of random pixels are written with lcd_write_rect, read back
+// with lcd_read_rect and compared, and what the panel shows is compared
+// against what was written:
+//
+//    plain       as written
+//    mirrored    with each lcd_set_mirror setting, shown flipped
+//    scrolled    after lcd_scroll_define and lcd_scroll, each row written
+//                to and read from lcd_scroll_row of its screen row
+//
+// A read costs some 20 GPIO accesses a byte on the virtual board, so the
+// rectangles are few and small.  Prints the failures and exits 1 if there
+// were any.
+//*****************************************************************************
+#include <stdio.h>
+#include "lcd.h"
+#include "sim.h"
+
+#define RECTS       8                   // random rectangles per case
+#define RECT_MAX    24                  // largest width and height
+
+static uint16_t written[RECT_MAX * RECT_MAX];
+static uint16_t read_back[RECT_MAX * RECT_MAX];
+static uint32_t seed = 353;
+static uint32_t failures = 0;
+
+static uint32_t next_random(void)
+{
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+static void fail(const char *test, uint16_t x, uint16_t y, uint16_t expected, uint16_t got)
+{
+  if(failures++ < 20)
+  {
+    printf("%s: %u,%u is %04X, not %04X\n", test, x, y, got, expected);
+  }
+}
+
+static void random_rect(uint16_t *x, uint16_t *y, uint16_t *width, uint16_t *height)
+{
+  uint32_t i;
+
+  *width = 1 + next_random() % RECT_MAX;
+  *height = 1 + next_random() % RECT_MAX;
+  *x = next_random() % (COLS - *width + 1);
+  *y = next_random() % (ROWS - *height + 1);
+  for(i = 0; i < (uint32_t)*width * *height; i++)
+  {
+    written[i] = next_random();
+  }
+}
+
+//*****************************************************************************
+// Writes and reads back random rectangles with the mirror set, and checks
+// the panel shows them flipped the way the mirror says
+//*****************************************************************************
+static void test_mirrored(const char *test, bool mirror_x, bool mirror_y)
+{
+  uint16_t x, y, width, height;
+  uint16_t i, j, shown_x, shown_y;
+  uint16_t n;
+
+  lcd_set_mirror(mirror_x, mirror_y);
+  for(n = 0; n < RECTS; n++)
+  {
+    random_rect(&x, &y, &width, &height);
+    lcd_write_rect(x, y, width, height, written);
+    lcd_read_rect(x, y, width, height, read_back);
+
+    for(j = 0; j < height; j++)
+    {
+      for(i = 0; i < width; i++)
+      {
+        if(read_back[j * width + i] != written[j * width + i])
+        {
+          fail(test, x + i, y + j, written[j * width + i], read_back[j * width + i]);
+        }
+
+        shown_x = mirror_x ? COLS - 1 - (x + i) : x + i;
+        shown_y = mirror_y ? ROWS - 1 - (y + j) : y + j;
+        if(sim_board_lcd_pixel(shown_x, shown_y) != written[j * width + i])
+        {
+          fail(test, shown_x, shown_y, written[j * width + i], sim_board_lcd_pixel(shown_x, shown_y));
+        }
+      }
+    }
+  }
+  lcd_set_mirror(false, false);
+}
+
+//*****************************************************************************
+// Rows of a rectangle go to the GRAM rows lcd_scroll_row gives, so it must
+// show where it was meant to, and read back from there
+//*****************************************************************************
+static void test_scrolled(int16_t lines)
+{
+  uint16_t x, y, width, height;
+  uint16_t i, j;
+  uint16_t n;
+
+  lcd_scroll(lines, NULL);
+  for(n = 0; n < RECTS; n++)
+  {
+    random_rect(&x, &y, &width, &height);
+    for(j = 0; j < height; j++)
+    {
+      lcd_write_rect(x, lcd_scroll_row(y + j), width, 1, &written[j * width]);
+    }
+
+    for(j = 0; j < height; j++)
+    {
+      lcd_read_rect(x, lcd_scroll_row(y + j), width, 1, read_back);
+      for(i = 0; i < width; i++)
+      {
+        if(read_back[i] != written[j * width + i])
+        {
+          fail("scrolled", x + i, y + j, written[j * width + i], read_back[i]);
+        }
+        if(sim_board_lcd_pixel(x + i, y + j) != written[j * width + i])
+        {
+          fail("scrolled shown", x + i, y + j, written[j * width + i],
+               sim_board_lcd_pixel(x + i, y + j));
+        }
+      }
+    }
+  }
+}
+
+int main(void)
+{
+  lcd_config_screen();
+  lcd_clear_screen(LCD_COLOR_BLACK);
+
+  test_mirrored("plain", false, false);
+  test_mirrored("mirrored x", true, false);
+  test_mirrored("mirrored y", false, true);
+  test_mirrored("mirrored xy", true, true);
+
+  lcd_scroll_define(24, 40);
+  test_scrolled(57);
+  test_scrolled(-200);
+  test_scrolled(131);
+  lcd_scroll_define(0, 0);
+
+  if(failures != 0)
+  {
+    printf("lcdtest: %lu mismatches\n", (unsigned long)failures);
+    return 1;
+  }
+  printf("lcdtest: passed\n");
+  return 0;
+}
@@ -0,0 +1,288 @@
+//*****************************************************************************
+// rgb565bench -- host check and benchmark of peripherals/c/rgb565.c against
+// a per pixel, per channel scalar reference
+//
+// Build (any host C compiler), from the tools directory:
+//    gcc -O2 -I../peripherals/include -o rgb565bench rgb565bench.c ../peripherals/c/rgb565.c
+//
+// Usage:
+//    rgb565bench [pixels]
+//
+// Every kernel is first compared against the reference for every alpha on
+// a spread of colors, including odd lengths and unaligned buffers, then
+// both are timed on a pixels long buffer (default 76800, one full screen).
+// Host timings only show the relative cost.  What carries over to the
+// Cortex-M4 is the operation count, ex one multiply per blended pixel
+// instead of six.
+//*****************************************************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "rgb565.h"
+
+#define REPEATS     50
+
+//*****************************************************************************
+// Scalar reference, one channel at a time
+//*****************************************************************************
+static uint16_t ref_blend(uint16_t fg, uint16_t bg, int alpha)
+{
+  int r = ((fg >> 11) * alpha + (bg >> 11) * (32 - alpha)) / 32;
+  int g = (((fg >> 5) & 0x3F) * alpha + ((bg >> 5) & 0x3F) * (32 - alpha)) / 32;
+  int b = ((fg & 0x1F) * alpha + (bg & 0x1F) * (32 - alpha)) / 32;
+
+  return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+static uint16_t ref_scale(uint16_t color, int level)
+{
+  int r = (color >> 11) * level / 32;
+  int g = ((color >> 5) & 0x3F) * level / 32;
+  int b = (color & 0x1F) * level / 32;
+
+  return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+static void ref_blend_buf(uint16_t *dst, const uint16_t *fg, uint32_t count, int alpha)
+{
+  uint32_t i;
+
+  for (i = 0; i < count; i++)
+  {
+    dst[i] = ref_blend(fg[i], dst[i], alpha);
+  }
+}
+
+static void ref_fade_buf(uint16_t *dst, const uint16_t *src, uint32_t count, uint16_t color, int alpha)
+{
+  uint32_t i;
+
+  for (i = 0; i < count; i++)
+  {
+    dst[i] = ref_blend(color, src[i], alpha);
+  }
+}
+
+static void ref_scale_buf(uint16_t *dst, const uint16_t *src, uint32_t count, int level)
+{
+  uint32_t i;
+
+  for (i = 0; i < count; i++)
+  {
+    dst[i] = ref_scale(src[i], level);
+  }
+}
+
+static void ref_888_buf(uint16_t *dst, const uint8_t *rgb, uint32_t count)
+{
+  uint32_t i;
+
+  for (i = 0; i < count; i++)
+  {
+    dst[i] = (uint16_t)(((rgb[3 * i] >> 3) << 11) | ((rgb[3 * i + 1] >> 2) << 5) | (rgb[3 * i + 2] >> 3));
+  }
+}
+
+//*****************************************************************************
+// Correctness
+//*****************************************************************************
+static int check(void)
+{
+  static uint16_t a[67];
+  static uint16_t b[67];
+  static uint16_t out[67];
+  static uint16_t ref[67];
+  static uint8_t rgb[3 * 67 + 4];
+  uint32_t fg;
+  uint32_t bg;
+  int alpha;
+  int off;
+  int i;
+  int bad = 0;
+
+  // single pixel kernels, every fg against a sample of bg
+  for (fg = 0; fg < 0x10000; fg++)
+  {
+    for (bg = fg % 97; bg < 0x10000; bg += 97)
+    {
+      for (alpha = 0; alpha <= RGB565_ALPHA_MAX; alpha++)
+      {
+        if (rgb565_blend(fg, bg, alpha) != ref_blend(fg, bg, alpha))
+        {
+          if (bad++ < 5)
+          {
+            printf("blend %04x %04x %d\n", (unsigned)fg, (unsigned)bg, alpha);
+          }
+        }
+      }
+    }
+    for (alpha = 0; alpha <= RGB565_ALPHA_MAX; alpha++)
+    {
+      if (rgb565_scale(fg, alpha) != ref_scale(fg, alpha))
+      {
+        if (bad++ < 5)
+        {
+          printf("scale %04x %d\n", (unsigned)fg, alpha);
+        }
+      }
+    }
+  }
+
+  // buffer kernels, odd lengths and both alignments
+  for (off = 0; off < 2; off++)
+  {
+    for (alpha = 0; alpha <= RGB565_ALPHA_MAX; alpha++)
+    {
+      for (i = 0; i < 67; i++)
+      {
+        a[i] = rand();
+        b[i] = rand();
+      }
+      for (i = 0; i < (int)sizeof(rgb); i++)
+      {
+        rgb[i] = rand();
+      }
+
+      memcpy(out, b, sizeof(out));
+      memcpy(ref, b, sizeof(ref));
+      rgb565_blend_buf(out + off, a, 67 - off, alpha);
+      ref_blend_buf(ref + off, a, 67 - off, alpha);
+      bad += memcmp(out, ref, sizeof(out)) != 0;
+
+      rgb565_fade_buf(out, a + off, 67 - off, b[alpha], alpha);
+      ref_fade_buf(ref, a + off, 67 - off, b[alpha], alpha);
+      bad += memcmp(out, ref, sizeof(out)) != 0;
+
+      rgb565_scale_buf(out + off, a + off, 67 - off, alpha);
+      ref_scale_buf(ref + off, a + off, 67 - off, alpha);
+      bad += memcmp(out, ref, sizeof(out)) != 0;
+
+      rgb888_to_565_buf(out, rgb + off, 67);
+      ref_888_buf(ref, rgb + off, 67);
+      bad += memcmp(out, ref, sizeof(out)) != 0;
+    }
+  }
+
+  return bad;
+}
+
+//*****************************************************************************
+// Timing
+//*****************************************************************************
+static double seconds(clock_t start)
+{
+  return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static void report(const char *name, double ref, double kernel, uint32_t pixels)
+{
+  printf("%-10s scalar %7.2f Mpx/s   kernel %7.2f Mpx/s   %.2fx\n", name,
+         pixels * (double)REPEATS / ref / 1e6, pixels * (double)REPEATS / kernel / 1e6,
+         ref / kernel);
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t pixels = 240 * 320;
+  uint16_t *a;
+  uint16_t *b;
+  uint8_t *rgb;
+  uint32_t i;
+  clock_t start;
+  double t_ref;
+  double t_kernel;
+  int n;
+  int bad;
+
+  if (argc > 1)
+  {
+    pixels = strtoul(argv[1], NULL, 0);
+  }
+
+  bad = check();
+  printf("check: %d mismatches\n", bad);
+
+  a = malloc(pixels * sizeof(uint16_t));
+  b = malloc(pixels * sizeof(uint16_t));
+  rgb = malloc(pixels * 3);
+  if (a == NULL || b == NULL || rgb == NULL)
+  {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+  for (i = 0; i < pixels; i++)
+  {
+    a[i] = rand();
+    b[i] = rand();
+  }
+  for (i = 0; i < pixels * 3; i++)
+  {
+    rgb[i] = rand();
+  }
+
+  start = clock();
+  for (n = 0; n < REPEATS; n++)
+  {
+    ref_blend_buf(b, a, pixels, n % 33);
+  }
+  t_ref = seconds(start);
+  start = clock();
+  for (n = 0; n < REPEATS; n++)
+  {
+    rgb565_blend_buf(b, a, pixels, n % 33);
+  }
+  t_kernel = seconds(start);
+  report("blend", t_ref, t_kernel, pixels);
+
+  start = clock();
+  for (n = 0; n < REPEATS; n++)
+  {
+    ref_fade_buf(b, a, pixels, 0x0000, n % 33);
+  }
+  t_ref = seconds(start);
+  start = clock();
+  for (n = 0; n < REPEATS; n++)
+  {
+    rgb565_fade_buf(b, a, pixels, 0x0000, n % 33);
+  }
+  t_kernel = seconds(start);
+  report("fade", t_ref, t_kernel, pixels);
+
+  start = clock();
+  for (n = 0; n < REPEATS; n++)
+  {
+    ref_scale_buf(b, a, pixels, n % 33);
+  }
+  t_ref = seconds(start);
+  start = clock();
+  for (n = 0; n < REPEATS; n++)
+  {
+    rgb565_scale_buf(b, a, pixels, n % 33);
+  }
+  t_kernel = seconds(start);
+  report("scale", t_ref, t_kernel, pixels);
+
+  start = clock();
+  for (n = 0; n < REPEATS; n++)
+  {
+    ref_888_buf(b, rgb, pixels);
+  }
+  t_ref = seconds(start);
+  start = clock();
+  for (n = 0; n < REPEATS; n++)
+  {
+    rgb888_to_565_buf(b, rgb, pixels);
+  }
+  t_kernel = seconds(start);
+  report("rgb888", t_ref, t_kernel, pixels);
+
+  // keep the results live
+  printf("(%04x)\n", b[pixels / 2]);
+
+  free(a);
+  free(b);
+  free(rgb);
+  return bad != 0;
+}
@@ -0,0 +1,700 @@
+//*****************************************************************************
+// shapetest -- host check of the span rasterizer in lcd_shapes.c
+//
+// Build (Linux, gcc), from the tools directory, all one command:
+//    gcc -O2 -DLCD_CAPTURE=1 -Ihost -I../peripherals/include -I../drivers/include
+//        -o shapetest shapetest.c host/registers.c
+//        ../peripherals/c/lcd_shapes.c ../peripherals/c/lcd.c
+//        ../drivers/c/gpio_port.c ../drivers/c/timers.c
+//
+// Usage:
+//    shapetest [-s seed]
+//
+// Random shapes and clip rectangles, 600 of each of
+//
+//    lcd_hline  lcd_vline  lcd_draw_line  lcd_draw_polygon
+//    lcd_draw_circle  lcd_fill_circle  lcd_fill_triangle  lcd_fill_polygon
+//    lcd_draw_round_rect  lcd_fill_round_rect
+//
+// many of them hanging off the screen.  Each is checked against a per-pixel
+// reference plotted on a canvas that reaches past the screen, then clipped:
+//
+//    lines       Bresenham one pixel at a time
+//    outlines    the midpoint circle's eight symmetric points per step, the
+//                quadrants of a round rect moved apart, plus its straight
+//                sides
+//    circle and round rect fills
+//                every row of the outline filled from its leftmost to its
+//                rightmost pixel, so a fill always matches its outline
+//    triangles   both edges of every row interpolated directly from the
+//                corners
+//    polygons    a pixel is in if it is on an edge crossing of its row or
+//                has an odd number of crossings left of it (even-odd), with
+//                each edge taking its upper end row but not its lower one
+//
+// The panel is modeled as in cliptest, through the driver's capture hooks.
+// Every draw must paint exactly the reference pixels inside the clip
+// rectangle and send nothing outside it.
+//
+// Prints the failures and exits 1 if there were any.
+//*****************************************************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "lcd.h"
+#include "lcd_shapes.h"
+#include "capture.h"
+
+#define DRAWS           600         // draws of each shape
+#define REACH           60          // how far shapes are placed off the screen
+#define SIZE_MAX_PIXELS 120         // largest round rect side, twice the radius
+#define MARGIN          200         // canvas beyond each side of the screen
+#define SENTINEL        0x0821      // color no draw uses
+
+//*****************************************************************************
+// Panel model, fed by the LCD driver's capture hooks
+//*****************************************************************************
+bool capture_enabled = true;
+uint16_t capture_run_color;
+uint32_t capture_run_length = 0;
+
+static uint16_t gram[ROWS][COLS];
+
+static int win_x0;
+static int win_x1 = COLS - 1;
+static int win_y0;
+static int win_y1 = ROWS - 1;
+static int cur_x;
+static int cur_y;
+static bool mirror_x;
+static bool mirror_y;
+
+static lcd_rect_t visible;          // the clip rectangle of the draw
+static uint32_t pixels_outside;
+
+static void put_pixels(uint16_t color, uint32_t count)
+{
+  int x;
+  int y;
+
+  while(count--)
+  {
+    x = mirror_x ? COLS - 1 - cur_x : cur_x;
+    y = mirror_y ? ROWS - 1 - cur_y : cur_y;
+    if(x < visible.x0 || x > visible.x1 || y < visible.y0 || y > visible.y1)
+    {
+      pixels_outside++;
+    }
+    else
+    {
+      gram[y][x] = color;
+    }
+    if(++cur_x > win_x1)
+    {
+      cur_x = win_x0;
+      if(++cur_y > win_y1)
+      {
+        cur_y = win_y0;
+      }
+    }
+  }
+}
+
+static void end_run(void)
+{
+  put_pixels(capture_run_color, capture_run_length);
+  capture_run_length = 0;
+}
+
+void capture_window(uint16_t x0, uint16_t x1, uint16_t y0, uint16_t y1)
+{
+  end_run();
+  win_x0 = x0;
+  win_x1 = x1;
+  win_y0 = y0;
+  win_y1 = y1;
+  cur_x = x0;
+  cur_y = y0;
+}
+
+void capture_run(uint16_t color, uint32_t count)
+{
+  if(color != capture_run_color)
+  {
+    end_run();
+    capture_run_color = color;
+  }
+  capture_run_length += count;
+}
+
+void capture_color_change(uint16_t color)
+{
+  end_run();
+  capture_run_color = color;
+  capture_run_length = 1;
+}
+
+void capture_mirror(bool x, bool y)
+{
+  end_run();
+  mirror_x = x;
+  mirror_y = y;
+}
+
+void capture_scroll(uint16_t top, uint16_t height, uint16_t offset)
+{
+  (void)top;
+  (void)height;
+  (void)offset;
+}
+
+//*****************************************************************************
+// Reference canvas.  Screen pixel x, y is canvas[y + MARGIN][x + MARGIN].
+//*****************************************************************************
+static uint8_t canvas[ROWS + 2 * MARGIN][COLS + 2 * MARGIN];
+static bool off_canvas;
+
+static uint32_t failures = 0;
+static uint32_t draws = 0;
+
+static void plot(int x, int y)
+{
+  if(x < -MARGIN || x >= COLS + MARGIN || y < -MARGIN || y >= ROWS + MARGIN)
+  {
+    off_canvas = true;
+    return;
+  }
+  canvas[y + MARGIN][x + MARGIN] = 1;
+}
+
+static void plot_span(int x0, int x1, int y)
+{
+  int x;
+
+  for(x = x0; x <= x1; x++)
+  {
+    plot(x, y);
+  }
+}
+
+static int random_between(int low, int high)
+{
+  return low + rand() % (high - low + 1);
+}
+
+static int16_t random_x(void)
+{
+  return random_between(-REACH, COLS - 1 + REACH);
+}
+
+static int16_t random_y(void)
+{
+  return random_between(-REACH, ROWS - 1 + REACH);
+}
+
+static uint16_t random_color(void)
+{
+  uint16_t color = rand() & 0xFFFF;
+
+  return (color == SENTINEL) ? color ^ 1 : color;
+}
+
+// The whole screen half of the time, otherwise a random rectangle on it
+static void random_clip(void)
+{
+  int16_t x0, y0;
+
+  if(rand() % 2)
+  {
+    lcd_reset_clip();
+    return;
+  }
+  x0 = random_between(0, COLS - 1);
+  y0 = random_between(0, ROWS - 1);
+  lcd_set_clip(x0, y0, random_between(x0, COLS - 1), random_between(y0, ROWS - 1));
+}
+
+static void begin_draw(void)
+{
+  int x;
+  int y;
+
+  random_clip();
+  visible = lcd_get_clip();
+  pixels_outside = 0;
+  off_canvas = false;
+  memset(canvas, 0, sizeof(canvas));
+  for(y = 0; y < ROWS; y++)
+  {
+    for(x = 0; x < COLS; x++)
+    {
+      gram[y][x] = SENTINEL;
+    }
+  }
+  draws++;
+}
+
+static void fail(const char *test, const char *what, int a, int b)
+{
+  if(failures++ < 20)
+  {
+    printf("%s draw %lu: %s (%d, %d)\n", test, (unsigned long)draws, what, a, b);
+  }
+}
+
+//*****************************************************************************
+// Every pixel in the clip rectangle must hold color where the reference has
+// one and be untouched elsewhere
+//*****************************************************************************
+static void end_draw(const char *test, uint16_t color)
+{
+  int x;
+  int y;
+  bool expected;
+
+  end_run();
+  if(off_canvas)
+  {
+    fail(test, "reference off the canvas", 0, 0);
+  }
+  if(pixels_outside != 0)
+  {
+    fail(test, "pixels sent outside the clip", pixels_outside, 0);
+  }
+  for(y = visible.y0; y <= visible.y1; y++)
+  {
+    for(x = visible.x0; x <= visible.x1; x++)
+    {
+      expected = canvas[y + MARGIN][x + MARGIN] != 0;
+      if(gram[y][x] != (expected ? color : SENTINEL))
+      {
+        fail(test, expected ? "pixel missing" : "extra pixel", x, y);
+        return;
+      }
+    }
+  }
+}
+
+//*****************************************************************************
+// References
+//*****************************************************************************
+static void ref_line(int x0, int y0, int x1, int y1)
+{
+  int dx = abs(x1 - x0);
+  int dy = abs(y1 - y0);
+  int err;
+  int temp;
+
+  if(dx >= dy)
+  {
+    if(x0 > x1)
+    {
+      temp = x0; x0 = x1; x1 = temp;
+      temp = y0; y0 = y1; y1 = temp;
+    }
+    err = dx / 2;
+    for(; x0 <= x1; x0++)
+    {
+      plot(x0, y0);
+      err -= dy;
+      if(err < 0)
+      {
+        y0 += (y0 < y1) ? 1 : -1;
+        err += dx;
+      }
+    }
+  }
+  else
+  {
+    if(y0 > y1)
+    {
+      temp = x0; x0 = x1; x1 = temp;
+      temp = y0; y0 = y1; y1 = temp;
+    }
+    err = dy / 2;
+    for(; y0 <= y1; y0++)
+    {
+      plot(x0, y0);
+      err -= dx;
+      if(err < 0)
+      {
+        x0 += (x0 < x1) ? 1 : -1;
+        err += dy;
+      }
+    }
+  }
+}
+
+// The right half is moved over by sx and the bottom half down by sy
+static void ref_circle(int xc, int yc, int r, int sx, int sy)
+{
+  int x = 0;
+  int y = r;
+  int d = 1 - r;
+
+  while(x <= y)
+  {
+    plot(xc - x, yc - y);
+    plot(xc + sx + x, yc - y);
+    plot(xc - x, yc + sy + y);
+    plot(xc + sx + x, yc + sy + y);
+    plot(xc - y, yc - x);
+    plot(xc + sx + y, yc - x);
+    plot(xc - y, yc + sy + x);
+    plot(xc + sx + y, yc + sy + x);
+
+    if(d >= 0)
+    {
+      d += 2 * (x - y) + 5;
+      y--;
+    }
+    else
+    {
+      d += 2 * x + 3;
+    }
+    x++;
+  }
+}
+
+// Fills every canvas row from its leftmost to its rightmost pixel
+static void ref_hull(void)
+{
+  int x0;
+  int x1;
+  int y;
+
+  for(y = 0; y < ROWS + 2 * MARGIN; y++)
+  {
+    for(x0 = 0; x0 < COLS + 2 * MARGIN && !canvas[y][x0]; x0++)
+    {
+    }
+    for(x1 = COLS + 2 * MARGIN - 1; x1 > x0 && !canvas[y][x1]; x1--)
+    {
+    }
+    if(x0 < COLS + 2 * MARGIN)
+    {
+      memset(&canvas[y][x0], 1, x1 - x0 + 1);
+    }
+  }
+}
+
+static void ref_round_rect(int x, int y, int width, int height, int r)
+{
+  int sx;
+  int sy;
+  int row;
+
+  if(r > width / 2)   r = width / 2;
+  if(r > height / 2)  r = height / 2;
+  if(r < 0)           r = 0;
+  sx = width - 2 * r - 1;
+  sy = height - 2 * r - 1;
+
+  plot_span(x + r + 1, x + r + sx - 1, y);
+  plot_span(x + r + 1, x + r + sx - 1, y + height - 1);
+  for(row = y + r + 1; row <= y + r + sy - 1; row++)
+  {
+    plot(x, row);
+    plot(x + width - 1, row);
+  }
+  ref_circle(x + r, y + r, r, sx, sy);
+}
+
+// Edge x of a corner to corner edge at row y
+static int edge_x(int x0, int y0, int x1, int y1, int y)
+{
+  return x0 + (x1 - x0) * (y - y0) / (y1 - y0);
+}
+
+static void ref_triangle(int x0, int y0, int x1, int y1, int x2, int y2)
+{
+  int temp;
+  int a;
+  int b;
+  int y;
+
+  if(y0 > y1) { temp = y0; y0 = y1; y1 = temp; temp = x0; x0 = x1; x1 = temp; }
+  if(y1 > y2) { temp = y1; y1 = y2; y2 = temp; temp = x1; x1 = x2; x2 = temp; }
+  if(y0 > y1) { temp = y0; y0 = y1; y1 = temp; temp = x0; x0 = x1; x1 = temp; }
+
+  if(y0 == y2)
+  {
+    a = (x0 < x1) ? x0 : x1;
+    a = (a < x2) ? a : x2;
+    b = (x0 > x1) ? x0 : x1;
+    b = (b > x2) ? b : x2;
+    plot_span(a, b, y0);
+    return;
+  }
+
+  for(y = y0; y <= y2; y++)
+  {
+    // a flat bottom ends the upper edge on row y1 itself
+    if(y < y1 || (y == y1 && y1 == y2))
+    {
+      a = edge_x(x0, y0, x1, y1, y);
+    }
+    else
+    {
+      a = edge_x(x1, y1, x2, y2, y);
+    }
+    b = edge_x(x0, y0, x2, y2, y);
+    plot_span((a < b) ? a : b, (a > b) ? a : b, y);
+  }
+}
+
+static void ref_polygon(const lcd_point_t *points, uint8_t count)
+{
+  int crossings[LCD_POLYGON_MAX_POINTS];
+  int n;
+  int left;
+  bool on_edge;
+  int x;
+  int y;
+  int i;
+  int j;
+  int k;
+
+  for(y = -MARGIN; y < ROWS + MARGIN; y++)
+  {
+    n = 0;
+    for(i = 0, j = count - 1; i < count; j = i++)
+    {
+      if((points[i].y <= y && points[j].y > y) || (points[j].y <= y && points[i].y > y))
+      {
+        crossings[n++] = points[i].x + (int32_t)(y - points[i].y) *
+                         (points[j].x - points[i].x) / (points[j].y - points[i].y);
+      }
+    }
+    if(n == 0)
+    {
+      continue;
+    }
+
+    for(x = -MARGIN; x < COLS + MARGIN; x++)
+    {
+      left = 0;
+      on_edge = false;
+      for(k = 0; k < n; k++)
+      {
+        left += crossings[k] < x;
+        on_edge |= crossings[k] == x;
+      }
+      if(on_edge || (left & 1))
+      {
+        plot(x, y);
+      }
+    }
+  }
+}
+
+//*****************************************************************************
+// Tests
+//*****************************************************************************
+static void test_lines(void)
+{
+  int16_t x0, y0, x1, y1;
+  uint16_t color;
+  int y;
+  int n;
+
+  for(n = 0; n < DRAWS; n++)
+  {
+    color = random_color();
+    x0 = random_x();
+    y0 = random_y();
+    x1 = random_x();
+    y1 = random_y();
+
+    begin_draw();
+    lcd_hline(x0, x1, y0, color);
+    plot_span((x0 < x1) ? x0 : x1, (x0 > x1) ? x0 : x1, y0);
+    end_draw("lcd_hline", color);
+
+    begin_draw();
+    lcd_vline(x0, y0, y1, color);
+    for(y = (y0 < y1) ? y0 : y1; y <= ((y0 > y1) ? y0 : y1); y++)
+    {
+      plot(x0, y);
+    }
+    end_draw("lcd_vline", color);
+
+    // short lines as well, most of the time
+    if(rand() % 2)
+    {
+      x1 = x0 + random_between(-20, 20);
+      y1 = y0 + random_between(-20, 20);
+    }
+    begin_draw();
+    lcd_draw_line(x0, y0, x1, y1, color);
+    ref_line(x0, y0, x1, y1);
+    end_draw("lcd_draw_line", color);
+  }
+}
+
+static void test_circles(void)
+{
+  int16_t xc, yc, r;
+  uint16_t color;
+  int n;
+
+  for(n = 0; n < DRAWS; n++)
+  {
+    color = random_color();
+    xc = random_x();
+    yc = random_y();
+    r = random_between(0, SIZE_MAX_PIXELS / 2);
+
+    begin_draw();
+    lcd_draw_circle(xc, yc, r, color);
+    ref_circle(xc, yc, r, 0, 0);
+    end_draw("lcd_draw_circle", color);
+
+    begin_draw();
+    lcd_fill_circle(xc, yc, r, color);
+    ref_circle(xc, yc, r, 0, 0);
+    ref_hull();
+    end_draw("lcd_fill_circle", color);
+  }
+}
+
+static void test_round_rects(void)
+{
+  int16_t x, y, width, height, r;
+  uint16_t color;
+  int n;
+
+  for(n = 0; n < DRAWS; n++)
+  {
+    color = random_color();
+    x = random_x();
+    y = random_y();
+    width = random_between(1, SIZE_MAX_PIXELS);
+    height = random_between(1, SIZE_MAX_PIXELS);
+    r = random_between(0, SIZE_MAX_PIXELS / 2);
+
+    begin_draw();
+    lcd_draw_round_rect(x, y, width, height, r, color);
+    ref_round_rect(x, y, width, height, r);
+    end_draw("lcd_draw_round_rect", color);
+
+    begin_draw();
+    lcd_fill_round_rect(x, y, width, height, r, color);
+    ref_round_rect(x, y, width, height, r);
+    ref_hull();
+    end_draw("lcd_fill_round_rect", color);
+  }
+}
+
+static void test_triangles(void)
+{
+  int16_t x[3], y[3];
+  uint16_t color;
+  int i;
+  int n;
+
+  for(n = 0; n < DRAWS; n++)
+  {
+    color = random_color();
+    for(i = 0; i < 3; i++)
+    {
+      x[i] = random_x();
+      y[i] = random_y();
+    }
+    // flat tops and bottoms, and all on one row
+    if(rand() % 4 == 0)
+    {
+      y[rand() % 3] = y[0];
+    }
+    if(rand() % 8 == 0)
+    {
+      y[1] = y[2] = y[0];
+    }
+
+    begin_draw();
+    lcd_fill_triangle(x[0], y[0], x[1], y[1], x[2], y[2], color);
+    ref_triangle(x[0], y[0], x[1], y[1], x[2], y[2]);
+    end_draw("lcd_fill_triangle", color);
+  }
+}
+
+static void test_polygons(void)
+{
+  lcd_point_t points[LCD_POLYGON_MAX_POINTS + 1];
+  uint8_t count;
+  uint16_t color;
+  int i;
+  int j;
+  int n;
+
+  for(n = 0; n < DRAWS; n++)
+  {
+    color = random_color();
+    count = random_between(3, LCD_POLYGON_MAX_POINTS);
+    for(i = 0; i < count; i++)
+    {
+      points[i].x = random_x();
+      points[i].y = random_y();
+    }
+
+    begin_draw();
+    lcd_draw_polygon(points, count, color);
+    for(i = 0, j = count - 1; i < count; j = i++)
+    {
+      ref_line(points[j].x, points[j].y, points[i].x, points[i].y);
+    }
+    end_draw("lcd_draw_polygon", color);
+
+    begin_draw();
+    if(!lcd_fill_polygon(points, count, color))
+    {
+      fail("lcd_fill_polygon", "refused corners", count, 0);
+    }
+    ref_polygon(points, count);
+    end_draw("lcd_fill_polygon", color);
+  }
+
+  // too many corners draws nothing
+  begin_draw();
+  if(lcd_fill_polygon(points, LCD_POLYGON_MAX_POINTS + 1, color))
+  {
+    fail("lcd_fill_polygon", "took corners", LCD_POLYGON_MAX_POINTS + 1, 0);
+  }
+  end_draw("lcd_fill_polygon", color);
+}
+
+int main(int argc, char *argv[])
+{
+  unsigned seed = 1;
+
+  if(argc == 3 && strcmp(argv[1], "-s") == 0)
+  {
+    seed = strtoul(argv[2], NULL, 0);
+  }
+  else if(argc != 1)
+  {
+    fprintf(stderr, "usage: shapetest [-s seed]\n");
+    return 1;
+  }
+  if(!host_map_registers())
+  {
+    fprintf(stderr, "shapetest: can not map the register addresses\n");
+    return 1;
+  }
+  srand(seed);
+
+  test_lines();
+  test_circles();
+  test_round_rects();
+  test_triangles();
+  test_polygons();
+
+  if(failures != 0)
+  {
+    printf("shapetest: %lu failures in %lu draws\n", (unsigned long)failures, (unsigned long)draws);
+    return 1;
+  }
+  printf("shapetest: %lu draws, all matched\n", (unsigned long)draws);
+  return 0;
+}